@@ -1,378 +1,1267 @@
-//=====================================================================
-//
-// casmpure.c - assembly pure compiler
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#include "casmpure.h"
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <stdarg.h>
-
-#define IMAX_LINESIZE		4096
-
-//---------------------------------------------------------------------
-// CORE INTERFACE
-//---------------------------------------------------------------------
-
-// create assembler
-CAssembler *casm_create(void)
-{
-	CAssembler *self;
-	self = (CAssembler*)malloc(sizeof(CAssembler));
-	assert(self);
-	self->parser = cparser_create();
-	assert(self->parser);
-	self->loader = cloader_create();
-	assert(self->loader);
-	self->source = (char*)malloc(1024 + 1);
-	assert(self->source);
-	self->srcblock = 1024;
-	self->srcsize = 0;
-	self->source[0] = 0;
-	self->line = (char*)malloc(IMAX_LINESIZE + 10);
-	assert(self->line);
-	self->error = (char*)malloc(2048);
-	assert(self->error);
-	self->error[0] = 0;
-	self->errcode = 0;
-	return self;
-}
-
-// reset assembler
-void casm_reset(CAssembler *self)
-{
-	assert(self);
-	if (self->source) free(self->source);
-	self->source = (char*)malloc(1024 + 1);
-	assert(self->source);
-	self->srcblock = 1024;
-	self->srcsize = 0;
-	self->source[0] = 0;
-	cloader_reset(self->loader);
-	cparser_reset(self->parser);
-}
-
-// release assembler
-void casm_release(CAssembler *self)
-{
-	assert(self);
-	if (self->parser) {
-		cparser_release(self->parser);
-		self->parser = NULL;
-	}
-	if (self->loader) {
-		cloader_release(self->loader);
-		self->loader = NULL;
-	}
-	if (self->source) {
-		free(self->source);
-		self->source = NULL;
-	}
-	if (self->line) {
-		free(self->line);
-		self->line = NULL;
-	}
-	if (self->error) {
-		free(self->error);
-		self->error = NULL;
-	}
-	self->srcblock = 0;
-	self->srcsize = 0;
-	free(self);
-}
-
-// add source to source buffer
-int casm_source(CAssembler *self, const char *text)
-{
-	int datasize = (int)strlen(text);
-	int newsize = datasize + self->srcsize;
-	int newblock = 1;
-	while (newblock < newsize) newblock <<= 1;
-	if (newblock != self->srcblock) {
-		char *buffer = (char*)malloc(newblock + 1);
-		assert(buffer);
-		memcpy(buffer, self->source, self->srcsize);
-		buffer[self->srcsize] = 0;
-		free(self->source);
-		self->source = buffer;
-		self->srcblock = newblock;
-	}
-	memcpy(self->source + self->srcsize, text, datasize);
-	self->srcsize = newsize;
-	self->source[newsize] = 0;
-	return 0;
-}
-
-// prompt error
-static void casm_error(CAssembler *self, const char *msg, int code)
-{
-	sprintf(self->error, "line(%d): error(%d): %s", self->lineno, code, msg);
-	self->errcode = code;
-}
-
-// compile single line
-static int casm_compile_line(CAssembler *self, const char *line)
-{
-	const CEncoding *encoding;
-
-	assert(self);
-
-	self->error[0] = 0;
-	self->errcode = 0;
-
-	encoding = cparser_parse_line(self->parser, line);
-
-	if (encoding == NULL) {
-		casm_error(self, self->parser->error, self->parser->errcode);
-		return -1;
-	}
-
-	cloader_new_encoding(self->loader, encoding);
-
-	return 0;
-}
-
-// compile source buffer
-// if (code == NULL) returns compiled code size
-// if (code != NULL) and (maxsize >= codesize) compile and returns codesize
-// if (code != NULL) and (maxsize < codesize) returns error
-int casm_compile(CAssembler *self, unsigned char *code, long maxsize)
-{
-	int lineno, p1, p2;
-	const char *text;
-	long codesize;
-
-	assert(self);
-
-	text = self->source;
-
-	cloader_reset(self->loader);
-	cparser_reset(self->parser);
-
-	for (lineno = 1, p1 = 0; p1 < self->srcsize; ) {
-		for (p2 = p1; text[p2] != 0 && text[p2] != '\n'; p2++);
-		self->lineno = lineno++;
-		if (p2 - p1 >= IMAX_LINESIZE) {
-			casm_error(self, "line size too long", 1);
-			return -1;
-		}
-
-		memcpy(self->line, self->source + p1, p2 - p1);
-		self->line[p2 - p1] = 0;
-		p1 = p2 + 1;
-
-		if (casm_compile_line(self, self->line) != 0) {
-			return -2;
-		}
-	}
-
-	codesize = cloader_get_codesize(self->loader) + 10;
-
-	if (code == NULL) 
-		return codesize;
-
-	if (maxsize < codesize) {
-		casm_error(self, "need a larger memory block to get code", 2);
-		return -3;
-	}
-
-	memset(code, 0xcc, codesize);
-
-	if (cloader_output(self->loader, code) != 0) {
-		self->lineno = self->loader->errcode;
-		casm_error(self, self->loader->error, 3);
-		return -4;
-	}
-
-	return codesize;
-}
-
-
-// get error
-const char *casm_geterror(const CAssembler *self, int *errcode)
-{
-	if (errcode) *errcode = self->errcode;
-	return self->error;
-}
-
-
-//---------------------------------------------------------------------
-// HIGH LEVEL
-//---------------------------------------------------------------------
-int casm_pushline(CAssembler *self, const char *fmt, ...)
-{
-	char *buffer = self->error;
-	va_list argptr;
-
-	va_start(argptr, fmt);
-	vsprintf(buffer, fmt, argptr);
-	va_end(argptr);
-
-	casm_source(self, buffer);
-	casm_source(self, "\n");
-
-	self->error[0] = 0;
-
-	return 0;
-}
-
-
-void *casm_callable(CAssembler *self, long *codesize)
-{
-	unsigned char *code;
-	long size;
-
-	if (codesize) *codesize = 0;
-
-	size = casm_compile(self, NULL, 0);
-
-	if (size < 0) {
-		return NULL;
-	}
-
-	code = (unsigned char*)malloc(size + 1);
-	assert(code);
-
-	if (casm_compile(self, code, size) < 0) {
-		free(code);
-		return NULL;
-	}
-
-	if (codesize) *codesize = size;
-
-	return code;
-}
-
-
-// load assembly source file
-int casm_loadfile(CAssembler *self, const char *filename)
-{
-	char line[80];
-	FILE *fp;
-	casm_reset(self);
-	if ((fp = fopen(filename, "r")) == NULL) 
-		return -1;
-	while (!feof(fp)) {
-		int size = (int)fread(line, 1, 60, fp);
-		line[size] = 0;
-		casm_source(self, line);
-	}
-	fclose(fp);
-	return 0;
-}
-
-int casm_savefile(CAssembler *self, const char *filename)
-{
-	char *codedata, *p;
-	long codesize;
-	FILE *fp;
-
-	codedata = (char*)casm_callable(self, &codesize);
-	if (codedata == NULL) return -1;
-
-	if ((fp = fopen(filename, "wb")) == NULL) {
-		free(codedata);
-		return -2;
-	}
-
-	for (p = codedata; p < codedata + codesize; ) {
-		int canwrite = codesize - (int)(p - codedata);
-		int hr = (int)fwrite(p, 1, canwrite, fp);
-		if (hr > 0) p += hr;
-	}
-
-	fclose(fp);
-
-	free(codedata);
-
-	return 0;
-}
-
-int casm_dumpinst(CAssembler *self, FILE *fp)
-{
-	CLoader *loader = self->loader;
-	int lineno, p1, p2, maxsize, pos;
-	const char *text;
-	char *codedata;
-	iqueue_head *node;
-
-	text = self->source;
-
-	codedata = (char*)casm_callable(self, NULL);
-	if (codedata == NULL) return -1;
-	free(codedata);
-
-	node = loader->head.next;
-
-	for (maxsize = 0; node != &loader->head; node = node->next) {
-		CLink *link = iqueue_entry(node, CLink, head);
-		int length = cencoding_length(&link->encoding);
-		if (length > maxsize) maxsize = length;
-	}
-
-	node = loader->head.next;
-	fp = (fp != NULL)? fp : stdout;
-
-	for (lineno = 1, p1 = 0, pos = 0; p1 < self->srcsize; lineno++) {
-		for (p2 = p1; text[p2] != 0 && text[p2] != '\n'; p2++);
-		if (p2 - p1 >= IMAX_LINESIZE) {
-			casm_error(self, "line size too long", 1);
-			return -1;
-		}
-
-		memcpy(self->line, self->source + p1, p2 - p1);
-		self->line[p2 - p1] = 0;
-		p1 = p2 + 1;
-
-		while (node != &loader->head) {
-			CLink *link = iqueue_entry(node, CLink, head);
-			if (link->lineno >= lineno) break;
-			node = node->next;
-		}
-
-		if (node != &loader->head) {
-			CLink *link = iqueue_entry(node, CLink, head);
-			if (link->lineno == lineno) {
-				static char output[4096];
-				int length, size;
-				length = cencoding_length(&link->encoding);
-				if (link->encoding.align > 0) {
-					int align, i, k;
-					align = link->encoding.align;
-					length = align - (pos % align);
-					for (i = length, k = 0; i > 0; ) {
-						if (i >= 2) {
-							output[k++] = '6';
-							output[k++] = '6';
-							output[k++] = ' ';
-							i--;
-						}
-						output[k++] = '9';
-						output[k++] = '0';
-						output[k++] = ' ';
-						i--;
-					}
-					output[k++] = 0;
-				}	else {
-					cencoding_to_string(&link->encoding, output);
-				}
-				for (size = (int)strlen(output); size < (maxsize) * 3; )
-					output[size++] = ' ';
-				output[size] = 0;
-				if (length == 0) fprintf(fp, "         ");
-				else fprintf(fp, "%08X:", pos);
-				pos += length;
-				fprintf(fp, "  %s\t%s\n", output, self->line);
-			}
-		}
-	}
-
-	return 0;
-}
-
-
+//=====================================================================
+//
+// casmpure.c - assembly pure compiler
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "casmpure.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#define CASM_TOKEN_BLOCK	4096
+
+#if defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(WIN64)
+#include <windows.h>
+#define CASM_WIN32
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#endif
+
+
+//---------------------------------------------------------------------
+// file mapping
+//---------------------------------------------------------------------
+
+// map a whole file read-only, NULL if it can't be mapped or is empty
+static char *casm_file_map(const char *filename, int *size)
+{
+	char *ptr = NULL;
+#ifdef CASM_WIN32
+	HANDLE file, mapping;
+	DWORD high, low;
+	file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return NULL;
+	low = GetFileSize(file, &high);
+	if (low != INVALID_FILE_SIZE && high == 0 && low > 0 && 
+		low < 0x7fffffff) {
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping != NULL) {
+			ptr = (char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			*size = (int)low;
+		}
+	}
+	CloseHandle(file);
+#else
+	struct stat st;
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) return NULL;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && 
+		st.st_size > 0 && st.st_size < 0x7fffffff) {
+		ptr = (char*)mmap(NULL, (size_t)st.st_size, PROT_READ, 
+			MAP_PRIVATE, fd, 0);
+		if (ptr == (char*)MAP_FAILED) ptr = NULL;
+		*size = (int)st.st_size;
+	}
+	close(fd);
+#endif
+	return ptr;
+}
+
+static void casm_file_unmap(char *ptr, int size)
+{
+#ifdef CASM_WIN32
+	UnmapViewOfFile(ptr);
+#else
+	munmap(ptr, (size_t)size);
+#endif
+}
+
+// free source buffer or file view
+static void casm_source_free(CAssembler *self)
+{
+	if (self->mapped) casm_file_unmap(self->source, self->srcsize);
+	else free(self->source);
+	self->source = NULL;
+	self->mapped = 0;
+}
+
+// instruction of casm_emit, the source only has an empty line for it
+struct CAsmEmit
+{
+	int lineno;
+	const char *label;
+	const char *mnemonic;
+	CAsmOperand operands[4];
+	int count;
+	struct CAsmEmit *next;
+};
+
+typedef struct CAsmEmit CAsmEmit;
+
+static void casm_emit_reset(CAssembler *self)
+{
+	cmempool_reset(self->emitpool);
+	self->emitted = NULL;
+	self->lastemit = NULL;
+	self->replay = NULL;
+}
+
+//---------------------------------------------------------------------
+// CORE INTERFACE
+//---------------------------------------------------------------------
+
+// create assembler
+CAssembler *casm_create(void)
+{
+	CAssembler *self;
+	self = (CAssembler*)malloc(sizeof(CAssembler));
+	assert(self);
+	self->parser = cparser_create();
+	assert(self->parser);
+	self->loader = cloader_create();
+	assert(self->loader);
+	self->source = (char*)malloc(1024 + 1);
+	assert(self->source);
+	self->srcblock = 1024;
+	self->srcsize = 0;
+	self->source[0] = 0;
+	self->mapped = 0;
+	self->error = (char*)malloc(2048);
+	assert(self->error);
+	self->error[0] = 0;
+	self->errcode = 0;
+	self->compiled = 0;
+	self->parsed = 0;
+	self->emitpool = cmempool_create(0);
+	assert(self->emitpool);
+	self->emitted = NULL;
+	self->lastemit = NULL;
+	self->replay = NULL;
+	return self;
+}
+
+// reset assembler
+void casm_reset(CAssembler *self)
+{
+	assert(self);
+	if (self->source) casm_source_free(self);
+	self->source = (char*)malloc(1024 + 1);
+	assert(self->source);
+	self->srcblock = 1024;
+	self->srcsize = 0;
+	self->source[0] = 0;
+	self->compiled = 0;
+	self->parsed = 0;
+	casm_emit_reset(self);
+	cloader_reset(self->loader);
+	cparser_reset(self->parser);
+}
+
+// release assembler
+void casm_release(CAssembler *self)
+{
+	assert(self);
+	if (self->parser) {
+		cparser_release(self->parser);
+		self->parser = NULL;
+	}
+	if (self->loader) {
+		cloader_release(self->loader);
+		self->loader = NULL;
+	}
+	if (self->source) {
+		casm_source_free(self);
+	}
+	if (self->emitpool) {
+		cmempool_release(self->emitpool);
+		self->emitpool = NULL;
+	}
+	if (self->error) {
+		free(self->error);
+		self->error = NULL;
+	}
+	self->srcblock = 0;
+	self->srcsize = 0;
+	free(self);
+}
+
+// add source to source buffer
+int casm_source(CAssembler *self, const char *text)
+{
+	int datasize = (int)strlen(text);
+	int newsize = datasize + self->srcsize;
+	int newblock = 1;
+	while (newblock < newsize) newblock <<= 1;
+	if (newblock != self->srcblock) {
+		char *buffer = (char*)malloc(newblock + 1);
+		assert(buffer);
+		memcpy(buffer, self->source, self->srcsize);
+		buffer[self->srcsize] = 0;
+		casm_source_free(self);
+		self->source = buffer;
+		self->srcblock = newblock;
+	}
+	// a parsed last line without '\n' must be parsed again if it goes on
+	if (datasize > 0 && self->parsed > self->srcsize && text[0] != '\n')
+		self->compiled = 0;
+	memcpy(self->source + self->srcsize, text, datasize);
+	self->srcsize = newsize;
+	self->source[newsize] = 0;
+	return 0;
+}
+
+// select 32-bit or 64-bit code
+int casm_set_mode(CAssembler *self, int bits)
+{
+	assert(self);
+	if (cparser_set_mode(self->parser, bits) != 0) return -1;
+	self->loader->bits = bits;
+	self->compiled = 0;
+	return 0;
+}
+
+// prompt error
+static void casm_error(CAssembler *self, const char *msg, int code)
+{
+	sprintf(self->error, "line(%d): error(%d): %s", self->lineno, code, msg);
+	self->errcode = code;
+}
+
+// add encoding of a line to the loader
+static int casm_load_encoding(CAssembler *self, const CEncoding *encoding)
+{
+	if (encoding == NULL) {
+		casm_error(self, self->parser->error, self->parser->errcode);
+		return -1;
+	}
+
+	if (cloader_new_encoding(self->loader, encoding) != 0) {
+		casm_error(self, self->loader->error, 5);
+		return -1;
+	}
+
+	return 0;
+}
+
+// compile a line of the tokenized source
+static int casm_compile_line(CAssembler *self, int line)
+{
+	const CEncoding *encoding;
+
+	assert(self);
+
+	self->error[0] = 0;
+	self->errcode = 0;
+
+	// the empty line of an emitted instruction
+	if (self->replay && self->replay->lineno == self->lineno) {
+		const CAsmEmit *emit = self->replay;
+		self->replay = emit->next;
+		encoding = cparser_encode(self->parser, emit->label, 
+			emit->mnemonic, emit->operands, emit->count);
+		return casm_load_encoding(self, encoding);
+	}
+
+	encoding = cparser_parse_tokens(self->parser, line);
+
+	return casm_load_encoding(self, encoding);
+}
+
+// parse source buffer into the loader, the encoded link list is kept
+// and only lines added since the last call are parsed
+static int casm_assemble(CAssembler *self)
+{
+	const char *text = self->source;
+	int p1, p2, count, i;
+
+	assert(self);
+
+	if (self->compiled == 0) {
+		cloader_reset(self->loader);
+		cparser_reset(self->parser);
+		self->parsed = 0;
+		self->replay = self->emitted;
+		self->compiled = 1;
+	}
+
+	if (self->parsed >= self->srcsize) 
+		return 0;
+
+	// new text is tokenized a block of lines at a time in one pass, in
+	// place as the source may be a file view. blocks are small enough
+	// for the tokens to be still in cache when the lines are parsed
+	for (p1 = self->parsed; p1 < self->srcsize; p1 = p2) {
+		p2 = p1 + CASM_TOKEN_BLOCK;
+		if (p2 >= self->srcsize) p2 = self->srcsize;
+		for (; p2 < self->srcsize && text[p2 - 1] != '\n'; p2++);
+
+		count = cparser_tokenize(self->parser, text + p1, p2 - p1);
+
+		for (i = 0; i < count; i++) {
+			self->lineno = self->loader->lineno + 1;
+			if (casm_compile_line(self, i) != 0) {
+				self->compiled = 0;
+				return -2;
+			}
+		}
+
+		self->parsed = p2;
+	}
+
+	// past the end when the last line has no '\n' yet
+	if (text[self->srcsize - 1] != '\n') 
+		self->parsed = self->srcsize + 1;
+
+	return 0;
+}
+
+// compile source buffer
+// if (code == NULL) returns size of memory block needed
+// if (code != NULL) and (maxsize >= needed) compile and returns codesize
+// if (code != NULL) and (maxsize < needed) returns error
+int casm_compile(CAssembler *self, unsigned char *code, long maxsize)
+{
+	long codesize;
+	int retval;
+
+	assert(self);
+
+	retval = casm_assemble(self);
+
+	if (retval != 0) 
+		return retval;
+
+	codesize = cloader_get_codesize(self->loader) + 10;
+
+	if (code == NULL) 
+		return codesize;
+
+	if (maxsize < codesize) {
+		casm_error(self, "need a larger memory block to get code", 2);
+		return -3;
+	}
+
+	memset(code, 0xcc, codesize);
+
+	if (cloader_output(self->loader, code) != 0) {
+		self->lineno = self->loader->errcode;
+		casm_error(self, self->loader->error, 3);
+		return -4;
+	}
+
+	// jumps which fit in rel8 leave the code shorter than the bound
+	return self->loader->size + 10;
+}
+
+
+// encode instruction of typed operands after the source
+static int casm_emit_encoding(CAssembler *self, const char *label,
+	const char *mnemonic, const CAsmOperand *operands, int count)
+{
+	const CEncoding *encoding;
+	CAsmEmit *emit;
+	int i;
+
+	assert(self);
+
+	// the instruction takes a line of its own
+	if (self->srcsize > 0 && self->source[self->srcsize - 1] != '\n')
+		casm_source(self, "\n");
+
+	if (casm_assemble(self) != 0) 
+		return -1;
+
+	self->lineno = self->loader->lineno + 1;
+	self->error[0] = 0;
+	self->errcode = 0;
+
+	encoding = cparser_encode(self->parser, label, mnemonic, operands, count);
+
+	if (casm_load_encoding(self, encoding) != 0) 
+		return -2;
+
+	casm_source(self, "\n");
+	self->parsed = self->srcsize;
+
+	// keep it for the next parse, names may be in the caller's buffers
+	emit = (CAsmEmit*)cmempool_alloc(self->emitpool, sizeof(CAsmEmit));
+	emit->lineno = self->lineno;
+	emit->label = label? cmempool_strdup(self->emitpool, label) : NULL;
+	emit->mnemonic = mnemonic? 
+		cmempool_strdup(self->emitpool, mnemonic) : NULL;
+	emit->count = count;
+	emit->next = NULL;
+	for (i = 0; i < count; i++) {
+		emit->operands[i] = operands[i];
+		if (operands[i].label) {
+			emit->operands[i].label = 
+				cmempool_strdup(self->emitpool, operands[i].label);
+		}
+	}
+	if (self->lastemit) self->lastemit->next = emit;
+	else self->emitted = emit;
+	self->lastemit = emit;
+
+	return 0;
+}
+
+
+// get error
+const char *casm_geterror(const CAssembler *self, int *errcode)
+{
+	if (errcode) *errcode = self->errcode;
+	return self->error;
+}
+
+
+//---------------------------------------------------------------------
+// HIGH LEVEL
+//---------------------------------------------------------------------
+int casm_pushline(CAssembler *self, const char *fmt, ...)
+{
+	char *buffer = self->error;
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	vsprintf(buffer, fmt, argptr);
+	va_end(argptr);
+
+	casm_source(self, buffer);
+	casm_source(self, "\n");
+
+	self->error[0] = 0;
+
+	return 0;
+}
+
+
+//---------------------------------------------------------------------
+// BUILDER interface
+//---------------------------------------------------------------------
+int casm_emit(CAssembler *self, const char *mnemonic, int count, ...)
+{
+	CAsmOperand operands[4];
+	va_list argptr;
+	int i;
+
+	if (count < 0 || count > 4) {
+		casm_error(self, "Too many operands", 15);
+		return -1;
+	}
+
+	va_start(argptr, count);
+	for (i = 0; i < count; i++) 
+		operands[i] = va_arg(argptr, CAsmOperand);
+	va_end(argptr);
+
+	return casm_emit_encoding(self, NULL, mnemonic, operands, count);
+}
+
+int casm_emit_label(CAssembler *self, const char *label)
+{
+	return casm_emit_encoding(self, label, NULL, NULL, 0);
+}
+
+CAsmOperand casm_none(void)
+{
+	CAsmOperand operand;
+	memset(&operand, 0, sizeof(operand));
+	operand.operand.type = O_UNKNOWN;
+	operand.size = CS_UNKNOWN;
+	operand.base.type = O_UNKNOWN;
+	operand.index.type = O_UNKNOWN;
+	operand.label = NULL;
+	return operand;
+}
+
+CAsmOperand casm_reg(enum COperandType type, enum CRegID id)
+{
+	CAsmOperand operand = casm_none();
+	operand.operand = coperand_make_reg(type, id);
+	return operand;
+}
+
+CAsmOperand casm_imm(cint64 value)
+{
+	CAsmOperand operand = casm_none();
+	operand.operand.type = O_IMM;
+	operand.operand.value = value;
+	return operand;
+}
+
+CAsmOperand casm_label(const char *label)
+{
+	CAsmOperand operand = casm_none();
+	operand.operand.type = O_IMM;
+	operand.label = label;
+	return operand;
+}
+
+CAsmOperand casm_mem(enum CSpecifierType size, CAsmOperand base, 
+	CAsmOperand index, int scale, long disp)
+{
+	CAsmOperand operand = casm_none();
+	operand.operand.type = O_MEM;
+	operand.size = size;
+	operand.base = base.operand;
+	operand.index = index.operand;
+	operand.scale = scale;
+	operand.displacement = disp;
+	return operand;
+}
+
+CAsmOperand casm_mem_label(enum CSpecifierType size, const char *label,
+	CAsmOperand base, long disp)
+{
+	CAsmOperand operand = casm_mem(size, base, casm_none(), 0, disp);
+	operand.label = label;
+	return operand;
+}
+
+
+void *casm_callable(CAssembler *self, long *codesize)
+{
+	unsigned char *code;
+	long size;
+
+	if (codesize) *codesize = 0;
+
+	size = casm_compile(self, NULL, 0);
+
+	if (size < 0) {
+		return NULL;
+	}
+
+	code = (unsigned char*)malloc(size + 1);
+	assert(code);
+
+	size = casm_compile(self, code, size);
+
+	if (size < 0) {
+		free(code);
+		return NULL;
+	}
+
+	if (codesize) *codesize = size;
+
+	return code;
+}
+
+
+void *casm_callable_arena(CAssembler *self, CExecArena *arena, 
+	long *codesize)
+{
+	unsigned char *code;
+	long size;
+
+	assert(self && arena);
+
+	if (codesize) *codesize = 0;
+
+	size = casm_compile(self, NULL, 0);
+
+	if (size < 0) {
+		return NULL;
+	}
+
+	code = (unsigned char*)cexec_arena_alloc(arena, size);
+
+	if (code == NULL) {
+		casm_error(self, "cannot allocate executable memory", 4);
+		return NULL;
+	}
+
+	size = casm_compile(self, code, size);
+
+	if (size < 0) {
+		cexec_arena_free(arena, code);
+		return NULL;
+	}
+
+	if (codesize) *codesize = size;
+
+	return code;
+}
+
+
+//---------------------------------------------------------------------
+// CACHE
+//---------------------------------------------------------------------
+#define CASM_CACHE_HEAD		16
+
+// entries take whole pages of one arena shared by the cache, so each
+// is protected alone while the next ones are written. the code follows
+// a header pointing back to the entry, so a release doesn't need to 
+// search
+struct CAsmCacheEntry
+{
+	iqueue_head lru;
+	struct CAsmCacheEntry *next;	// hash chain
+	unsigned int hash;
+	int bits;
+	int srcsize;
+	char *source;
+	unsigned char *block;
+	unsigned char *code;
+	long codesize;
+	int refs;		// casm_callable_cached results not released yet
+	int cached;		// still in the table
+};
+
+typedef struct CAsmCacheEntry CAsmCacheEntry;
+
+struct CAsmCache
+{
+	iqueue_head lru;		// most recently used first
+	CAsmCacheEntry **table;
+	CExecArena *arena;
+	int tablesize;
+	int capacity;
+	int count;
+	long hits;
+	long misses;
+};
+
+static struct CAsmCache casm_cache = { 
+	{ NULL, NULL }, NULL, NULL, 0, 0, 0, 0, 0 };
+
+#ifdef CASM_WIN32
+static SRWLOCK casm_cache_mutex = SRWLOCK_INIT;
+
+static void casm_cache_lock(void)
+{
+	AcquireSRWLockExclusive(&casm_cache_mutex);
+}
+
+static void casm_cache_unlock(void)
+{
+	ReleaseSRWLockExclusive(&casm_cache_mutex);
+}
+
+#else
+static pthread_mutex_t casm_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void casm_cache_lock(void)
+{
+	pthread_mutex_lock(&casm_cache_mutex);
+}
+
+static void casm_cache_unlock(void)
+{
+	pthread_mutex_unlock(&casm_cache_mutex);
+}
+
+#endif
+
+// FNV-1a of source and code size
+static unsigned int casm_cache_hash(const char *source, int size, int bits)
+{
+	unsigned int hash = 2166136261u;
+	const unsigned char *p = (const unsigned char*)source;
+	int i;
+	for (i = 0; i < size; i++) {
+		hash = (hash ^ p[i]) * 16777619u;
+	}
+	return (hash ^ (unsigned int)bits) * 16777619u;
+}
+
+// called with the lock held, the arena is shared
+static void casm_cache_free(CAsmCacheEntry *entry)
+{
+	if (entry->block) cexec_arena_free(casm_cache.arena, entry->block);
+	free(entry->source);
+	free(entry);
+}
+
+// take entry out of the table, freed now if nobody uses it
+static void casm_cache_remove(CAsmCacheEntry *entry)
+{
+	CAsmCacheEntry **link;
+	link = &casm_cache.table[entry->hash & (casm_cache.tablesize - 1)];
+	while (*link != entry) link = &(*link)->next;
+	*link = entry->next;
+	iqueue_del_init(&entry->lru);
+	entry->cached = 0;
+	casm_cache.count--;
+	if (entry->refs == 0) casm_cache_free(entry);
+}
+
+// drop least recently used entries over capacity
+static void casm_cache_shrink(void)
+{
+	while (casm_cache.count > casm_cache.capacity) {
+		CAsmCacheEntry *entry;
+		entry = iqueue_entry(casm_cache.lru.prev, CAsmCacheEntry, lru);
+		casm_cache_remove(entry);
+	}
+}
+
+static CAsmCacheEntry *casm_cache_find(unsigned int hash, 
+	const char *source, int size, int bits)
+{
+	CAsmCacheEntry *entry;
+	if (casm_cache.capacity == 0) return NULL;
+	entry = casm_cache.table[hash & (casm_cache.tablesize - 1)];
+	for (; entry; entry = entry->next) {
+		if (entry->hash == hash && entry->bits == bits && 
+			entry->srcsize == size && 
+			memcmp(entry->source, source, size) == 0) {
+			iqueue_del(&entry->lru);
+			iqueue_add(&entry->lru, &casm_cache.lru);
+			entry->refs++;
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+void casm_cache_enable(int capacity)
+{
+	CAsmCacheEntry **table = NULL;
+	iqueue_head *p;
+	int tablesize = 0;
+
+	if (capacity < 0) capacity = 0;
+
+	casm_cache_lock();
+
+	if (casm_cache.lru.next == NULL) {
+		iqueue_init(&casm_cache.lru);
+	}
+
+	// unused entries go away when it shrinks
+	casm_cache.capacity = (capacity < casm_cache.capacity)? capacity : 
+		casm_cache.capacity;
+	casm_cache_shrink();
+
+	if (capacity > 0) {
+		for (tablesize = 1; tablesize < capacity; tablesize <<= 1);
+		table = (CAsmCacheEntry**)malloc(sizeof(CAsmCacheEntry*) * tablesize);
+		assert(table);
+		memset(table, 0, sizeof(CAsmCacheEntry*) * tablesize);
+		for (p = casm_cache.lru.next; p != &casm_cache.lru; p = p->next) {
+			CAsmCacheEntry *entry = iqueue_entry(p, CAsmCacheEntry, lru);
+			entry->next = table[entry->hash & (tablesize - 1)];
+			table[entry->hash & (tablesize - 1)] = entry;
+		}
+	}
+
+	if (casm_cache.table) free(casm_cache.table);
+
+	casm_cache.table = table;
+	casm_cache.tablesize = tablesize;
+	casm_cache.capacity = capacity;
+
+	casm_cache_unlock();
+}
+
+// free an entry not in the table yet
+static void casm_cache_drop(CAsmCacheEntry *entry)
+{
+	casm_cache_lock();
+	casm_cache_free(entry);
+	casm_cache_unlock();
+}
+
+// compile into pages of the cache arena, the code is protected
+static CAsmCacheEntry *casm_cache_compile(CAssembler *self)
+{
+	CAsmCacheEntry *entry;
+	unsigned char *block;
+	long size;
+
+	size = casm_compile(self, NULL, 0);
+
+	if (size < 0) {
+		return NULL;
+	}
+
+	entry = (CAsmCacheEntry*)malloc(sizeof(CAsmCacheEntry));
+	assert(entry);
+	entry->source = NULL;
+	entry->next = NULL;
+	entry->refs = 1;
+	entry->cached = 0;
+	iqueue_init(&entry->lru);
+
+	// pages of their own, compiling needs no lock
+	casm_cache_lock();
+	if (casm_cache.arena == NULL) casm_cache.arena = cexec_arena_create(0);
+	block = (unsigned char*)cexec_arena_alloc_pages(casm_cache.arena, 
+		CASM_CACHE_HEAD + size);
+	casm_cache_unlock();
+
+	entry->block = block;
+
+	if (block == NULL) {
+		casm_error(self, "cannot allocate executable memory", 4);
+		casm_cache_drop(entry);
+		return NULL;
+	}
+
+	*(CAsmCacheEntry**)block = entry;
+	entry->code = block + CASM_CACHE_HEAD;
+
+	entry->codesize = casm_compile(self, entry->code, size);
+
+	if (entry->codesize < 0) {
+		casm_cache_drop(entry);
+		return NULL;
+	}
+
+	if (cexec_arena_protect_pages(casm_cache.arena, block, 
+		CASM_CACHE_HEAD + size) != 0) {
+		casm_error(self, "cannot protect executable memory", 4);
+		casm_cache_drop(entry);
+		return NULL;
+	}
+
+	return entry;
+}
+
+void *casm_callable_cached(CAssembler *self, long *codesize)
+{
+	CAsmCacheEntry *entry, *found;
+	unsigned int hash;
+	int bits;
+
+	assert(self);
+
+	if (codesize) *codesize = 0;
+
+	// emitted instructions are not in the text
+	if (self->emitted) {
+		entry = casm_cache_compile(self);
+		if (entry == NULL) return NULL;
+		if (codesize) *codesize = entry->codesize;
+		return entry->code;
+	}
+
+	bits = self->loader->bits;
+	hash = casm_cache_hash(self->source, self->srcsize, bits);
+
+	casm_cache_lock();
+	found = casm_cache_find(hash, self->source, self->srcsize, bits);
+	if (found) casm_cache.hits++;
+	else if (casm_cache.capacity > 0) casm_cache.misses++;
+	casm_cache_unlock();
+
+	if (found) {
+		if (codesize) *codesize = found->codesize;
+		return found->code;
+	}
+
+	// compile without the lock, other threads keep hitting
+	entry = casm_cache_compile(self);
+
+	if (entry == NULL) {
+		return NULL;
+	}
+
+	entry->hash = hash;
+	entry->bits = bits;
+	entry->srcsize = self->srcsize;
+	entry->source = (char*)malloc(self->srcsize + 1);
+	assert(entry->source);
+	memcpy(entry->source, self->source, self->srcsize);
+
+	casm_cache_lock();
+
+	// another thread may have added the same source meanwhile
+	found = casm_cache_find(hash, self->source, self->srcsize, bits);
+
+	if (found == NULL && casm_cache.capacity > 0) {
+		int index = hash & (casm_cache.tablesize - 1);
+		entry->next = casm_cache.table[index];
+		casm_cache.table[index] = entry;
+		iqueue_add(&entry->lru, &casm_cache.lru);
+		entry->cached = 1;
+		casm_cache.count++;
+		casm_cache_shrink();
+	}
+
+	casm_cache_unlock();
+
+	if (found) {
+		casm_cache_drop(entry);
+		entry = found;
+	}
+
+	if (codesize) *codesize = entry->codesize;
+
+	return entry->code;
+}
+
+void casm_cache_release(void *code)
+{
+	CAsmCacheEntry *entry;
+
+	if (code == NULL) return;
+
+	entry = *(CAsmCacheEntry**)((unsigned char*)code - CASM_CACHE_HEAD);
+
+	casm_cache_lock();
+	entry->refs--;
+	if (entry->refs == 0 && entry->cached == 0) {
+		casm_cache_free(entry);
+	}
+	casm_cache_unlock();
+}
+
+void casm_cache_stats(long *hits, long *misses, int *entries)
+{
+	casm_cache_lock();
+	if (hits) *hits = casm_cache.hits;
+	if (misses) *misses = casm_cache.misses;
+	if (entries) *entries = casm_cache.count;
+	casm_cache_unlock();
+}
+
+
+CTemplate *casm_template(CAssembler *self)
+{
+	CTemplate *tpl;
+	long size;
+
+	assert(self);
+
+	if (casm_assemble(self) != 0) {
+		return NULL;
+	}
+
+	size = cloader_get_codesize(self->loader) + 10;
+	tpl = ctemplate_create(self->loader, size);
+
+	if (tpl == NULL) {
+		self->lineno = self->loader->errcode;
+		casm_error(self, self->loader->error, 3);
+		return NULL;
+	}
+
+	return tpl;
+}
+
+
+//---------------------------------------------------------------------
+// BATCH
+//---------------------------------------------------------------------
+#define CASM_BATCH_ALIGN	16
+
+CAsmBatch *casm_batch_create(void)
+{
+	CAsmBatch *batch;
+	batch = (CAsmBatch*)malloc(sizeof(CAsmBatch));
+	assert(batch);
+	batch->casm = casm_create();
+	assert(batch->casm);
+	batch->units = NULL;
+	batch->count = 0;
+	batch->code = NULL;
+	batch->codesize = 0;
+	batch->error = (char*)malloc(2048);
+	assert(batch->error);
+	batch->error[0] = 0;
+	return batch;
+}
+
+void casm_batch_release(CAsmBatch *batch)
+{
+	int i;
+	assert(batch);
+	for (i = 0; i < batch->count; i++) {
+		CAsmUnit *unit = &batch->units[i];
+		if (unit->loader) cloader_release(unit->loader);
+		free(unit->name);
+		free(unit->source);
+	}
+	if (batch->units) free(batch->units);
+	if (batch->casm) casm_release(batch->casm);
+	if (batch->error) free(batch->error);
+	batch->units = NULL;
+	batch->casm = NULL;
+	batch->error = NULL;
+	free(batch);
+}
+
+int casm_batch_add(CAsmBatch *batch, const char *name, const char *source)
+{
+	CAsmUnit *unit;
+	assert(batch && name && source);
+	batch->units = (CAsmUnit*)realloc(batch->units, 
+		sizeof(CAsmUnit) * (batch->count + 1));
+	assert(batch->units);
+	unit = &batch->units[batch->count];
+	unit->name = strdup(name);
+	unit->source = strdup(source);
+	assert(unit->name && unit->source);
+	unit->loader = NULL;
+	unit->offset = 0;
+	unit->size = 0;
+	unit->entry = NULL;
+	return batch->count++;
+}
+
+static void casm_batch_error(CAsmBatch *batch, const CAsmUnit *unit, 
+	const char *msg)
+{
+	strncpy(batch->error, unit->name, 100);
+	batch->error[100] = 0;
+	strcat(batch->error, ": ");
+	strncat(batch->error, msg, 1024);
+}
+
+// parse every unit into a loader of its own, returns total code size
+static long casm_batch_assemble(CAsmBatch *batch)
+{
+	CAssembler *casm = batch->casm;
+	long total = CASM_BATCH_ALIGN;
+	int i;
+
+	for (i = 0; i < batch->count; i++) {
+		CAsmUnit *unit = &batch->units[i];
+		CLoader *loader;
+
+		if (unit->loader) {
+			cloader_release(unit->loader);
+			unit->loader = NULL;
+		}
+
+		casm_reset(casm);
+		casm_source(casm, unit->source);
+
+		if (casm_assemble(casm) != 0) {
+			casm_batch_error(batch, unit, casm->error);
+			return -1;
+		}
+
+		// keep encoded links of this unit, assembler gets a new loader
+		loader = cloader_create();
+		assert(loader);
+		loader->bits = casm->loader->bits;
+		unit->loader = casm->loader;
+		casm->loader = loader;
+		casm->compiled = 0;
+
+		total += cloader_get_codesize(unit->loader) + CASM_BATCH_ALIGN;
+	}
+
+	return total;
+}
+
+void *casm_batch_compile(CAsmBatch *batch, CExecArena *arena, 
+	long *codesize)
+{
+	unsigned char *code, *ptr;
+	long total;
+	int i;
+
+	assert(batch);
+
+	if (codesize) *codesize = 0;
+
+	batch->error[0] = 0;
+	batch->code = NULL;
+	batch->codesize = 0;
+
+	total = casm_batch_assemble(batch);
+
+	if (total < 0) {
+		return NULL;
+	}
+
+	if (arena) code = (unsigned char*)cexec_arena_alloc(arena, total);
+	else code = (unsigned char*)malloc(total);
+
+	if (code == NULL) {
+		strncpy(batch->error, "cannot allocate code block", 100);
+		return NULL;
+	}
+
+	memset(code, 0xcc, total);
+
+	for (i = 0, ptr = code; i < batch->count; i++) {
+		CAsmUnit *unit = &batch->units[i];
+		cuintptr linear = (cuintptr)ptr;
+		ptr += (CASM_BATCH_ALIGN - linear % CASM_BATCH_ALIGN) % 
+			CASM_BATCH_ALIGN;
+		if (cloader_output(unit->loader, ptr) != 0) {
+			casm_batch_error(batch, unit, unit->loader->error);
+			if (arena) cexec_arena_free(arena, code);
+			else free(code);
+			return NULL;
+		}
+		unit->offset = (long)(ptr - code);
+		unit->size = (long)(unit->loader->output - ptr);
+		unit->entry = ptr;
+		ptr += unit->size;
+		cloader_release(unit->loader);
+		unit->loader = NULL;
+	}
+
+	batch->code = code;
+	batch->codesize = (long)(ptr - code);
+
+	if (codesize) *codesize = batch->codesize;
+
+	return code;
+}
+
+void *casm_batch_symbol(const CAsmBatch *batch, const char *name)
+{
+	int i;
+	assert(batch && name);
+	if (batch->code == NULL) return NULL;
+	for (i = 0; i < batch->count; i++) {
+		if (strcmp(batch->units[i].name, name) == 0) 
+			return batch->units[i].entry;
+	}
+	return NULL;
+}
+
+
+// load assembly source file
+int casm_loadfile(CAssembler *self, const char *filename)
+{
+	char line[4096 + 1];
+	char *view;
+	int size = 0;
+	FILE *fp;
+
+	casm_reset(self);
+
+	// regular files are parsed from the mapping, no copy is made
+	view = casm_file_map(filename, &size);
+
+	if (view != NULL) {
+		casm_source_free(self);
+		self->source = view;
+		self->srcsize = size;
+		self->srcblock = 0;
+		self->mapped = 1;
+		return 0;
+	}
+
+	// empty files, pipes and devices are read
+	if ((fp = fopen(filename, "rb")) == NULL) 
+		return -1;
+	while (!feof(fp)) {
+		size = (int)fread(line, 1, 4096, fp);
+		if (size <= 0) break;
+		line[size] = 0;
+		casm_source(self, line);
+	}
+	fclose(fp);
+	return 0;
+}
+
+int casm_savefile(CAssembler *self, const char *filename)
+{
+	char *codedata, *p;
+	long codesize;
+	FILE *fp;
+
+	codedata = (char*)casm_callable(self, &codesize);
+	if (codedata == NULL) return -1;
+
+	if ((fp = fopen(filename, "wb")) == NULL) {
+		free(codedata);
+		return -2;
+	}
+
+	for (p = codedata; p < codedata + codesize; ) {
+		int canwrite = codesize - (int)(p - codedata);
+		int hr = (int)fwrite(p, 1, canwrite, fp);
+		if (hr > 0) p += hr;
+	}
+
+	fclose(fp);
+
+	free(codedata);
+
+	return 0;
+}
+
+int casm_dumpinst(CAssembler *self, FILE *fp)
+{
+	CLoader *loader = self->loader;
+	int lineno, p1, p2, maxsize, pos;
+	const char *text;
+	char output[4096];
+	char *codedata;
+	iqueue_head *node;
+
+	text = self->source;
+
+	codedata = (char*)casm_callable(self, NULL);
+	if (codedata == NULL) return -1;
+	free(codedata);
+
+	node = loader->head.next;
+
+	for (maxsize = 0; node != &loader->head; node = node->next) {
+		CLink *link = iqueue_entry(node, CLink, head);
+		int length = cencoding_length(&link->encoding);
+		if (length > maxsize) maxsize = length;
+	}
+
+	node = loader->head.next;
+	fp = (fp != NULL)? fp : stdout;
+
+	for (lineno = 1, p1 = 0, pos = 0; p1 < self->srcsize; lineno++) {
+		const char *line = text + p1;
+		int length;
+
+		for (p2 = p1; p2 < self->srcsize && text[p2] != '\n'; p2++);
+		length = p2 - p1;
+		p1 = p2 + 1;
+
+		// keep a '\r' of CRLF source out of the listing
+		if (length > 0 && line[length - 1] == '\r') length--;
+
+		while (node != &loader->head) {
+			CLink *link = iqueue_entry(node, CLink, head);
+			if (link->lineno >= lineno) break;
+			node = node->next;
+		}
+
+		if (node != &loader->head) {
+			CLink *link = iqueue_entry(node, CLink, head);
+			if (link->lineno == lineno) {
+				int inslen, size;
+				inslen = cencoding_length(&link->encoding);
+				if (link->encoding.align > 0) {
+					int align, i, k;
+					align = link->encoding.align;
+					inslen = align - (pos % align);
+					for (i = inslen, k = 0; i > 0; ) {
+						if (i >= 2) {
+							output[k++] = '6';
+							output[k++] = '6';
+							output[k++] = ' ';
+							i--;
+						}
+						output[k++] = '9';
+						output[k++] = '0';
+						output[k++] = ' ';
+						i--;
+					}
+					output[k++] = 0;
+				}	else {
+					cencoding_to_string(&link->encoding, output);
+				}
+				for (size = (int)strlen(output); size < (maxsize) * 3; )
+					output[size++] = ' ';
+				output[size] = 0;
+				if (inslen == 0) fprintf(fp, "         ");
+				else fprintf(fp, "%08X:", pos);
+				pos += inslen;
+				fprintf(fp, "  %s\t%.*s\n", output, length, line);
+			}
+		}
+	}
+
+	return 0;
+}
+
+
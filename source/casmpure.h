@@ -1,91 +1,248 @@
-//=====================================================================
-//
-// casmpure.h - assembly pure compiler
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CASMPURE_H__
-#define __CASMPURE_H__
-
-#include "cloader.h"
-#include "cparser.h"
-
-
-//---------------------------------------------------------------------
-// CAssembler Definition
-//---------------------------------------------------------------------
-struct CAssembler
-{
-	CParser *parser;
-	CLoader *loader;
-	int srcblock;
-	int srcsize;
-	char *line;
-	char *source;
-	char *error;
-	int errcode;
-	int lineno;
-};
-
-typedef struct CAssembler CAssembler; 
-
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-//---------------------------------------------------------------------
-// Interface
-//---------------------------------------------------------------------
-
-// create assembler
-CAssembler *casm_create(void);
-
-// delete assembler
-void casm_release(CAssembler *self);
-
-// reset compiler state and clean source buffer
-void casm_reset(CAssembler *self);
-
-// add source to assembler source buffer
-int casm_source(CAssembler *self, const char *text);
-
-// compile source buffer
-// if (code == NULL) returns compiled code size
-// if (code != NULL) and (maxsize >= codesize) compile and returns codesize
-// if (code != NULL) and (maxsize < codesize) returns error
-int casm_compile(CAssembler *self, unsigned char *code, long maxsize);
-
-// get error
-const char *casm_geterror(const CAssembler *self, int *errcode);
-
-
-// HIGH LEVEL interface:
-
-// add a single line to assembly
-int casm_pushline(CAssembler *self, const char *fmt, ...);
-
-// compile and write execode into a memory block
-// you can call free() when you need to dispose
-void *casm_callable(CAssembler *self, long *codesize);
-
-
-// load assembly source file (will reset source buffer)
-int casm_loadfile(CAssembler *self, const char *filename);
-
-// save compiled code into file
-int casm_savefile(CAssembler *self, const char *filename);
-
-// dump instructions and source line 
-int casm_dumpinst(CAssembler *self, FILE *fp);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
-
+//=====================================================================
+//
+// casmpure.h - assembly pure compiler
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CASMPURE_H__
+#define __CASMPURE_H__
+
+#include "cloader.h"
+#include "cparser.h"
+#include "cexecmem.h"
+#include "ctemplate.h"
+
+
+//---------------------------------------------------------------------
+// CAssembler Definition
+//---------------------------------------------------------------------
+struct CAsmEmit;
+
+struct CAssembler
+{
+	CParser *parser;
+	CLoader *loader;
+	int srcblock;
+	int srcsize;
+	int mapped;		// source is a read-only view of a file
+	char *source;
+	char *error;
+	int errcode;
+	int lineno;
+	int compiled;
+	int parsed;		// source bytes already in the loader
+	CMemPool *emitpool;
+	struct CAsmEmit *emitted;	// instructions of casm_emit in line order
+	struct CAsmEmit *lastemit;
+	struct CAsmEmit *replay;	// next one to encode again on a parse
+};
+
+typedef struct CAssembler CAssembler; 
+
+
+//---------------------------------------------------------------------
+// CAsmOperand - operand of casm_emit, made by casm_reg, casm_imm ...
+//---------------------------------------------------------------------
+typedef CParserOperand CAsmOperand;
+
+
+//---------------------------------------------------------------------
+// CAsmBatch - independent functions compiled into one code block
+//---------------------------------------------------------------------
+struct CAsmUnit
+{
+	char *name;
+	char *source;
+	CLoader *loader;
+	long offset;		// offset of entry point in code block
+	long size;
+	void *entry;
+};
+
+typedef struct CAsmUnit CAsmUnit;
+
+struct CAsmBatch
+{
+	CAssembler *casm;
+	CAsmUnit *units;
+	int count;
+	unsigned char *code;
+	long codesize;
+	char *error;
+};
+
+typedef struct CAsmBatch CAsmBatch;
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// Interface
+//---------------------------------------------------------------------
+
+// create assembler. an assembler must be used by one thread at a time,
+// but threads can compile with their own assemblers concurrently: the
+// instruction set they share is read-only after it is built.
+CAssembler *casm_create(void);
+
+// delete assembler
+void casm_release(CAssembler *self);
+
+// reset compiler state and clean source buffer
+void casm_reset(CAssembler *self);
+
+// add source to assembler source buffer
+int casm_source(CAssembler *self, const char *text);
+
+// compile source buffer
+// if (code == NULL) returns size of memory block needed
+// if (code != NULL) and (maxsize >= needed) compile and returns codesize
+// if (code != NULL) and (maxsize < needed) returns error
+// the block needed counts every label jump in rel32 form, codesize is
+// the size after short jumps are laid out and can be smaller.
+// source is parsed only once, text added later is parsed on the next
+// call, so a size query followed by a real compile only encodes the 
+// instructions a single time.
+int casm_compile(CAssembler *self, unsigned char *code, long maxsize);
+
+// select code size: 32 (default) or 64 for x86-64 code. in 64-bit 
+// mode RAX-R15, R8D-R15D, SPL-DIL and XMM8-XMM15 are registers, 
+// [RIP + label] and a lone [label] are rip-relative, returns -1 for 
+// other sizes. the source is compiled again after a change.
+int casm_set_mode(CAssembler *self, int bits);
+
+// get error
+const char *casm_geterror(const CAssembler *self, int *errcode);
+
+
+// HIGH LEVEL interface:
+
+// add a single line to assembly
+int casm_pushline(CAssembler *self, const char *fmt, ...);
+
+// compile and write execode into a memory block
+// you can call free() when you need to dispose
+void *casm_callable(CAssembler *self, long *codesize);
+
+// compile and write execode into an executable memory arena, call 
+// cexec_arena_protect() before running and cexec_arena_free() to dispose
+void *casm_callable_arena(CAssembler *self, CExecArena *arena, 
+	long *codesize);
+
+// compile into executable code shared through the process-wide cache
+// (see casm_cache_enable), the same source compiled in the same mode 
+// again returns the same code without parsing. code is ready to run,
+// call casm_cache_release() to dispose. sources with instructions of 
+// casm_emit are compiled without the cache. returns NULL for error
+void *casm_callable_cached(CAssembler *self, long *codesize);
+
+// compile source buffer once into a template, labels referenced but not
+// defined in source become named parameters which can be patched by
+// ctemplate_instance() without parsing again. ctemplate_release() it.
+CTemplate *casm_template(CAssembler *self);
+
+
+
+// BATCH interface: every unit has its own labels and PROC scope, all 
+// units share one assembler and are packed into one block (16 bytes
+// aligned each) so related functions stay close in cache.
+
+CAsmBatch *casm_batch_create(void);
+
+// release batch, the code block is not freed
+void casm_batch_release(CAsmBatch *batch);
+
+// add a named source unit, returns unit index
+int casm_batch_add(CAsmBatch *batch, const char *name, const char *source);
+
+// compile all units into one block. if arena is NULL the block comes 
+// from malloc() and should be free()d, otherwise it is allocated in 
+// the arena and needs cexec_arena_protect() before running. 
+// returns NULL for error (see batch->error)
+void *casm_batch_compile(CAsmBatch *batch, CExecArena *arena, 
+	long *codesize);
+
+// get entry point of a unit after compile, NULL if not found
+void *casm_batch_symbol(const CAsmBatch *batch, const char *name);
+
+
+
+// BUILDER interface: instructions made of typed operands are encoded
+// and appended to the code directly, no text is formatted or scanned.
+// they go after the source added so far and take an empty line of it,
+// so errors and casm_dumpinst line numbers stay in step. they are kept
+// (label names copied) and encoded again at their line whenever the
+// source is parsed again, after an error, a continued last line or
+// casm_set_mode. casm_reset drops them.
+
+// "add eax, [ebx + esi*4 + 8]" is:
+//   casm_emit(casm, "add", 2, casm_reg(O_REG32, E_EAX), 
+//       casm_mem(CS_UNKNOWN, casm_reg(O_REG32, E_EBX), 
+//       casm_reg(O_REG32, E_ESI), 4, 8));
+// count is the number of operands (0-4), returns 0 or error
+int casm_emit(CAssembler *self, const char *mnemonic, int count, ...);
+
+// define a label at the next instruction
+int casm_emit_label(CAssembler *self, const char *label);
+
+// register number id of a class: O_REG8, O_REG16, O_REG32, O_REG64,
+// O_MMREG, O_XMMREG, O_YMMREG, O_ZMMREG, O_KREG or O_FPUREG
+CAsmOperand casm_reg(enum COperandType type, enum CRegID id);
+
+// no register, base or index of casm_mem
+CAsmOperand casm_none(void);
+
+// immediate value
+CAsmOperand casm_imm(cint64 value);
+
+// address of a label as immediate, a jump or call target
+CAsmOperand casm_label(const char *label);
+
+// memory [base + index * scale + disp], size is CS_UNKNOWN when the
+// other operands tell it. base and index can be casm_none()
+CAsmOperand casm_mem(enum CSpecifierType size, CAsmOperand base, 
+	CAsmOperand index, int scale, long disp);
+
+// memory [label + base + disp], rip-relative in 64-bit mode when base
+// is casm_none()
+CAsmOperand casm_mem_label(enum CSpecifierType size, const char *label,
+	CAsmOperand base, long disp);
+
+
+// CACHE interface: code of casm_callable_cached is kept by source and
+// code size in a process-wide LRU cache, which is safe to use from many
+// threads. entries evicted while still in use are freed by their last
+// casm_cache_release().
+
+// set max number of entries (0: disable the cache and drop unused code)
+void casm_cache_enable(int capacity);
+
+// release code returned by casm_callable_cached
+void casm_cache_release(void *code);
+
+// get hits, misses and number of entries, any can be NULL
+void casm_cache_stats(long *hits, long *misses, int *entries);
+
+
+// load assembly source file (will reset source buffer), the file is
+// mapped and parsed in place until more source is added
+int casm_loadfile(CAssembler *self, const char *filename);
+
+// save compiled code into file
+int casm_savefile(CAssembler *self, const char *filename);
+
+// dump instructions and source line 
+int casm_dumpinst(CAssembler *self, FILE *fp);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
@@ -0,0 +1,242 @@
+//=====================================================================
+//
+// cexecmem.c - executable memory arena
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cexecmem.h"
+
+#if defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(WIN64)
+#include <windows.h>
+#define CEXEC_WIN32
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#define CEXEC_BLOCKSIZE		65536
+#define CEXEC_ALIGN			16
+
+
+//---------------------------------------------------------------------
+// page operation
+//---------------------------------------------------------------------
+static long cexec_page_size(void)
+{
+#ifdef CEXEC_WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (long)info.dwPageSize;
+#else
+	long size = (long)sysconf(_SC_PAGESIZE);
+	return (size > 0)? size : 4096;
+#endif
+}
+
+static unsigned char *cexec_page_map(long size)
+{
+	void *ptr;
+#ifdef CEXEC_WIN32
+	ptr = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, 
+		PAGE_READWRITE);
+#else
+	ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, 
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED) ptr = NULL;
+#endif
+	return (unsigned char*)ptr;
+}
+
+static int cexec_page_protect(unsigned char *ptr, long size)
+{
+#ifdef CEXEC_WIN32
+	DWORD old;
+	if (!VirtualProtect(ptr, size, PAGE_EXECUTE_READ, &old)) 
+		return -1;
+	FlushInstructionCache(GetCurrentProcess(), ptr, size);
+#else
+	if (mprotect(ptr, size, PROT_READ | PROT_EXEC) != 0) 
+		return -1;
+#endif
+	return 0;
+}
+
+static void cexec_page_unmap(unsigned char *ptr, long size)
+{
+#ifdef CEXEC_WIN32
+	VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+	munmap(ptr, size);
+#endif
+}
+
+
+//---------------------------------------------------------------------
+// CExecArena interface
+//---------------------------------------------------------------------
+CExecArena *cexec_arena_create(long blocksize)
+{
+	CExecArena *arena;
+	arena = (CExecArena*)malloc(sizeof(CExecArena));
+	assert(arena);
+	arena->regions = NULL;
+	arena->current = NULL;
+	arena->pagesize = cexec_page_size();
+	if (blocksize <= 0) blocksize = CEXEC_BLOCKSIZE;
+	blocksize = (blocksize + arena->pagesize - 1) / arena->pagesize;
+	arena->blocksize = blocksize * arena->pagesize;
+	return arena;
+}
+
+void cexec_arena_release(CExecArena *arena)
+{
+	assert(arena);
+	while (arena->regions) {
+		CExecRegion *region = arena->regions;
+		arena->regions = region->next;
+		cexec_page_unmap(region->base, region->size);
+		free(region);
+	}
+	arena->current = NULL;
+	free(arena);
+}
+
+static CExecRegion *cexec_region_create(CExecArena *arena, long need)
+{
+	CExecRegion *region;
+	long size = arena->blocksize;
+
+	if (need > size) {
+		size = (need + arena->pagesize - 1) / arena->pagesize;
+		size = size * arena->pagesize;
+	}
+
+	region = (CExecRegion*)malloc(sizeof(CExecRegion));
+	assert(region);
+
+	region->base = cexec_page_map(size);
+
+	if (region->base == NULL) {
+		free(region);
+		return NULL;
+	}
+
+	region->size = size;
+	region->used = 0;
+	region->refs = 0;
+	region->executable = 0;
+	region->next = arena->regions;
+	arena->regions = region;
+
+	return region;
+}
+
+// take size bytes at an offset of align in a region
+static void *cexec_arena_take(CExecArena *arena, long size, long align)
+{
+	CExecRegion *region;
+	unsigned char *ptr;
+
+	assert(arena);
+
+	region = arena->current;
+
+	if (size <= 0) size = 1;
+	size = (size + align - 1) / align * align;
+
+	if (region != NULL) 
+		region->used = (region->used + align - 1) / align * align;
+
+	if (region == NULL || region->used + size > region->size) {
+		region = cexec_region_create(arena, size);
+		if (region == NULL) return NULL;
+		// only a fresh block becomes current, a large function gets 
+		// its own region and leaves the current one to be filled 
+		if (size <= arena->blocksize || arena->current == NULL) 
+			arena->current = region;
+	}
+
+	ptr = region->base + region->used;
+	region->used += size;
+	region->refs++;
+
+	return ptr;
+}
+
+void *cexec_arena_alloc(CExecArena *arena, long size)
+{
+	return cexec_arena_take(arena, size, CEXEC_ALIGN);
+}
+
+void *cexec_arena_alloc_pages(CExecArena *arena, long size)
+{
+	return cexec_arena_take(arena, size, arena->pagesize);
+}
+
+int cexec_arena_protect_pages(CExecArena *arena, void *ptr, long size)
+{
+	assert(arena);
+	size = (size + arena->pagesize - 1) / arena->pagesize;
+	return cexec_page_protect((unsigned char*)ptr, size * arena->pagesize);
+}
+
+int cexec_arena_protect(CExecArena *arena)
+{
+	CExecRegion *region;
+	int retval = 0;
+
+	assert(arena);
+
+	for (region = arena->regions; region; region = region->next) {
+		if (region->executable || region->used == 0) continue;
+		if (cexec_page_protect(region->base, region->size) != 0) {
+			retval = -1;
+			continue;
+		}
+		region->executable = 1;
+	}
+
+	// no more writes to pages already executable
+	if (arena->current && arena->current->executable) {
+		arena->current = NULL;
+	}
+
+	return retval;
+}
+
+void cexec_arena_free(CExecArena *arena, void *ptr)
+{
+	CExecRegion *region, *prev;
+	unsigned char *p = (unsigned char*)ptr;
+
+	assert(arena);
+
+	if (ptr == NULL) return;
+
+	for (region = arena->regions, prev = NULL; region; ) {
+		if (p >= region->base && p < region->base + region->size) 
+			break;
+		prev = region;
+		region = region->next;
+	}
+
+	assert(region);
+	if (region == NULL) return;
+
+	if (--region->refs > 0) return;
+
+	if (prev) prev->next = region->next;
+	else arena->regions = region->next;
+
+	if (arena->current == region) arena->current = NULL;
+
+	cexec_page_unmap(region->base, region->size);
+	free(region);
+}
+
+
@@ -0,0 +1,85 @@
+//=====================================================================
+//
+// cexecmem.h - executable memory arena
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CEXECMEM_H__
+#define __CEXECMEM_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+//---------------------------------------------------------------------
+// CExecRegion - one mapped block of pages
+//---------------------------------------------------------------------
+struct CExecRegion
+{
+	struct CExecRegion *next;
+	unsigned char *base;
+	long size;
+	long used;
+	int refs;
+	int executable;
+};
+
+typedef struct CExecRegion CExecRegion;
+
+
+//---------------------------------------------------------------------
+// CExecArena
+//---------------------------------------------------------------------
+struct CExecArena
+{
+	CExecRegion *regions;
+	CExecRegion *current;
+	long blocksize;
+	long pagesize;
+};
+
+typedef struct CExecArena CExecArena;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// interface
+//---------------------------------------------------------------------
+
+// create arena, blocksize is the size of each mapped region (0: 64KB)
+CExecArena *cexec_arena_create(long blocksize);
+
+// unmap every region (all functions allocated in it become invalid)
+void cexec_arena_release(CExecArena *arena);
+
+// allocate writable memory for a function, 16 bytes aligned
+void *cexec_arena_alloc(CExecArena *arena, long size);
+
+// switch every writable region to read/execute in one batch, memory 
+// allocated after this goes to new regions. returns zero for success
+int cexec_arena_protect(CExecArena *arena);
+
+// free a single function, region is unmapped when it becomes empty
+void cexec_arena_free(CExecArena *arena, void *ptr);
+
+// allocate whole pages for a function protected alone, other functions
+// of the region can still be written meanwhile
+void *cexec_arena_alloc_pages(CExecArena *arena, long size);
+
+// switch the pages of one cexec_arena_alloc_pages block to read/execute
+int cexec_arena_protect_pages(CExecArena *arena, void *ptr, long size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
@@ -1,299 +1,348 @@
-//=====================================================================
-//
-// cinstruct.c - 
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#include "cinstruct.h"
-
-#ifdef _MSC_VER
-#pragma warning(disable: 4996)
-#endif
-
-static void cinst_extract_operands(CInstruction *self, const char *syntax);
-
-CInstruction *cinst_create(const CInstSyntax *syntax)
-{
-	CInstruction *self;
-	self = (CInstruction*)malloc(sizeof(CInstruction));
-	assert(self);
-	self->syntax = syntax;
-	cinst_extract_operands(self, syntax->operands);
-	self->syntaxMnemonic = 0;
-	self->syntaxSpecifier = 0;
-	self->syntaxFirstOperand = 0;
-	self->syntaxSecondOperand = 0;
-	self->syntaxThirdOperand = 0;
-	self->flags = syntax->flags;
-	self->next = NULL;
-	return self;
-}
-
-void cinst_release(CInstruction *self)
-{
-	if (self->next) cinst_release(self->next);
-	self->next = NULL;
-	memset(self, 0, sizeof(CInstruction));
-	free(self);
-}
-
-static void cinst_extract_operands(CInstruction *self, const char *syntax)
-{
-	char *token;
-	char *string;
-	char *sep;
-
-	assert(syntax && self);
-
-	self->specifier = CS_UNKNOWN;
-	self->firstOperand = O_VOID;
-	self->secondOperand = O_VOID;
-	self->thirdOperand = O_VOID;
-
-	string = strdup(syntax);
-	cstring_strip(string);
-
-	sep = string;
-	token = cstring_strsep(&sep, " ,");
-
-	if (token == NULL) return;
-
-	cstring_strip(token);
-	self->specifier = cspecifier_scan(token);
-
-	if (self->specifier != CS_UNKNOWN) {
-		token = cstring_strsep(&sep, " ,");
-		if (token == 0) {
-			free(string);
-			return;
-		}
-	}
-
-	cstring_strip(token);
-	self->firstOperand = coperand_scan_syntax(token);
-
-	if (self->firstOperand != O_UNKNOWN) {
-		token = cstring_strsep(&sep, " ,");
-		if (token == 0) {
-			free(string);
-			return;
-		}
-	}
-
-	cstring_strip(token);
-	self->secondOperand = coperand_scan_syntax(token);
-
-	if (self->secondOperand != O_UNKNOWN) {
-		token = cstring_strsep(&sep, " ,");
-		if (token == 0) {
-			free(string);
-			return;
-		}
-	}
-
-	cstring_strip(token);
-	self->thirdOperand = coperand_scan_syntax(token);
-
-	if (self->thirdOperand != O_UNKNOWN) {
-		token = cstring_strsep(&sep, " ,");
-		if (token == 0) {
-			free(string);
-			return;
-		}
-	}
-
-	if (token != 0) {
-		fprintf(stderr, "casm: Invalid operand encoding '%s'\n", syntax);
-		fflush(stderr);
-		assert(0);
-		return;
-	}
-
-	free(string);
-}
-
-CInstruction *cinst_get_next(CInstruction *self)
-{
-	assert(self);
-	return self->next;
-}
-
-void cinst_attach_new(CInstruction *self, const CInstSyntax *instruction)
-{
-	if (!self->next) {
-		self->next = cinst_create(instruction);
-	}	else {
-		cinst_attach_new(self->next, instruction);
-	}
-}
-		
-void cinst_reset_match(CInstruction *self)
-{
-	self->syntaxMnemonic = 0;
-	self->syntaxSpecifier = 0;
-	self->syntaxFirstOperand = 0;
-	self->syntaxSecondOperand = 0;
-	self->syntaxThirdOperand = 0;
-
-	if (self->next) {
-		cinst_reset_match(self->next);
-	}
-}
-
-int cinst_match_syntax(CInstruction *self)
-{
-	return  self->syntaxMnemonic != 0 &&
-			self->syntaxSpecifier != 0 &&
-			self->syntaxFirstOperand != 0 &&
-			self->syntaxSecondOperand != 0 &&
-			self->syntaxThirdOperand != 0;	
-}
-
-void cinst_match_mnemonic(CInstruction *self, const char *mnemonic)
-{
-	if (stricmp(self->syntax->mnemonic, mnemonic) == 0) {
-		self->syntaxMnemonic = 1;
-	}
-	if (self->next) {
-		cinst_match_mnemonic(self->next, mnemonic);
-	}
-}
-
-void cinst_match_specifier(CInstruction *self, enum CSpecifierType specifier)
-{
-	if (self->specifier == CS_UNKNOWN) 
-	{
-		if (self->specifier != CS_UNKNOWN) {
-			if (self->firstOperand == O_R_M8 || 
-				self->secondOperand == O_R_M8) {
-				self->syntaxSpecifier = self->specifier == CS_BYTE;
-			}
-			else if (self->firstOperand == O_R_M16 || 
-					self->secondOperand == O_R_M16) {
-				self->syntaxSpecifier = self->specifier == CS_WORD;
-			}
-			else if (self->firstOperand == O_R_M32 || 
-					self->secondOperand == O_R_M32) {
-				self->syntaxSpecifier = self->specifier == CS_DWORD;
-			}
-			else if (self->firstOperand == O_R_M64 || 
-					self->secondOperand == O_R_M64) {
-				self->syntaxSpecifier = 
-					(self->specifier == CS_QWORD || 
-					self->specifier == CS_MMWORD);
-			}
-			else if (self->firstOperand == O_R_M128 || 
-					self->secondOperand == O_R_M128) {
-				self->syntaxSpecifier = self->specifier == CS_XMMWORD;
-			}	
-			else {
-				self->syntaxSpecifier = 1;
-			}
-		}	else {
-			self->syntaxSpecifier = 1;
-		}
-	}
-	else if (self->specifier != CS_UNKNOWN)   // Explicit specifier
-	{
-		if (self->specifier == specifier) {
-			self->syntaxSpecifier = 1;
-		}
-		else if (specifier == CS_UNKNOWN) {  
-			self->syntaxSpecifier = 1;	// Specifiers are optional
-		}
-		else {
-			self->syntaxSpecifier = 0;
-		}
-	}
-
-	if (self->next) {
-		cinst_match_specifier(self->next, specifier);
-	}
-}
-
-void cinst_match_first_operand(CInstruction *self, const COperand *operand)
-{
-	if (coperand_is_subtype_of(operand, self->firstOperand)) {
-		self->syntaxFirstOperand = 1;
-	}
-	else if (operand->type == O_MEM && self->firstOperand & O_MEM) {
-		if(self->syntaxSpecifier) {  // Explicit size specfier
-			self->syntaxFirstOperand = 1;
-		}
-		else if(self->secondOperand != O_UNKNOWN) { //Implicit size specifier
-			self->syntaxFirstOperand = 1;
-		}
-	}
-
-	if (self->next) {
-		cinst_match_first_operand(self->next, operand);
-	}
-}
-
-void cinst_match_second_operand(CInstruction *self, const COperand *operand)
-{
-	if (coperand_is_subtype_of(operand, self->secondOperand)) {
-		self->syntaxSecondOperand = 1;
-	}
-	else if (operand->type == O_MEM && self->secondOperand & O_MEM) {
-		if (self->syntaxSpecifier) {  // Explicit size specfier
-			self->syntaxSecondOperand = 1;
-		}
-		else if (self->firstOperand != O_UNKNOWN) {
-			self->syntaxSecondOperand = 1;
-		}
-	}
-	if (self->next) {
-		cinst_match_second_operand(self->next, operand);
-	}
-}
-
-void cinst_match_third_operand(CInstruction *self, const COperand *operand)
-{
-	if (coperand_is_subtype_of(operand, self->thirdOperand)) {
-		self->syntaxThirdOperand = 1;
-	}
-	if (self->next) {
-		cinst_match_third_operand(self->next, operand);
-	}
-}
-
-enum COperandType cinst_getFirstOperand(CInstruction *self)
-{
-	return self->firstOperand;
-}
-
-enum COperandType cinst_getSecondOperand(CInstruction *self)
-{
-	return self->secondOperand;
-}
-
-enum COperandType cinst_getThirdOperand(CInstruction *self)
-{
-	return self->thirdOperand;
-}
-
-const char *cinst_getMnemonic(CInstruction *self)
-{
-	return self->syntax->mnemonic;
-}
-
-const char *cinst_getOperandSyntax(CInstruction *self)
-{
-	return self->syntax->operands;
-}
-
-const char *cinst_getEncoding(CInstruction *self)
-{
-	return self->syntax->encoding;
-}
-		
-int cinst_is_32bit(CInstruction *self)
-{
-	return (self->flags & CT_CPU_386) == CT_CPU_386;
-}
-
-
-
+//=====================================================================
+//
+// cinstruct.c - 
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cinstruct.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4996)
+#endif
+
+static void cinst_extract_operands(CInstruction *self, const char *syntax);
+
+// initialize a node in place, the syntax row must outlive the node
+void cinst_init(CInstruction *self, const CInstSyntax *syntax)
+{
+	assert(self && syntax);
+	self->syntax = syntax;
+	cinst_extract_operands(self, syntax->operands);
+	self->flags = syntax->flags;
+	self->next = NULL;
+}
+
+static void cinst_extract_operands(CInstruction *self, const char *syntax)
+{
+	char string[64];
+	char *token;
+	char *sep;
+
+	assert(syntax && self);
+	assert(strlen(syntax) < sizeof(string));
+
+	self->specifier = CS_UNKNOWN;
+	self->firstOperand = O_VOID;
+	self->secondOperand = O_VOID;
+	self->thirdOperand = O_VOID;
+	self->fourthOperand = O_VOID;
+
+	strcpy(string, syntax);
+	cstring_strip(string);
+
+	sep = string;
+	token = cstring_strsep(&sep, " ,");
+
+	if (token == NULL) return;
+
+	cstring_strip(token);
+	self->specifier = cspecifier_scan(token);
+
+	if (self->specifier != CS_UNKNOWN) {
+		token = cstring_strsep(&sep, " ,");
+		if (token == 0) {
+			return;
+		}
+	}
+
+	cstring_strip(token);
+	self->firstOperand = coperand_scan_syntax(token);
+
+	if (self->firstOperand != O_UNKNOWN) {
+		token = cstring_strsep(&sep, " ,");
+		if (token == 0) {
+			return;
+		}
+	}
+
+	cstring_strip(token);
+	self->secondOperand = coperand_scan_syntax(token);
+
+	if (self->secondOperand != O_UNKNOWN) {
+		token = cstring_strsep(&sep, " ,");
+		if (token == 0) {
+			return;
+		}
+	}
+
+	cstring_strip(token);
+	self->thirdOperand = coperand_scan_syntax(token);
+
+	if (self->thirdOperand != O_UNKNOWN) {
+		token = cstring_strsep(&sep, " ,");
+		if (token == 0) {
+			return;
+		}
+	}
+
+	cstring_strip(token);
+	self->fourthOperand = coperand_scan_syntax(token);
+
+	if (self->fourthOperand != O_UNKNOWN) {
+		token = cstring_strsep(&sep, " ,");
+		if (token == 0) {
+			return;
+		}
+	}
+
+	if (token != 0) {
+		fprintf(stderr, "casm: Invalid operand encoding '%s'\n", syntax);
+		fflush(stderr);
+		assert(0);
+		return;
+	}
+}
+
+const CInstruction *cinst_get_next(const CInstruction *self)
+{
+	assert(self);
+	return self->next;
+}
+
+
+//---------------------------------------------------------------------
+// decision table
+//---------------------------------------------------------------------
+
+// every operand type the parser can produce
+static const enum COperandType cinst_classes[CINST_CLASSES] = {
+	O_VOID, O_UNKNOWN, O_ONE, O_IMM8, O_IMM16, O_IMM32, 
+	O_AL, O_CL, O_REG8, O_AX, O_DX, O_CX, O_REG16, O_EAX, O_ECX, O_REG32,
+	O_ST0, O_FPUREG, O_MMREG, O_XMMREG, O_YMMREG, O_ZMMREG, O_KREG, 
+	O_MEM, O_MEM8, O_MEM16, O_MEM32, O_MEM64, O_MEM128, O_MEM256, 
+	O_MEM512, O_VSIBX, O_VSIBY,
+};
+
+static int cinst_class(enum COperandType type)
+{
+	int i;
+	for (i = 0; i < CINST_CLASSES; i++) {
+		if (cinst_classes[i] == type) return i;
+	}
+	return -1;
+}
+
+static enum COperandType cinst_get_operand(const CInstruction *self, 
+	int index)
+{
+	if (index == 0) return self->firstOperand;
+	if (index == 1) return self->secondOperand;
+	if (index == 2) return self->thirdOperand;
+	return self->fourthOperand;
+}
+
+// general purpose 32-bit row, it becomes the 64-bit one with REX.W.
+// "MOVZX reg32,r/m8" and "ROL r/m32,CL" count too, their byte operand
+// stays a byte. VEX and ADX rows have their own reg64 rows.
+static int cinst_is_promotable(const CInstruction *self)
+{
+	const int simd = CT_CPU_FPU | CT_CPU_MMX | CT_CPU_KATMAI | CT_CPU_SSE |
+		CT_CPU_3DNOW | CT_CPU_PNI | CT_CPU_SSE3 | CT_CPU_SSSE3 | 
+		CT_CPU_SSE41 | CT_CPU_AVX | CT_CPU_AVX2 | CT_CPU_FMA | 
+		CT_CPU_AVX512F | CT_CPU_AVX512BW | CT_CPU_AES | CT_CPU_ADX |
+		CT_CPU_X64;
+	if (self->flags & simd) return 0;
+	if (self->syntax->encoding[0] == 'v') return 0;
+	if (cinst_operand_size(self) == 16) return 0;
+	return ((self->firstOperand | self->secondOperand | 
+		self->thirdOperand) & O_REG32) != 0;
+}
+
+void cinst_table_init(CInstTable *table, const CInstruction *list)
+{
+	int i, j, k;
+
+	memset(table, 0, sizeof(CInstTable));
+	table->mnemonic = list? list->syntax->mnemonic : NULL;
+
+	for (i = 0; list; list = list->next, i++) {
+		unsigned int bit = 1u << i;
+		assert(i < CINST_MAXROWS);
+
+		table->rows[i] = list;
+		table->all |= bit;
+
+		// specifiers are optional, an explicit one must agree
+		for (k = 0; k < CINST_SPECIFIERS; k++) {
+			if (list->specifier == CS_UNKNOWN || 
+				(int)list->specifier == k || k == CS_UNKNOWN) {
+				table->specifier[k] |= bit;
+			}
+		}
+
+		for (j = 0; j < CINST_OPERANDS; j++) {
+			enum COperandType type = cinst_get_operand(list, j);
+			// the parser hands 64-bit registers over as the 32-bit 
+			// classes, the row only exists in 64-bit mode
+			if (type & O_REG64) {
+				type = (enum COperandType)((type & ~O_REG64) | O_REG32);
+				table->gpr64[j] |= bit;
+				table->x64 |= bit;
+			}
+			for (k = 0; k < CINST_CLASSES; k++) {
+				if ((cinst_classes[k] & type) == cinst_classes[k]) 
+					table->operand[j][k] |= bit;
+			}
+			if (type & O_MEM) table->memory[j] |= bit;
+		}
+
+		// an untyped memory operand takes its size from the register
+		if (list->secondOperand != O_UNKNOWN) table->implicit[0] |= bit;
+		if (list->firstOperand != O_UNKNOWN) table->implicit[1] |= bit;
+		if (list->firstOperand != O_UNKNOWN) table->implicit[2] |= bit;
+
+		if (list->flags & CT_CPU_LEGACY) table->legacy |= bit;
+		if (list->flags & CT_CPU_X64) table->x64 |= bit;
+		if (list->flags & CT_CPU_STACK64) table->stack64 |= bit;
+		if (cinst_is_promotable(list)) table->promote |= bit;
+	}
+
+	table->count = i;
+}
+
+unsigned int cinst_table_specifier(const CInstTable *table, 
+	enum CSpecifierType specifier)
+{
+	if ((int)specifier < 0 || (int)specifier >= CINST_SPECIFIERS) 
+		return 0;
+	return table->specifier[specifier];
+}
+
+unsigned int cinst_table_operand(const CInstTable *table, int index, 
+	const COperand *operand, unsigned int specifier)
+{
+	unsigned int match;
+	int k;
+
+	assert(index >= 0 && index < CINST_OPERANDS);
+
+	k = cinst_class(operand->type);
+
+	if (k >= 0) {
+		match = table->operand[index][k];
+	}	else {
+		for (match = 0, k = 0; k < table->count; k++) {
+			enum COperandType type = cinst_get_operand(table->rows[k], index);
+			if (coperand_is_subtype_of(operand, type)) match |= 1u << k;
+		}
+	}
+
+	if (operand->type == O_MEM && index < 3) {
+		match |= table->memory[index] & (specifier | table->implicit[index]);
+	}
+
+	return match;
+}
+
+const CInstruction *cinst_table_select(const CInstTable *table, 
+	unsigned int match)
+{
+	int i;
+	match &= table->all;
+	if (match == 0) return NULL;
+	for (i = 0; (match & 1) == 0; i++) match >>= 1;
+	return table->rows[i];
+}
+
+enum COperandType cinst_getFirstOperand(const CInstruction *self)
+{
+	return self->firstOperand;
+}
+
+enum COperandType cinst_getSecondOperand(const CInstruction *self)
+{
+	return self->secondOperand;
+}
+
+enum COperandType cinst_getThirdOperand(const CInstruction *self)
+{
+	return self->thirdOperand;
+}
+
+enum COperandType cinst_getFourthOperand(const CInstruction *self)
+{
+	return self->fourthOperand;
+}
+
+const char *cinst_getMnemonic(const CInstruction *self)
+{
+	return self->syntax->mnemonic;
+}
+
+const char *cinst_getOperandSyntax(const CInstruction *self)
+{
+	return self->syntax->operands;
+}
+
+const char *cinst_getEncoding(const CInstruction *self)
+{
+	return self->syntax->encoding;
+}
+		
+// rows of 386 and later go by their first operand too: "BT r/m16,imm8"
+// is a 386 row and still needs the 66h prefix
+int cinst_is_32bit(const CInstruction *self)
+{
+	enum COperandType first = self->firstOperand;
+	if (first == O_REG16 || first == O_R_M16 || first == O_MEM16) 
+		return 0;
+	return (self->flags & CT_CPU_386) == CT_CPU_386;
+}
+
+static int cinst_is_byte(enum COperandType type)
+{
+	return type != O_UNKNOWN && (type & O_R_M8) == type;
+}
+
+int cinst_operand_size(const CInstruction *self)
+{
+	const char *encoding = self->syntax->encoding;
+	if (cinst_is_byte(self->firstOperand) || 
+		cinst_is_byte(self->secondOperand)) {
+		return 8;
+	}
+	if (encoding[0] == 'p' && encoding[1] == 'o' && !cinst_is_32bit(self)) {
+		return 16;
+	}
+	return 32;
+}
+
+int cinst_immediate_fits(const CInstruction *self, cint64 immediate, 
+	int wide)
+{
+	const char *encoding = self->syntax->encoding;
+	for (; encoding[0]; encoding++) {
+		if (encoding[0] != 'i') continue;
+		if (encoding[1] == 'b') {
+			if (cinst_operand_size(self) == 8) 
+				return immediate >= -128 && immediate <= 255;
+			return immediate >= -128 && immediate <= 127;
+		}
+		if (encoding[1] == 'w') {
+			return immediate >= -32768 && immediate <= 65535;
+		}
+		if (encoding[1] == 'd') {
+			if (wide) return immediate >= -0x7fffffffL - 1 && 
+				immediate <= 0x7fffffffL;
+			return 1;
+		}
+		if (encoding[1] == 'o') {
+			return 1;
+		}
+	}
+	return 1;
+}
+
+
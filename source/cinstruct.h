@@ -1,129 +1,195 @@
-//=====================================================================
-//
-// cinstruct.h - 
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CINSTRUCT_H__
-#define __CINSTRUCT_H__
-
-#include "ckeywords.h"
-
-//---------------------------------------------------------------------
-// CInstructionType
-//---------------------------------------------------------------------
-enum CInstructionType
-{
-	CT_CPU_UNKNOWN	= 0x00000000,
-
-	CT_CPU_8086		= 0x00000001,
-	CT_CPU_186		= 0x00000002,
-	CT_CPU_286		= 0x00000004,
-	CT_CPU_386		= 0x00000008,
-	CT_CPU_486		= 0x00000010,
-	CT_CPU_PENT		= 0x00000020,   // Pentium
-	CT_CPU_P6		= 0x00000040,   // Pentium Pro
-
-	CT_CPU_FPU		= 0x00000080,
-	CT_CPU_MMX		= 0x00000100,
-	CT_CPU_KATMAI	= 0x00000200,
-	CT_CPU_SSE		= 0x00000400,
-
-//	CT_CPU_AMD		= 0x00000800,   // AMD specific system calls
-	CT_CPU_CYRIX	= 0x00001000,
-	CT_CPU_3DNOW	= 0x00002000,
-	CT_CPU_ATHLON	= 0x00004000,
-//	CT_CPU_SMM		= 0x00008000,   // System Management Mode, standby mode
-
-	CT_CPU_P7		= 0x00010000 | CT_CPU_SSE,
-	CT_CPU_WILLAMETTE = CT_CPU_P7,
-	CT_CPU_SSE2		= 0x00020000 | CT_CPU_WILLAMETTE,
-	CT_CPU_PNI		= 0x00040000,
-	CT_CPU_SSE3		= 0x00080000,
-
-// Undocumented, also not supported by inline assembler
-//	CT_CPU_UNDOC	= 0x00010000,  
-// Priviledged, run-time compiled OS kernel anyone?
-//	CT_CPU_PRIV	= 0x00020000    
-};
-
-
-//---------------------------------------------------------------------
-// CInstructionSyntax
-//---------------------------------------------------------------------
-struct CInstSyntax
-{
-	const char *mnemonic;
-	const char *operands;
-	const char *encoding;
-	int flags;
-};
-
-typedef struct CInstSyntax CInstSyntax;
-
-
-//---------------------------------------------------------------------
-// CInstruction
-//---------------------------------------------------------------------
-struct CInstruction
-{
-	int syntaxMnemonic : 1;
-	int syntaxSpecifier : 1;
-	int syntaxFirstOperand : 1;
-	int syntaxSecondOperand : 1;
-	int syntaxThirdOperand : 1;
-
-	const struct CInstSyntax *syntax;
-	enum CSpecifierType specifier;
-	enum COperandType firstOperand;
-	enum COperandType secondOperand;
-	enum COperandType thirdOperand;
-	int flags;
-
-	struct CInstruction *next;
-};
-
-typedef struct CInstruction CInstruction;
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-
-CInstruction *cinst_create(const CInstSyntax *syntax);
-void cinst_release(CInstruction *self);
-
-CInstruction *cinst_get_next(CInstruction *self);
-
-void cinst_attach_new(CInstruction *self, const CInstSyntax *instruction);
-		
-void cinst_reset_match(CInstruction *self);
-int cinst_match_syntax(CInstruction *self);
-void cinst_match_mnemonic(CInstruction *self, const char *mnemonic);
-void cinst_match_specifier(CInstruction *self, enum CSpecifierType sizeSpec);
-void cinst_match_first_operand(CInstruction *self, const COperand *operand);
-void cinst_match_second_operand(CInstruction *self, const COperand *operand);
-void cinst_match_third_operand(CInstruction *self, const COperand *operand);
-
-enum COperandType cinst_getFirstOperand(CInstruction *self);
-enum COperandType cinst_getSecondOperand(CInstruction *self);
-enum COperandType cinst_getThirdOperand(CInstruction *self);
-
-const char *cinst_getMnemonic(CInstruction *self);
-const char *cinst_getOperandSyntax(CInstruction *self);
-const char *cinst_getEncoding(CInstruction *self);
-		
-int cinst_is_32bit(CInstruction *self);
-
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
-
+//=====================================================================
+//
+// cinstruct.h - 
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CINSTRUCT_H__
+#define __CINSTRUCT_H__
+
+#include "ckeywords.h"
+
+//---------------------------------------------------------------------
+// CInstructionType
+//---------------------------------------------------------------------
+enum CInstructionType
+{
+	CT_CPU_UNKNOWN	= 0x00000000,
+
+	CT_CPU_8086		= 0x00000001,
+	CT_CPU_186		= 0x00000002,
+	CT_CPU_286		= 0x00000004,
+	CT_CPU_386		= 0x00000008,
+	CT_CPU_486		= 0x00000010,
+	CT_CPU_PENT		= 0x00000020,   // Pentium
+	CT_CPU_P6		= 0x00000040,   // Pentium Pro
+
+	CT_CPU_FPU		= 0x00000080,
+	CT_CPU_MMX		= 0x00000100,
+	CT_CPU_KATMAI	= 0x00000200,
+	CT_CPU_SSE		= 0x00000400,
+
+	CT_CPU_CYRIX	= 0x00001000,
+	CT_CPU_3DNOW	= 0x00002000,
+	CT_CPU_ATHLON	= 0x00004000,
+
+	CT_CPU_SSE2		= 0x00020000 | CT_CPU_SSE,
+	CT_CPU_P7		= CT_CPU_SSE2,
+	CT_CPU_WILLAMETTE = CT_CPU_P7,
+	CT_CPU_PNI		= 0x00040000,
+	CT_CPU_SSE3		= CT_CPU_PNI,
+	CT_CPU_SSSE3	= 0x00800000,
+	CT_CPU_SSE41	= 0x01000000,
+	CT_CPU_SSE42	= 0x02000000,
+	CT_CPU_AVX		= 0x04000000,
+	CT_CPU_AVX2		= 0x08000000,
+	CT_CPU_FMA		= 0x10000000,
+	CT_CPU_AVX512F	= 0x20000000,
+	CT_CPU_AVX512BW	= 0x40000000,
+
+	// scalar bit manipulation, the VEX rows are sized by VEX.W
+	CT_CPU_BMI1		= 0x00000800,
+	CT_CPU_BMI2		= 0x00008000,
+	CT_CPU_ADX		= 0x00080000,
+	CT_CPU_POPCNT	= CT_CPU_SSE42,   // came with SSE4.2 (Nehalem)
+	CT_CPU_LZCNT	= CT_CPU_BMI1,    // ABM on AMD, with BMI1 on Intel
+
+	// crypto, one bit for the three sets as the enum is out of bits
+	CT_CPU_AES		= 0x00010000,
+	CT_CPU_PCLMUL	= CT_CPU_AES,
+	CT_CPU_SHA		= CT_CPU_AES,
+
+	CT_CPU_LEGACY	= 0x00100000,   // not encodable in 64-bit mode
+	CT_CPU_STACK64	= 0x00200000,   // 64-bit operand by default in 64-bit mode
+	CT_CPU_X64		= 0x00400000,   // 64-bit mode only
+
+// Undocumented, also not supported by inline assembler
+//	CT_CPU_UNDOC	= 0x00010000,  
+// Priviledged, run-time compiled OS kernel anyone?
+//	CT_CPU_PRIV	= 0x00020000    
+};
+
+
+//---------------------------------------------------------------------
+// CInstructionSyntax
+//---------------------------------------------------------------------
+struct CInstSyntax
+{
+	const char *mnemonic;
+	const char *operands;
+	const char *encoding;
+	int flags;
+};
+
+typedef struct CInstSyntax CInstSyntax;
+
+
+//---------------------------------------------------------------------
+// CInstruction
+//---------------------------------------------------------------------
+// nodes are read-only after the instruction set is built, so they can 
+// be shared by threads. rows of one mnemonic are chained by next.
+struct CInstruction
+{
+	const struct CInstSyntax *syntax;
+	enum CSpecifierType specifier;
+	enum COperandType firstOperand;
+	enum COperandType secondOperand;
+	enum COperandType thirdOperand;
+	enum COperandType fourthOperand;
+	int flags;
+
+	struct CInstruction *next;
+};
+
+typedef struct CInstruction CInstruction;
+
+
+//---------------------------------------------------------------------
+// CInstTable - decision table of one mnemonic
+//---------------------------------------------------------------------
+// every row of the mnemonic owns one bit. for each specifier and each 
+// operand class the table keeps the set of rows accepting it, so a 
+// parsed line is matched by and-ing a few masks and taking the lowest
+// bit: the first row in table order wins.
+#define CINST_MAXROWS		32
+#define CINST_SPECIFIERS	(CS_ZMMWORD + 1)
+#define CINST_CLASSES		33
+#define CINST_OPERANDS		4
+
+struct CInstTable
+{
+	const char *mnemonic;
+	const CInstruction *rows[CINST_MAXROWS];
+	int count;
+	unsigned int all;
+	unsigned int specifier[CINST_SPECIFIERS];
+	unsigned int operand[CINST_OPERANDS][CINST_CLASSES];
+	unsigned int memory[CINST_OPERANDS];	// rows taking any memory
+	unsigned int implicit[3];	// rows where memory size is implicit
+	unsigned int legacy;		// rows not encodable in 64-bit mode
+	unsigned int x64;			// rows only encodable in 64-bit mode
+	unsigned int promote;		// 32-bit integer rows, REX.W widens them
+	unsigned int stack64;		// rows of 64-bit operand size by default
+	unsigned int gpr64[CINST_OPERANDS];	// rows naming a 64-bit register
+};
+
+typedef struct CInstTable CInstTable;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+void cinst_init(CInstruction *self, const CInstSyntax *syntax);
+
+const CInstruction *cinst_get_next(const CInstruction *self);
+
+// build decision table from a row list (at most CINST_MAXROWS rows)
+void cinst_table_init(CInstTable *table, const CInstruction *list);
+
+// rows accepting the size specifier written before an operand
+unsigned int cinst_table_specifier(const CInstTable *table, 
+	enum CSpecifierType specifier);
+
+// rows accepting operand at position index (0-3), specifier is the 
+// mask of the last cinst_table_specifier
+unsigned int cinst_table_operand(const CInstTable *table, int index, 
+	const COperand *operand, unsigned int specifier);
+
+// first row in mask, NULL for empty mask
+const CInstruction *cinst_table_select(const CInstTable *table, 
+	unsigned int match);
+
+enum COperandType cinst_getFirstOperand(const CInstruction *self);
+enum COperandType cinst_getSecondOperand(const CInstruction *self);
+enum COperandType cinst_getThirdOperand(const CInstruction *self);
+enum COperandType cinst_getFourthOperand(const CInstruction *self);
+
+const char *cinst_getMnemonic(const CInstruction *self);
+const char *cinst_getOperandSyntax(const CInstruction *self);
+const char *cinst_getEncoding(const CInstruction *self);
+		
+int cinst_is_32bit(const CInstruction *self);
+
+// operand size in bits the row works on: 8, 16 or 32
+int cinst_operand_size(const CInstruction *self);
+
+// check immediate can be encoded by the row, an ib of a 16/32-bit 
+// operation is sign extended by the cpu, so is an id of a 64-bit 
+// operation (wide), only an io can hold a full 64-bit value then
+int cinst_immediate_fits(const CInstruction *self, cint64 immediate, 
+	int wide);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
@@ -1,1191 +1,2791 @@
-//=====================================================================
-//
-// cinstset.c - 
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#include "cinstset.h"
-
-#ifdef _MSC_VER
-#pragma warning(disable: 4996)
-#endif
-
-CInstSyntax cinstruction_set[] = 
-{
-	/*
-		Encoding syntax:
-		----------------
-		+r Add register value to opcode
-		/# Value for Mod R/M register field encoding
-		/r Effective address encoding
-		ib Byte immediate
-		iw Word immediate
-		id Dword immediate
-		-b Byte relative address
-		-i Word or dword relative address
-		p0 LOCK instruction prefix (F0h)
-		p2 REPNE/REPNZ instruction prefix (F2h)
-		p3 REP/REPE/REPZ instruction prefix (F3h) (also SSE prefix)
-		po Offset override prefix (66h)
-		pa Address override prefix (67h)
-	*/
-
-	{"AAA",			"",							"37",				CT_CPU_8086},
-	{"AAS",			"",							"3F",				CT_CPU_8086},
-	{"AAD",			"",							"D5 0A",			CT_CPU_8086},
-	{"AAD",			"imm",						"D5 ib",			CT_CPU_8086},
-	{"AAM",			"",							"D4 0A",			CT_CPU_8086},
-	{"AAM",			"imm",						"D4 ib",			CT_CPU_8086},
-	{"ADC",			"r/m8,reg8",				"10 /r",			CT_CPU_8086},
-	{"ADC",			"r/m16,reg16",				"po 11 /r",			CT_CPU_8086},
-	{"ADC",			"r/m32,reg32",				"po 11 /r",			CT_CPU_386},
-	{"ADC",			"reg8,r/m8",				"12 /r",			CT_CPU_8086},
-	{"ADC",			"reg16,r/m16",				"po 13 /r",			CT_CPU_8086},
-	{"ADC",			"reg32,r/m32",				"po 13 /r",			CT_CPU_386},
-	{"ADC",			"r/m8,imm8",				"80 /2 ib",			CT_CPU_8086},
-	{"ADC",			"r/m16,imm16",				"po 81 /2 iw",		CT_CPU_8086},
-	{"ADC",			"r/m32,imm32",				"po 81 /2 id",		CT_CPU_386},
-	{"ADC",			"r/m16,imm8",				"po 83 /2 ib",		CT_CPU_8086},
-	{"ADC",			"r/m32,imm8",				"po 83 /2 ib",		CT_CPU_386},
-	{"ADC",			"AL,imm8",					"14 ib",			CT_CPU_8086},
-	{"ADC",			"AX,imm16",					"po 15 iw",			CT_CPU_8086},
-	{"ADC",			"EAX,imm32",				"po 15 id",			CT_CPU_386},
-	{"ADD",			"r/m8,reg8",				"00 /r",			CT_CPU_8086},
-	{"ADD",			"r/m16,reg16",				"po 01 /r",			CT_CPU_8086},
-	{"ADD",			"r/m32,reg32",				"po 01 /r",			CT_CPU_386},
-	{"ADD",			"reg8,r/m8",				"02 /r",			CT_CPU_8086},
-	{"ADD",			"reg16,r/m16",				"po 03 /r",			CT_CPU_8086},
-	{"ADD",			"reg32,r/m32",				"po 03 /r",			CT_CPU_386},
-	{"ADD",			"r/m8,imm8",				"80 /0 ib",			CT_CPU_8086},
-	{"ADD",			"r/m16,imm16",				"po 81 /0 iw",		CT_CPU_8086},
-	{"ADD",			"r/m32,imm32",				"po 81 /0 id",		CT_CPU_386},
-	{"ADD",			"r/m16,imm8",				"po 83 /0 ib",		CT_CPU_8086},
-	{"ADD",			"r/m32,imm8",				"po 83 /0 ib",		CT_CPU_386},
-	{"ADD",			"AL,imm8",					"04 ib",			CT_CPU_8086},
-	{"ADD",			"AX,imm16",					"po 05 iw",			CT_CPU_8086},
-	{"ADD",			"EAX,imm32",				"po 05 id",			CT_CPU_386},
-	{"ADDPS",		"xmmreg,r/m128",			"0F 58 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"ADDSS",		"xmmreg,xmmreg/mem32",		"p3 0F 58 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"AND",			"r/m8,reg8",				"20 /r",			CT_CPU_8086},
-	{"AND",			"r/m16,reg16",				"po 21 /r",			CT_CPU_8086},
-	{"AND",			"r/m32,reg32",				"po 21 /r",			CT_CPU_386},
-	{"AND",			"reg8,r/m8",				"22 /r",			CT_CPU_8086},
-	{"AND",			"reg16,r/m16",				"po 23 /r",			CT_CPU_8086},
-	{"AND",			"reg32,r/m32",				"po 23 /r",			CT_CPU_386},
-	{"AND",			"r/m8,imm8",				"80 /4 ib",			CT_CPU_8086},
-	{"AND",			"r/m16,imm16",				"po 81 /4 iw",		CT_CPU_8086},
-	{"AND",			"r/m32,imm32",				"po 81 /4 id",		CT_CPU_386},
-	{"AND",			"r/m16,imm8",				"po 83 /4 ib",		CT_CPU_8086},
-	{"AND",			"r/m32,imm8",				"po 83 /4 ib",		CT_CPU_386},
-	{"AND",			"AL,imm8",					"24 ib",			CT_CPU_8086},
-	{"AND",			"AX,imm16",					"po 25 iw",			CT_CPU_8086},
-	{"AND",			"EAX,imm32",				"po 25 id",			CT_CPU_386},
-	{"ANDNPS",		"xmmreg,r/m128",			"0F 55 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"ANDPS",		"xmmreg,r/m128",			"0F 54 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"ARPL",		"r/m16,reg16",				"63 /r",			CT_CPU_286 | CT_CPU_PRIV},
-	{"BOUND",		"reg16,mem",				"po 62 /r",			CT_CPU_186},
-	{"BOUND",		"reg32,mem",				"po 62 /r",			CT_CPU_386},
-	{"BSF",			"reg16,r/m16",				"po 0F BC /r",		CT_CPU_386},
-	{"BSF",			"reg32,r/m32",				"po 0F BC /r",		CT_CPU_386},
-	{"BSR",			"reg16,r/m16",				"po 0F BD /r",		CT_CPU_386},
-	{"BSR",			"reg32,r/m32",				"po 0F BD /r",		CT_CPU_386},
-	{"BSWAP",		"reg32",					"po 0F C8 +r",		CT_CPU_486},
-	{"BT",			"r/m16,reg16",				"po 0F A3 /r",		CT_CPU_386},
-	{"BT",			"r/m32,reg32",				"po 0F A3 /r",		CT_CPU_386},
-	{"BT",			"r/m16,imm8",				"po 0F BA /4 ib",	CT_CPU_386},
-	{"BT",			"r/m32,imm8",				"po 0F BA /4 ib",	CT_CPU_386},
-	{"BTC",			"r/m16,reg16",				"po 0F BB /r",		CT_CPU_386},
-	{"BTC",			"r/m32,reg32",				"po 0F BB /r",		CT_CPU_386},
-	{"BTC",			"r/m16,imm8",				"po 0F BA /7 ib",	CT_CPU_386},
-	{"BTC",			"r/m32,imm8",				"po 0F BA /7 ib",	CT_CPU_386},
-	{"BTR",			"r/m16,reg16",				"po 0F B3 /r",		CT_CPU_386},
-	{"BTR",			"r/m32,reg32",				"po 0F B3 /r",		CT_CPU_386},
-	{"BTR",			"r/m16,imm8",				"po 0F BA /6 ib",	CT_CPU_386},
-	{"BTR",			"r/m32,imm8",				"po 0F BA /6 ib",	CT_CPU_386},
-	{"BTS",			"r/m16,reg16",				"po 0F AB /r",		CT_CPU_386},
-	{"BTS",			"r/m32,reg32",				"po 0F AB /r",		CT_CPU_386},
-	{"BTS",			"r/m16,imm",				"po 0F BA /5 ib",	CT_CPU_386},
-	{"BTS",			"r/m32,imm",				"po 0F BA /5 ib",	CT_CPU_386},
-	{"CALL",		"imm",						"E8 -i",			CT_CPU_8086},
-//	{"CALL",		"imm:imm16",				"po 9A iw iw",		CT_CPU_8086},
-//	{"CALL",		"imm:imm32",				"po 9A id iw",		CT_CPU_386},
-//	{"CALL",		"FAR mem16",				"po FF /3",			CT_CPU_8086},
-//	{"CALL",		"FAR mem32",				"po FF /3",			CT_CPU_386},
-	{"CALL",		"WORD r/m16",				"po FF /2",			CT_CPU_8086},
-	{"CALL",		"DWORD r/m32",				"po FF /2",			CT_CPU_386},
-	{"CBW",			"",							"po 98",			CT_CPU_8086},
-	{"CWD",			"",							"po 99",			CT_CPU_8086},
-	{"CDQ",			"",							"po 99",			CT_CPU_386},
-	{"CWDE",		"",							"po 98",			CT_CPU_386},
-	{"CLC",			"",							"F8",				CT_CPU_8086},
-	{"CLD",			"",							"FC",				CT_CPU_8086},
-	{"CLI",			"",							"FA",				CT_CPU_8086},
-//	{"CLTS",		"",							"0F 06",			CT_CPU_286 | CT_CPU_PRIV},
-	{"CMC",			"",							"F5",				CT_CPU_8086},
-	{"CMOVO",		"reg16,r/m16",				"po 0F 40 /r",		CT_CPU_P6},
-	{"CMOVNO",		"reg16,r/m16",				"po 0F 41 /r",		CT_CPU_P6},
-	{"CMOVB",		"reg16,r/m16",				"po 0F 42 /r",		CT_CPU_P6},
-	{"CMOVC",		"reg16,r/m16",				"po 0F 42 /r",		CT_CPU_P6},
-	{"CMOVNEA",		"reg16,r/m16",				"po 0F 42 /r",		CT_CPU_P6},
-	{"CMOVAE",		"reg16,r/m16",				"po 0F 43 /r",		CT_CPU_P6},
-	{"CMOVNB",		"reg16,r/m16",				"po 0F 43 /r",		CT_CPU_P6},
-	{"CMOVNC",		"reg16,r/m16",				"po 0F 43 /r",		CT_CPU_P6},
-	{"CMOVE",		"reg16,r/m16",				"po 0F 44 /r",		CT_CPU_P6},
-	{"CMOVZ",		"reg16,r/m16",				"po 0F 44 /r",		CT_CPU_P6},
-	{"CMOVNE",		"reg16,r/m16",				"po 0F 45 /r",		CT_CPU_P6},
-	{"CMOVNZ",		"reg16,r/m16",				"po 0F 45 /r",		CT_CPU_P6},
-	{"CMOVBE",		"reg16,r/m16",				"po 0F 46 /r",		CT_CPU_P6},
-	{"CMOVNA",		"reg16,r/m16",				"po 0F 46 /r",		CT_CPU_P6},
-	{"CMOVA",		"reg16,r/m16",				"po 0F 47 /r",		CT_CPU_P6},
-	{"CMOVNBE",		"reg16,r/m16",				"po 0F 47 /r",		CT_CPU_P6},
-	{"CMOVS",		"reg16,r/m16",				"po 0F 48 /r",		CT_CPU_P6},
-	{"CMOVNS",		"reg16,r/m16",				"po 0F 49 /r",		CT_CPU_P6},
-	{"CMOVP",		"reg16,r/m16",				"po 0F 4A /r",		CT_CPU_P6},
-	{"CMOVPE",		"reg16,r/m16",				"po 0F 4A /r",		CT_CPU_P6},
-	{"CMOVNP",		"reg16,r/m16",				"po 0F 4B /r",		CT_CPU_P6},
-	{"CMOVPO",		"reg16,r/m16",				"po 0F 4B /r",		CT_CPU_P6},
-	{"CMOVL",		"reg16,r/m16",				"po 0F 4C /r",		CT_CPU_P6},
-	{"CMOVNGE",		"reg16,r/m16",				"po 0F 4C /r",		CT_CPU_P6},
-	{"CMOVGE",		"reg16,r/m16",				"po 0F 4D /r",		CT_CPU_P6},
-	{"CMOVNL",		"reg16,r/m16",				"po 0F 4D /r",		CT_CPU_P6},
-	{"CMOVLE",		"reg16,r/m16",				"po 0F 4E /r",		CT_CPU_P6},
-	{"CMOVNG",		"reg16,r/m16",				"po 0F 4E /r",		CT_CPU_P6},
-	{"CMOVG",		"reg16,r/m16",				"po 0F 4F /r",		CT_CPU_P6},
-	{"CMOVNLE",		"reg16,r/m16",				"po 0F 4F /r",		CT_CPU_P6},
-	{"CMOVO",		"reg32,r/m32",				"po 0F 40 /r",		CT_CPU_P6},
-	{"CMOVNO",		"reg32,r/m32",				"po 0F 41 /r",		CT_CPU_P6},
-	{"CMOVB",		"reg32,r/m32",				"po 0F 42 /r",		CT_CPU_P6},
-	{"CMOVC",		"reg32,r/m32",				"po 0F 42 /r",		CT_CPU_P6},
-	{"CMOVNEA",		"reg32,r/m32",				"po 0F 42 /r",		CT_CPU_P6},
-	{"CMOVAE",		"reg32,r/m32",				"po 0F 43 /r",		CT_CPU_P6},
-	{"CMOVNB",		"reg32,r/m32",				"po 0F 43 /r",		CT_CPU_P6},
-	{"CMOVNC",		"reg32,r/m32",				"po 0F 43 /r",		CT_CPU_P6},
-	{"CMOVE",		"reg32,r/m32",				"po 0F 44 /r",		CT_CPU_P6},
-	{"CMOVZ",		"reg32,r/m32",				"po 0F 44 /r",		CT_CPU_P6},
-	{"CMOVNE",		"reg32,r/m32",				"po 0F 45 /r",		CT_CPU_P6},
-	{"CMOVNZ",		"reg32,r/m32",				"po 0F 45 /r",		CT_CPU_P6},
-	{"CMOVBE",		"reg32,r/m32",				"po 0F 46 /r",		CT_CPU_P6},
-	{"CMOVNA",		"reg32,r/m32",				"po 0F 46 /r",		CT_CPU_P6},
-	{"CMOVA",		"reg32,r/m32",				"po 0F 47 /r",		CT_CPU_P6},
-	{"CMOVNBE",		"reg32,r/m32",				"po 0F 47 /r",		CT_CPU_P6},
-	{"CMOVS",		"reg32,r/m32",				"po 0F 48 /r",		CT_CPU_P6},
-	{"CMOVNS",		"reg32,r/m32",				"po 0F 49 /r",		CT_CPU_P6},
-	{"CMOVP",		"reg32,r/m32",				"po 0F 4A /r",		CT_CPU_P6},
-	{"CMOVPE",		"reg32,r/m32",				"po 0F 4A /r",		CT_CPU_P6},
-	{"CMOVNP",		"reg32,r/m32",				"po 0F 4B /r",		CT_CPU_P6},
-	{"CMOVPO",		"reg32,r/m32",				"po 0F 4B /r",		CT_CPU_P6},
-	{"CMOVL",		"reg32,r/m32",				"po 0F 4C /r",		CT_CPU_P6},
-	{"CMOVNGE",		"reg32,r/m32",				"po 0F 4C /r",		CT_CPU_P6},
-	{"CMOVGE",		"reg32,r/m32",				"po 0F 4D /r",		CT_CPU_P6},
-	{"CMOVNL",		"reg32,r/m32",				"po 0F 4D /r",		CT_CPU_P6},
-	{"CMOVLE",		"reg32,r/m32",				"po 0F 4E /r",		CT_CPU_P6},
-	{"CMOVNG",		"reg32,r/m32",				"po 0F 4E /r",		CT_CPU_P6},
-	{"CMOVG",		"reg32,r/m32",				"po 0F 4F /r",		CT_CPU_P6},
-	{"CMOVNLE",		"reg32,r/m32",				"po 0F 4F /r",		CT_CPU_P6},
-	{"CMP",			"r/m8,reg8",				"38 /r",			CT_CPU_8086},
-	{"CMP",			"r/m16,reg16",				"po 39 /r",			CT_CPU_8086},
-	{"CMP",			"r/m32,reg32",				"po 39 /r",			CT_CPU_386},
-	{"CMP",			"reg8,r/m8",				"3A /r",			CT_CPU_8086},
-	{"CMP",			"reg16,r/m16",				"po 3B /r",			CT_CPU_8086},
-	{"CMP",			"reg32,r/m32",				"po 3B /r",			CT_CPU_386},
-	{"CMP",			"r/m8,imm8",				"80 /7 ib",			CT_CPU_8086},
-	{"CMP",			"r/m16,imm16",				"po 81 /7 iw",		CT_CPU_8086},
-	{"CMP",			"r/m32,imm32",				"po 81 /7 id",		CT_CPU_386},
-	{"CMP",			"r/m16,imm8",				"po 83 /7 ib",		CT_CPU_8086},
-	{"CMP",			"r/m32,imm8",				"po 83 /7 ib",		CT_CPU_386},
-	{"CMP",			"AL,imm8",					"3C ib",			CT_CPU_8086},
-	{"CMP",			"AX,imm16",					"po 3D iw",			CT_CPU_8086},
-	{"CMP",			"EAX,imm32",				"po 3D id",			CT_CPU_386},
-	{"CMPPS",		"xmmreg,r/m128,imm8",		"0F C2 /r ib",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPEQPS",		"xmmreg,r/m128",			"0F C2 /r 00",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPLEPS",		"xmmreg,r/m128",			"0F C2 /r 02",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPLTPS",		"xmmreg,r/m128",			"0F C2 /r 01",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPNEQPS",	"xmmreg,r/m128",			"0F C2 /r 04",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPNLEPS",	"xmmreg,r/m128",			"0F C2 /r 06",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPNLTPS",	"xmmreg,r/m128",			"0F C2 /r 05",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPORDPS",	"xmmreg,r/m128",			"0F C2 /r 07",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPUNORDPS",	"xmmreg,r/m128",			"0F C2 /r 03",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPSB",		"",							"A6",				CT_CPU_8086},
-	{"CMPSW",		"",							"po A7",			CT_CPU_8086},
-	{"CMPSD",		"",							"po A7",			CT_CPU_386},
-	{"CMPSS",		"xmmreg,xmmreg/mem32,imm8",	"p3 0F C2 /r ib",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPEQSS",		"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 00",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPLESS",		"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 02",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPLTSS",		"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 01",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPNEQSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 04",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPNLESS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 06",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPNLTSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 05",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPORDSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 07",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPUNORDSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 03",	CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CMPXCHG",		"r/m8,reg8",				"0F B0 /r",			CT_CPU_PENT},
-	{"CMPXCHG",		"r/m16,reg16",				"po 0F B1 /r",		CT_CPU_PENT},
-	{"CMPXCHG",		"r/m32,reg32",				"po 0F B1 /r",		CT_CPU_PENT},
-//	{"CMPXCHG486",	"r/m8,reg8",				"0F A6 /r",			CT_CPU_486 | CT_CPU_UNDOC},
-//	{"CMPXCHG486",	"r/m16,reg16",				"po 0F A7 /r",		CT_CPU_486 | CT_CPU_UNDOC},
-//	{"CMPXCHG486",	"r/m32,reg32",				"po 0F A7 /r",		CT_CPU_486 | CT_CPU_UNDOC},
-	{"CMPXCHG8B",	"mem",						"0F C7 /1",			CT_CPU_PENT},
-	{"COMISS",		"xmmreg,xmmreg/mem32",		"0F 2F /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CPUID",		"",							"0F A2",			CT_CPU_PENT},
-	{"CVTPI2PS",	"xmmreg,r/m64",				"0F 2A /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CVTPS2PI",	"mmreg,xmmreg/mem64",		"0F 2D /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CVTTPS2PI",	"mmreg,xmmreg/mem64",		"0F 2C /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CVTSI2SS",	"xmmreg,r/m32",				"p3 0F 2A /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CVTSS2SI",	"reg32,xmmreg/mem32",		"p3 0F 2D /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"CVTTSS2SI",	"reg32,xmmreg/mem32",		"p3 0F 2C /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"DAA",			"",							"27",				CT_CPU_8086},
-	{"DAS",			"",							"2F",				CT_CPU_8086},
-	{"DEC",			"reg16",					"po 48 +r",			CT_CPU_8086},
-	{"DEC",			"reg32",					"po 48 +r",			CT_CPU_386},
-	{"DEC",			"BYTE r/m8",				"FE /1",			CT_CPU_8086},
-	{"DEC",			"WORD r/m16",				"po FF /1",			CT_CPU_8086},
-	{"DEC",			"DWORD r/m32",				"po FF /1",			CT_CPU_386},
-	{"DIV",			"BYTE r/m8",				"F6 /6",			CT_CPU_8086},
-	{"DIV",			"WORD r/m16",				"po F7 /6",			CT_CPU_8086},
-	{"DIV",			"DWORD r/m32",				"po F7 /6",			CT_CPU_386},
-	{"DIVPS",		"xmmreg,r/m128",			"0F 5E /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"DIVSS",		"xmmreg,xmmreg/mem32",		"p3 0F 5E /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"EMMS",		"",							"0F 77",			CT_CPU_PENT | CT_CPU_MMX},
-//	{"ENTER",		"imm,imm",					"C8 iw ib",			CT_CPU_186},
-	{"F2XM1",		"",							"D9 F0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FABS",		"",							"D9 E1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADD",		"DWORD mem32",				"D8 /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADD",		"QWORD mem64",				"DC /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADD",		"fpureg",					"D8 C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADD",		"ST0,fpureg",				"D8 C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FADD",		"TO fpureg",				"DC C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADD",		"fpureg,ST0",				"DC C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADDP",		"fpureg",					"DE C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FADDP",		"fpureg,ST0",				"DE C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FBLD",		"mem80",					"DF /4",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FBSTP",		"mem80",					"DF /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCHS",		"",							"D9 E0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCLEX",		"",							"9B DB E2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNCLEX",		"",							"DB E2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCMOVB",		"fpureg",					"DA C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVB",		"ST0,fpureg",				"DA C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVBE",		"fpureg",					"DA D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVBE",		"ST0,fpureg",				"DA D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVE",		"fpureg",					"DA C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVE",		"ST0,fpureg",				"DA C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNB",		"fpureg",					"DB C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNB",		"ST0,fpureg",				"DB C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNBE",	"fpureg",					"DB D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNBE",	"ST0,fpureg",				"DB D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNE",		"fpureg",					"DB C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNE",		"ST0,fpureg",				"DB C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNU",		"fpureg",					"DB D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVNU",		"ST0,fpureg",				"DB D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVU",		"fpureg",					"DA D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCMOVU",		"ST0,fpureg",				"DA D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCOM",		"DWORD mem32",				"D8 /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOM",		"QWORD mem64",				"DC /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOM",		"fpureg",					"D8 D0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOM",		"ST0,fpureg",				"D8 D0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOMP",		"DWORD mem32",				"D8 /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOMP",		"QWORD mem64",				"DC /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOMP",		"fpureg",					"D8 D8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOMP",		"ST0,fpureg",				"D8 D8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOMPP",		"",							"DE D9",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FCOMI",		"fpureg",					"DB F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCOMI",		"ST0,fpureg",				"DB F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCOMIP",		"fpureg",					"DF F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCOMIP",		"ST0,fpureg",				"DF F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FCOS",		"",							"D9 FF",			CT_CPU_386 | CT_CPU_FPU},
-	{"FDECSTP",		"",							"D9 F6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDISI",		"",							"9B DB E1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNDISI",		"",							"DB E1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FENI",		"",							"9B DB E0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNENI",		"",							"DB E0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIV",		"DWORD mem32",				"D8 /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIV",		"QWORD mem64",				"DC /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIV",		"fpureg",					"D8 F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIV",		"ST0,fpureg",				"D8 F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FDIV",		"TO fpureg",				"DC F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIV",		"fpureg,ST0",				"DC F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVR",		"DWORD mem32",				"D8 /7",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVR",		"QWORD mem64",				"DC /7",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVR",		"fpureg",					"D8 F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVR",		"ST0,fpureg",				"D8 F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FDIVR",		"TO fpureg",				"DC F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVR",		"fpureg,ST0",				"DC F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVP",		"fpureg",					"DE F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVP",		"fpureg,ST0",				"DE F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVRP",		"fpureg",					"DE F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FDIVRP",		"fpureg,ST0",				"DE F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FEMMS",		"",							"0F 0E",			CT_CPU_3DNOW},
-	{"FFREE",		"fpureg",					"DD C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FFREEP",		"fpureg",					"DF C0 +r",			CT_CPU_P6 | CT_CPU_FPU | CT_CPU_UNDOC},
-	{"FIADD",		"WORD mem16",				"DE /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIADD",		"DWORD mem32",				"DA /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FICOM",		"WORD mem16",				"DE /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FICOM",		"DWORD mem32",				"DA /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FICOMP",		"WORD mem16",				"DE /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FICOMP",		"DWORD mem32",				"DA /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIDIV",		"WORD mem16",				"DE /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIDIV",		"DWORD mem32",				"DA /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIDIVR",		"WORD mem16",				"DE /7",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIDIVR",		"DWORD mem32",				"DA /7",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FILD",		"WORD mem16",				"DF /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FILD",		"DWORD mem32",				"DB /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FILD",		"QWORD mem64",				"DF /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIST",		"WORD mem16",				"DF /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIST",		"DWORD mem32",				"DB /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISTP",		"WORD mem16",				"DF /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISTP",		"DWORD mem32",				"DB /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISTP",		"QWORD mem64",				"DF /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIMUL",		"WORD mem16",				"DE /1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FIMUL",		"DWORD mem32",				"DA /1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FINCSTP",		"",							"D9 F7",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FINIT",		"",							"9B DB E3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNINIT",		"",							"DB E3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISUB",		"WORD mem16",				"DE /4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISUB",		"DWORD mem32",				"DA /4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISUBR",		"WORD mem16",				"DE /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FISUBR",		"DWORD mem32",				"DA /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLD",			"DWORD mem32",				"D9 /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLD",			"QWORD mem64",				"DD /0",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FLD",			"mem80",					"DB /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLD",			"fpureg",					"D9 C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLD1",		"",							"D9 E8",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDL2E",		"",							"D9 EA",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDL2T",		"",							"D9 E9",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDLG2",		"",							"D9 EC",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDLN2",		"",							"D9 ED",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDPI",		"",							"D9 EB",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDZ",		"",							"D9 EE",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDCW",		"mem16",					"D9 /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FLDENV",		"mem",						"D9 /4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMUL",		"DWORD mem32",				"D8 /1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMUL",		"QWORD mem64",				"DC /1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMUL",		"fpureg",					"D8 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMUL",		"ST0,fpureg",				"D8 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FMUL",		"TO fpureg",				"DC C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMUL",		"fpureg,ST0",				"DC C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMULP",		"fpureg",					"DE C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FMULP",		"fpureg,ST0",				"DE C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNOP",		"",							"D9 D0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FPATAN",		"",							"D9 F3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FPTAN",		"",							"D9 F2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FPREM",		"",							"D9 F8",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FPREM1",		"",							"D9 F5",			CT_CPU_386 | CT_CPU_FPU},
-	{"FRNDINT",		"",							"D9 FC",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSAVE",		"mem",						"9B DD /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNSAVE",		"mem",						"DD /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FRSTOR",		"mem",						"DD /4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSCALE",		"",							"D9 FD",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSETPM",		"",							"DB E4",			CT_CPU_286 | CT_CPU_FPU},
-	{"FSIN",		"",							"D9 FE",			CT_CPU_386 | CT_CPU_FPU},
-	{"FSINCOS",		"",							"D9 FB",			CT_CPU_386 | CT_CPU_FPU},
-	{"FSQRT",		"",							"D9 FA",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FST",			"DWORD mem32",				"D9 /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FST",			"QWORD mem64",				"DD /2",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FST",			"fpureg",					"DD D0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTP",		"DWORD mem32",				"D9 /3",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTP",		"QWORD mem64",				"DD /3",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FSTP",		"mem80",					"DB /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTP",		"fpureg",					"DD D8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTCW",		"mem16",					"9B D9 /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNSTCW",		"mem16",					"D9 /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTENV",		"mem",						"9B D9 /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNSTENV",		"mem",						"D9 /6",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTSW",		"mem16",					"9B DD /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSTSW",		"AX",						"9B DF E0",			CT_CPU_286 | CT_CPU_FPU},
-	{"FNSTSW",		"mem16",					"DD /0",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FNSTSW",		"AX",						"DF E0",			CT_CPU_286 | CT_CPU_FPU},
-	{"FSUB",		"DWORD mem32",				"D8 /4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUB",		"QWORD mem64",				"DC /4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUB",		"fpureg",					"D8 E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUB",		"ST0,fpureg",				"D8 E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FSUB",		"TO fpureg",				"DC E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUB",		"fpureg,ST0",				"DC E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBR",		"DWORD mem32",				"D8 /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBR",		"QWORD mem64",				"DC /5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBR",		"fpureg",					"D8 E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBR",		"ST0,fpureg",				"D8 E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FSUBR",		"TO fpureg",				"DC E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBR",		"fpureg,ST0",				"DC E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBP",		"fpureg",					"DE E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBP",		"fpureg,ST0",				"DE E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBRP",		"fpureg",					"DE E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FSUBRP",		"fpureg,ST0",				"DE E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FTST",		"",							"D9 E4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FUCOM",		"fpureg",					"DD E0 +r",			CT_CPU_386 | CT_CPU_FPU},
-	{"FUCOM",		"ST0,fpureg",				"DD E0 +r",			CT_CPU_386 | CT_CPU_FPU},
-	{"FUCOMP",		"fpureg",					"DD E8 +r",			CT_CPU_386 | CT_CPU_FPU},
-	{"FUCOMP",		"ST0,fpureg",				"DD E8 +r",			CT_CPU_386 | CT_CPU_FPU},
-	{"FUCOMPP",		"",							"DA E9",			CT_CPU_386 | CT_CPU_FPU},
-	{"FUCOMI",		"fpureg",					"DB E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FUCOMI",		"ST0,fpureg",				"DB E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FUCOMIP",		"fpureg",					"DF E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FUCOMIP",		"ST0,fpureg",				"DF E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
-	{"FWAIT",		"",							"9B",				CT_CPU_8086},
-	{"FXAM",		"",							"D9 E5",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FXCH",		"",							"D9 C9",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FXCH",		"fpureg",					"D9 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FXCH",		"fpureg,ST0",				"D9 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FXCH",		"ST0,fpureg",				"D9 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
-//	{"FXRSTOR",		"m512byte",					"0F AE /1",			CT_CPU_P6 | CT_CPU_SSE | CT_CPU_FPU},
-//	{"FXSAVE",		"m512byte",					"0F AE /0",			CT_CPU_P6 | CT_CPU_SSE | CT_CPU_FPU},
-	{"FXTRACT",		"",							"D9 F4",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FYL2X",		"",							"D9 F1",			CT_CPU_8086 | CT_CPU_FPU},
-	{"FYL2XP1",		"",							"D9 F9",			CT_CPU_8086 | CT_CPU_FPU},
-	{"HLT",			"",							"F4",				CT_CPU_8086},
-//	{"IBTS",		"r/m16,reg16",				"po 0F A7 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-//	{"IBTS",		"r/m32,reg32",				"po 0F A7 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-	{"IDIV",		"BYTE r/m8",				"F6 /7",			CT_CPU_8086},
-	{"IDIV",		"WORD r/m16",				"po F7 /7",			CT_CPU_8086},
-	{"IDIV",		"DWORD r/m32",				"po F7 /7",			CT_CPU_386},
-	{"IMUL",		"BYTE r/m8",				"F6 /5",			CT_CPU_8086},
-	{"IMUL",		"WORD r/m16",				"po F7 /5",			CT_CPU_8086},
-	{"IMUL",		"DWORD r/m32",				"po F7 /5",			CT_CPU_386},
-	{"IMUL",		"reg16,r/m16",				"po 0F AF /r",		CT_CPU_386},
-	{"IMUL",		"reg32,r/m32",				"po 0F AF /r",		CT_CPU_386},
-	{"IMUL",		"reg16,imm8",				"po 6B /r ib",		CT_CPU_286},
-	{"IMUL",		"reg16,imm16",				"po 69 /r iw",		CT_CPU_286},
-	{"IMUL",		"reg32,imm8",				"po 6B /r ib",		CT_CPU_386},
-	{"IMUL",		"reg32,imm32",				"po 69 /r id",		CT_CPU_386},
-	{"IMUL",		"reg16,r/m16,imm8",			"po 6B /r ib",		CT_CPU_286},
-	{"IMUL",		"reg16,r/m16,imm16",		"po 69 /r iw",		CT_CPU_286},
-	{"IMUL",		"reg32,r/m32,imm8",			"po 6B /r ib",		CT_CPU_386},
-	{"IMUL",		"reg32,r/m32,imm32",		"po 69 /r id",		CT_CPU_386},
-	{"IN",			"AL,imm8",					"E4 ib",			CT_CPU_8086},
-	{"IN",			"AX,imm8",					"po E5 ib",			CT_CPU_8086},
-	{"IN",			"EAX,imm8",					"po E5 ib",			CT_CPU_386},
-	{"IN",			"AL,DX",					"EC",				CT_CPU_8086},
-	{"IN",			"AX,DX",					"po ED",			CT_CPU_8086},
-	{"IN",			"EAX,DX",					"po ED",			CT_CPU_386},
-	{"INC",			"reg16",					"po 40 +r",			CT_CPU_8086},
-	{"INC",			"reg32",					"po 40 +r",			CT_CPU_386},
-	{"INC",			"BYTE r/m8",				"FE /0",			CT_CPU_8086},
-	{"INC",			"WORD r/m16",				"po FF /0",			CT_CPU_8086},
-	{"INC",			"DWORD r/m32",				"po FF /0",			CT_CPU_386},
-	{"INSB",		"",							"6C",				CT_CPU_186},
-	{"INSW",		"",							"po 6D",			CT_CPU_186},
-	{"INSD",		"",							"po 6D",			CT_CPU_386},
-	{"INT",			"imm8",						"CD ib",			CT_CPU_8086},
-	{"INT1",		"",							"F1",				CT_CPU_P6},
-	{"ICEBP",		"",							"F1",				CT_CPU_P6},
-	{"INT01",		"",							"F1",				CT_CPU_P6},
-	{"INT3",		"",							"CC",				CT_CPU_8086},
-	{"INT03",		"",							"CC",				CT_CPU_8086},
-	{"INTO",		"",							"CE",				CT_CPU_8086},
-	{"INVD",		"",							"0F 08",			CT_CPU_486},
-	{"INVLPG",		"mem",						"0F 01 /0",			CT_CPU_486},
-	{"IRET",		"",							"CF",				CT_CPU_8086},
-	{"IRETW",		"",							"po CF",			CT_CPU_8086},
-	{"IRETD",		"",							"po CF",			CT_CPU_386},
-	{"JCXZ",		"imm",						"po E3 -b",			CT_CPU_8086},
-	{"JECXZ",		"imm",						"po E3 -b",			CT_CPU_386},
-	{"JMP",			"imm",						"E9 -i",			CT_CPU_8086},
-	{"JMP",			"SHORT imm",				"EB -b",			CT_CPU_8086},
-//	{"JMP",			"imm:imm16",				"po EA iw iw",		CT_CPU_8086},
-//	{"JMP",			"imm:imm32",				"po EA id iw",		CT_CPU_386},
-	{"JMP",			"mem",						"po FF /5",			CT_CPU_8086},
-//	{"JMP",			"FAR mem",					"po FF /5",			CT_CPU_386},
-	{"JMP",			"WORD r/m16",				"po FF /4",			CT_CPU_8086},
-	{"JMP",			"DWORD r/m32",				"po FF /4",			CT_CPU_386},
-	{"JO",			"imm",						"70 -b",			CT_CPU_8086},
-	{"JNO",			"imm",						"71 -b",			CT_CPU_8086},
-	{"JB",			"imm",						"72 -b",			CT_CPU_8086},
-	{"JC",			"imm",						"72 -b",			CT_CPU_8086},
-	{"JNEA",		"imm",						"72 -b",			CT_CPU_8086},
-	{"JAE",			"imm",						"73 -b",			CT_CPU_8086},
-	{"JNB",			"imm",						"73 -b",			CT_CPU_8086},
-	{"JNC",			"imm",						"73 -b",			CT_CPU_8086},
-	{"JE",			"imm",						"74 -b",			CT_CPU_8086},
-	{"JZ",			"imm",						"74 -b",			CT_CPU_8086},
-	{"JNE",			"imm",						"75 -b",			CT_CPU_8086},
-	{"JNZ",			"imm",						"75 -b",			CT_CPU_8086},
-	{"JBE",			"imm",						"76 -b",			CT_CPU_8086},
-	{"JNA",			"imm",						"76 -b",			CT_CPU_8086},
-	{"JA",			"imm",						"77 -b",			CT_CPU_8086},
-	{"JNBE",		"imm",						"77 -b",			CT_CPU_8086},
-	{"JS",			"imm",						"78 -b",			CT_CPU_8086},
-//	{"JNS",			"imm",						"79 -b",			CT_CPU_8086},
-	{"JP",			"imm",						"7A -b",			CT_CPU_8086},
-	{"JPE",			"imm",						"7A -b",			CT_CPU_8086},
-	{"JNP",			"imm",						"7B -b",			CT_CPU_8086},
-	{"JPO",			"imm",						"7B -b",			CT_CPU_8086},
-	{"JL",			"imm",						"7C -b",			CT_CPU_8086},
-	{"JNGE",		"imm",						"7C -b",			CT_CPU_8086},
-	{"JGE",			"imm",						"7D -b",			CT_CPU_8086},
-	{"JNL",			"imm",						"7D -b",			CT_CPU_8086},
-	{"JLE",			"imm",						"7E -b",			CT_CPU_8086},
-	{"JNG",			"imm",						"7E -b",			CT_CPU_8086},
-	{"JG",			"imm",						"7F -b",			CT_CPU_8086},
-	{"JNLE",		"imm",						"7F -b",			CT_CPU_8086},
-	{"JO",			"NEAR imm",					"0F 80 -i",			CT_CPU_386},
-	{"JNO",			"NEAR imm",					"0F 81 -i",			CT_CPU_386},
-	{"JB",			"NEAR imm",					"0F 82 -i",			CT_CPU_386},
-	{"JC",			"NEAR imm",					"0F 82 -i",			CT_CPU_386},
-	{"JNEA",		"NEAR imm",					"0F 82 -i",			CT_CPU_386},
-	{"JAE",			"NEAR imm",					"0F 83 -i",			CT_CPU_386},
-	{"JNB",			"NEAR imm",					"0F 83 -i",			CT_CPU_386},
-	{"JNC",			"NEAR imm",					"0F 83 -i",			CT_CPU_386},
-	{"JE",			"NEAR imm",					"0F 84 -i",			CT_CPU_386},
-	{"JZ",			"NEAR imm",					"0F 84 -i",			CT_CPU_386},
-	{"JNE",			"NEAR imm",					"0F 85 -i",			CT_CPU_386},
-	{"JNZ",			"NEAR imm",					"0F 85 -i",			CT_CPU_386},
-	{"JBE",			"NEAR imm",					"0F 86 -i",			CT_CPU_386},
-	{"JNA",			"NEAR imm",					"0F 86 -i",			CT_CPU_386},
-	{"JA",			"NEAR imm",					"0F 87 -i",			CT_CPU_386},
-	{"JNBE",		"NEAR imm",					"0F 87 -i",			CT_CPU_386},
-	{"JS",			"NEAR imm",					"0F 88 -i",			CT_CPU_386},
-	{"JNS",			"NEAR imm",					"0F 89 -i",			CT_CPU_386},
-	{"JP",			"NEAR imm",					"0F 8A -i",			CT_CPU_386},
-	{"JPE",			"NEAR imm",					"0F 8A -i",			CT_CPU_386},
-	{"JNP",			"NEAR imm",					"0F 8B -i",			CT_CPU_386},
-	{"JPO",			"NEAR imm",					"0F 8B -i",			CT_CPU_386},
-	{"JL",			"NEAR imm",					"0F 8C -i",			CT_CPU_386},
-	{"JNGE",		"NEAR imm",					"0F 8C -i",			CT_CPU_386},
-	{"JGE",			"NEAR imm",					"0F 8D -i",			CT_CPU_386},
-	{"JNL",			"NEAR imm",					"0F 8D -i",			CT_CPU_386},
-	{"JLE",			"NEAR imm",					"0F 8E -i",			CT_CPU_386},
-	{"JNG",			"NEAR imm",					"0F 8E -i",			CT_CPU_386},
-	{"JG",			"NEAR imm",					"0F 8F -i",			CT_CPU_386},
-	{"JNLE",		"NEAR imm",					"0F 8F -i",			CT_CPU_386},
-	{"LAHF",		"",							"9F",				CT_CPU_8086},
-//	{"LAR",			"reg16,r/m16",				"po 0F 02 /r",		CT_CPU_286 | CT_CPU_PRIV},
-//	{"LAR",			"reg32,r/m32",				"po 0F 02 /r",		CT_CPU_286 | CT_CPU_PRIV},
-	{"LDS",			"reg16,mem",				"po C5 /r",			CT_CPU_8086},
-	{"LDS",			"reg32,mem",				"po C5 /r",			CT_CPU_8086},
-	{"LES",			"reg16,mem",				"po C4 /r",			CT_CPU_8086},
-	{"LES",			"reg32,mem",				"po C4 /r",			CT_CPU_8086},
-	{"LFS",			"reg16,mem",				"po 0F B4 /r",		CT_CPU_386},
-	{"LFS",			"reg32,mem",				"po 0F B4 /r",		CT_CPU_386},
-	{"LGS",			"reg16,mem",				"po 0F B5 /r",		CT_CPU_386},
-	{"LGS",			"reg32,mem",				"po 0F B5 /r",		CT_CPU_386},
-	{"LSS",			"reg16,mem",				"po 0F B2 /r",		CT_CPU_386},
-	{"LSS",			"reg32,mem",				"po 0F B2 /r",		CT_CPU_386},
-	{"LDMXCSR",		"mem32",					"0F AE /2",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"LEA",			"reg16,mem",				"po 8D /r",			CT_CPU_8086},
-	{"LEA",			"reg32,mem",				"po 8D /r",			CT_CPU_386},
-	{"LEAVE",		"",							"C9",				CT_CPU_186},
-//	{"LGDT",		"mem",						"0F 01 /2",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"LIDT",		"mem",						"0F 01 /3",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"LLDT",		"r/m16",					"0F 00 /2",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"LMSW",		"r/m16",					"0F 01 /6",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"LOADALL",		"",							"0F 07",			CT_CPU_386 | CT_CPU_UNDOC},
-//	{"LOADALL286",	"",							"0F 05",			CT_CPU_286 | CT_CPU_UNDOC},
-	{"LODSB",		"",							"AC",				CT_CPU_8086},
-	{"LODSW",		"",							"po AD",			CT_CPU_8086},
-	{"LODSD",		"",							"po AD",			CT_CPU_386},
-	{"LOOP",		"imm",						"E2 -b",			CT_CPU_8086},
-	{"LOOP",		"imm,CX",					"pa E2 -b",			CT_CPU_8086},
-	{"LOOP",		"imm,ECX",					"pa E2 -b",			CT_CPU_386},
-	{"LOOPE",		"imm",						"E1 -b",			CT_CPU_8086},
-	{"LOOPE",		"imm,CX",					"pa E1 -b",			CT_CPU_8086},
-	{"LOOPE",		"imm,ECX",					"pa E1 -b",			CT_CPU_386},
-	{"LOOPZ",		"imm",						"E1 -b",			CT_CPU_8086},
-	{"LOOPZ",		"imm,CX",					"pa E1 -b",			CT_CPU_8086},
-	{"LOOPZ",		"imm,ECX",					"pa E1 -b",			CT_CPU_386},
-	{"LOOPNE",		"imm",						"E0 -b",			CT_CPU_8086},
-	{"LOOPNE",		"imm,CX",					"pa E0 -b",			CT_CPU_8086},
-	{"LOOPNE",		"imm,ECX",					"pa E0 -b",			CT_CPU_386},
-	{"LOOPNZ",		"imm",						"E0 -b",			CT_CPU_8086},
-	{"LOOPNZ",		"imm,CX",					"pa E0 -b",			CT_CPU_8086},
-	{"LOOPNZ",		"imm,ECX",					"pa E0 -b",			CT_CPU_386},
-//	{"LSL",			"reg16,r/m16",				"po 0F 03 /r",		CT_CPU_286 | CT_CPU_PRIV},
-//	{"LSL",			"reg32,r/m32",				"po 0F 03 /r",		CT_CPU_286 | CT_CPU_PRIV},
-//	{"LTR",			"r/m16",					"0F 00 /3",			CT_CPU_286 | CT_CPU_PRIV},
-	{"MASKMOVQ",	"mmreg,mmreg",				"0F F7 /r",			CT_CPU_KATMAI},
-//	{"MAXPS",		"xmmreg,r/m128",			"0F 5F /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"MAXSS",		"xmmreg,r/m128",			"p3 0F 5F /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"MINPS",		"xmmreg,r/m128",			"0F 5D /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"MINSS",		"xmmreg,r/m128",			"p3 0F 5D /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOV",			"r/m8,reg8",				"88 /r",			CT_CPU_8086},
-	{"MOV",			"r/m16,reg16",				"po 89 /r",			CT_CPU_8086},
-	{"MOV",			"r/m32,reg32",				"po 89 /r",			CT_CPU_386},
-	{"MOV",			"reg8,r/m8",				"8A /r",			CT_CPU_8086},
-	{"MOV",			"reg16,r/m16",				"po 8B /r",			CT_CPU_8086},
-	{"MOV",			"reg32,r/m32",				"po 8B /r",			CT_CPU_386},
-	{"MOV",			"reg8,imm8",				"B0 +r ib",			CT_CPU_8086},
-	{"MOV",			"reg16,imm16",				"po B8 +r iw",		CT_CPU_8086},
-	{"MOV",			"reg32,imm32",				"po B8 +r id",		CT_CPU_386},
-	{"MOV",			"r/m8,imm8",				"C6 /0 ib",			CT_CPU_8086},
-	{"MOV",			"r/m16,imm16",				"po C7 /0 iw",		CT_CPU_8086},
-	{"MOV",			"r/m32,imm32",				"po C7 /0 id",		CT_CPU_386},
-//	{"MOV",			"AL,memoffs8",				"A0 id",			CT_CPU_8086},
-//	{"MOV",			"AX,memoffs16",				"po A1 id",			CT_CPU_8086},
-//	{"MOV",			"EAX,memoffs32",			"po A1 id",			CT_CPU_386},
-//	{"MOV",			"memoffs8,AL",				"A2 id",			CT_CPU_8086},
-//	{"MOV",			"memoffs16,AX",				"po A3 id",			CT_CPU_8086},
-//	{"MOV",			"memoffs32,EAX",			"po A3 id",			CT_CPU_386},
-//	{"MOV",			"r/m16,segreg",				"po 8C /r",			CT_CPU_8086},
-//	{"MOV",			"r/m32,segreg",				"po 8C /r",			CT_CPU_386},
-//	{"MOV",			"segreg,r/m16",				"po 8E /r",			CT_CPU_8086},
-//	{"MOV",			"segreg,r/m32",				"po 8E /r",			CT_CPU_386},
-//	{"MOV",			"reg32,CR0/2/3/4",			"0F 20 /r",			CT_CPU_386},
-//	{"MOV",			"reg32,DR0/1/2/3/6/7",		"0F 21 /r",			CT_CPU_386},
-//	{"MOV",			"reg32,TR3/4/5/6/7",		"0F 24 /r",			CT_CPU_386},
-//	{"MOV",			"CR0/2/3/4,reg32",			"0F 22 /r",			CT_CPU_386},
-//	{"MOV",			"DR0/1/2/3/6/7,reg32",		"0F 23 /r",			CT_CPU_386},
-//	{"MOV",			"TR3/4/5/6/7,reg32",		"0F 26 /r",			CT_CPU_386},
-	{"MOVAPS",		"xmmreg,r/m128",			"0F 28 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVAPS",		"r/m128,xmmreg",			"0F 29 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVD",		"mmreg,r/m32",				"0F 6E /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"MOVD",		"r/m32,mmreg",				"0F 7E /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"MOVHLPS",		"xmmreg,xmmreg",			"0F 12 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVHPS",		"xmmreg,mem64",				"0F 16 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVHPS",		"mem64,xmmreg",				"0F 17 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVHPS",		"xmmreg,xmmreg",			"0F 16 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVLHPS",		"xmmreg,xmmreg",			"0F 16 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVLPS",		"xmmreg,mem64",				"0F 12 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVLPS",		"mem64,xmmreg",				"0F 13 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVLPS",		"xmmreg,xmmreg",			"0F 12 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVMSKPS",	"reg32,xmmreg",				"0F 50 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVNTPS",		"mem128,xmmreg",			"0F 2B /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVNTQ",		"mem64,mmreg",				"0F E7 /r",			CT_CPU_KATMAI},
-	{"MOVQ",		"mmreg,r/m64",				"0F 6F /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"MOVQ",		"r/m64,mmreg",				"0F 7F /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"MOVSB",		"",							"A4",				CT_CPU_8086},
-	{"MOVSW",		"",							"po A5",			CT_CPU_8086},
-	{"MOVSD",		"",							"po A5",			CT_CPU_386},
-	{"MOVSS",		"xmmreg,xmmreg/mem32",		"p3 0F 10 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVSS",		"xmmreg/mem32,xmmreg",		"p3 0F 11 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVSX",		"reg16,r/m8",				"po 0F BE /r",		CT_CPU_386},
-	{"MOVSX",		"reg32,r/m8",				"po 0F BE /r",		CT_CPU_386},
-	{"MOVSX",		"reg32,r/m16",				"po 0F BF /r",		CT_CPU_386},
-	{"MOVZX",		"reg16,r/m8",				"po 0F B6 /r",		CT_CPU_386},
-	{"MOVZX",		"reg32,r/m8",				"po 0F B6 /r",		CT_CPU_386},
-	{"MOVZX",		"reg32,r/m16",				"po 0F B7 /r",		CT_CPU_386},
-	{"MOVUPS",		"xmmreg,r/m128",			"0F 10 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MOVUPS",		"r/m128,xmmreg",			"0F 11 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MUL",			"BYTE r/m8",				"F6 /4",			CT_CPU_8086},
-	{"MUL",			"WORD r/m16",				"po F7 /4",			CT_CPU_8086},
-	{"MUL",			"DWORD r/m32",				"po F7 /4",			CT_CPU_386},
-	{"MULPS",		"xmmreg,r/m128",			"0F 59 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"MULSS",		"xmmreg,xmmreg/mem32",		"p3 0F 59 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"NEG",			"BYTE r/m8",				"F6 /3",			CT_CPU_8086},
-	{"NEG",			"WORD r/m16",				"po F7 /3",			CT_CPU_8086},
-	{"NEG",			"DWORD r/m32",				"po F7 /3",			CT_CPU_386},
-	{"NOT",			"BYTE r/m8",				"F6 /2",			CT_CPU_8086},
-	{"NOT",			"WORD r/m16",				"po F7 /2",			CT_CPU_8086},
-	{"NOT",			"DWORD r/m32",				"po F7 /2",			CT_CPU_386},
-	{"NOP",			"",							"90",				CT_CPU_8086},
-	{"OR",			"r/m8,reg8",				"08 /r",			CT_CPU_8086},
-	{"OR",			"r/m16,reg16",				"po 09 /r",			CT_CPU_8086},
-	{"OR",			"r/m32,reg32",				"po 09 /r",			CT_CPU_386},
-	{"OR",			"reg8,r/m8",				"0A /r",			CT_CPU_8086},
-	{"OR",			"reg16,r/m16",				"po 0B /r",			CT_CPU_8086},
-	{"OR",			"reg32,r/m32",				"po 0B /r",			CT_CPU_386},
-	{"OR",			"r/m8,imm8",				"80 /1 ib",			CT_CPU_8086},
-	{"OR",			"r/m16,imm16",				"po 81 /1 iw",		CT_CPU_8086},
-	{"OR",			"r/m32,imm32",				"po 81 /1 id",		CT_CPU_386},
-	{"OR",			"r/m16,imm8",				"po 83 /1 ib",		CT_CPU_8086},
-	{"OR",			"r/m32,imm8",				"po 83 /1 ib",		CT_CPU_386},
-	{"OR",			"AL,imm8",					"0C ib",			CT_CPU_8086},
-	{"OR",			"AX,imm16",					"po 0D iw",			CT_CPU_8086},
-	{"OR",			"EAX,imm32",				"po 0D id",			CT_CPU_386},
-	{"ORPS",		"xmmreg,r/m128",			"0F 56 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"OUT",			"imm8,AL",					"E6 ib",			CT_CPU_8086},
-	{"OUT",			"imm8,AX",					"po E7 ib",			CT_CPU_8086},
-	{"OUT",			"imm8,EAX",					"po E7 ib",			CT_CPU_386},
-	{"OUT",			"DX,AL",					"EE",				CT_CPU_8086},
-	{"OUT",			"DX,AX",					"po EF",			CT_CPU_8086},
-	{"OUT",			"DX,EAX",					"po EF",			CT_CPU_386},
-	{"OUTSB",		"",							"6E",				CT_CPU_186},
-	{"OUTSW",		"",							"po 6F",			CT_CPU_186},
-	{"OUTSD",		"",							"po 6F",			CT_CPU_386},
-	{"PACKSSDW",	"mmreg,r/m64",				"0F 6B /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PACKSSWB",	"mmreg,r/m64",				"0F 63 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PACKUSWB",	"mmreg,r/m64",				"0F 67 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDB",		"mmreg,r/m64",				"0F FC /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDW",		"mmreg,r/m64",				"0F FD /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDD",		"mmreg,r/m64",				"0F FE /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDSB",		"mmreg,r/m64",				"0F EC /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDSW",		"mmreg,r/m64",				"0F ED /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDUSB",		"mmreg,r/m64",				"0F DC /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDUSW",		"mmreg,r/m64",				"0F DD /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PADDSIW",		"mmreg,r/m64",				"0F 51 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PAND",		"mmreg,r/m64",				"0F DB /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PANDN",		"mmreg,r/m64",				"0F DF /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PAVEB",		"mmreg,r/m64",				"0F 50 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PAVGB",		"mmreg,r/m64",				"0F E0 /r",			CT_CPU_KATMAI},
-	{"PAVGW",		"mmreg,r/m64",				"0F E3 /r",			CT_CPU_KATMAI},
-	{"PAVGUSB",		"mmreg,r/m64",				"0F 0F /r BF",		CT_CPU_3DNOW},
-	{"PCMPEQB",		"mmreg,r/m64",				"0F 74 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PCMPEQW",		"mmreg,r/m64",				"0F 75 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PCMPEQD",		"mmreg,r/m64",				"0F 76 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PCMPGTB",		"mmreg,r/m64",				"0F 64 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PCMPGTW",		"mmreg,r/m64",				"0F 65 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PCMPGTD",		"mmreg,r/m64",				"0F 66 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PDISTIB",		"mmreg,mem64",				"0F 54 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PEXTRW",		"reg32,mmreg,imm8",			"0F C5 /r ib",		CT_CPU_KATMAI},
-	{"PF2ID",		"mmreg,r/m64",				"0F 0F /r 1D",		CT_CPU_3DNOW},
-	{"PF2IW",		"mmreg,r/m64",				"0F 0F /r 1C",		CT_CPU_ATHLON},
-	{"PFACC",		"mmreg,r/m64",				"0F 0F /r AE",		CT_CPU_3DNOW},
-	{"PFADD",		"mmreg,r/m64",				"0F 0F /r 9E",		CT_CPU_3DNOW},
-	{"PFCMPEQ",		"mmreg,r/m64",				"0F 0F /r B0",		CT_CPU_3DNOW},
-	{"PFCMPGE",		"mmreg,r/m64",				"0F 0F /r 90",		CT_CPU_3DNOW},
-	{"PFCMPGT",		"mmreg,r/m64",				"0F 0F /r A0",		CT_CPU_3DNOW},
-	{"PFMAX",		"mmreg,r/m64",				"0F 0F /r A4",		CT_CPU_3DNOW},
-	{"PFMIN",		"mmreg,r/m64",				"0F 0F /r 94",		CT_CPU_3DNOW},
-	{"PFMUL",		"mmreg,r/m64",				"0F 0F /r B4",		CT_CPU_3DNOW},
-	{"PFNACC",		"mmreg,r/m64",				"0F 0F /r 8A",		CT_CPU_ATHLON},
-	{"PFPNACC",		"mmreg,r/m64",				"0F 0F /r 8E",		CT_CPU_ATHLON},
-	{"PFRCP",		"mmreg,r/m64",				"0F 0F /r 96",		CT_CPU_3DNOW},
-	{"PFRCPIT1",	"mmreg,r/m64",				"0F 0F /r A6",		CT_CPU_3DNOW},
-	{"PFRCPIT2",	"mmreg,r/m64",				"0F 0F /r B6",		CT_CPU_3DNOW},
-	{"PFRSQIT1",	"mmreg,r/m64",				"0F 0F /r A7",		CT_CPU_3DNOW},
-	{"PFRSQRT",		"mmreg,r/m64",				"0F 0F /r 97",		CT_CPU_3DNOW},
-	{"PFSUB",		"mmreg,r/m64",				"0F 0F /r 9A",		CT_CPU_3DNOW},
-	{"PFSUBR",		"mmreg,r/m64",				"0F 0F /r AA",		CT_CPU_3DNOW},
-	{"PI2FD",		"mmreg,r/m64",				"0F 0F /r 0D",		CT_CPU_3DNOW},
-	{"PI2FW",		"mmreg,r/m64",				"0F 0F /r 0C",		CT_CPU_ATHLON},
-	{"PINSRW",		"mmreg,r/m16,imm8",			"0F C4 /r ib",		CT_CPU_KATMAI},
-	{"PMACHRIW",	"mmreg,mem64",				"0F 5E /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMADDWD",		"mmreg,r/m64",				"0F F5 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PMAGW",		"mmreg,r/m64",				"0F 52 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMAXSW",		"mmreg,r/m64",				"0F EE /r",			CT_CPU_KATMAI},
-	{"PMAXUB",		"mmreg,r/m64",				"0F DE /r",			CT_CPU_KATMAI},
-	{"PMINSW",		"mmreg,r/m64",				"0F EA /r",			CT_CPU_KATMAI},
-	{"PMINUB",		"mmreg,r/m64",				"0F DA /r",			CT_CPU_KATMAI},
-	{"PMOVMSKB",	"reg32,mmreg",				"0F D7 /r",			CT_CPU_KATMAI},
-	{"PMULHRWA",	"mmreg,r/m64",				"0F 0F /r B7",		CT_CPU_3DNOW},
-	{"PMULHRWC",	"mmreg,r/m64",				"0F 59 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMULHRIW",	"mmreg,r/m64",				"0F 5D /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMULHUW",		"mmreg,r/m64",				"0F E4 /r",			CT_CPU_KATMAI},
-	{"PMULHW",		"mmreg,r/m64",				"0F E5 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PMULLW",		"mmreg,r/m64",				"0F D5 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PMVZB",		"mmreg,mem64",				"0F 58 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMVNZB",		"mmreg,mem64",				"0F 5A /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMVLZB",		"mmreg,mem64",				"0F 5B /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PMVGEZB",		"mmreg,mem64",				"0F 5C /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"POP",			"reg16",					"po 58 +r",			CT_CPU_8086},
-	{"POP",			"reg32",					"po 58 +r",			CT_CPU_386},
-	{"POP",			"WORD r/m16",				"po 8F /0",			CT_CPU_8086},
-	{"POP",			"DWORD r/m32",				"po 8F /0",			CT_CPU_386},
-//	{"POP",			"CS",						"0F",				CT_CPU_8086 | CT_CPU_UNDOC},
-//	{"POP",			"DS",						"1F",				CT_CPU_8086},
-//	{"POP",			"ES",						"07",				CT_CPU_8086},
-//	{"POP",			"SS",						"17",				CT_CPU_8086},
-//	{"POP",			"FS",						"0F A1",			CT_CPU_386},
-//	{"POP",			"GS",						"0F A9",			CT_CPU_386},
-	{"POPA",		"",							"61",				CT_CPU_186},
-	{"POPAW",		"",							"po 61",			CT_CPU_186},
-	{"POPAD",		"",							"po 61",			CT_CPU_386},
-	{"POPF",		"",							"9D",				CT_CPU_186},
-	{"POPFW",		"",							"po 9D",			CT_CPU_186},
-	{"POPFD",		"",							"po 9D",			CT_CPU_386},
-	{"POR",			"mmreg,r/m64",				"0F EB /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PREFETCH",	"mem",						"0F 0D /0",			CT_CPU_3DNOW},
-	{"PREFETCHW",	"mem",						"0F 0D /1",			CT_CPU_3DNOW},
-	{"PREFETCHNTA",	"mem",						"0F 18 /0",			CT_CPU_KATMAI},
-	{"PREFETCHT0",	"mem",						"0F 18 /1",			CT_CPU_KATMAI},
-	{"PREFETCHT1",	"mem",						"0F 18 /2",			CT_CPU_KATMAI},
-	{"PREFETCHT2",	"mem",						"0F 18 /3",			CT_CPU_KATMAI},
-	{"PSADBW",		"mmreg,r/m64",				"0F F6 /r",			CT_CPU_KATMAI},
-	{"PSHUFW",		"mmreg,r/m64,imm8",			"0F 70 /r ib",		CT_CPU_KATMAI},
-	{"PSLLW",		"mmreg,r/m64",				"0F F1 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSLLW",		"mmreg,imm8",				"0F 71 /6 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSLLD",		"mmreg,r/m64",				"0F F2 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSLLD",		"mmreg,imm8",				"0F 72 /6 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSLLQ",		"mmreg,r/m64",				"0F F3 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSLLQ",		"mmreg,imm8",				"0F 73 /6 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRAW",		"mmreg,r/m64",				"0F E1 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRAW",		"mmreg,imm8",				"0F 71 /4 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRAD",		"mmreg,r/m64",				"0F E2 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRAD",		"mmreg,imm8",				"0F 72 /4 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRLW",		"mmreg,r/m64",				"0F D1 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRLW",		"mmreg,imm8",				"0F 71 /2 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRLD",		"mmreg,r/m64",				"0F D2 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRLD",		"mmreg,imm8",				"0F 72 /2 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRLQ",		"mmreg,r/m64",				"0F D3 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSRLQ",		"mmreg,imm8",				"0F 73 /2 ib",		CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBB",		"mmreg,r/m64",				"0F F8 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBW",		"mmreg,r/m64",				"0F F9 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBD",		"mmreg,r/m64",				"0F FA /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBSB",		"mmreg,r/m64",				"0F E8 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBSW",		"mmreg,r/m64",				"0F E9 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBUSB",		"mmreg,r/m64",				"0F D8 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBUSW",		"mmreg,r/m64",				"0F D9 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PSUBSIW",		"mmreg,r/m64",				"0F 55 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
-	{"PSWAPD",		"mmreg,r/m64",				"0F 0F /r BB",		CT_CPU_ATHLON},
-	{"PUNPCKHBW",	"mmreg,r/m64",				"0F 68 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PUNPCKHWD",	"mmreg,r/m64",				"0F 69 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PUNPCKHDQ",	"mmreg,r/m64",				"0F 6A /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PUNPCKLBW",	"mmreg,r/m64",				"0F 60 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PUNPCKLWD",	"mmreg,r/m64",				"0F 61 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PUNPCKLDQ",	"mmreg,r/m64",				"0F 62 /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"PUSH",		"reg16",					"po 50 +r",			CT_CPU_8086},
-	{"PUSH",		"reg32",					"po 50 +r",			CT_CPU_386},
-	{"PUSH",		"WORD r/m16",				"po FF /6",			CT_CPU_8086},
-	{"PUSH",		"DWORD r/m32",				"po FF /6",			CT_CPU_386},
-//	{"PUSH",		"CS",						"0E",				CT_CPU_8086},
-//	{"PUSH",		"DS",						"1E",				CT_CPU_8086},
-//	{"PUSH",		"ES",						"06",				CT_CPU_8086},
-//	{"PUSH",		"SS",						"16",				CT_CPU_8086},
-//	{"PUSH",		"FS",						"0F A0",			CT_CPU_386},
-//	{"PUSH",		"GS",						"0F A8",			CT_CPU_386},
-	{"PUSH",		"imm8",						"6A ib",			CT_CPU_286},
-	{"PUSH",		"imm16",					"po 68 iw",			CT_CPU_286},
-	{"PUSH",		"imm32",					"po 68 id",			CT_CPU_386},
-	{"PUSHA",		"",							"60",				CT_CPU_186},
-	{"PUSHAD",		"",							"po 60",			CT_CPU_386},
-	{"PUSHAW",		"",							"po 60",			CT_CPU_186},
-	{"PUSHF",		"",							"9C",				CT_CPU_186},
-	{"PUSHFD",		"",							"po 9C",			CT_CPU_386},
-	{"PUSHFW",		"",							"po 9C",			CT_CPU_186},
-	{"PXOR",		"mmreg,r/m64",				"0F EF /r",			CT_CPU_PENT | CT_CPU_MMX},
-	{"RCL",			"r/m8,1",					"D0 /2",			CT_CPU_8086},
-	{"RCL",			"r/m8,CL",					"D2 /2",			CT_CPU_8086},
-	{"RCL",			"r/m8,imm8",				"C0 /2 ib",			CT_CPU_286},
-	{"RCL",			"r/m16,1",					"po D1 /2",			CT_CPU_8086},
-	{"RCL",			"r/m16,CL",					"po D3 /2",			CT_CPU_8086},
-	{"RCL",			"r/m16,imm8",				"po C1 /2 ib",		CT_CPU_286},
-	{"RCL",			"r/m32,1",					"po D1 /2",			CT_CPU_386},
-	{"RCL",			"r/m32,CL",					"po D3 /2",			CT_CPU_386},
-	{"RCL",			"r/m32,imm8",				"po C1 /2 ib",		CT_CPU_386},
-	{"RCR",			"r/m8,1",					"D0 /3",			CT_CPU_8086},
-	{"RCR",			"r/m8,CL",					"D2 /3",			CT_CPU_8086},
-	{"RCR",			"r/m8,imm8",				"C0 /3 ib",			CT_CPU_286},
-	{"RCR",			"r/m16,1",					"po D1 /3",			CT_CPU_8086},
-	{"RCR",			"r/m16,CL",					"po D3 /3",			CT_CPU_8086},
-	{"RCR",			"r/m16,imm8",				"po C1 /3 ib",		CT_CPU_286},
-	{"RCR",			"r/m32,1",					"po D1 /3",			CT_CPU_386},
-	{"RCR",			"r/m32,CL",					"po D3 /3",			CT_CPU_386},
-	{"RCR",			"r/m32,imm8",				"po C1 /3 ib",		CT_CPU_386},
-	{"RCPPS",		"xmmreg,r/m128",			"0F 53 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"RCPSS",		"xmmreg,xmmreg/mem32",		"p3 0F 53 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"RDMSR",		"",							"0F 32",			CT_CPU_PENT},
-	{"RDPMC",		"",							"0F 33",			CT_CPU_P6},
-//	{"RDSHR",		"",							"0F 36",			CT_CPU_P6 | CT_CPU_CYRIX | CT_CPU_SMM},
-	{"RDTSC",		"",							"0F 31",			CT_CPU_PENT},
-	{"RET",			"",							"C3",				CT_CPU_8086},
-	{"RET",			"imm16",					"C2 iw",			CT_CPU_8086},
-	{"RETF",		"",							"CB",				CT_CPU_8086},
-	{"RETF",		"imm16",					"CA iw",			CT_CPU_8086},
-	{"RETN",		"",							"C3",				CT_CPU_8086},
-	{"RETN",		"imm16",					"C2 iw",			CT_CPU_8086},
-	{"ROL",			"r/m8,1",					"D0 /0",			CT_CPU_8086},
-	{"ROL",			"r/m8,CL",					"D2 /0",			CT_CPU_8086},
-	{"ROL",			"r/m8,imm8",				"C0 /0 ib",			CT_CPU_286},
-	{"ROL",			"r/m16,1",					"po D1 /0",			CT_CPU_8086},
-	{"ROL",			"r/m16,CL",					"po D3 /0",			CT_CPU_8086},
-	{"ROL",			"r/m16,imm8",				"po C1 /0 ib",		CT_CPU_286},
-	{"ROL",			"r/m32,1",					"po D1 /0",			CT_CPU_386},
-	{"ROL",			"r/m32,CL",					"po D3 /0",			CT_CPU_386},
-	{"ROL",			"r/m32,imm8",				"po C1 /0 ib",		CT_CPU_386},
-	{"ROR",			"r/m8,1",					"D0 /1",			CT_CPU_8086},
-	{"ROR",			"r/m8,CL",					"D2 /1",			CT_CPU_8086},
-	{"ROR",			"r/m8,imm8",				"C0 /1 ib",			CT_CPU_286},
-	{"ROR",			"r/m16,1",					"po D1 /1",			CT_CPU_8086},
-	{"ROR",			"r/m16,CL",					"po D3 /1",			CT_CPU_8086},
-	{"ROR",			"r/m16,imm8",				"po C1 /1 ib",		CT_CPU_286},
-	{"ROR",			"r/m32,1",					"po D1 /1",			CT_CPU_386},
-	{"ROR",			"r/m32,CL",					"po D3 /1",			CT_CPU_386},
-	{"ROR",			"r/m32,imm8",				"po C1 /1 ib",		CT_CPU_386},
-//	{"RSDC",		"segreg,mem80",				"0F 79 /r",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
-//	{"RSLDT",		"mem80",					"0F 7B /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
-	{"RSM",			"",							"0F AA",			CT_CPU_PENT},
-	{"RSQRTPS",		"xmmreg,r/m128",			"0F 52 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"RSQRTSS",		"xmmreg,r/m128",			"p3 0F 52 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"RSTS",		"mem80",					"0F 7D /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
-	{"SAHF",		"",							"9E",				CT_CPU_8086},
-	{"SAL",			"r/m8,1",					"D0 /4",			CT_CPU_8086},
-	{"SAL",			"r/m8,CL",					"D2 /4",			CT_CPU_8086},
-	{"SAL",			"r/m8,imm8",				"C0 /4 ib",			CT_CPU_286},
-	{"SAL",			"r/m16,1",					"po D1 /4",			CT_CPU_8086},
-	{"SAL",			"r/m16,CL",					"po D3 /4",			CT_CPU_8086},
-	{"SAL",			"r/m16,imm8",				"po C1 /4 ib",		CT_CPU_286},
-	{"SAL",			"r/m32,1",					"po D1 /4",			CT_CPU_386},
-	{"SAL",			"r/m32,CL",					"po D3 /4",			CT_CPU_386},
-	{"SAL",			"r/m32,imm8",				"po C1 /4 ib",		CT_CPU_386},
-	{"SAR",			"r/m8,1",					"D0 /7",			CT_CPU_8086},
-	{"SAR",			"r/m8,CL",					"D2 /7",			CT_CPU_8086},
-	{"SAR",			"r/m8,imm8",				"C0 /7 ib",			CT_CPU_286},
-	{"SAR",			"r/m16,1",					"po D1 /7",			CT_CPU_8086},
-	{"SAR",			"r/m16,CL",					"po D3 /7",			CT_CPU_8086},
-	{"SAR",			"r/m16,imm8",				"po C1 /7 ib",		CT_CPU_286},
-	{"SAR",			"r/m32,1",					"po D1 /7",			CT_CPU_386},
-	{"SAR",			"r/m32,CL",					"po D3 /7",			CT_CPU_386},
-	{"SAR",			"r/m32,imm8",				"po C1 /7 ib",		CT_CPU_386},
-//	{"SALC",		"",							"D6",				CT_CPU_8086 | CT_CPU_UNDOC},
-	{"SBB",			"r/m8,reg8",				"18 /r",			CT_CPU_8086},
-	{"SBB",			"r/m16,reg16",				"po 19 /r",			CT_CPU_8086},
-	{"SBB",			"r/m32,reg32",				"po 19 /r",			CT_CPU_386},
-	{"SBB",			"reg8,r/m8",				"1A /r",			CT_CPU_8086},
-	{"SBB",			"reg16,r/m16",				"po 1B /r",			CT_CPU_8086},
-	{"SBB",			"reg32,r/m32",				"po 1B /r",			CT_CPU_386},
-	{"SBB",			"r/m8,imm8",				"80 /3 ib",			CT_CPU_8086},
-	{"SBB",			"r/m16,imm16",				"po 81 /3 iw",		CT_CPU_8086},
-	{"SBB",			"r/m32,imm32",				"po 81 /3 id",		CT_CPU_386},
-	{"SBB",			"r/m16,imm8",				"po 83 /3 ib",		CT_CPU_8086},
-	{"SBB",			"r/m32,imm8",				"po 83 /3 ib",		CT_CPU_8086},
-	{"SBB",			"AL,imm8",					"1C ib",			CT_CPU_8086},
-	{"SBB",			"AX,imm16",					"po 1D iw",			CT_CPU_8086},
-	{"SBB",			"EAX,imm32",				"po 1D id",			CT_CPU_386},
-	{"SCASB",		"",							"AE",				CT_CPU_8086},
-	{"SCASW",		"",							"po AF",			CT_CPU_8086},
-	{"SCASD",		"",							"po AF",			CT_CPU_386},
-	{"SETO",		"BYTE r/m8",				"0F 90 /2",			CT_CPU_386},
-	{"SETNO",		"BYTE r/m8",				"0F 91 /2",			CT_CPU_386},
-	{"SETB",		"BYTE r/m8",				"0F 92 /2",			CT_CPU_386},
-	{"SETC",		"BYTE r/m8",				"0F 92 /2",			CT_CPU_386},
-	{"SETNEA",		"BYTE r/m8",				"0F 92 /2",			CT_CPU_386},
-	{"SETAE",		"BYTE r/m8",				"0F 93 /2",			CT_CPU_386},
-	{"SETNB",		"BYTE r/m8",				"0F 93 /2",			CT_CPU_386},
-	{"SETNC",		"BYTE r/m8",				"0F 93 /2",			CT_CPU_386},
-	{"SETE",		"BYTE r/m8",				"0F 94 /2",			CT_CPU_386},
-	{"SETZ",		"BYTE r/m8",				"0F 94 /2",			CT_CPU_386},
-	{"SETNE",		"BYTE r/m8",				"0F 95 /2",			CT_CPU_386},
-	{"SETNZ",		"BYTE r/m8",				"0F 95 /2",			CT_CPU_386},
-	{"SETBE",		"BYTE r/m8",				"0F 96 /2",			CT_CPU_386},
-	{"SETNA",		"BYTE r/m8",				"0F 96 /2",			CT_CPU_386},
-	{"SETA",		"BYTE r/m8",				"0F 97 /2",			CT_CPU_386},
-	{"SETNBE",		"BYTE r/m8",				"0F 97 /2",			CT_CPU_386},
-	{"SETS",		"BYTE r/m8",				"0F 98 /2",			CT_CPU_386},
-	{"SETNS",		"BYTE r/m8",				"0F 99 /2",			CT_CPU_386},
-	{"SETP",		"BYTE r/m8",				"0F 9A /2",			CT_CPU_386},
-	{"SETPE",		"BYTE r/m8",				"0F 9A /2",			CT_CPU_386},
-	{"SETNP",		"BYTE r/m8",				"0F 9B /2",			CT_CPU_386},
-	{"SETPO",		"BYTE r/m8",				"0F 9B /2",			CT_CPU_386},
-	{"SETL",		"BYTE r/m8",				"0F 9C /2",			CT_CPU_386},
-	{"SETNGE",		"BYTE r/m8",				"0F 9C /2",			CT_CPU_386},
-	{"SETGE",		"BYTE r/m8",				"0F 9D /2",			CT_CPU_386},
-	{"SETNL",		"BYTE r/m8",				"0F 9D /2",			CT_CPU_386},
-	{"SETLE",		"BYTE r/m8",				"0F 9E /2",			CT_CPU_386},
-	{"SETNG",		"BYTE r/m8",				"0F 9E /2",			CT_CPU_386},
-	{"SETG",		"BYTE r/m8",				"0F 9F /2",			CT_CPU_386},
-	{"SETNLE",		"BYTE r/m8",				"0F 9F /2",			CT_CPU_386},
-	{"SFENCE",		"",							"0F AE /7",			CT_CPU_KATMAI},
-//	{"SGDT",		"mem",						"0F 01 /0",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"SIDT",		"mem",						"0F 01 /1",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"SLDT",		"r/m16",					"0F 00 /0",			CT_CPU_286 | CT_CPU_PRIV},
-	{"SHL",			"BYTE r/m8,1",				"D0 /4",			CT_CPU_8086},
-	{"SHL",			"BYTE r/m8,CL",				"D2 /4",			CT_CPU_8086},
-	{"SHL",			"BYTE r/m8,imm8",			"C0 /4 ib",			CT_CPU_286},
-	{"SHL",			"WORD r/m16,1",				"po D1 /4",			CT_CPU_8086},
-	{"SHL",			"WORD r/m16,CL",			"po D3 /4",			CT_CPU_8086},
-	{"SHL",			"WORD r/m16,imm8",			"po C1 /4 ib",		CT_CPU_286},
-	{"SHL",			"DWORD r/m32,1",			"po D1 /4",			CT_CPU_386},
-	{"SHL",			"DWORD r/m32,CL",			"po D3 /4",			CT_CPU_386},
-	{"SHL",			"DWORD r/m32,imm8",			"po C1 /4 ib",		CT_CPU_386},
-	{"SHR",			"BYTE r/m8,1",				"D0 /5",			CT_CPU_8086},
-	{"SHR",			"BYTE r/m8,CL",				"D2 /5",			CT_CPU_8086},
-	{"SHR",			"BYTE r/m8,imm8",			"C0 /5 ib",			CT_CPU_286},
-	{"SHR",			"WORD r/m16,1",				"po D1 /5",			CT_CPU_8086},
-	{"SHR",			"WORD r/m16,CL",			"po D3 /5",			CT_CPU_8086},
-	{"SHR",			"WORD r/m16,imm8",			"po C1 /5 ib",		CT_CPU_286},
-	{"SHR",			"DWORD r/m32,1",			"po D1 /5",			CT_CPU_386},
-	{"SHR",			"DWORD r/m32,CL",			"po D3 /5",			CT_CPU_386},
-	{"SHR",			"DWORD r/m32,imm8",			"po C1 /5 ib",		CT_CPU_386},
-	{"SHLD",		"WORD r/m16,reg16,imm8",	"po 0F A4 /r ib",	CT_CPU_386},
-	{"SHLD",		"DWORD r/m32,reg32,imm8",	"po 0F A4 /r ib",	CT_CPU_386},
-	{"SHLD",		"WORD r/m16,reg16,CL",		"po 0F A5 /r",		CT_CPU_386},
-	{"SHLD",		"DWORD r/m32,reg32,CL",		"po 0F A5 /r",		CT_CPU_386},
-	{"SHRD",		"WORD r/m16,reg16,imm8",	"po 0F AC /r ib",	CT_CPU_386},
-	{"SHRD",		"DWORD r/m32,reg32,imm8",	"po 0F AC /r ib",	CT_CPU_386},
-	{"SHRD",		"WORD r/m16,reg16,CL",		"po 0F AD /r",		CT_CPU_386},
-	{"SHRD",		"DWORD r/m32,reg32,CL",		"po 0F AD /r",		CT_CPU_386},
-	{"SHUFPS",		"xmmreg,r/m128,imm8",		"0F C6 /r ib",		CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"SMI",			"",							"F1",				CT_CPU_386 | CT_CPU_UNDOC},
-	{"SMINT",		"",							"0F 38",			CT_CPU_P6 | CT_CPU_CYRIX},
-	{"SMINTOLD",	"",							"0F 7E",			CT_CPU_486 | CT_CPU_CYRIX},
-//	{"SMSW",		"r/m16",					"0F 01 /4",			CT_CPU_286 | CT_CPU_PRIV},
-	{"SQRTPS",		"xmmreg,r/m128",			"0F 51 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"SQRTSS",		"xmmreg,xmmreg/mem32",		"p3 0F 51 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-	{"STC",			"",							"F9",				CT_CPU_8086},
-	{"STD",			"",							"FD",				CT_CPU_8086},
-	{"STI",			"",							"FB",				CT_CPU_8086},
-	{"STMXCSR",		"mem32",					"0F AE /3",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"STOSB",		"",							"AA",				CT_CPU_8086},
-	{"STOSW",		"",							"po AB",			CT_CPU_8086},
-	{"STOSD",		"",							"po AB",			CT_CPU_386},
-//	{"STR",			"r/m16",					"0F 00 /1",			CT_CPU_286 | CT_CPU_PRIV},
-	{"SUB",			"r/m8,reg8",				"28 /r",			CT_CPU_8086},
-	{"SUB",			"r/m16,reg16",				"po 29 /r",			CT_CPU_8086},
-	{"SUB",			"r/m32,reg32",				"po 29 /r",			CT_CPU_386},
-	{"SUB",			"reg8,r/m8",				"2A /r",			CT_CPU_8086},
-	{"SUB",			"reg16,r/m16",				"po 2B /r",			CT_CPU_8086},
-	{"SUB",			"reg32,r/m32",				"po 2B /r",			CT_CPU_386},
-	{"SUB",			"r/m8,imm8",				"80 /5 ib",			CT_CPU_8086},
-	{"SUB",			"r/m16,imm16",				"po 81 /5 iw",		CT_CPU_8086},
-	{"SUB",			"r/m32,imm32",				"po 81 /5 id",		CT_CPU_386},
-	{"SUB",			"r/m16,imm8",				"po 83 /5 ib",		CT_CPU_8086},
-	{"SUB",			"r/m32,imm8",				"po 83 /5 ib",		CT_CPU_386},
-	{"SUB",			"AL,imm8",					"2C ib",			CT_CPU_8086},
-	{"SUB",			"AX,imm16",					"po 2D iw",			CT_CPU_8086},
-	{"SUB",			"EAX,imm32",				"po 2D id",			CT_CPU_386},
-	{"SUBPS",		"xmmreg,r/m128",			"0F 5C /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"SUBSS",		"xmmreg,xmmreg/mem32",		"p3 0F 5C /r",		CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"SVDC",		"mem80,segreg",				"0F 78 /r",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
-//	{"SVLDT",		"mem80",					"0F 7A /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
-//	{"SVTS",		"mem80",					"0F 7C /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
-//	{"SYSCALL",		"",							"0F 05",			CT_CPU_P6 | CT_CPU_AMD},
-	{"SYSENTER",	"",							"0F 34",			CT_CPU_P6},
-//	{"SYSEXIT",		"",							"0F 36",			CT_CPU_P6 | CT_CPU_PRIV},
-//	{"SYSRET",		"",							"0F 07",			CT_CPU_P6 | CT_CPU_AMD | CT_CPU_PRIV},
-	{"TEST",		"r/m8,reg8",				"84 /r",			CT_CPU_8086},
-	{"TEST",		"r/m16,reg16",				"po 85 /r",			CT_CPU_8086},
-	{"TEST",		"r/m32,reg32",				"po 85 /r",			CT_CPU_386},
-	{"TEST",		"r/m8,imm8",				"F6 /7 ib",			CT_CPU_8086},
-	{"TEST",		"r/m16,imm16",				"po F7 /7 iw",		CT_CPU_8086},
-	{"TEST",		"r/m32,imm32",				"po F7 /7 id",		CT_CPU_386},
-	{"TEST",		"AL,imm8",					"A8 ib",			CT_CPU_8086},
-	{"TEST",		"AX,imm16",					"po A9 iw",			CT_CPU_8086},
-	{"TEST",		"EAX,imm32",				"po A9 id",			CT_CPU_386},
-	{"UCOMISS",		"xmmreg,xmmreg/mem32",		"0F 2E /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"UD2",			"",							"0F 0B",			CT_CPU_286},
-//	{"UMOV",		"r/m8,reg8",				"0F 10 /r",			CT_CPU_386 | CT_CPU_UNDOC},
-//	{"UMOV",		"r/m16,reg16",				"po 0F 11 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-//	{"UMOV",		"r/m32,reg32",				"po 0F 11 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-//	{"UMOV",		"reg8,r/m8",				"0F 12 /r",			CT_CPU_386 | CT_CPU_UNDOC},
-//	{"UMOV",		"reg16,r/m16",				"po 0F 13 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-//	{"UMOV",		"reg32,r/m32",				"po 0F 13 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-	{"UNPCKHPS",	"xmmreg,r/m128",			"0F 15 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-	{"UNPCKLPS",	"xmmreg,r/m128",			"0F 14 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
-//	{"VERR",		"r/m16",					"0F 00 /4",			CT_CPU_286 | CT_CPU_PRIV},
-//	{"VERW",		"r/m16",					"0F 00 /5",			CT_CPU_286 | CT_CPU_PRIV},
-	{"WAIT",		"",							"9B",				CT_CPU_8086},
-	{"WBINVD",		"",							"0F 09",			CT_CPU_486},
-	{"WRMSR",		"",							"0F 30",			CT_CPU_PENT},
-//	{"WRSHR",		"",							"0F 37",			CT_CPU_P6 | CT_CPU_CYRIX | CT_CPU_SMM},
-	{"XADD",		"r/m8,reg8",				"0F C0 /r",			CT_CPU_486},
-	{"XADD",		"r/m16,reg16",				"po 0F C1 /r",		CT_CPU_486},
-	{"XADD",		"r/m32,reg32",				"po 0F C1 /r",		CT_CPU_486},
-//	{"XBTS",		"reg16,r/m16",				"po 0F A6 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-//	{"XBTS",		"reg32,r/m32",				"po 0F A6 /r",		CT_CPU_386 | CT_CPU_UNDOC},
-	{"XCHG",		"reg8,r/m8",				"86 /r",			CT_CPU_8086},
-	{"XCHG",		"reg16,r/m8",				"po 87 /r",			CT_CPU_8086},
-	{"XCHG",		"reg32,r/m32",				"po 87 /r",			CT_CPU_386},
-	{"XCHG",		"r/m8,reg8",				"86 /r",			CT_CPU_8086},
-	{"XCHG",		"r/m16,reg16",				"po 87 /r",			CT_CPU_8086},
-	{"XCHG",		"r/m32,reg32",				"po 87 /r",			CT_CPU_386},
-	{"XCHG",		"AX,reg16",					"po 90 +r",			CT_CPU_8086},
-	{"XCHG",		"EAX,reg32",				"po 90 +r",			CT_CPU_386},
-	{"XCHG",		"reg16,AX",					"po 90 +r",			CT_CPU_8086},
-	{"XCHG",		"reg32,EAX",				"po 90 +r",			CT_CPU_386},
-	{"XLATB",		"",							"D7",				CT_CPU_8086},
-	{"XOR",			"r/m8,reg8",				"30 /r",			CT_CPU_8086},
-	{"XOR",			"r/m16,reg16",				"po 31 /r",			CT_CPU_8086},
-	{"XOR",			"r/m32,reg32",				"po 31 /r",			CT_CPU_386},
-	{"XOR",			"reg8,r/m8",				"32 /r",			CT_CPU_8086},
-	{"XOR",			"reg16,r/m16",				"po 33 /r",			CT_CPU_8086},
-	{"XOR",			"reg32,r/m32",				"po 33 /r",			CT_CPU_386},
-	{"XOR",			"r/m8,imm8",				"80 /6 ib",			CT_CPU_8086},
-	{"XOR",			"r/m16,imm16",				"po 81 /6 iw",		CT_CPU_8086},
-	{"XOR",			"r/m32,imm32",				"po 81 /6 id",		CT_CPU_386},
-	{"XOR",			"r/m16,imm8",				"po 83 /6 ib",		CT_CPU_8086},
-	{"XOR",			"r/m32,imm8",				"po 83 /6 ib",		CT_CPU_386},
-	{"XOR",			"AL,imm8",					"34 ib",			CT_CPU_8086},
-	{"XOR",			"AX,imm16",					"po 35 iw",			CT_CPU_8086},
-	{"XOR",			"EAX,imm32",				"po 35 id",			CT_CPU_386},
-	{"XORPS",		"xmmreg,r/m128",			"0F 57 /r",			CT_CPU_KATMAI | CT_CPU_SSE}
-};
-
-
-static int cinstset_compare_syntax(const void *element1, const void *element2)
-{
-	return stricmp(((CInstSyntax*)element1)->mnemonic, 
-		((CInstSyntax*)element2)->mnemonic);
-}
-
-static int cinstset_compare_entry(const void *mnemonic, const void *entry)
-{
-	return stricmp((char*)mnemonic, ((CInstructionEntry*)entry)->mnemonic);
-}
-
-int cinstset_num_instructions(void)
-{
-	return sizeof(cinstruction_set) / sizeof(CInstSyntax);
-}
-
-int cinstset_num_mnemonics(void)
-{
-	static int num = 0;
-	int i;
-	if (!num) {
-		if (cinstset_num_instructions() != 0) {
-			num = 1;
-		}
-		for(i = 0; i + 1 < cinstset_num_instructions(); i++) {
-			if (stricmp(cinstruction_set[i].mnemonic, 
-				cinstruction_set[i + 1].mnemonic) != 0) {
-				num++;
-			}
-		}
-	}
-
-	return num;
-}
-
-static void cinstset_matrix_sort(void)
-{
-	static int inited = 0;
-	if (inited == 0) {
-		inited = 1;
-		qsort(cinstruction_set, cinstset_num_instructions(), 
-			sizeof(CInstSyntax), cinstset_compare_syntax);
-	}
-}
-
-CInstructionSet *cinstset_create(void)
-{
-	CInstructionSet *self;
-	int i, j;
-
-	cinstset_matrix_sort();
-
-	self = (CInstructionSet*)malloc(sizeof(CInstructionSet));
-	assert(self);
-
-	self->instructionMap = (CInstructionEntry*)malloc(
-		sizeof(CInstructionEntry) * cinstset_num_mnemonics());
-
-	for (i = 0, j = 0; i < cinstset_num_instructions(); ) {
-		self->instructionMap[j].mnemonic = cinstruction_set[i].mnemonic;
-		self->instructionMap[j].instruction = 
-			cinst_create(&cinstruction_set[i++]);
-
-		while (i < cinstset_num_instructions() && 
-			stricmp(cinstruction_set[i - 1].mnemonic, 
-			cinstruction_set[i].mnemonic) == 0) {
-			cinst_attach_new(self->instructionMap[j].instruction, 
-				&cinstruction_set[i++]);
-		}
-
-		j++;
-	}
-	assert(j == cinstset_num_mnemonics());
-	return self;
-}
-
-void cinstset_release(CInstructionSet *self)
-{
-	int i;
-	assert(self);
-	for (i = 0; i < cinstset_num_mnemonics(); i++) {
-		cinst_release(self->instructionMap[i].instruction);
-	}
-	free(self->instructionMap);
-	self->instructionMap = NULL;
-	free(self);
-}
-
-
-CInstruction *cinstset_query(const CInstructionSet *self, const char *name)
-{
-	CInstructionEntry *entry;
-	assert(self && name);
-	assert(self->instructionMap);
-
-	entry = (CInstructionEntry*)bsearch(name, self->instructionMap, 
-		cinstset_num_mnemonics(), sizeof(CInstructionEntry), 
-		cinstset_compare_entry);
-
-	if (entry == NULL) {
-		fprintf(stderr, "Unrecognised mnemonic '%s'\n", name);
-		fflush(stderr);
-		return NULL;
-	}
-
-	cinst_reset_match(entry->instruction);
-
-	return entry->instruction;
-}
-
-
+//=====================================================================
+//
+// cinstset.c - 
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cinstset.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4996)
+#endif
+
+const CInstSyntax cinstruction_set[] = 
+{
+	/*
+		Encoding syntax:
+		----------------
+		+r Add register value to opcode
+		/# Value for Mod R/M register field encoding
+		/r Effective address encoding
+		ib Byte immediate
+		iw Word immediate
+		id Dword immediate
+		-b Byte relative address
+		-i Word or dword relative address
+		p0 LOCK instruction prefix (F0h)
+		p2 REPNE/REPNZ instruction prefix (F2h)
+		p3 REP/REPE/REPZ instruction prefix (F3h) (also SSE prefix)
+		po Offset override prefix (66h)
+		pa Address override prefix (67h)
+		pw REX.W prefix, 64-bit operand size (64-bit mode)
+		io Dword immediate, qword with REX.W (MOV reg64,imm64)
+		v0 VEX prefix, v1-v3 also puts that operand in VEX.vvvv
+		vl VEX.L, 256-bit vectors
+		is Register of the fourth operand in immediate bits 7-4
+		x0 EVEX prefix, x1-x3 also puts that operand in EVEX.vvvv
+		xl EVEX.L'L, 512-bit vectors
+		t4 Dword elements for {1toN} broadcast, t8 qword elements
+	*/
+
+	{"AAA",			"",							"37",				CT_CPU_8086 | CT_CPU_LEGACY},
+	{"AAS",			"",							"3F",				CT_CPU_8086 | CT_CPU_LEGACY},
+	{"AAD",			"",							"D5 0A",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"AAD",			"imm",						"D5 ib",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"AAM",			"",							"D4 0A",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"AAM",			"imm",						"D4 ib",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"ADC",			"r/m8,reg8",				"10 /r",			CT_CPU_8086},
+	{"ADC",			"r/m16,reg16",				"po 11 /r",			CT_CPU_8086},
+	{"ADC",			"r/m32,reg32",				"po 11 /r",			CT_CPU_386},
+	{"ADC",			"reg8,r/m8",				"12 /r",			CT_CPU_8086},
+	{"ADC",			"reg16,r/m16",				"po 13 /r",			CT_CPU_8086},
+	{"ADC",			"reg32,r/m32",				"po 13 /r",			CT_CPU_386},
+	{"ADC",			"r/m8,imm8",				"80 /2 ib",			CT_CPU_8086},
+	{"ADC",			"r/m16,imm16",				"po 81 /2 iw",		CT_CPU_8086},
+	{"ADC",			"r/m32,imm32",				"po 81 /2 id",		CT_CPU_386},
+	{"ADC",			"r/m16,imm8",				"po 83 /2 ib",		CT_CPU_8086},
+	{"ADC",			"r/m32,imm8",				"po 83 /2 ib",		CT_CPU_386},
+	{"ADC",			"AL,imm8",					"14 ib",			CT_CPU_8086},
+	{"ADC",			"AX,imm16",					"po 15 iw",			CT_CPU_8086},
+	{"ADC",			"EAX,imm32",				"po 15 id",			CT_CPU_386},
+	{"ADCX",		"reg32,r/m32",				"po 0F 38 F6 /r",	CT_CPU_ADX},
+	{"ADCX",		"reg64,reg64/mem64",		"po pw 0F 38 F6 /r",	CT_CPU_ADX | CT_CPU_X64},
+	{"ADD",			"r/m8,reg8",				"00 /r",			CT_CPU_8086},
+	{"ADD",			"r/m16,reg16",				"po 01 /r",			CT_CPU_8086},
+	{"ADD",			"r/m32,reg32",				"po 01 /r",			CT_CPU_386},
+	{"ADD",			"reg8,r/m8",				"02 /r",			CT_CPU_8086},
+	{"ADD",			"reg16,r/m16",				"po 03 /r",			CT_CPU_8086},
+	{"ADD",			"reg32,r/m32",				"po 03 /r",			CT_CPU_386},
+	{"ADD",			"r/m8,imm8",				"80 /0 ib",			CT_CPU_8086},
+	{"ADD",			"r/m16,imm16",				"po 81 /0 iw",		CT_CPU_8086},
+	{"ADD",			"r/m32,imm32",				"po 81 /0 id",		CT_CPU_386},
+	{"ADD",			"r/m16,imm8",				"po 83 /0 ib",		CT_CPU_8086},
+	{"ADD",			"r/m32,imm8",				"po 83 /0 ib",		CT_CPU_386},
+	{"ADD",			"AL,imm8",					"04 ib",			CT_CPU_8086},
+	{"ADD",			"AX,imm16",					"po 05 iw",			CT_CPU_8086},
+	{"ADD",			"EAX,imm32",				"po 05 id",			CT_CPU_386},
+	{"ADDPD",		"xmmreg,r/m128",			"po 0F 58 /r",		CT_CPU_SSE2},
+	{"ADDPS",		"xmmreg,r/m128",			"0F 58 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"ADDSD",		"xmmreg,xmmreg/mem64",		"p2 0F 58 /r",		CT_CPU_SSE2},
+	{"ADDSS",		"xmmreg,xmmreg/mem32",		"p3 0F 58 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"ADOX",		"reg32,r/m32",				"p3 0F 38 F6 /r",	CT_CPU_ADX},
+	{"ADOX",		"reg64,reg64/mem64",		"p3 pw 0F 38 F6 /r",	CT_CPU_ADX | CT_CPU_X64},
+	{"AESDEC",		"xmmreg,r/m128",			"po 0F 38 DE /r",	CT_CPU_AES},
+	{"AESDECLAST",	"xmmreg,r/m128",			"po 0F 38 DF /r",	CT_CPU_AES},
+	{"AESENC",		"xmmreg,r/m128",			"po 0F 38 DC /r",	CT_CPU_AES},
+	{"AESENCLAST",	"xmmreg,r/m128",			"po 0F 38 DD /r",	CT_CPU_AES},
+	{"AESIMC",		"xmmreg,r/m128",			"po 0F 38 DB /r",	CT_CPU_AES},
+	{"AESKEYGENASSIST",	"xmmreg,r/m128,imm8",	"po 0F 3A DF /r ib",	CT_CPU_AES},
+	{"AND",			"r/m8,reg8",				"20 /r",			CT_CPU_8086},
+	{"AND",			"r/m16,reg16",				"po 21 /r",			CT_CPU_8086},
+	{"AND",			"r/m32,reg32",				"po 21 /r",			CT_CPU_386},
+	{"AND",			"reg8,r/m8",				"22 /r",			CT_CPU_8086},
+	{"AND",			"reg16,r/m16",				"po 23 /r",			CT_CPU_8086},
+	{"AND",			"reg32,r/m32",				"po 23 /r",			CT_CPU_386},
+	{"AND",			"r/m8,imm8",				"80 /4 ib",			CT_CPU_8086},
+	{"AND",			"r/m16,imm16",				"po 81 /4 iw",		CT_CPU_8086},
+	{"AND",			"r/m32,imm32",				"po 81 /4 id",		CT_CPU_386},
+	{"AND",			"r/m16,imm8",				"po 83 /4 ib",		CT_CPU_8086},
+	{"AND",			"r/m32,imm8",				"po 83 /4 ib",		CT_CPU_386},
+	{"AND",			"AL,imm8",					"24 ib",			CT_CPU_8086},
+	{"AND",			"AX,imm16",					"po 25 iw",			CT_CPU_8086},
+	{"AND",			"EAX,imm32",				"po 25 id",			CT_CPU_386},
+	{"ANDN",		"reg32,reg32,r/m32",		"v2 0F 38 F2 /r",	CT_CPU_BMI1},
+	{"ANDN",		"reg64,reg64,reg64/mem64",	"v2 pw 0F 38 F2 /r",	CT_CPU_BMI1 | CT_CPU_X64},
+	{"ANDNPD",		"xmmreg,r/m128",			"po 0F 55 /r",		CT_CPU_SSE2},
+	{"ANDNPS",		"xmmreg,r/m128",			"0F 55 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"ANDPD",		"xmmreg,r/m128",			"po 0F 54 /r",		CT_CPU_SSE2},
+	{"ANDPS",		"xmmreg,r/m128",			"0F 54 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"ARPL",		"r/m16,reg16",				"63 /r",			CT_CPU_286 | CT_CPU_PRIV},
+	{"BEXTR",		"reg32,r/m32,reg32",		"v3 0F 38 F7 /r",	CT_CPU_BMI1},
+	{"BEXTR",		"reg64,reg64/mem64,reg64",	"v3 pw 0F 38 F7 /r",	CT_CPU_BMI1 | CT_CPU_X64},
+	{"BLENDPD",		"xmmreg,r/m128,imm8",		"po 0F 3A 0D /r ib",	CT_CPU_SSE41},
+	{"BLENDPS",		"xmmreg,r/m128,imm8",		"po 0F 3A 0C /r ib",	CT_CPU_SSE41},
+	{"BLENDVPD",	"xmmreg,r/m128",			"po 0F 38 15 /r",	CT_CPU_SSE41},
+	{"BLENDVPS",	"xmmreg,r/m128",			"po 0F 38 14 /r",	CT_CPU_SSE41},
+	{"BLSI",		"reg32,r/m32",				"v1 0F 38 F3 /3",	CT_CPU_BMI1},
+	{"BLSI",		"reg64,reg64/mem64",		"v1 pw 0F 38 F3 /3",	CT_CPU_BMI1 | CT_CPU_X64},
+	{"BLSMSK",		"reg32,r/m32",				"v1 0F 38 F3 /2",	CT_CPU_BMI1},
+	{"BLSMSK",		"reg64,reg64/mem64",		"v1 pw 0F 38 F3 /2",	CT_CPU_BMI1 | CT_CPU_X64},
+	{"BLSR",		"reg32,r/m32",				"v1 0F 38 F3 /1",	CT_CPU_BMI1},
+	{"BLSR",		"reg64,reg64/mem64",		"v1 pw 0F 38 F3 /1",	CT_CPU_BMI1 | CT_CPU_X64},
+	{"BOUND",		"reg16,mem",				"po 62 /r",			CT_CPU_186 | CT_CPU_LEGACY},
+	{"BOUND",		"reg32,mem",				"po 62 /r",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"BSF",			"reg16,r/m16",				"po 0F BC /r",		CT_CPU_386},
+	{"BSF",			"reg32,r/m32",				"po 0F BC /r",		CT_CPU_386},
+	{"BSR",			"reg16,r/m16",				"po 0F BD /r",		CT_CPU_386},
+	{"BSR",			"reg32,r/m32",				"po 0F BD /r",		CT_CPU_386},
+	{"BSWAP",		"reg32",					"po 0F C8 +r",		CT_CPU_386 | CT_CPU_486},
+	{"BT",			"r/m16,reg16",				"po 0F A3 /r",		CT_CPU_386},
+	{"BT",			"r/m32,reg32",				"po 0F A3 /r",		CT_CPU_386},
+	{"BT",			"r/m16,imm8",				"po 0F BA /4 ib",	CT_CPU_386},
+	{"BT",			"r/m32,imm8",				"po 0F BA /4 ib",	CT_CPU_386},
+	{"BTC",			"r/m16,reg16",				"po 0F BB /r",		CT_CPU_386},
+	{"BTC",			"r/m32,reg32",				"po 0F BB /r",		CT_CPU_386},
+	{"BTC",			"r/m16,imm8",				"po 0F BA /7 ib",	CT_CPU_386},
+	{"BTC",			"r/m32,imm8",				"po 0F BA /7 ib",	CT_CPU_386},
+	{"BTR",			"r/m16,reg16",				"po 0F B3 /r",		CT_CPU_386},
+	{"BTR",			"r/m32,reg32",				"po 0F B3 /r",		CT_CPU_386},
+	{"BTR",			"r/m16,imm8",				"po 0F BA /6 ib",	CT_CPU_386},
+	{"BTR",			"r/m32,imm8",				"po 0F BA /6 ib",	CT_CPU_386},
+	{"BTS",			"r/m16,reg16",				"po 0F AB /r",		CT_CPU_386},
+	{"BTS",			"r/m32,reg32",				"po 0F AB /r",		CT_CPU_386},
+	{"BTS",			"r/m16,imm8",				"po 0F BA /5 ib",	CT_CPU_386},
+	{"BTS",			"r/m32,imm8",				"po 0F BA /5 ib",	CT_CPU_386},
+	{"BZHI",		"reg32,r/m32,reg32",		"v3 0F 38 F5 /r",	CT_CPU_BMI2},
+	{"BZHI",		"reg64,reg64/mem64,reg64",	"v3 pw 0F 38 F5 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"CALL",		"imm",						"E8 -i",			CT_CPU_8086},
+//	{"CALL",		"imm:imm16",				"po 9A iw iw",		CT_CPU_8086},
+//	{"CALL",		"imm:imm32",				"po 9A id iw",		CT_CPU_386},
+//	{"CALL",		"FAR mem16",				"po FF /3",			CT_CPU_8086},
+//	{"CALL",		"FAR mem32",				"po FF /3",			CT_CPU_386},
+	{"CALL",		"WORD r/m16",				"po FF /2",			CT_CPU_8086},
+	{"CALL",		"DWORD r/m32",				"po FF /2",			CT_CPU_386 | CT_CPU_STACK64},
+	{"CBW",			"",							"po 98",			CT_CPU_8086},
+	{"CLFLUSH",		"mem",						"0F AE /7",			CT_CPU_SSE2},
+	{"CMPEQPD",		"xmmreg,r/m128",			"po 0F C2 /r 00",	CT_CPU_SSE2},
+	{"CMPEQSD",		"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 00",	CT_CPU_SSE2},
+	{"CMPLEPD",		"xmmreg,r/m128",			"po 0F C2 /r 02",	CT_CPU_SSE2},
+	{"CMPLESD",		"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 02",	CT_CPU_SSE2},
+	{"CMPLTPD",		"xmmreg,r/m128",			"po 0F C2 /r 01",	CT_CPU_SSE2},
+	{"CMPLTSD",		"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 01",	CT_CPU_SSE2},
+	{"CMPNEQPD",	"xmmreg,r/m128",			"po 0F C2 /r 04",	CT_CPU_SSE2},
+	{"CMPNEQSD",	"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 04",	CT_CPU_SSE2},
+	{"CMPNLEPD",	"xmmreg,r/m128",			"po 0F C2 /r 06",	CT_CPU_SSE2},
+	{"CMPNLESD",	"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 06",	CT_CPU_SSE2},
+	{"CMPNLTPD",	"xmmreg,r/m128",			"po 0F C2 /r 05",	CT_CPU_SSE2},
+	{"CMPNLTSD",	"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 05",	CT_CPU_SSE2},
+	{"CMPORDPD",	"xmmreg,r/m128",			"po 0F C2 /r 07",	CT_CPU_SSE2},
+	{"CMPORDSD",	"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 07",	CT_CPU_SSE2},
+	{"CMPPD",		"xmmreg,r/m128,imm8",		"po 0F C2 /r ib",	CT_CPU_SSE2},
+	{"CMPUNORDPD",	"xmmreg,r/m128",			"po 0F C2 /r 03",	CT_CPU_SSE2},
+	{"CMPUNORDSD",	"xmmreg,xmmreg/mem64",		"p2 0F C2 /r 03",	CT_CPU_SSE2},
+	{"COMISD",		"xmmreg,xmmreg/mem64",		"po 0F 2F /r",		CT_CPU_SSE2},
+	{"CRC32",		"reg32,r/m32",				"p2 0F 38 F1 /r",	CT_CPU_SSE42},
+	{"CRC32",		"reg32,r/m16",				"po p2 0F 38 F1 /r",	CT_CPU_SSE42},
+	{"CRC32",		"reg32,r/m8",				"p2 0F 38 F0 /r",	CT_CPU_SSE42},
+	{"CRC32",		"reg64,reg64/mem64",		"p2 pw 0F 38 F1 /r",	CT_CPU_SSE42 | CT_CPU_X64},
+	{"CRC32",		"reg64,r/m8",				"p2 pw 0F 38 F0 /r",	CT_CPU_SSE42 | CT_CPU_X64},
+	{"CVTDQ2PD",	"xmmreg,xmmreg/mem64",		"p3 0F E6 /r",		CT_CPU_SSE2},
+	{"CVTDQ2PS",	"xmmreg,r/m128",			"0F 5B /r",			CT_CPU_SSE2},
+	{"CVTPD2DQ",	"xmmreg,r/m128",			"p2 0F E6 /r",		CT_CPU_SSE2},
+	{"CVTPD2PI",	"mmreg,r/m128",				"po 0F 2D /r",		CT_CPU_SSE2},
+	{"CVTPD2PS",	"xmmreg,r/m128",			"po 0F 5A /r",		CT_CPU_SSE2},
+	{"CVTPI2PD",	"xmmreg,r/m64",				"po 0F 2A /r",		CT_CPU_SSE2},
+	{"CVTPS2DQ",	"xmmreg,r/m128",			"po 0F 5B /r",		CT_CPU_SSE2},
+	{"CVTPS2PD",	"xmmreg,xmmreg/mem64",		"0F 5A /r",			CT_CPU_SSE2},
+	{"CVTSD2SI",	"reg32,xmmreg/mem64",		"p2 0F 2D /r",		CT_CPU_SSE2},
+	{"CVTSD2SI",	"reg64,xmmreg/mem64",		"p2 pw 0F 2D /r",	CT_CPU_SSE2 | CT_CPU_X64},
+	{"CVTSD2SS",	"xmmreg,xmmreg/mem64",		"p2 0F 5A /r",		CT_CPU_SSE2},
+	{"CVTSI2SD",	"xmmreg,r/m32",				"p2 0F 2A /r",		CT_CPU_SSE2},
+	{"CVTSI2SD",	"xmmreg,reg64/mem64",		"p2 pw 0F 2A /r",	CT_CPU_SSE2 | CT_CPU_X64},
+	{"CVTSS2SD",	"xmmreg,xmmreg/mem32",		"p3 0F 5A /r",		CT_CPU_SSE2},
+	{"CVTTPD2DQ",	"xmmreg,r/m128",			"po 0F E6 /r",		CT_CPU_SSE2},
+	{"CVTTPD2PI",	"mmreg,r/m128",				"po 0F 2C /r",		CT_CPU_SSE2},
+	{"CVTTPS2DQ",	"xmmreg,r/m128",			"p3 0F 5B /r",		CT_CPU_SSE2},
+	{"CVTTSD2SI",	"reg32,xmmreg/mem64",		"p2 0F 2C /r",		CT_CPU_SSE2},
+	{"CVTTSD2SI",	"reg64,xmmreg/mem64",		"p2 pw 0F 2C /r",	CT_CPU_SSE2 | CT_CPU_X64},
+	{"CWD",			"",							"po 99",			CT_CPU_8086},
+	{"CDQ",			"",							"po 99",			CT_CPU_386},
+	{"CDQE",		"",							"pw 98",			CT_CPU_X64},
+	{"CQO",			"",							"pw 99",			CT_CPU_X64},
+	{"CWDE",		"",							"po 98",			CT_CPU_386},
+	{"CLC",			"",							"F8",				CT_CPU_8086},
+	{"CLD",			"",							"FC",				CT_CPU_8086},
+	{"CLI",			"",							"FA",				CT_CPU_8086},
+//	{"CLTS",		"",							"0F 06",			CT_CPU_286 | CT_CPU_PRIV},
+	{"CMC",			"",							"F5",				CT_CPU_8086},
+	{"CMOVO",		"reg16,r/m16",				"po 0F 40 /r",		CT_CPU_P6},
+	{"CMOVNO",		"reg16,r/m16",				"po 0F 41 /r",		CT_CPU_P6},
+	{"CMOVB",		"reg16,r/m16",				"po 0F 42 /r",		CT_CPU_P6},
+	{"CMOVC",		"reg16,r/m16",				"po 0F 42 /r",		CT_CPU_P6},
+	{"CMOVNEA",		"reg16,r/m16",				"po 0F 42 /r",		CT_CPU_P6},
+	{"CMOVAE",		"reg16,r/m16",				"po 0F 43 /r",		CT_CPU_P6},
+	{"CMOVNB",		"reg16,r/m16",				"po 0F 43 /r",		CT_CPU_P6},
+	{"CMOVNC",		"reg16,r/m16",				"po 0F 43 /r",		CT_CPU_P6},
+	{"CMOVE",		"reg16,r/m16",				"po 0F 44 /r",		CT_CPU_P6},
+	{"CMOVZ",		"reg16,r/m16",				"po 0F 44 /r",		CT_CPU_P6},
+	{"CMOVNE",		"reg16,r/m16",				"po 0F 45 /r",		CT_CPU_P6},
+	{"CMOVNZ",		"reg16,r/m16",				"po 0F 45 /r",		CT_CPU_P6},
+	{"CMOVBE",		"reg16,r/m16",				"po 0F 46 /r",		CT_CPU_P6},
+	{"CMOVNA",		"reg16,r/m16",				"po 0F 46 /r",		CT_CPU_P6},
+	{"CMOVA",		"reg16,r/m16",				"po 0F 47 /r",		CT_CPU_P6},
+	{"CMOVNBE",		"reg16,r/m16",				"po 0F 47 /r",		CT_CPU_P6},
+	{"CMOVS",		"reg16,r/m16",				"po 0F 48 /r",		CT_CPU_P6},
+	{"CMOVNS",		"reg16,r/m16",				"po 0F 49 /r",		CT_CPU_P6},
+	{"CMOVP",		"reg16,r/m16",				"po 0F 4A /r",		CT_CPU_P6},
+	{"CMOVPE",		"reg16,r/m16",				"po 0F 4A /r",		CT_CPU_P6},
+	{"CMOVNP",		"reg16,r/m16",				"po 0F 4B /r",		CT_CPU_P6},
+	{"CMOVPO",		"reg16,r/m16",				"po 0F 4B /r",		CT_CPU_P6},
+	{"CMOVL",		"reg16,r/m16",				"po 0F 4C /r",		CT_CPU_P6},
+	{"CMOVNGE",		"reg16,r/m16",				"po 0F 4C /r",		CT_CPU_P6},
+	{"CMOVGE",		"reg16,r/m16",				"po 0F 4D /r",		CT_CPU_P6},
+	{"CMOVNL",		"reg16,r/m16",				"po 0F 4D /r",		CT_CPU_P6},
+	{"CMOVLE",		"reg16,r/m16",				"po 0F 4E /r",		CT_CPU_P6},
+	{"CMOVNG",		"reg16,r/m16",				"po 0F 4E /r",		CT_CPU_P6},
+	{"CMOVG",		"reg16,r/m16",				"po 0F 4F /r",		CT_CPU_P6},
+	{"CMOVNLE",		"reg16,r/m16",				"po 0F 4F /r",		CT_CPU_P6},
+	{"CMOVO",		"reg32,r/m32",				"po 0F 40 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNO",		"reg32,r/m32",				"po 0F 41 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVB",		"reg32,r/m32",				"po 0F 42 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVC",		"reg32,r/m32",				"po 0F 42 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNEA",		"reg32,r/m32",				"po 0F 42 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVAE",		"reg32,r/m32",				"po 0F 43 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNB",		"reg32,r/m32",				"po 0F 43 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNC",		"reg32,r/m32",				"po 0F 43 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVE",		"reg32,r/m32",				"po 0F 44 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVZ",		"reg32,r/m32",				"po 0F 44 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNE",		"reg32,r/m32",				"po 0F 45 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNZ",		"reg32,r/m32",				"po 0F 45 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVBE",		"reg32,r/m32",				"po 0F 46 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNA",		"reg32,r/m32",				"po 0F 46 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVA",		"reg32,r/m32",				"po 0F 47 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNBE",		"reg32,r/m32",				"po 0F 47 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVS",		"reg32,r/m32",				"po 0F 48 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNS",		"reg32,r/m32",				"po 0F 49 /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVP",		"reg32,r/m32",				"po 0F 4A /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVPE",		"reg32,r/m32",				"po 0F 4A /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNP",		"reg32,r/m32",				"po 0F 4B /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVPO",		"reg32,r/m32",				"po 0F 4B /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVL",		"reg32,r/m32",				"po 0F 4C /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNGE",		"reg32,r/m32",				"po 0F 4C /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVGE",		"reg32,r/m32",				"po 0F 4D /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNL",		"reg32,r/m32",				"po 0F 4D /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVLE",		"reg32,r/m32",				"po 0F 4E /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNG",		"reg32,r/m32",				"po 0F 4E /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVG",		"reg32,r/m32",				"po 0F 4F /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMOVNLE",		"reg32,r/m32",				"po 0F 4F /r",		CT_CPU_386 | CT_CPU_P6},
+	{"CMP",			"r/m8,reg8",				"38 /r",			CT_CPU_8086},
+	{"CMP",			"r/m16,reg16",				"po 39 /r",			CT_CPU_8086},
+	{"CMP",			"r/m32,reg32",				"po 39 /r",			CT_CPU_386},
+	{"CMP",			"reg8,r/m8",				"3A /r",			CT_CPU_8086},
+	{"CMP",			"reg16,r/m16",				"po 3B /r",			CT_CPU_8086},
+	{"CMP",			"reg32,r/m32",				"po 3B /r",			CT_CPU_386},
+	{"CMP",			"r/m8,imm8",				"80 /7 ib",			CT_CPU_8086},
+	{"CMP",			"r/m16,imm16",				"po 81 /7 iw",		CT_CPU_8086},
+	{"CMP",			"r/m32,imm32",				"po 81 /7 id",		CT_CPU_386},
+	{"CMP",			"r/m16,imm8",				"po 83 /7 ib",		CT_CPU_8086},
+	{"CMP",			"r/m32,imm8",				"po 83 /7 ib",		CT_CPU_386},
+	{"CMP",			"AL,imm8",					"3C ib",			CT_CPU_8086},
+	{"CMP",			"AX,imm16",					"po 3D iw",			CT_CPU_8086},
+	{"CMP",			"EAX,imm32",				"po 3D id",			CT_CPU_386},
+	{"CMPPS",		"xmmreg,r/m128,imm8",		"0F C2 /r ib",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPEQPS",		"xmmreg,r/m128",			"0F C2 /r 00",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPLEPS",		"xmmreg,r/m128",			"0F C2 /r 02",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPLTPS",		"xmmreg,r/m128",			"0F C2 /r 01",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPNEQPS",	"xmmreg,r/m128",			"0F C2 /r 04",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPNLEPS",	"xmmreg,r/m128",			"0F C2 /r 06",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPNLTPS",	"xmmreg,r/m128",			"0F C2 /r 05",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPORDPS",	"xmmreg,r/m128",			"0F C2 /r 07",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPUNORDPS",	"xmmreg,r/m128",			"0F C2 /r 03",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPSB",		"",							"A6",				CT_CPU_8086},
+	{"CMPSW",		"",							"po A7",			CT_CPU_8086},
+	{"CMPSD",		"",							"po A7",			CT_CPU_386},
+	{"CMPSD",		"xmmreg,xmmreg/mem64,imm8",	"p2 0F C2 /r ib",	CT_CPU_SSE2},
+	{"CMPSQ",		"",							"pw A7",			CT_CPU_X64},
+	{"CMPSS",		"xmmreg,xmmreg/mem32,imm8",	"p3 0F C2 /r ib",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPEQSS",		"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 00",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPLESS",		"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 02",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPLTSS",		"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 01",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPNEQSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 04",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPNLESS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 06",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPNLTSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 05",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPORDSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 07",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPUNORDSS",	"xmmreg,xmmreg/mem32",		"p3 0F C2 /r 03",	CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CMPXCHG",		"r/m8,reg8",				"0F B0 /r",			CT_CPU_PENT},
+	{"CMPXCHG",		"r/m16,reg16",				"po 0F B1 /r",		CT_CPU_PENT},
+	{"CMPXCHG",		"r/m32,reg32",				"po 0F B1 /r",		CT_CPU_386 | CT_CPU_PENT},
+//	{"CMPXCHG486",	"r/m8,reg8",				"0F A6 /r",			CT_CPU_486 | CT_CPU_UNDOC},
+//	{"CMPXCHG486",	"r/m16,reg16",				"po 0F A7 /r",		CT_CPU_486 | CT_CPU_UNDOC},
+//	{"CMPXCHG486",	"r/m32,reg32",				"po 0F A7 /r",		CT_CPU_486 | CT_CPU_UNDOC},
+	{"CMPXCHG8B",	"mem",						"0F C7 /1",			CT_CPU_PENT},
+	{"CMPXCHG16B",	"mem",						"pw 0F C7 /1",		CT_CPU_X64},
+	{"COMISS",		"xmmreg,xmmreg/mem32",		"0F 2F /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CPUID",		"",							"0F A2",			CT_CPU_PENT},
+	{"CVTPI2PS",	"xmmreg,r/m64",				"0F 2A /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CVTPS2PI",	"mmreg,xmmreg/mem64",		"0F 2D /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CVTTPS2PI",	"mmreg,xmmreg/mem64",		"0F 2C /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CVTSI2SS",	"xmmreg,r/m32",				"p3 0F 2A /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CVTSI2SS",	"xmmreg,reg64/mem64",		"p3 pw 0F 2A /r",	CT_CPU_KATMAI | CT_CPU_SSE | CT_CPU_X64},
+	{"CVTSS2SI",	"reg32,xmmreg/mem32",		"p3 0F 2D /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CVTSS2SI",	"reg64,xmmreg/mem32",		"p3 pw 0F 2D /r",	CT_CPU_KATMAI | CT_CPU_SSE | CT_CPU_X64},
+	{"CVTTSS2SI",	"reg32,xmmreg/mem32",		"p3 0F 2C /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"CVTTSS2SI",	"reg64,xmmreg/mem32",		"p3 pw 0F 2C /r",	CT_CPU_KATMAI | CT_CPU_SSE | CT_CPU_X64},
+	{"DAA",			"",							"27",				CT_CPU_8086 | CT_CPU_LEGACY},
+	{"DAS",			"",							"2F",				CT_CPU_8086 | CT_CPU_LEGACY},
+	{"DEC",			"reg16",					"po 48 +r",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"DEC",			"reg32",					"po 48 +r",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"DEC",			"BYTE r/m8",				"FE /1",			CT_CPU_8086},
+	{"DEC",			"WORD r/m16",				"po FF /1",			CT_CPU_8086},
+	{"DEC",			"DWORD r/m32",				"po FF /1",			CT_CPU_386},
+	{"DIV",			"BYTE r/m8",				"F6 /6",			CT_CPU_8086},
+	{"DIV",			"WORD r/m16",				"po F7 /6",			CT_CPU_8086},
+	{"DIV",			"DWORD r/m32",				"po F7 /6",			CT_CPU_386},
+	{"DIVPD",		"xmmreg,r/m128",			"po 0F 5E /r",		CT_CPU_SSE2},
+	{"DIVPS",		"xmmreg,r/m128",			"0F 5E /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"DIVSD",		"xmmreg,xmmreg/mem64",		"p2 0F 5E /r",		CT_CPU_SSE2},
+	{"DIVSS",		"xmmreg,xmmreg/mem32",		"p3 0F 5E /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"DPPD",		"xmmreg,r/m128,imm8",		"po 0F 3A 41 /r ib",	CT_CPU_SSE41},
+	{"DPPS",		"xmmreg,r/m128,imm8",		"po 0F 3A 40 /r ib",	CT_CPU_SSE41},
+	{"EMMS",		"",							"0F 77",			CT_CPU_PENT | CT_CPU_MMX},
+//	{"ENTER",		"imm,imm",					"C8 iw ib",			CT_CPU_186},
+	{"EXTRACTPS",	"r/m32,xmmreg,imm8",		"po 0F 3A 17 /r ib",	CT_CPU_SSE41},
+	{"F2XM1",		"",							"D9 F0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FABS",		"",							"D9 E1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADD",		"DWORD mem32",				"D8 /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADD",		"QWORD mem64",				"DC /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADD",		"fpureg",					"D8 C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADD",		"ST0,fpureg",				"D8 C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FADD",		"TO fpureg",				"DC C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADD",		"fpureg,ST0",				"DC C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADDP",		"fpureg",					"DE C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FADDP",		"fpureg,ST0",				"DE C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FBLD",		"mem80",					"DF /4",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FBSTP",		"mem80",					"DF /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCHS",		"",							"D9 E0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCLEX",		"",							"9B DB E2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNCLEX",		"",							"DB E2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCMOVB",		"fpureg",					"DA C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVB",		"ST0,fpureg",				"DA C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVBE",		"fpureg",					"DA D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVBE",		"ST0,fpureg",				"DA D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVE",		"fpureg",					"DA C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVE",		"ST0,fpureg",				"DA C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNB",		"fpureg",					"DB C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNB",		"ST0,fpureg",				"DB C0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNBE",	"fpureg",					"DB D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNBE",	"ST0,fpureg",				"DB D0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNE",		"fpureg",					"DB C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNE",		"ST0,fpureg",				"DB C8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNU",		"fpureg",					"DB D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVNU",		"ST0,fpureg",				"DB D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVU",		"fpureg",					"DA D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCMOVU",		"ST0,fpureg",				"DA D8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCOM",		"DWORD mem32",				"D8 /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOM",		"QWORD mem64",				"DC /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOM",		"fpureg",					"D8 D0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOM",		"ST0,fpureg",				"D8 D0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOMP",		"DWORD mem32",				"D8 /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOMP",		"QWORD mem64",				"DC /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOMP",		"fpureg",					"D8 D8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOMP",		"ST0,fpureg",				"D8 D8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOMPP",		"",							"DE D9",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FCOMI",		"fpureg",					"DB F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCOMI",		"ST0,fpureg",				"DB F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCOMIP",		"fpureg",					"DF F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCOMIP",		"ST0,fpureg",				"DF F0 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FCOS",		"",							"D9 FF",			CT_CPU_386 | CT_CPU_FPU},
+	{"FDECSTP",		"",							"D9 F6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDISI",		"",							"9B DB E1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNDISI",		"",							"DB E1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FENI",		"",							"9B DB E0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNENI",		"",							"DB E0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIV",		"DWORD mem32",				"D8 /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIV",		"QWORD mem64",				"DC /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIV",		"fpureg",					"D8 F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIV",		"ST0,fpureg",				"D8 F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FDIV",		"TO fpureg",				"DC F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIV",		"fpureg,ST0",				"DC F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVR",		"DWORD mem32",				"D8 /7",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVR",		"QWORD mem64",				"DC /7",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVR",		"fpureg",					"D8 F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVR",		"ST0,fpureg",				"D8 F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FDIVR",		"TO fpureg",				"DC F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVR",		"fpureg,ST0",				"DC F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVP",		"fpureg",					"DE F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVP",		"fpureg,ST0",				"DE F8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVRP",		"fpureg",					"DE F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FDIVRP",		"fpureg,ST0",				"DE F0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FEMMS",		"",							"0F 0E",			CT_CPU_3DNOW},
+	{"FFREE",		"fpureg",					"DD C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FFREEP",		"fpureg",					"DF C0 +r",			CT_CPU_P6 | CT_CPU_FPU | CT_CPU_UNDOC},
+	{"FIADD",		"WORD mem16",				"DE /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIADD",		"DWORD mem32",				"DA /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FICOM",		"WORD mem16",				"DE /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FICOM",		"DWORD mem32",				"DA /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FICOMP",		"WORD mem16",				"DE /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FICOMP",		"DWORD mem32",				"DA /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIDIV",		"WORD mem16",				"DE /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIDIV",		"DWORD mem32",				"DA /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIDIVR",		"WORD mem16",				"DE /7",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIDIVR",		"DWORD mem32",				"DA /7",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FILD",		"WORD mem16",				"DF /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FILD",		"DWORD mem32",				"DB /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FILD",		"QWORD mem64",				"DF /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIST",		"WORD mem16",				"DF /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIST",		"DWORD mem32",				"DB /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISTP",		"WORD mem16",				"DF /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISTP",		"DWORD mem32",				"DB /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISTP",		"QWORD mem64",				"DF /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIMUL",		"WORD mem16",				"DE /1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FIMUL",		"DWORD mem32",				"DA /1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FINCSTP",		"",							"D9 F7",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FINIT",		"",							"9B DB E3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNINIT",		"",							"DB E3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISUB",		"WORD mem16",				"DE /4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISUB",		"DWORD mem32",				"DA /4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISUBR",		"WORD mem16",				"DE /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FISUBR",		"DWORD mem32",				"DA /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLD",			"DWORD mem32",				"D9 /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLD",			"QWORD mem64",				"DD /0",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FLD",			"mem80",					"DB /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLD",			"fpureg",					"D9 C0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLD1",		"",							"D9 E8",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDL2E",		"",							"D9 EA",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDL2T",		"",							"D9 E9",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDLG2",		"",							"D9 EC",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDLN2",		"",							"D9 ED",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDPI",		"",							"D9 EB",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDZ",		"",							"D9 EE",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDCW",		"mem16",					"D9 /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FLDENV",		"mem",						"D9 /4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMUL",		"DWORD mem32",				"D8 /1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMUL",		"QWORD mem64",				"DC /1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMUL",		"fpureg",					"D8 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMUL",		"ST0,fpureg",				"D8 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FMUL",		"TO fpureg",				"DC C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMUL",		"fpureg,ST0",				"DC C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMULP",		"fpureg",					"DE C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FMULP",		"fpureg,ST0",				"DE C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNOP",		"",							"D9 D0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FPATAN",		"",							"D9 F3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FPTAN",		"",							"D9 F2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FPREM",		"",							"D9 F8",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FPREM1",		"",							"D9 F5",			CT_CPU_386 | CT_CPU_FPU},
+	{"FRNDINT",		"",							"D9 FC",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSAVE",		"mem",						"9B DD /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNSAVE",		"mem",						"DD /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FRSTOR",		"mem",						"DD /4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSCALE",		"",							"D9 FD",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSETPM",		"",							"DB E4",			CT_CPU_286 | CT_CPU_FPU},
+	{"FSIN",		"",							"D9 FE",			CT_CPU_386 | CT_CPU_FPU},
+	{"FSINCOS",		"",							"D9 FB",			CT_CPU_386 | CT_CPU_FPU},
+	{"FSQRT",		"",							"D9 FA",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FST",			"DWORD mem32",				"D9 /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FST",			"QWORD mem64",				"DD /2",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FST",			"fpureg",					"DD D0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTP",		"DWORD mem32",				"D9 /3",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTP",		"QWORD mem64",				"DD /3",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FSTP",		"mem80",					"DB /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTP",		"fpureg",					"DD D8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTCW",		"mem16",					"9B D9 /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNSTCW",		"mem16",					"D9 /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTENV",		"mem",						"9B D9 /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNSTENV",		"mem",						"D9 /6",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTSW",		"mem16",					"9B DD /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSTSW",		"AX",						"9B DF E0",			CT_CPU_286 | CT_CPU_FPU},
+	{"FNSTSW",		"mem16",					"DD /0",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FNSTSW",		"AX",						"DF E0",			CT_CPU_286 | CT_CPU_FPU},
+	{"FSUB",		"DWORD mem32",				"D8 /4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUB",		"QWORD mem64",				"DC /4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUB",		"fpureg",					"D8 E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUB",		"ST0,fpureg",				"D8 E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FSUB",		"TO fpureg",				"DC E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUB",		"fpureg,ST0",				"DC E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBR",		"DWORD mem32",				"D8 /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBR",		"QWORD mem64",				"DC /5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBR",		"fpureg",					"D8 E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBR",		"ST0,fpureg",				"D8 E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FSUBR",		"TO fpureg",				"DC E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBR",		"fpureg,ST0",				"DC E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBP",		"fpureg",					"DE E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBP",		"fpureg,ST0",				"DE E8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBRP",		"fpureg",					"DE E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FSUBRP",		"fpureg,ST0",				"DE E0 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FTST",		"",							"D9 E4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FUCOM",		"fpureg",					"DD E0 +r",			CT_CPU_386 | CT_CPU_FPU},
+	{"FUCOM",		"ST0,fpureg",				"DD E0 +r",			CT_CPU_386 | CT_CPU_FPU},
+	{"FUCOMP",		"fpureg",					"DD E8 +r",			CT_CPU_386 | CT_CPU_FPU},
+	{"FUCOMP",		"ST0,fpureg",				"DD E8 +r",			CT_CPU_386 | CT_CPU_FPU},
+	{"FUCOMPP",		"",							"DA E9",			CT_CPU_386 | CT_CPU_FPU},
+	{"FUCOMI",		"fpureg",					"DB E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FUCOMI",		"ST0,fpureg",				"DB E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FUCOMIP",		"fpureg",					"DF E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FUCOMIP",		"ST0,fpureg",				"DF E8 +r",			CT_CPU_P6 | CT_CPU_FPU},
+	{"FWAIT",		"",							"9B",				CT_CPU_8086},
+	{"FXAM",		"",							"D9 E5",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FXCH",		"",							"D9 C9",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FXCH",		"fpureg",					"D9 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FXCH",		"fpureg,ST0",				"D9 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FXCH",		"ST0,fpureg",				"D9 C8 +r",			CT_CPU_8086 | CT_CPU_FPU},
+//	{"FXRSTOR",		"m512byte",					"0F AE /1",			CT_CPU_P6 | CT_CPU_SSE | CT_CPU_FPU},
+//	{"FXSAVE",		"m512byte",					"0F AE /0",			CT_CPU_P6 | CT_CPU_SSE | CT_CPU_FPU},
+	{"FXTRACT",		"",							"D9 F4",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FYL2X",		"",							"D9 F1",			CT_CPU_8086 | CT_CPU_FPU},
+	{"FYL2XP1",		"",							"D9 F9",			CT_CPU_8086 | CT_CPU_FPU},
+	{"HLT",			"",							"F4",				CT_CPU_8086},
+//	{"IBTS",		"r/m16,reg16",				"po 0F A7 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+//	{"IBTS",		"r/m32,reg32",				"po 0F A7 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+	{"IDIV",		"BYTE r/m8",				"F6 /7",			CT_CPU_8086},
+	{"IDIV",		"WORD r/m16",				"po F7 /7",			CT_CPU_8086},
+	{"IDIV",		"DWORD r/m32",				"po F7 /7",			CT_CPU_386},
+	{"IMUL",		"BYTE r/m8",				"F6 /5",			CT_CPU_8086},
+	{"IMUL",		"WORD r/m16",				"po F7 /5",			CT_CPU_8086},
+	{"IMUL",		"DWORD r/m32",				"po F7 /5",			CT_CPU_386},
+	{"IMUL",		"reg16,r/m16",				"po 0F AF /r",		CT_CPU_386},
+	{"IMUL",		"reg32,r/m32",				"po 0F AF /r",		CT_CPU_386},
+	{"IMUL",		"reg16,imm8",				"po 6B /r ib",		CT_CPU_286},
+	{"IMUL",		"reg16,imm16",				"po 69 /r iw",		CT_CPU_286},
+	{"IMUL",		"reg32,imm8",				"po 6B /r ib",		CT_CPU_386},
+	{"IMUL",		"reg32,imm32",				"po 69 /r id",		CT_CPU_386},
+	{"IMUL",		"reg16,r/m16,imm8",			"po 6B /r ib",		CT_CPU_286},
+	{"IMUL",		"reg16,r/m16,imm16",		"po 69 /r iw",		CT_CPU_286},
+	{"IMUL",		"reg32,r/m32,imm8",			"po 6B /r ib",		CT_CPU_386},
+	{"IMUL",		"reg32,r/m32,imm32",		"po 69 /r id",		CT_CPU_386},
+	{"IN",			"AL,imm8",					"E4 ib",			CT_CPU_8086},
+	{"IN",			"AX,imm8",					"po E5 ib",			CT_CPU_8086},
+	{"IN",			"EAX,imm8",					"po E5 ib",			CT_CPU_386},
+	{"IN",			"AL,DX",					"EC",				CT_CPU_8086},
+	{"IN",			"AX,DX",					"po ED",			CT_CPU_8086},
+	{"IN",			"EAX,DX",					"po ED",			CT_CPU_386},
+	{"INC",			"reg16",					"po 40 +r",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"INC",			"reg32",					"po 40 +r",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"INC",			"BYTE r/m8",				"FE /0",			CT_CPU_8086},
+	{"INC",			"WORD r/m16",				"po FF /0",			CT_CPU_8086},
+	{"INC",			"DWORD r/m32",				"po FF /0",			CT_CPU_386},
+	{"INSB",		"",							"6C",				CT_CPU_186},
+	{"INSERTPS",	"xmmreg,xmmreg/mem32,imm8",	"po 0F 3A 21 /r ib",	CT_CPU_SSE41},
+	{"INSW",		"",							"po 6D",			CT_CPU_186},
+	{"INSD",		"",							"po 6D",			CT_CPU_386},
+	{"INT",			"imm8",						"CD ib",			CT_CPU_8086},
+	{"INT1",		"",							"F1",				CT_CPU_P6},
+	{"ICEBP",		"",							"F1",				CT_CPU_P6},
+	{"INT01",		"",							"F1",				CT_CPU_P6},
+	{"INT3",		"",							"CC",				CT_CPU_8086},
+	{"INT03",		"",							"CC",				CT_CPU_8086},
+	{"INTO",		"",							"CE",				CT_CPU_8086 | CT_CPU_LEGACY},
+	{"INVD",		"",							"0F 08",			CT_CPU_486},
+	{"INVLPG",		"mem",						"0F 01 /0",			CT_CPU_486},
+	{"IRET",		"",							"CF",				CT_CPU_8086},
+	{"IRETW",		"",							"po CF",			CT_CPU_8086},
+	{"IRETD",		"",							"po CF",			CT_CPU_386},
+	{"JCXZ",		"imm",						"po E3 -b",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"JECXZ",		"imm",						"po E3 -b",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"JRCXZ",		"imm",						"E3 -b",			CT_CPU_X64},
+	{"JMP",			"imm",						"E9 -i",			CT_CPU_8086},
+	{"JMP",			"SHORT imm",				"EB -b",			CT_CPU_8086},
+//	{"JMP",			"imm:imm16",				"po EA iw iw",		CT_CPU_8086},
+//	{"JMP",			"imm:imm32",				"po EA id iw",		CT_CPU_386},
+	{"JMP",			"mem",						"po FF /5",			CT_CPU_8086},
+//	{"JMP",			"FAR mem",					"po FF /5",			CT_CPU_386},
+	{"JMP",			"WORD r/m16",				"po FF /4",			CT_CPU_8086},
+	{"JMP",			"DWORD r/m32",				"po FF /4",			CT_CPU_386 | CT_CPU_STACK64},
+	{"JO",			"imm",						"70 -b",			CT_CPU_8086},
+	{"JNO",			"imm",						"71 -b",			CT_CPU_8086},
+	{"JB",			"imm",						"72 -b",			CT_CPU_8086},
+	{"JC",			"imm",						"72 -b",			CT_CPU_8086},
+	{"JNEA",		"imm",						"72 -b",			CT_CPU_8086},
+	{"JAE",			"imm",						"73 -b",			CT_CPU_8086},
+	{"JNB",			"imm",						"73 -b",			CT_CPU_8086},
+	{"JNC",			"imm",						"73 -b",			CT_CPU_8086},
+	{"JE",			"imm",						"74 -b",			CT_CPU_8086},
+	{"JZ",			"imm",						"74 -b",			CT_CPU_8086},
+	{"JNE",			"imm",						"75 -b",			CT_CPU_8086},
+	{"JNZ",			"imm",						"75 -b",			CT_CPU_8086},
+	{"JBE",			"imm",						"76 -b",			CT_CPU_8086},
+	{"JNA",			"imm",						"76 -b",			CT_CPU_8086},
+	{"JA",			"imm",						"77 -b",			CT_CPU_8086},
+	{"JNBE",		"imm",						"77 -b",			CT_CPU_8086},
+	{"JS",			"imm",						"78 -b",			CT_CPU_8086},
+//	{"JNS",			"imm",						"79 -b",			CT_CPU_8086},
+	{"JP",			"imm",						"7A -b",			CT_CPU_8086},
+	{"JPE",			"imm",						"7A -b",			CT_CPU_8086},
+	{"JNP",			"imm",						"7B -b",			CT_CPU_8086},
+	{"JPO",			"imm",						"7B -b",			CT_CPU_8086},
+	{"JL",			"imm",						"7C -b",			CT_CPU_8086},
+	{"JNGE",		"imm",						"7C -b",			CT_CPU_8086},
+	{"JGE",			"imm",						"7D -b",			CT_CPU_8086},
+	{"JNL",			"imm",						"7D -b",			CT_CPU_8086},
+	{"JLE",			"imm",						"7E -b",			CT_CPU_8086},
+	{"JNG",			"imm",						"7E -b",			CT_CPU_8086},
+	{"JG",			"imm",						"7F -b",			CT_CPU_8086},
+	{"JNLE",		"imm",						"7F -b",			CT_CPU_8086},
+	{"JO",			"NEAR imm",					"0F 80 -i",			CT_CPU_386},
+	{"JNO",			"NEAR imm",					"0F 81 -i",			CT_CPU_386},
+	{"JB",			"NEAR imm",					"0F 82 -i",			CT_CPU_386},
+	{"JC",			"NEAR imm",					"0F 82 -i",			CT_CPU_386},
+	{"JNEA",		"NEAR imm",					"0F 82 -i",			CT_CPU_386},
+	{"JAE",			"NEAR imm",					"0F 83 -i",			CT_CPU_386},
+	{"JNB",			"NEAR imm",					"0F 83 -i",			CT_CPU_386},
+	{"JNC",			"NEAR imm",					"0F 83 -i",			CT_CPU_386},
+	{"JE",			"NEAR imm",					"0F 84 -i",			CT_CPU_386},
+	{"JZ",			"NEAR imm",					"0F 84 -i",			CT_CPU_386},
+	{"JNE",			"NEAR imm",					"0F 85 -i",			CT_CPU_386},
+	{"JNZ",			"NEAR imm",					"0F 85 -i",			CT_CPU_386},
+	{"JBE",			"NEAR imm",					"0F 86 -i",			CT_CPU_386},
+	{"JNA",			"NEAR imm",					"0F 86 -i",			CT_CPU_386},
+	{"JA",			"NEAR imm",					"0F 87 -i",			CT_CPU_386},
+	{"JNBE",		"NEAR imm",					"0F 87 -i",			CT_CPU_386},
+	{"JS",			"NEAR imm",					"0F 88 -i",			CT_CPU_386},
+	{"JNS",			"NEAR imm",					"0F 89 -i",			CT_CPU_386},
+	{"JP",			"NEAR imm",					"0F 8A -i",			CT_CPU_386},
+	{"JPE",			"NEAR imm",					"0F 8A -i",			CT_CPU_386},
+	{"JNP",			"NEAR imm",					"0F 8B -i",			CT_CPU_386},
+	{"JPO",			"NEAR imm",					"0F 8B -i",			CT_CPU_386},
+	{"JL",			"NEAR imm",					"0F 8C -i",			CT_CPU_386},
+	{"JNGE",		"NEAR imm",					"0F 8C -i",			CT_CPU_386},
+	{"JGE",			"NEAR imm",					"0F 8D -i",			CT_CPU_386},
+	{"JNL",			"NEAR imm",					"0F 8D -i",			CT_CPU_386},
+	{"JLE",			"NEAR imm",					"0F 8E -i",			CT_CPU_386},
+	{"JNG",			"NEAR imm",					"0F 8E -i",			CT_CPU_386},
+	{"JG",			"NEAR imm",					"0F 8F -i",			CT_CPU_386},
+	{"JNLE",		"NEAR imm",					"0F 8F -i",			CT_CPU_386},
+	{"KADDD",		"kreg,kreg,kreg",			"v2 vl po pw 0F 4A /r",	CT_CPU_AVX512BW},
+	{"KADDQ",		"kreg,kreg,kreg",			"v2 vl pw 0F 4A /r",	CT_CPU_AVX512BW},
+	{"KANDD",		"kreg,kreg,kreg",			"v2 vl po pw 0F 41 /r",	CT_CPU_AVX512BW},
+	{"KANDND",		"kreg,kreg,kreg",			"v2 vl po pw 0F 42 /r",	CT_CPU_AVX512BW},
+	{"KANDNQ",		"kreg,kreg,kreg",			"v2 vl pw 0F 42 /r",	CT_CPU_AVX512BW},
+	{"KANDNW",		"kreg,kreg,kreg",			"v2 vl 0F 42 /r",	CT_CPU_AVX512F},
+	{"KANDQ",		"kreg,kreg,kreg",			"v2 vl pw 0F 41 /r",	CT_CPU_AVX512BW},
+	{"KANDW",		"kreg,kreg,kreg",			"v2 vl 0F 41 /r",	CT_CPU_AVX512F},
+	{"KMOVD",		"kreg,kreg/mem32",			"v0 po pw 0F 90 /r",	CT_CPU_AVX512BW},
+	{"KMOVD",		"mem32,kreg",				"v0 po pw 0F 91 /r",	CT_CPU_AVX512BW},
+	{"KMOVD",		"kreg,reg32",				"v0 p2 0F 92 /r",	CT_CPU_AVX512BW},
+	{"KMOVD",		"reg32,kreg",				"v0 p2 0F 93 /r",	CT_CPU_AVX512BW},
+	{"KMOVQ",		"kreg,kreg/mem64",			"v0 pw 0F 90 /r",	CT_CPU_AVX512BW},
+	{"KMOVQ",		"mem64,kreg",				"v0 pw 0F 91 /r",	CT_CPU_AVX512BW},
+	{"KMOVQ",		"kreg,reg64",				"v0 p2 pw 0F 92 /r",	CT_CPU_AVX512BW | CT_CPU_X64},
+	{"KMOVQ",		"reg64,kreg",				"v0 p2 pw 0F 93 /r",	CT_CPU_AVX512BW | CT_CPU_X64},
+	{"KMOVW",		"kreg,kreg/mem16",			"v0 0F 90 /r",		CT_CPU_AVX512F},
+	{"KMOVW",		"mem16,kreg",				"v0 0F 91 /r",		CT_CPU_AVX512F},
+	{"KMOVW",		"kreg,reg32",				"v0 0F 92 /r",		CT_CPU_AVX512F},
+	{"KMOVW",		"reg32,kreg",				"v0 0F 93 /r",		CT_CPU_AVX512F},
+	{"KNOTD",		"kreg,kreg",				"v0 po pw 0F 44 /r",	CT_CPU_AVX512BW},
+	{"KNOTQ",		"kreg,kreg",				"v0 pw 0F 44 /r",	CT_CPU_AVX512BW},
+	{"KNOTW",		"kreg,kreg",				"v0 0F 44 /r",		CT_CPU_AVX512F},
+	{"KORD",		"kreg,kreg,kreg",			"v2 vl po pw 0F 45 /r",	CT_CPU_AVX512BW},
+	{"KORQ",		"kreg,kreg,kreg",			"v2 vl pw 0F 45 /r",	CT_CPU_AVX512BW},
+	{"KORTESTD",	"kreg,kreg",				"v0 po pw 0F 98 /r",	CT_CPU_AVX512BW},
+	{"KORTESTQ",	"kreg,kreg",				"v0 pw 0F 98 /r",	CT_CPU_AVX512BW},
+	{"KORTESTW",	"kreg,kreg",				"v0 0F 98 /r",		CT_CPU_AVX512F},
+	{"KORW",		"kreg,kreg,kreg",			"v2 vl 0F 45 /r",	CT_CPU_AVX512F},
+	{"KSHIFTLD",	"kreg,kreg,imm8",			"v0 po 0F 3A 33 /r ib",	CT_CPU_AVX512BW},
+	{"KSHIFTLQ",	"kreg,kreg,imm8",			"v0 po pw 0F 3A 33 /r ib",	CT_CPU_AVX512BW},
+	{"KSHIFTLW",	"kreg,kreg,imm8",			"v0 po pw 0F 3A 32 /r ib",	CT_CPU_AVX512F},
+	{"KSHIFTRD",	"kreg,kreg,imm8",			"v0 po 0F 3A 31 /r ib",	CT_CPU_AVX512BW},
+	{"KSHIFTRQ",	"kreg,kreg,imm8",			"v0 po pw 0F 3A 31 /r ib",	CT_CPU_AVX512BW},
+	{"KSHIFTRW",	"kreg,kreg,imm8",			"v0 po pw 0F 3A 30 /r ib",	CT_CPU_AVX512F},
+	{"KTESTD",		"kreg,kreg",				"v0 po pw 0F 99 /r",	CT_CPU_AVX512BW},
+	{"KTESTQ",		"kreg,kreg",				"v0 pw 0F 99 /r",	CT_CPU_AVX512BW},
+	{"KUNPCKBW",	"kreg,kreg,kreg",			"v2 vl po 0F 4B /r",	CT_CPU_AVX512F},
+	{"KUNPCKDQ",	"kreg,kreg,kreg",			"v2 vl pw 0F 4B /r",	CT_CPU_AVX512BW},
+	{"KUNPCKWD",	"kreg,kreg,kreg",			"v2 vl 0F 4B /r",	CT_CPU_AVX512BW},
+	{"KXNORD",		"kreg,kreg,kreg",			"v2 vl po pw 0F 46 /r",	CT_CPU_AVX512BW},
+	{"KXNORQ",		"kreg,kreg,kreg",			"v2 vl pw 0F 46 /r",	CT_CPU_AVX512BW},
+	{"KXNORW",		"kreg,kreg,kreg",			"v2 vl 0F 46 /r",	CT_CPU_AVX512F},
+	{"KXORD",		"kreg,kreg,kreg",			"v2 vl po pw 0F 47 /r",	CT_CPU_AVX512BW},
+	{"KXORQ",		"kreg,kreg,kreg",			"v2 vl pw 0F 47 /r",	CT_CPU_AVX512BW},
+	{"KXORW",		"kreg,kreg,kreg",			"v2 vl 0F 47 /r",	CT_CPU_AVX512F},
+	{"LAHF",		"",							"9F",				CT_CPU_8086},
+//	{"LAR",			"reg16,r/m16",				"po 0F 02 /r",		CT_CPU_286 | CT_CPU_PRIV},
+//	{"LAR",			"reg32,r/m32",				"po 0F 02 /r",		CT_CPU_286 | CT_CPU_PRIV},
+	{"LDS",			"reg16,mem",				"po C5 /r",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LDS",			"reg32,mem",				"po C5 /r",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"LES",			"reg16,mem",				"po C4 /r",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LES",			"reg32,mem",				"po C4 /r",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"LFENCE",		"",							"0F AE E8",			CT_CPU_SSE2},
+	{"LFS",			"reg16,mem",				"po 0F B4 /r",		CT_CPU_386},
+	{"LFS",			"reg32,mem",				"po 0F B4 /r",		CT_CPU_386},
+	{"LGS",			"reg16,mem",				"po 0F B5 /r",		CT_CPU_386},
+	{"LGS",			"reg32,mem",				"po 0F B5 /r",		CT_CPU_386},
+	{"LSS",			"reg16,mem",				"po 0F B2 /r",		CT_CPU_386},
+	{"LSS",			"reg32,mem",				"po 0F B2 /r",		CT_CPU_386},
+	{"LDMXCSR",		"mem32",					"0F AE /2",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"LEA",			"reg16,mem",				"po 8D /r",			CT_CPU_8086},
+	{"LEA",			"reg32,mem",				"po 8D /r",			CT_CPU_386},
+	{"LEAVE",		"",							"C9",				CT_CPU_186},
+//	{"LGDT",		"mem",						"0F 01 /2",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"LIDT",		"mem",						"0F 01 /3",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"LLDT",		"r/m16",					"0F 00 /2",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"LMSW",		"r/m16",					"0F 01 /6",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"LOADALL",		"",							"0F 07",			CT_CPU_386 | CT_CPU_UNDOC},
+//	{"LOADALL286",	"",							"0F 05",			CT_CPU_286 | CT_CPU_UNDOC},
+	{"LODSB",		"",							"AC",				CT_CPU_8086},
+	{"LODSW",		"",							"po AD",			CT_CPU_8086},
+	{"LODSD",		"",							"po AD",			CT_CPU_386},
+	{"LODSQ",		"",							"pw AD",			CT_CPU_X64},
+	{"LOOP",		"imm",						"E2 -b",			CT_CPU_8086},
+	{"LOOP",		"imm,CX",					"pa E2 -b",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LOOP",		"imm,ECX",					"pa E2 -b",			CT_CPU_386},
+	{"LOOPE",		"imm",						"E1 -b",			CT_CPU_8086},
+	{"LOOPE",		"imm,CX",					"pa E1 -b",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LOOPE",		"imm,ECX",					"pa E1 -b",			CT_CPU_386},
+	{"LOOPZ",		"imm",						"E1 -b",			CT_CPU_8086},
+	{"LOOPZ",		"imm,CX",					"pa E1 -b",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LOOPZ",		"imm,ECX",					"pa E1 -b",			CT_CPU_386},
+	{"LOOPNE",		"imm",						"E0 -b",			CT_CPU_8086},
+	{"LOOPNE",		"imm,CX",					"pa E0 -b",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LOOPNE",		"imm,ECX",					"pa E0 -b",			CT_CPU_386},
+	{"LOOPNZ",		"imm",						"E0 -b",			CT_CPU_8086},
+	{"LOOPNZ",		"imm,CX",					"pa E0 -b",			CT_CPU_8086 | CT_CPU_LEGACY},
+	{"LOOPNZ",		"imm,ECX",					"pa E0 -b",			CT_CPU_386},
+//	{"LSL",			"reg16,r/m16",				"po 0F 03 /r",		CT_CPU_286 | CT_CPU_PRIV},
+//	{"LSL",			"reg32,r/m32",				"po 0F 03 /r",		CT_CPU_286 | CT_CPU_PRIV},
+//	{"LTR",			"r/m16",					"0F 00 /3",			CT_CPU_286 | CT_CPU_PRIV},
+	{"LZCNT",		"reg16,r/m16",				"po p3 0F BD /r",	CT_CPU_LZCNT},
+	{"LZCNT",		"reg32,r/m32",				"p3 0F BD /r",		CT_CPU_LZCNT},
+	{"MASKMOVDQU",	"xmmreg,xmmreg",			"po 0F F7 /r",		CT_CPU_SSE2},
+	{"MASKMOVQ",	"mmreg,mmreg",				"0F F7 /r",			CT_CPU_KATMAI},
+//	{"MAXPS",		"xmmreg,r/m128",			"0F 5F /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"MAXSS",		"xmmreg,r/m128",			"p3 0F 5F /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"MINPS",		"xmmreg,r/m128",			"0F 5D /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"MINSS",		"xmmreg,r/m128",			"p3 0F 5D /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MAXPD",		"xmmreg,r/m128",			"po 0F 5F /r",		CT_CPU_SSE2},
+	{"MAXSD",		"xmmreg,xmmreg/mem64",		"p2 0F 5F /r",		CT_CPU_SSE2},
+	{"MFENCE",		"",							"0F AE F0",			CT_CPU_SSE2},
+	{"MINPD",		"xmmreg,r/m128",			"po 0F 5D /r",		CT_CPU_SSE2},
+	{"MINSD",		"xmmreg,xmmreg/mem64",		"p2 0F 5D /r",		CT_CPU_SSE2},
+	{"MOV",			"r/m8,reg8",				"88 /r",			CT_CPU_8086},
+	{"MOV",			"r/m16,reg16",				"po 89 /r",			CT_CPU_8086},
+	{"MOV",			"r/m32,reg32",				"po 89 /r",			CT_CPU_386},
+	{"MOV",			"reg8,r/m8",				"8A /r",			CT_CPU_8086},
+	{"MOV",			"reg16,r/m16",				"po 8B /r",			CT_CPU_8086},
+	{"MOV",			"reg32,r/m32",				"po 8B /r",			CT_CPU_386},
+	{"MOV",			"reg8,imm8",				"B0 +r ib",			CT_CPU_8086},
+	{"MOV",			"reg16,imm16",				"po B8 +r iw",		CT_CPU_8086},
+	{"MOV",			"reg32,imm32",				"po B8 +r io",		CT_CPU_386},
+	{"MOV",			"r/m8,imm8",				"C6 /0 ib",			CT_CPU_8086},
+	{"MOV",			"r/m16,imm16",				"po C7 /0 iw",		CT_CPU_8086},
+	{"MOV",			"r/m32,imm32",				"po C7 /0 id",		CT_CPU_386},
+//	{"MOV",			"AL,memoffs8",				"A0 id",			CT_CPU_8086},
+//	{"MOV",			"AX,memoffs16",				"po A1 id",			CT_CPU_8086},
+//	{"MOV",			"EAX,memoffs32",			"po A1 id",			CT_CPU_386},
+//	{"MOV",			"memoffs8,AL",				"A2 id",			CT_CPU_8086},
+//	{"MOV",			"memoffs16,AX",				"po A3 id",			CT_CPU_8086},
+//	{"MOV",			"memoffs32,EAX",			"po A3 id",			CT_CPU_386},
+//	{"MOV",			"r/m16,segreg",				"po 8C /r",			CT_CPU_8086},
+//	{"MOV",			"r/m32,segreg",				"po 8C /r",			CT_CPU_386},
+//	{"MOV",			"segreg,r/m16",				"po 8E /r",			CT_CPU_8086},
+//	{"MOV",			"segreg,r/m32",				"po 8E /r",			CT_CPU_386},
+//	{"MOV",			"reg32,CR0/2/3/4",			"0F 20 /r",			CT_CPU_386},
+//	{"MOV",			"reg32,DR0/1/2/3/6/7",		"0F 21 /r",			CT_CPU_386},
+//	{"MOV",			"reg32,TR3/4/5/6/7",		"0F 24 /r",			CT_CPU_386},
+//	{"MOV",			"CR0/2/3/4,reg32",			"0F 22 /r",			CT_CPU_386},
+//	{"MOV",			"DR0/1/2/3/6/7,reg32",		"0F 23 /r",			CT_CPU_386},
+//	{"MOV",			"TR3/4/5/6/7,reg32",		"0F 26 /r",			CT_CPU_386},
+	{"MOVAPD",		"xmmreg,r/m128",			"po 0F 28 /r",		CT_CPU_SSE2},
+	{"MOVAPD",		"r/m128,xmmreg",			"po 0F 29 /r",		CT_CPU_SSE2},
+	{"MOVAPS",		"xmmreg,r/m128",			"0F 28 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVAPS",		"r/m128,xmmreg",			"0F 29 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVD",		"mmreg,r/m32",				"0F 6E /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"MOVD",		"r/m32,mmreg",				"0F 7E /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"MOVD",		"xmmreg,r/m32",				"po 0F 6E /r",		CT_CPU_SSE2},
+	{"MOVD",		"r/m32,xmmreg",				"po 0F 7E /r",		CT_CPU_SSE2},
+	{"MOVDQ2Q",		"mmreg,xmmreg",				"p2 0F D6 /r",		CT_CPU_SSE2},
+	{"MOVDQA",		"xmmreg,r/m128",			"po 0F 6F /r",		CT_CPU_SSE2},
+	{"MOVDQA",		"r/m128,xmmreg",			"po 0F 7F /r",		CT_CPU_SSE2},
+	{"MOVDQU",		"xmmreg,r/m128",			"p3 0F 6F /r",		CT_CPU_SSE2},
+	{"MOVDQU",		"r/m128,xmmreg",			"p3 0F 7F /r",		CT_CPU_SSE2},
+	{"MOVHLPS",		"xmmreg,xmmreg",			"0F 12 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVHPD",		"xmmreg,mem64",				"po 0F 16 /r",		CT_CPU_SSE2},
+	{"MOVHPD",		"mem64,xmmreg",				"po 0F 17 /r",		CT_CPU_SSE2},
+	{"MOVHPS",		"xmmreg,mem64",				"0F 16 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVHPS",		"mem64,xmmreg",				"0F 17 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVHPS",		"xmmreg,xmmreg",			"0F 16 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVLHPS",		"xmmreg,xmmreg",			"0F 16 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVLPD",		"xmmreg,mem64",				"po 0F 12 /r",		CT_CPU_SSE2},
+	{"MOVLPD",		"mem64,xmmreg",				"po 0F 13 /r",		CT_CPU_SSE2},
+	{"MOVLPS",		"xmmreg,mem64",				"0F 12 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVLPS",		"mem64,xmmreg",				"0F 13 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVLPS",		"xmmreg,xmmreg",			"0F 12 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVMSKPD",	"reg32,xmmreg",				"po 0F 50 /r",		CT_CPU_SSE2},
+	{"MOVMSKPS",	"reg32,xmmreg",				"0F 50 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVNTDQ",		"mem128,xmmreg",			"po 0F E7 /r",		CT_CPU_SSE2},
+	{"MOVNTDQA",	"xmmreg,mem128",			"po 0F 38 2A /r",	CT_CPU_SSE41},
+	{"MOVNTI",		"mem32,reg32",				"0F C3 /r",			CT_CPU_SSE2},
+	{"MOVNTI",		"mem64,reg64",				"pw 0F C3 /r",		CT_CPU_SSE2 | CT_CPU_X64},
+	{"MOVNTPD",		"mem128,xmmreg",			"po 0F 2B /r",		CT_CPU_SSE2},
+	{"MOVNTPS",		"mem128,xmmreg",			"0F 2B /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVNTQ",		"mem64,mmreg",				"0F E7 /r",			CT_CPU_KATMAI},
+	{"MOVQ",		"mmreg,r/m64",				"0F 6F /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"MOVQ",		"r/m64,mmreg",				"0F 7F /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"MOVQ",		"xmmreg,xmmreg/mem64",		"p3 0F 7E /r",		CT_CPU_SSE2},
+	{"MOVQ",		"xmmreg/mem64,xmmreg",		"po 0F D6 /r",		CT_CPU_SSE2},
+	{"MOVQ",		"xmmreg,reg64/mem64",		"po pw 0F 6E /r",	CT_CPU_SSE2 | CT_CPU_X64},
+	{"MOVQ",		"reg64/mem64,xmmreg",		"po pw 0F 7E /r",	CT_CPU_SSE2 | CT_CPU_X64},
+	{"MOVQ2DQ",		"xmmreg,mmreg",				"p3 0F D6 /r",		CT_CPU_SSE2},
+	{"MOVSB",		"",							"A4",				CT_CPU_8086},
+	{"MOVSW",		"",							"po A5",			CT_CPU_8086},
+	{"MOVSD",		"",							"po A5",			CT_CPU_386},
+	{"MOVSD",		"xmmreg,xmmreg/mem64",		"p2 0F 10 /r",		CT_CPU_SSE2},
+	{"MOVSD",		"xmmreg/mem64,xmmreg",		"p2 0F 11 /r",		CT_CPU_SSE2},
+	{"MOVSQ",		"",							"pw A5",			CT_CPU_X64},
+	{"MOVSS",		"xmmreg,xmmreg/mem32",		"p3 0F 10 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVSS",		"xmmreg/mem32,xmmreg",		"p3 0F 11 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVSX",		"reg16,r/m8",				"po 0F BE /r",		CT_CPU_386},
+	{"MOVSX",		"reg32,r/m8",				"po 0F BE /r",		CT_CPU_386},
+	{"MOVSX",		"reg32,r/m16",				"po 0F BF /r",		CT_CPU_386},
+	{"MOVSXD",		"reg64,r/m32",				"pw 63 /r",			CT_CPU_X64},
+	{"MOVUPD",		"xmmreg,r/m128",			"po 0F 10 /r",		CT_CPU_SSE2},
+	{"MOVUPD",		"r/m128,xmmreg",			"po 0F 11 /r",		CT_CPU_SSE2},
+	{"MOVZX",		"reg16,r/m8",				"po 0F B6 /r",		CT_CPU_386},
+	{"MOVZX",		"reg32,r/m8",				"po 0F B6 /r",		CT_CPU_386},
+	{"MOVZX",		"reg32,r/m16",				"po 0F B7 /r",		CT_CPU_386},
+	{"MOVUPS",		"xmmreg,r/m128",			"0F 10 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MOVUPS",		"r/m128,xmmreg",			"0F 11 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MPSADBW",		"xmmreg,r/m128,imm8",		"po 0F 3A 42 /r ib",	CT_CPU_SSE41},
+	{"MUL",			"BYTE r/m8",				"F6 /4",			CT_CPU_8086},
+	{"MUL",			"WORD r/m16",				"po F7 /4",			CT_CPU_8086},
+	{"MUL",			"DWORD r/m32",				"po F7 /4",			CT_CPU_386},
+	{"MULPD",		"xmmreg,r/m128",			"po 0F 59 /r",		CT_CPU_SSE2},
+	{"MULPS",		"xmmreg,r/m128",			"0F 59 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MULSD",		"xmmreg,xmmreg/mem64",		"p2 0F 59 /r",		CT_CPU_SSE2},
+	{"MULSS",		"xmmreg,xmmreg/mem32",		"p3 0F 59 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"MULX",		"reg32,reg32,r/m32",		"v2 p2 0F 38 F6 /r",	CT_CPU_BMI2},
+	{"MULX",		"reg64,reg64,reg64/mem64",	"v2 p2 pw 0F 38 F6 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"NEG",			"BYTE r/m8",				"F6 /3",			CT_CPU_8086},
+	{"NEG",			"WORD r/m16",				"po F7 /3",			CT_CPU_8086},
+	{"NEG",			"DWORD r/m32",				"po F7 /3",			CT_CPU_386},
+	{"NOT",			"BYTE r/m8",				"F6 /2",			CT_CPU_8086},
+	{"NOT",			"WORD r/m16",				"po F7 /2",			CT_CPU_8086},
+	{"NOT",			"DWORD r/m32",				"po F7 /2",			CT_CPU_386},
+	{"NOP",			"",							"90",				CT_CPU_8086},
+	{"OR",			"r/m8,reg8",				"08 /r",			CT_CPU_8086},
+	{"OR",			"r/m16,reg16",				"po 09 /r",			CT_CPU_8086},
+	{"OR",			"r/m32,reg32",				"po 09 /r",			CT_CPU_386},
+	{"OR",			"reg8,r/m8",				"0A /r",			CT_CPU_8086},
+	{"OR",			"reg16,r/m16",				"po 0B /r",			CT_CPU_8086},
+	{"OR",			"reg32,r/m32",				"po 0B /r",			CT_CPU_386},
+	{"OR",			"r/m8,imm8",				"80 /1 ib",			CT_CPU_8086},
+	{"OR",			"r/m16,imm16",				"po 81 /1 iw",		CT_CPU_8086},
+	{"OR",			"r/m32,imm32",				"po 81 /1 id",		CT_CPU_386},
+	{"OR",			"r/m16,imm8",				"po 83 /1 ib",		CT_CPU_8086},
+	{"OR",			"r/m32,imm8",				"po 83 /1 ib",		CT_CPU_386},
+	{"OR",			"AL,imm8",					"0C ib",			CT_CPU_8086},
+	{"OR",			"AX,imm16",					"po 0D iw",			CT_CPU_8086},
+	{"OR",			"EAX,imm32",				"po 0D id",			CT_CPU_386},
+	{"ORPD",		"xmmreg,r/m128",			"po 0F 56 /r",		CT_CPU_SSE2},
+	{"ORPS",		"xmmreg,r/m128",			"0F 56 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"OUT",			"imm8,AL",					"E6 ib",			CT_CPU_8086},
+	{"OUT",			"imm8,AX",					"po E7 ib",			CT_CPU_8086},
+	{"OUT",			"imm8,EAX",					"po E7 ib",			CT_CPU_386},
+	{"OUT",			"DX,AL",					"EE",				CT_CPU_8086},
+	{"OUT",			"DX,AX",					"po EF",			CT_CPU_8086},
+	{"OUT",			"DX,EAX",					"po EF",			CT_CPU_386},
+	{"OUTSB",		"",							"6E",				CT_CPU_186},
+	{"OUTSW",		"",							"po 6F",			CT_CPU_186},
+	{"OUTSD",		"",							"po 6F",			CT_CPU_386},
+	{"PABSB",		"mmreg,r/m64",				"0F 38 1C /r",		CT_CPU_SSSE3},
+	{"PABSB",		"xmmreg,r/m128",			"po 0F 38 1C /r",	CT_CPU_SSSE3},
+	{"PABSD",		"mmreg,r/m64",				"0F 38 1E /r",		CT_CPU_SSSE3},
+	{"PABSD",		"xmmreg,r/m128",			"po 0F 38 1E /r",	CT_CPU_SSSE3},
+	{"PABSW",		"mmreg,r/m64",				"0F 38 1D /r",		CT_CPU_SSSE3},
+	{"PABSW",		"xmmreg,r/m128",			"po 0F 38 1D /r",	CT_CPU_SSSE3},
+	{"PACKSSDW",	"mmreg,r/m64",				"0F 6B /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PACKSSDW",	"xmmreg,r/m128",			"po 0F 6B /r",		CT_CPU_SSE2},
+	{"PACKSSWB",	"mmreg,r/m64",				"0F 63 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PACKSSWB",	"xmmreg,r/m128",			"po 0F 63 /r",		CT_CPU_SSE2},
+	{"PACKUSDW",	"xmmreg,r/m128",			"po 0F 38 2B /r",	CT_CPU_SSE41},
+	{"PACKUSWB",	"mmreg,r/m64",				"0F 67 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PACKUSWB",	"xmmreg,r/m128",			"po 0F 67 /r",		CT_CPU_SSE2},
+	{"PADDB",		"mmreg,r/m64",				"0F FC /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDB",		"xmmreg,r/m128",			"po 0F FC /r",		CT_CPU_SSE2},
+	{"PADDQ",		"mmreg,r/m64",				"0F D4 /r",			CT_CPU_SSE2},
+	{"PADDQ",		"xmmreg,r/m128",			"po 0F D4 /r",		CT_CPU_SSE2},
+	{"PADDW",		"mmreg,r/m64",				"0F FD /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDW",		"xmmreg,r/m128",			"po 0F FD /r",		CT_CPU_SSE2},
+	{"PADDD",		"mmreg,r/m64",				"0F FE /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDD",		"xmmreg,r/m128",			"po 0F FE /r",		CT_CPU_SSE2},
+	{"PADDSB",		"mmreg,r/m64",				"0F EC /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDSB",		"xmmreg,r/m128",			"po 0F EC /r",		CT_CPU_SSE2},
+	{"PADDSW",		"mmreg,r/m64",				"0F ED /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDSW",		"xmmreg,r/m128",			"po 0F ED /r",		CT_CPU_SSE2},
+	{"PADDUSB",		"mmreg,r/m64",				"0F DC /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDUSB",		"xmmreg,r/m128",			"po 0F DC /r",		CT_CPU_SSE2},
+	{"PADDUSW",		"mmreg,r/m64",				"0F DD /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PADDUSW",		"xmmreg,r/m128",			"po 0F DD /r",		CT_CPU_SSE2},
+	{"PADDSIW",		"mmreg,r/m64",				"0F 51 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PALIGNR",		"mmreg,r/m64,imm8",			"0F 3A 0F /r ib",	CT_CPU_SSSE3},
+	{"PALIGNR",		"xmmreg,r/m128,imm8",		"po 0F 3A 0F /r ib",	CT_CPU_SSSE3},
+	{"PAND",		"mmreg,r/m64",				"0F DB /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PAND",		"xmmreg,r/m128",			"po 0F DB /r",		CT_CPU_SSE2},
+	{"PANDN",		"mmreg,r/m64",				"0F DF /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PANDN",		"xmmreg,r/m128",			"po 0F DF /r",		CT_CPU_SSE2},
+	{"PAUSE",		"",							"p3 90",			CT_CPU_SSE2},
+	{"PAVEB",		"mmreg,r/m64",				"0F 50 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PAVGB",		"mmreg,r/m64",				"0F E0 /r",			CT_CPU_KATMAI},
+	{"PAVGB",		"xmmreg,r/m128",			"po 0F E0 /r",		CT_CPU_SSE2},
+	{"PAVGW",		"mmreg,r/m64",				"0F E3 /r",			CT_CPU_KATMAI},
+	{"PAVGW",		"xmmreg,r/m128",			"po 0F E3 /r",		CT_CPU_SSE2},
+	{"PAVGUSB",		"mmreg,r/m64",				"0F 0F /r BF",		CT_CPU_3DNOW},
+	{"PBLENDVB",	"xmmreg,r/m128",			"po 0F 38 10 /r",	CT_CPU_SSE41},
+	{"PBLENDW",		"xmmreg,r/m128,imm8",		"po 0F 3A 0E /r ib",	CT_CPU_SSE41},
+	{"PCLMULHQHQDQ",	"xmmreg,r/m128",		"po 0F 3A 44 /r 11",	CT_CPU_PCLMUL},
+	{"PCLMULHQLQDQ",	"xmmreg,r/m128",		"po 0F 3A 44 /r 01",	CT_CPU_PCLMUL},
+	{"PCLMULLQHQDQ",	"xmmreg,r/m128",		"po 0F 3A 44 /r 10",	CT_CPU_PCLMUL},
+	{"PCLMULLQLQDQ",	"xmmreg,r/m128",		"po 0F 3A 44 /r 00",	CT_CPU_PCLMUL},
+	{"PCLMULQDQ",	"xmmreg,r/m128,imm8",		"po 0F 3A 44 /r ib",	CT_CPU_PCLMUL},
+	{"PCMPEQB",		"mmreg,r/m64",				"0F 74 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PCMPEQB",		"xmmreg,r/m128",			"po 0F 74 /r",		CT_CPU_SSE2},
+	{"PCMPEQQ",		"xmmreg,r/m128",			"po 0F 38 29 /r",	CT_CPU_SSE41},
+	{"PCMPEQW",		"mmreg,r/m64",				"0F 75 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PCMPEQW",		"xmmreg,r/m128",			"po 0F 75 /r",		CT_CPU_SSE2},
+	{"PCMPEQD",		"mmreg,r/m64",				"0F 76 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PCMPEQD",		"xmmreg,r/m128",			"po 0F 76 /r",		CT_CPU_SSE2},
+	{"PCMPESTRI",	"xmmreg,r/m128,imm8",		"po 0F 3A 61 /r ib",	CT_CPU_SSE42},
+	{"PCMPESTRM",	"xmmreg,r/m128,imm8",		"po 0F 3A 60 /r ib",	CT_CPU_SSE42},
+	{"PCMPGTB",		"mmreg,r/m64",				"0F 64 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PCMPGTB",		"xmmreg,r/m128",			"po 0F 64 /r",		CT_CPU_SSE2},
+	{"PCMPGTQ",		"xmmreg,r/m128",			"po 0F 38 37 /r",	CT_CPU_SSE42},
+	{"PCMPGTW",		"mmreg,r/m64",				"0F 65 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PCMPGTW",		"xmmreg,r/m128",			"po 0F 65 /r",		CT_CPU_SSE2},
+	{"PCMPGTD",		"mmreg,r/m64",				"0F 66 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PCMPGTD",		"xmmreg,r/m128",			"po 0F 66 /r",		CT_CPU_SSE2},
+	{"PCMPISTRI",	"xmmreg,r/m128,imm8",		"po 0F 3A 63 /r ib",	CT_CPU_SSE42},
+	{"PCMPISTRM",	"xmmreg,r/m128,imm8",		"po 0F 3A 62 /r ib",	CT_CPU_SSE42},
+	{"PDEP",		"reg32,reg32,r/m32",		"v2 p2 0F 38 F5 /r",	CT_CPU_BMI2},
+	{"PDEP",		"reg64,reg64,reg64/mem64",	"v2 p2 pw 0F 38 F5 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"PDISTIB",		"mmreg,mem64",				"0F 54 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PEXT",		"reg32,reg32,r/m32",		"v2 p3 0F 38 F5 /r",	CT_CPU_BMI2},
+	{"PEXT",		"reg64,reg64,reg64/mem64",	"v2 p3 pw 0F 38 F5 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"PEXTRB",		"reg32/mem8,xmmreg,imm8",	"po 0F 3A 14 /r ib",	CT_CPU_SSE41},
+	{"PEXTRD",		"r/m32,xmmreg,imm8",		"po 0F 3A 16 /r ib",	CT_CPU_SSE41},
+	{"PEXTRQ",		"reg64/mem64,xmmreg,imm8",	"po pw 0F 3A 16 /r ib",	CT_CPU_SSE41 | CT_CPU_X64},
+	{"PEXTRW",		"reg32,mmreg,imm8",			"0F C5 /r ib",		CT_CPU_KATMAI},
+	{"PEXTRW",		"reg32,xmmreg,imm8",		"po 0F C5 /r ib",	CT_CPU_SSE2},
+	{"PEXTRW",		"mem16,xmmreg,imm8",		"po 0F 3A 15 /r ib",	CT_CPU_SSE41},
+	{"PF2ID",		"mmreg,r/m64",				"0F 0F /r 1D",		CT_CPU_3DNOW},
+	{"PF2IW",		"mmreg,r/m64",				"0F 0F /r 1C",		CT_CPU_ATHLON},
+	{"PFACC",		"mmreg,r/m64",				"0F 0F /r AE",		CT_CPU_3DNOW},
+	{"PFADD",		"mmreg,r/m64",				"0F 0F /r 9E",		CT_CPU_3DNOW},
+	{"PFCMPEQ",		"mmreg,r/m64",				"0F 0F /r B0",		CT_CPU_3DNOW},
+	{"PFCMPGE",		"mmreg,r/m64",				"0F 0F /r 90",		CT_CPU_3DNOW},
+	{"PFCMPGT",		"mmreg,r/m64",				"0F 0F /r A0",		CT_CPU_3DNOW},
+	{"PFMAX",		"mmreg,r/m64",				"0F 0F /r A4",		CT_CPU_3DNOW},
+	{"PFMIN",		"mmreg,r/m64",				"0F 0F /r 94",		CT_CPU_3DNOW},
+	{"PFMUL",		"mmreg,r/m64",				"0F 0F /r B4",		CT_CPU_3DNOW},
+	{"PFNACC",		"mmreg,r/m64",				"0F 0F /r 8A",		CT_CPU_ATHLON},
+	{"PFPNACC",		"mmreg,r/m64",				"0F 0F /r 8E",		CT_CPU_ATHLON},
+	{"PFRCP",		"mmreg,r/m64",				"0F 0F /r 96",		CT_CPU_3DNOW},
+	{"PFRCPIT1",	"mmreg,r/m64",				"0F 0F /r A6",		CT_CPU_3DNOW},
+	{"PFRCPIT2",	"mmreg,r/m64",				"0F 0F /r B6",		CT_CPU_3DNOW},
+	{"PFRSQIT1",	"mmreg,r/m64",				"0F 0F /r A7",		CT_CPU_3DNOW},
+	{"PFRSQRT",		"mmreg,r/m64",				"0F 0F /r 97",		CT_CPU_3DNOW},
+	{"PFSUB",		"mmreg,r/m64",				"0F 0F /r 9A",		CT_CPU_3DNOW},
+	{"PFSUBR",		"mmreg,r/m64",				"0F 0F /r AA",		CT_CPU_3DNOW},
+	{"PHADDD",		"mmreg,r/m64",				"0F 38 02 /r",		CT_CPU_SSSE3},
+	{"PHADDD",		"xmmreg,r/m128",			"po 0F 38 02 /r",	CT_CPU_SSSE3},
+	{"PHADDSW",		"mmreg,r/m64",				"0F 38 03 /r",		CT_CPU_SSSE3},
+	{"PHADDSW",		"xmmreg,r/m128",			"po 0F 38 03 /r",	CT_CPU_SSSE3},
+	{"PHADDW",		"mmreg,r/m64",				"0F 38 01 /r",		CT_CPU_SSSE3},
+	{"PHADDW",		"xmmreg,r/m128",			"po 0F 38 01 /r",	CT_CPU_SSSE3},
+	{"PHMINPOSUW",	"xmmreg,r/m128",			"po 0F 38 41 /r",	CT_CPU_SSE41},
+	{"PHSUBD",		"mmreg,r/m64",				"0F 38 06 /r",		CT_CPU_SSSE3},
+	{"PHSUBD",		"xmmreg,r/m128",			"po 0F 38 06 /r",	CT_CPU_SSSE3},
+	{"PHSUBSW",		"mmreg,r/m64",				"0F 38 07 /r",		CT_CPU_SSSE3},
+	{"PHSUBSW",		"xmmreg,r/m128",			"po 0F 38 07 /r",	CT_CPU_SSSE3},
+	{"PHSUBW",		"mmreg,r/m64",				"0F 38 05 /r",		CT_CPU_SSSE3},
+	{"PHSUBW",		"xmmreg,r/m128",			"po 0F 38 05 /r",	CT_CPU_SSSE3},
+	{"PI2FD",		"mmreg,r/m64",				"0F 0F /r 0D",		CT_CPU_3DNOW},
+	{"PI2FW",		"mmreg,r/m64",				"0F 0F /r 0C",		CT_CPU_ATHLON},
+	{"PINSRB",		"xmmreg,reg32/mem8,imm8",	"po 0F 3A 20 /r ib",	CT_CPU_SSE41},
+	{"PINSRD",		"xmmreg,r/m32,imm8",		"po 0F 3A 22 /r ib",	CT_CPU_SSE41},
+	{"PINSRQ",		"xmmreg,reg64/mem64,imm8",	"po pw 0F 3A 22 /r ib",	CT_CPU_SSE41 | CT_CPU_X64},
+	{"PINSRW",		"mmreg,r/m16,imm8",			"0F C4 /r ib",		CT_CPU_KATMAI},
+	{"PINSRW",		"xmmreg,r/m16,imm8",		"po 0F C4 /r ib",	CT_CPU_SSE2},
+	{"PINSRW",		"xmmreg,reg32,imm8",		"po 0F C4 /r ib",	CT_CPU_SSE2},
+	{"PMACHRIW",	"mmreg,mem64",				"0F 5E /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMADDUBSW",	"mmreg,r/m64",				"0F 38 04 /r",		CT_CPU_SSSE3},
+	{"PMADDUBSW",	"xmmreg,r/m128",			"po 0F 38 04 /r",	CT_CPU_SSSE3},
+	{"PMADDWD",		"mmreg,r/m64",				"0F F5 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PMADDWD",		"xmmreg,r/m128",			"po 0F F5 /r",		CT_CPU_SSE2},
+	{"PMAGW",		"mmreg,r/m64",				"0F 52 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMAXSB",		"xmmreg,r/m128",			"po 0F 38 3C /r",	CT_CPU_SSE41},
+	{"PMAXSD",		"xmmreg,r/m128",			"po 0F 38 3D /r",	CT_CPU_SSE41},
+	{"PMAXSW",		"mmreg,r/m64",				"0F EE /r",			CT_CPU_KATMAI},
+	{"PMAXSW",		"xmmreg,r/m128",			"po 0F EE /r",		CT_CPU_SSE2},
+	{"PMAXUB",		"mmreg,r/m64",				"0F DE /r",			CT_CPU_KATMAI},
+	{"PMAXUB",		"xmmreg,r/m128",			"po 0F DE /r",		CT_CPU_SSE2},
+	{"PMAXUD",		"xmmreg,r/m128",			"po 0F 38 3F /r",	CT_CPU_SSE41},
+	{"PMAXUW",		"xmmreg,r/m128",			"po 0F 38 3E /r",	CT_CPU_SSE41},
+	{"PMINSB",		"xmmreg,r/m128",			"po 0F 38 38 /r",	CT_CPU_SSE41},
+	{"PMINSD",		"xmmreg,r/m128",			"po 0F 38 39 /r",	CT_CPU_SSE41},
+	{"PMINSW",		"mmreg,r/m64",				"0F EA /r",			CT_CPU_KATMAI},
+	{"PMINSW",		"xmmreg,r/m128",			"po 0F EA /r",		CT_CPU_SSE2},
+	{"PMINUB",		"mmreg,r/m64",				"0F DA /r",			CT_CPU_KATMAI},
+	{"PMINUB",		"xmmreg,r/m128",			"po 0F DA /r",		CT_CPU_SSE2},
+	{"PMINUD",		"xmmreg,r/m128",			"po 0F 38 3B /r",	CT_CPU_SSE41},
+	{"PMINUW",		"xmmreg,r/m128",			"po 0F 38 3A /r",	CT_CPU_SSE41},
+	{"PMOVMSKB",	"reg32,mmreg",				"0F D7 /r",			CT_CPU_KATMAI},
+	{"PMOVMSKB",	"reg32,xmmreg",				"po 0F D7 /r",		CT_CPU_SSE2},
+	{"PMOVSXBD",	"xmmreg,xmmreg/mem32",		"po 0F 38 21 /r",	CT_CPU_SSE41},
+	{"PMOVSXBQ",	"xmmreg,xmmreg/mem16",		"po 0F 38 22 /r",	CT_CPU_SSE41},
+	{"PMOVSXBW",	"xmmreg,xmmreg/mem64",		"po 0F 38 20 /r",	CT_CPU_SSE41},
+	{"PMOVSXDQ",	"xmmreg,xmmreg/mem64",		"po 0F 38 25 /r",	CT_CPU_SSE41},
+	{"PMOVSXWD",	"xmmreg,xmmreg/mem64",		"po 0F 38 23 /r",	CT_CPU_SSE41},
+	{"PMOVSXWQ",	"xmmreg,xmmreg/mem32",		"po 0F 38 24 /r",	CT_CPU_SSE41},
+	{"PMOVZXBD",	"xmmreg,xmmreg/mem32",		"po 0F 38 31 /r",	CT_CPU_SSE41},
+	{"PMOVZXBQ",	"xmmreg,xmmreg/mem16",		"po 0F 38 32 /r",	CT_CPU_SSE41},
+	{"PMOVZXBW",	"xmmreg,xmmreg/mem64",		"po 0F 38 30 /r",	CT_CPU_SSE41},
+	{"PMOVZXDQ",	"xmmreg,xmmreg/mem64",		"po 0F 38 35 /r",	CT_CPU_SSE41},
+	{"PMOVZXWD",	"xmmreg,xmmreg/mem64",		"po 0F 38 33 /r",	CT_CPU_SSE41},
+	{"PMOVZXWQ",	"xmmreg,xmmreg/mem32",		"po 0F 38 34 /r",	CT_CPU_SSE41},
+	{"PMULDQ",		"xmmreg,r/m128",			"po 0F 38 28 /r",	CT_CPU_SSE41},
+	{"PMULHRSW",	"mmreg,r/m64",				"0F 38 0B /r",		CT_CPU_SSSE3},
+	{"PMULHRSW",	"xmmreg,r/m128",			"po 0F 38 0B /r",	CT_CPU_SSSE3},
+	{"PMULHRWA",	"mmreg,r/m64",				"0F 0F /r B7",		CT_CPU_3DNOW},
+	{"PMULHRWC",	"mmreg,r/m64",				"0F 59 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMULHRIW",	"mmreg,r/m64",				"0F 5D /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMULHUW",		"mmreg,r/m64",				"0F E4 /r",			CT_CPU_KATMAI},
+	{"PMULHUW",		"xmmreg,r/m128",			"po 0F E4 /r",		CT_CPU_SSE2},
+	{"PMULHW",		"mmreg,r/m64",				"0F E5 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PMULHW",		"xmmreg,r/m128",			"po 0F E5 /r",		CT_CPU_SSE2},
+	{"PMULLD",		"xmmreg,r/m128",			"po 0F 38 40 /r",	CT_CPU_SSE41},
+	{"PMULLW",		"mmreg,r/m64",				"0F D5 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PMULLW",		"xmmreg,r/m128",			"po 0F D5 /r",		CT_CPU_SSE2},
+	{"PMULUDQ",		"mmreg,r/m64",				"0F F4 /r",			CT_CPU_SSE2},
+	{"PMULUDQ",		"xmmreg,r/m128",			"po 0F F4 /r",		CT_CPU_SSE2},
+	{"PMVZB",		"mmreg,mem64",				"0F 58 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMVNZB",		"mmreg,mem64",				"0F 5A /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMVLZB",		"mmreg,mem64",				"0F 5B /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PMVGEZB",		"mmreg,mem64",				"0F 5C /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"POP",			"reg16",					"po 58 +r",			CT_CPU_8086},
+	{"POP",			"reg32",					"po 58 +r",			CT_CPU_386 | CT_CPU_STACK64},
+	{"POP",			"WORD r/m16",				"po 8F /0",			CT_CPU_8086},
+	{"POP",			"DWORD r/m32",				"po 8F /0",			CT_CPU_386 | CT_CPU_STACK64},
+//	{"POP",			"CS",						"0F",				CT_CPU_8086 | CT_CPU_UNDOC},
+//	{"POP",			"DS",						"1F",				CT_CPU_8086},
+//	{"POP",			"ES",						"07",				CT_CPU_8086},
+//	{"POP",			"SS",						"17",				CT_CPU_8086},
+//	{"POP",			"FS",						"0F A1",			CT_CPU_386},
+//	{"POP",			"GS",						"0F A9",			CT_CPU_386},
+	{"POPA",		"",							"61",				CT_CPU_186 | CT_CPU_LEGACY},
+	{"POPAW",		"",							"po 61",			CT_CPU_186 | CT_CPU_LEGACY},
+	{"POPAD",		"",							"po 61",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"POPCNT",		"reg16,r/m16",				"po p3 0F B8 /r",	CT_CPU_POPCNT},
+	{"POPCNT",		"reg32,r/m32",				"p3 0F B8 /r",		CT_CPU_POPCNT},
+	{"POPF",		"",							"9D",				CT_CPU_186},
+	{"POPFW",		"",							"po 9D",			CT_CPU_186},
+	{"POPFD",		"",							"po 9D",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"POPFQ",		"",							"9D",				CT_CPU_X64},
+	{"POR",			"mmreg,r/m64",				"0F EB /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"POR",			"xmmreg,r/m128",			"po 0F EB /r",		CT_CPU_SSE2},
+	{"PREFETCH",	"mem",						"0F 0D /0",			CT_CPU_3DNOW},
+	{"PREFETCHW",	"mem",						"0F 0D /1",			CT_CPU_3DNOW},
+	{"PREFETCHNTA",	"mem",						"0F 18 /0",			CT_CPU_KATMAI},
+	{"PREFETCHT0",	"mem",						"0F 18 /1",			CT_CPU_KATMAI},
+	{"PREFETCHT1",	"mem",						"0F 18 /2",			CT_CPU_KATMAI},
+	{"PREFETCHT2",	"mem",						"0F 18 /3",			CT_CPU_KATMAI},
+	{"PSADBW",		"mmreg,r/m64",				"0F F6 /r",			CT_CPU_KATMAI},
+	{"PSADBW",		"xmmreg,r/m128",			"po 0F F6 /r",		CT_CPU_SSE2},
+	{"PSHUFB",		"mmreg,r/m64",				"0F 38 00 /r",		CT_CPU_SSSE3},
+	{"PSHUFB",		"xmmreg,r/m128",			"po 0F 38 00 /r",	CT_CPU_SSSE3},
+	{"PSHUFD",		"xmmreg,r/m128,imm8",		"po 0F 70 /r ib",	CT_CPU_SSE2},
+	{"PSHUFHW",		"xmmreg,r/m128,imm8",		"p3 0F 70 /r ib",	CT_CPU_SSE2},
+	{"PSHUFLW",		"xmmreg,r/m128,imm8",		"p2 0F 70 /r ib",	CT_CPU_SSE2},
+	{"PSHUFW",		"mmreg,r/m64,imm8",			"0F 70 /r ib",		CT_CPU_KATMAI},
+	{"PSIGNB",		"mmreg,r/m64",				"0F 38 08 /r",		CT_CPU_SSSE3},
+	{"PSIGNB",		"xmmreg,r/m128",			"po 0F 38 08 /r",	CT_CPU_SSSE3},
+	{"PSIGND",		"mmreg,r/m64",				"0F 38 0A /r",		CT_CPU_SSSE3},
+	{"PSIGND",		"xmmreg,r/m128",			"po 0F 38 0A /r",	CT_CPU_SSSE3},
+	{"PSIGNW",		"mmreg,r/m64",				"0F 38 09 /r",		CT_CPU_SSSE3},
+	{"PSIGNW",		"xmmreg,r/m128",			"po 0F 38 09 /r",	CT_CPU_SSSE3},
+	{"PSLLDQ",		"xmmreg,imm8",				"po 0F 73 /7 ib",	CT_CPU_SSE2},
+	{"PSLLW",		"mmreg,r/m64",				"0F F1 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSLLW",		"mmreg,imm8",				"0F 71 /6 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSLLW",		"xmmreg,r/m128",			"po 0F F1 /r",		CT_CPU_SSE2},
+	{"PSLLW",		"xmmreg,imm8",				"po 0F 71 /6 ib",	CT_CPU_SSE2},
+	{"PSLLD",		"mmreg,r/m64",				"0F F2 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSLLD",		"mmreg,imm8",				"0F 72 /6 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSLLD",		"xmmreg,r/m128",			"po 0F F2 /r",		CT_CPU_SSE2},
+	{"PSLLD",		"xmmreg,imm8",				"po 0F 72 /6 ib",	CT_CPU_SSE2},
+	{"PSLLQ",		"mmreg,r/m64",				"0F F3 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSLLQ",		"mmreg,imm8",				"0F 73 /6 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSLLQ",		"xmmreg,r/m128",			"po 0F F3 /r",		CT_CPU_SSE2},
+	{"PSLLQ",		"xmmreg,imm8",				"po 0F 73 /6 ib",	CT_CPU_SSE2},
+	{"PSRAW",		"mmreg,r/m64",				"0F E1 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRAW",		"mmreg,imm8",				"0F 71 /4 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRAW",		"xmmreg,r/m128",			"po 0F E1 /r",		CT_CPU_SSE2},
+	{"PSRAW",		"xmmreg,imm8",				"po 0F 71 /4 ib",	CT_CPU_SSE2},
+	{"PSRAD",		"mmreg,r/m64",				"0F E2 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRAD",		"mmreg,imm8",				"0F 72 /4 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRAD",		"xmmreg,r/m128",			"po 0F E2 /r",		CT_CPU_SSE2},
+	{"PSRAD",		"xmmreg,imm8",				"po 0F 72 /4 ib",	CT_CPU_SSE2},
+	{"PSRLDQ",		"xmmreg,imm8",				"po 0F 73 /3 ib",	CT_CPU_SSE2},
+	{"PSRLW",		"mmreg,r/m64",				"0F D1 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRLW",		"mmreg,imm8",				"0F 71 /2 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRLW",		"xmmreg,r/m128",			"po 0F D1 /r",		CT_CPU_SSE2},
+	{"PSRLW",		"xmmreg,imm8",				"po 0F 71 /2 ib",	CT_CPU_SSE2},
+	{"PSRLD",		"mmreg,r/m64",				"0F D2 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRLD",		"mmreg,imm8",				"0F 72 /2 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRLD",		"xmmreg,r/m128",			"po 0F D2 /r",		CT_CPU_SSE2},
+	{"PSRLD",		"xmmreg,imm8",				"po 0F 72 /2 ib",	CT_CPU_SSE2},
+	{"PSRLQ",		"mmreg,r/m64",				"0F D3 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRLQ",		"mmreg,imm8",				"0F 73 /2 ib",		CT_CPU_PENT | CT_CPU_MMX},
+	{"PSRLQ",		"xmmreg,r/m128",			"po 0F D3 /r",		CT_CPU_SSE2},
+	{"PSRLQ",		"xmmreg,imm8",				"po 0F 73 /2 ib",	CT_CPU_SSE2},
+	{"PSUBB",		"mmreg,r/m64",				"0F F8 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBB",		"xmmreg,r/m128",			"po 0F F8 /r",		CT_CPU_SSE2},
+	{"PSUBQ",		"mmreg,r/m64",				"0F FB /r",			CT_CPU_SSE2},
+	{"PSUBQ",		"xmmreg,r/m128",			"po 0F FB /r",		CT_CPU_SSE2},
+	{"PSUBW",		"mmreg,r/m64",				"0F F9 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBW",		"xmmreg,r/m128",			"po 0F F9 /r",		CT_CPU_SSE2},
+	{"PSUBD",		"mmreg,r/m64",				"0F FA /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBD",		"xmmreg,r/m128",			"po 0F FA /r",		CT_CPU_SSE2},
+	{"PSUBSB",		"mmreg,r/m64",				"0F E8 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBSB",		"xmmreg,r/m128",			"po 0F E8 /r",		CT_CPU_SSE2},
+	{"PSUBSW",		"mmreg,r/m64",				"0F E9 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBSW",		"xmmreg,r/m128",			"po 0F E9 /r",		CT_CPU_SSE2},
+	{"PSUBUSB",		"mmreg,r/m64",				"0F D8 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBUSB",		"xmmreg,r/m128",			"po 0F D8 /r",		CT_CPU_SSE2},
+	{"PSUBUSW",		"mmreg,r/m64",				"0F D9 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PSUBUSW",		"xmmreg,r/m128",			"po 0F D9 /r",		CT_CPU_SSE2},
+	{"PSUBSIW",		"mmreg,r/m64",				"0F 55 /r",			CT_CPU_CYRIX | CT_CPU_MMX},
+	{"PSWAPD",		"mmreg,r/m64",				"0F 0F /r BB",		CT_CPU_ATHLON},
+	{"PTEST",		"xmmreg,r/m128",			"po 0F 38 17 /r",	CT_CPU_SSE41},
+	{"PUNPCKHBW",	"mmreg,r/m64",				"0F 68 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PUNPCKHBW",	"xmmreg,r/m128",			"po 0F 68 /r",		CT_CPU_SSE2},
+	{"PUNPCKHQDQ",	"xmmreg,r/m128",			"po 0F 6D /r",		CT_CPU_SSE2},
+	{"PUNPCKHWD",	"mmreg,r/m64",				"0F 69 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PUNPCKHWD",	"xmmreg,r/m128",			"po 0F 69 /r",		CT_CPU_SSE2},
+	{"PUNPCKHDQ",	"mmreg,r/m64",				"0F 6A /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PUNPCKHDQ",	"xmmreg,r/m128",			"po 0F 6A /r",		CT_CPU_SSE2},
+	{"PUNPCKLBW",	"mmreg,r/m64",				"0F 60 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PUNPCKLBW",	"xmmreg,r/m128",			"po 0F 60 /r",		CT_CPU_SSE2},
+	{"PUNPCKLQDQ",	"xmmreg,r/m128",			"po 0F 6C /r",		CT_CPU_SSE2},
+	{"PUNPCKLWD",	"mmreg,r/m64",				"0F 61 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PUNPCKLWD",	"xmmreg,r/m128",			"po 0F 61 /r",		CT_CPU_SSE2},
+	{"PUNPCKLDQ",	"mmreg,r/m64",				"0F 62 /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PUNPCKLDQ",	"xmmreg,r/m128",			"po 0F 62 /r",		CT_CPU_SSE2},
+	{"PUSH",		"reg16",					"po 50 +r",			CT_CPU_8086},
+	{"PUSH",		"reg32",					"po 50 +r",			CT_CPU_386 | CT_CPU_STACK64},
+	{"PUSH",		"WORD r/m16",				"po FF /6",			CT_CPU_8086},
+	{"PUSH",		"DWORD r/m32",				"po FF /6",			CT_CPU_386 | CT_CPU_STACK64},
+//	{"PUSH",		"CS",						"0E",				CT_CPU_8086},
+//	{"PUSH",		"DS",						"1E",				CT_CPU_8086},
+//	{"PUSH",		"ES",						"06",				CT_CPU_8086},
+//	{"PUSH",		"SS",						"16",				CT_CPU_8086},
+//	{"PUSH",		"FS",						"0F A0",			CT_CPU_386},
+//	{"PUSH",		"GS",						"0F A8",			CT_CPU_386},
+	{"PUSH",		"imm8",						"6A ib",			CT_CPU_286 | CT_CPU_STACK64},
+	{"PUSH",		"imm16",					"po 68 iw",			CT_CPU_286 | CT_CPU_LEGACY},
+	{"PUSH",		"imm32",					"po 68 id",			CT_CPU_386 | CT_CPU_STACK64},
+	{"PUSHA",		"",							"60",				CT_CPU_186 | CT_CPU_LEGACY},
+	{"PUSHAD",		"",							"po 60",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"PUSHAW",		"",							"po 60",			CT_CPU_186 | CT_CPU_LEGACY},
+	{"PUSHF",		"",							"9C",				CT_CPU_186},
+	{"PUSHFD",		"",							"po 9C",			CT_CPU_386 | CT_CPU_LEGACY},
+	{"PUSHFQ",		"",							"9C",				CT_CPU_X64},
+	{"PUSHFW",		"",							"po 9C",			CT_CPU_186},
+	{"PXOR",		"mmreg,r/m64",				"0F EF /r",			CT_CPU_PENT | CT_CPU_MMX},
+	{"PXOR",		"xmmreg,r/m128",			"po 0F EF /r",		CT_CPU_SSE2},
+	{"RCL",			"r/m8,1",					"D0 /2",			CT_CPU_8086},
+	{"RCL",			"r/m8,CL",					"D2 /2",			CT_CPU_8086},
+	{"RCL",			"r/m8,imm8",				"C0 /2 ib",			CT_CPU_286},
+	{"RCL",			"r/m16,1",					"po D1 /2",			CT_CPU_8086},
+	{"RCL",			"r/m16,CL",					"po D3 /2",			CT_CPU_8086},
+	{"RCL",			"r/m16,imm8",				"po C1 /2 ib",		CT_CPU_286},
+	{"RCL",			"r/m32,1",					"po D1 /2",			CT_CPU_386},
+	{"RCL",			"r/m32,CL",					"po D3 /2",			CT_CPU_386},
+	{"RCL",			"r/m32,imm8",				"po C1 /2 ib",		CT_CPU_386},
+	{"RCR",			"r/m8,1",					"D0 /3",			CT_CPU_8086},
+	{"RCR",			"r/m8,CL",					"D2 /3",			CT_CPU_8086},
+	{"RCR",			"r/m8,imm8",				"C0 /3 ib",			CT_CPU_286},
+	{"RCR",			"r/m16,1",					"po D1 /3",			CT_CPU_8086},
+	{"RCR",			"r/m16,CL",					"po D3 /3",			CT_CPU_8086},
+	{"RCR",			"r/m16,imm8",				"po C1 /3 ib",		CT_CPU_286},
+	{"RCR",			"r/m32,1",					"po D1 /3",			CT_CPU_386},
+	{"RCR",			"r/m32,CL",					"po D3 /3",			CT_CPU_386},
+	{"RCR",			"r/m32,imm8",				"po C1 /3 ib",		CT_CPU_386},
+	{"RCPPS",		"xmmreg,r/m128",			"0F 53 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"RCPSS",		"xmmreg,xmmreg/mem32",		"p3 0F 53 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"RDMSR",		"",							"0F 32",			CT_CPU_PENT},
+	{"RDPMC",		"",							"0F 33",			CT_CPU_P6},
+//	{"RDSHR",		"",							"0F 36",			CT_CPU_P6 | CT_CPU_CYRIX | CT_CPU_SMM},
+	{"RDTSC",		"",							"0F 31",			CT_CPU_PENT},
+	{"RET",			"",							"C3",				CT_CPU_8086},
+	{"RET",			"imm16",					"C2 iw",			CT_CPU_8086},
+	{"RETF",		"",							"CB",				CT_CPU_8086},
+	{"RETF",		"imm16",					"CA iw",			CT_CPU_8086},
+	{"RETN",		"",							"C3",				CT_CPU_8086},
+	{"RETN",		"imm16",					"C2 iw",			CT_CPU_8086},
+	{"ROL",			"r/m8,1",					"D0 /0",			CT_CPU_8086},
+	{"ROL",			"r/m8,CL",					"D2 /0",			CT_CPU_8086},
+	{"ROL",			"r/m8,imm8",				"C0 /0 ib",			CT_CPU_286},
+	{"ROL",			"r/m16,1",					"po D1 /0",			CT_CPU_8086},
+	{"ROL",			"r/m16,CL",					"po D3 /0",			CT_CPU_8086},
+	{"ROL",			"r/m16,imm8",				"po C1 /0 ib",		CT_CPU_286},
+	{"ROL",			"r/m32,1",					"po D1 /0",			CT_CPU_386},
+	{"ROL",			"r/m32,CL",					"po D3 /0",			CT_CPU_386},
+	{"ROL",			"r/m32,imm8",				"po C1 /0 ib",		CT_CPU_386},
+	{"ROR",			"r/m8,1",					"D0 /1",			CT_CPU_8086},
+	{"ROR",			"r/m8,CL",					"D2 /1",			CT_CPU_8086},
+	{"ROR",			"r/m8,imm8",				"C0 /1 ib",			CT_CPU_286},
+	{"ROR",			"r/m16,1",					"po D1 /1",			CT_CPU_8086},
+	{"ROR",			"r/m16,CL",					"po D3 /1",			CT_CPU_8086},
+	{"ROR",			"r/m16,imm8",				"po C1 /1 ib",		CT_CPU_286},
+	{"ROR",			"r/m32,1",					"po D1 /1",			CT_CPU_386},
+	{"ROR",			"r/m32,CL",					"po D3 /1",			CT_CPU_386},
+	{"ROR",			"r/m32,imm8",				"po C1 /1 ib",		CT_CPU_386},
+//	{"RSDC",		"segreg,mem80",				"0F 79 /r",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
+//	{"RSLDT",		"mem80",					"0F 7B /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
+	{"RORX",		"reg32,r/m32,imm8",			"v0 p2 0F 3A F0 /r ib",	CT_CPU_BMI2},
+	{"RORX",		"reg64,reg64/mem64,imm8",	"v0 p2 pw 0F 3A F0 /r ib",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"ROUNDPD",		"xmmreg,r/m128,imm8",		"po 0F 3A 09 /r ib",	CT_CPU_SSE41},
+	{"ROUNDPS",		"xmmreg,r/m128,imm8",		"po 0F 3A 08 /r ib",	CT_CPU_SSE41},
+	{"ROUNDSD",		"xmmreg,xmmreg/mem64,imm8",	"po 0F 3A 0B /r ib",	CT_CPU_SSE41},
+	{"ROUNDSS",		"xmmreg,xmmreg/mem32,imm8",	"po 0F 3A 0A /r ib",	CT_CPU_SSE41},
+	{"RSM",			"",							"0F AA",			CT_CPU_PENT},
+	{"RSQRTPS",		"xmmreg,r/m128",			"0F 52 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"RSQRTSS",		"xmmreg,r/m128",			"p3 0F 52 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"RSTS",		"mem80",					"0F 7D /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
+	{"SAHF",		"",							"9E",				CT_CPU_8086},
+	{"SAL",			"r/m8,1",					"D0 /4",			CT_CPU_8086},
+	{"SAL",			"r/m8,CL",					"D2 /4",			CT_CPU_8086},
+	{"SAL",			"r/m8,imm8",				"C0 /4 ib",			CT_CPU_286},
+	{"SAL",			"r/m16,1",					"po D1 /4",			CT_CPU_8086},
+	{"SAL",			"r/m16,CL",					"po D3 /4",			CT_CPU_8086},
+	{"SAL",			"r/m16,imm8",				"po C1 /4 ib",		CT_CPU_286},
+	{"SAL",			"r/m32,1",					"po D1 /4",			CT_CPU_386},
+	{"SAL",			"r/m32,CL",					"po D3 /4",			CT_CPU_386},
+	{"SAL",			"r/m32,imm8",				"po C1 /4 ib",		CT_CPU_386},
+	{"SAR",			"r/m8,1",					"D0 /7",			CT_CPU_8086},
+	{"SAR",			"r/m8,CL",					"D2 /7",			CT_CPU_8086},
+	{"SAR",			"r/m8,imm8",				"C0 /7 ib",			CT_CPU_286},
+	{"SAR",			"r/m16,1",					"po D1 /7",			CT_CPU_8086},
+	{"SAR",			"r/m16,CL",					"po D3 /7",			CT_CPU_8086},
+	{"SAR",			"r/m16,imm8",				"po C1 /7 ib",		CT_CPU_286},
+	{"SAR",			"r/m32,1",					"po D1 /7",			CT_CPU_386},
+	{"SAR",			"r/m32,CL",					"po D3 /7",			CT_CPU_386},
+	{"SAR",			"r/m32,imm8",				"po C1 /7 ib",		CT_CPU_386},
+//	{"SALC",		"",							"D6",				CT_CPU_8086 | CT_CPU_UNDOC},
+	{"SARX",		"reg32,r/m32,reg32",		"v3 p3 0F 38 F7 /r",	CT_CPU_BMI2},
+	{"SARX",		"reg64,reg64/mem64,reg64",	"v3 p3 pw 0F 38 F7 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"SBB",			"r/m8,reg8",				"18 /r",			CT_CPU_8086},
+	{"SBB",			"r/m16,reg16",				"po 19 /r",			CT_CPU_8086},
+	{"SBB",			"r/m32,reg32",				"po 19 /r",			CT_CPU_386},
+	{"SBB",			"reg8,r/m8",				"1A /r",			CT_CPU_8086},
+	{"SBB",			"reg16,r/m16",				"po 1B /r",			CT_CPU_8086},
+	{"SBB",			"reg32,r/m32",				"po 1B /r",			CT_CPU_386},
+	{"SBB",			"r/m8,imm8",				"80 /3 ib",			CT_CPU_8086},
+	{"SBB",			"r/m16,imm16",				"po 81 /3 iw",		CT_CPU_8086},
+	{"SBB",			"r/m32,imm32",				"po 81 /3 id",		CT_CPU_386},
+	{"SBB",			"r/m16,imm8",				"po 83 /3 ib",		CT_CPU_8086},
+	{"SBB",			"r/m32,imm8",				"po 83 /3 ib",		CT_CPU_386},
+	{"SBB",			"AL,imm8",					"1C ib",			CT_CPU_8086},
+	{"SBB",			"AX,imm16",					"po 1D iw",			CT_CPU_8086},
+	{"SBB",			"EAX,imm32",				"po 1D id",			CT_CPU_386},
+	{"SCASB",		"",							"AE",				CT_CPU_8086},
+	{"SCASW",		"",							"po AF",			CT_CPU_8086},
+	{"SCASD",		"",							"po AF",			CT_CPU_386},
+	{"SCASQ",		"",							"pw AF",			CT_CPU_X64},
+	{"SETO",		"BYTE r/m8",				"0F 90 /2",			CT_CPU_386},
+	{"SETNO",		"BYTE r/m8",				"0F 91 /2",			CT_CPU_386},
+	{"SETB",		"BYTE r/m8",				"0F 92 /2",			CT_CPU_386},
+	{"SETC",		"BYTE r/m8",				"0F 92 /2",			CT_CPU_386},
+	{"SETNEA",		"BYTE r/m8",				"0F 92 /2",			CT_CPU_386},
+	{"SETAE",		"BYTE r/m8",				"0F 93 /2",			CT_CPU_386},
+	{"SETNB",		"BYTE r/m8",				"0F 93 /2",			CT_CPU_386},
+	{"SETNC",		"BYTE r/m8",				"0F 93 /2",			CT_CPU_386},
+	{"SETE",		"BYTE r/m8",				"0F 94 /2",			CT_CPU_386},
+	{"SETZ",		"BYTE r/m8",				"0F 94 /2",			CT_CPU_386},
+	{"SETNE",		"BYTE r/m8",				"0F 95 /2",			CT_CPU_386},
+	{"SETNZ",		"BYTE r/m8",				"0F 95 /2",			CT_CPU_386},
+	{"SETBE",		"BYTE r/m8",				"0F 96 /2",			CT_CPU_386},
+	{"SETNA",		"BYTE r/m8",				"0F 96 /2",			CT_CPU_386},
+	{"SETA",		"BYTE r/m8",				"0F 97 /2",			CT_CPU_386},
+	{"SETNBE",		"BYTE r/m8",				"0F 97 /2",			CT_CPU_386},
+	{"SETS",		"BYTE r/m8",				"0F 98 /2",			CT_CPU_386},
+	{"SETNS",		"BYTE r/m8",				"0F 99 /2",			CT_CPU_386},
+	{"SETP",		"BYTE r/m8",				"0F 9A /2",			CT_CPU_386},
+	{"SETPE",		"BYTE r/m8",				"0F 9A /2",			CT_CPU_386},
+	{"SETNP",		"BYTE r/m8",				"0F 9B /2",			CT_CPU_386},
+	{"SETPO",		"BYTE r/m8",				"0F 9B /2",			CT_CPU_386},
+	{"SETL",		"BYTE r/m8",				"0F 9C /2",			CT_CPU_386},
+	{"SETNGE",		"BYTE r/m8",				"0F 9C /2",			CT_CPU_386},
+	{"SETGE",		"BYTE r/m8",				"0F 9D /2",			CT_CPU_386},
+	{"SETNL",		"BYTE r/m8",				"0F 9D /2",			CT_CPU_386},
+	{"SETLE",		"BYTE r/m8",				"0F 9E /2",			CT_CPU_386},
+	{"SETNG",		"BYTE r/m8",				"0F 9E /2",			CT_CPU_386},
+	{"SETG",		"BYTE r/m8",				"0F 9F /2",			CT_CPU_386},
+	{"SETNLE",		"BYTE r/m8",				"0F 9F /2",			CT_CPU_386},
+	{"SFENCE",		"",							"0F AE F8",			CT_CPU_KATMAI},
+//	{"SGDT",		"mem",						"0F 01 /0",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"SIDT",		"mem",						"0F 01 /1",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"SLDT",		"r/m16",					"0F 00 /0",			CT_CPU_286 | CT_CPU_PRIV},
+	{"SHA1MSG1",	"xmmreg,r/m128",			"0F 38 C9 /r",		CT_CPU_SHA},
+	{"SHA1MSG2",	"xmmreg,r/m128",			"0F 38 CA /r",		CT_CPU_SHA},
+	{"SHA1NEXTE",	"xmmreg,r/m128",			"0F 38 C8 /r",		CT_CPU_SHA},
+	{"SHA1RNDS4",	"xmmreg,r/m128,imm8",		"0F 3A CC /r ib",	CT_CPU_SHA},
+	{"SHA256MSG1",	"xmmreg,r/m128",			"0F 38 CC /r",		CT_CPU_SHA},
+	{"SHA256MSG2",	"xmmreg,r/m128",			"0F 38 CD /r",		CT_CPU_SHA},
+	{"SHA256RNDS2",	"xmmreg,r/m128",			"0F 38 CB /r",		CT_CPU_SHA},
+	{"SHL",			"BYTE r/m8,1",				"D0 /4",			CT_CPU_8086},
+	{"SHL",			"BYTE r/m8,CL",				"D2 /4",			CT_CPU_8086},
+	{"SHL",			"BYTE r/m8,imm8",			"C0 /4 ib",			CT_CPU_286},
+	{"SHL",			"WORD r/m16,1",				"po D1 /4",			CT_CPU_8086},
+	{"SHL",			"WORD r/m16,CL",			"po D3 /4",			CT_CPU_8086},
+	{"SHL",			"WORD r/m16,imm8",			"po C1 /4 ib",		CT_CPU_286},
+	{"SHL",			"DWORD r/m32,1",			"po D1 /4",			CT_CPU_386},
+	{"SHL",			"DWORD r/m32,CL",			"po D3 /4",			CT_CPU_386},
+	{"SHL",			"DWORD r/m32,imm8",			"po C1 /4 ib",		CT_CPU_386},
+	{"SHLX",		"reg32,r/m32,reg32",		"v3 po 0F 38 F7 /r",	CT_CPU_BMI2},
+	{"SHLX",		"reg64,reg64/mem64,reg64",	"v3 po pw 0F 38 F7 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"SHR",			"BYTE r/m8,1",				"D0 /5",			CT_CPU_8086},
+	{"SHR",			"BYTE r/m8,CL",				"D2 /5",			CT_CPU_8086},
+	{"SHR",			"BYTE r/m8,imm8",			"C0 /5 ib",			CT_CPU_286},
+	{"SHR",			"WORD r/m16,1",				"po D1 /5",			CT_CPU_8086},
+	{"SHR",			"WORD r/m16,CL",			"po D3 /5",			CT_CPU_8086},
+	{"SHR",			"WORD r/m16,imm8",			"po C1 /5 ib",		CT_CPU_286},
+	{"SHR",			"DWORD r/m32,1",			"po D1 /5",			CT_CPU_386},
+	{"SHR",			"DWORD r/m32,CL",			"po D3 /5",			CT_CPU_386},
+	{"SHR",			"DWORD r/m32,imm8",			"po C1 /5 ib",		CT_CPU_386},
+	{"SHLD",		"WORD r/m16,reg16,imm8",	"po 0F A4 /r ib",	CT_CPU_386},
+	{"SHLD",		"DWORD r/m32,reg32,imm8",	"po 0F A4 /r ib",	CT_CPU_386},
+	{"SHLD",		"WORD r/m16,reg16,CL",		"po 0F A5 /r",		CT_CPU_386},
+	{"SHLD",		"DWORD r/m32,reg32,CL",		"po 0F A5 /r",		CT_CPU_386},
+	{"SHRD",		"WORD r/m16,reg16,imm8",	"po 0F AC /r ib",	CT_CPU_386},
+	{"SHRD",		"DWORD r/m32,reg32,imm8",	"po 0F AC /r ib",	CT_CPU_386},
+	{"SHRD",		"WORD r/m16,reg16,CL",		"po 0F AD /r",		CT_CPU_386},
+	{"SHRD",		"DWORD r/m32,reg32,CL",		"po 0F AD /r",		CT_CPU_386},
+	{"SHRX",		"reg32,r/m32,reg32",		"v3 p2 0F 38 F7 /r",	CT_CPU_BMI2},
+	{"SHRX",		"reg64,reg64/mem64,reg64",	"v3 p2 pw 0F 38 F7 /r",	CT_CPU_BMI2 | CT_CPU_X64},
+	{"SHUFPD",		"xmmreg,r/m128,imm8",		"po 0F C6 /r ib",	CT_CPU_SSE2},
+	{"SHUFPS",		"xmmreg,r/m128,imm8",		"0F C6 /r ib",		CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"SMI",			"",							"F1",				CT_CPU_386 | CT_CPU_UNDOC},
+	{"SMINT",		"",							"0F 38",			CT_CPU_P6 | CT_CPU_CYRIX},
+	{"SMINTOLD",	"",							"0F 7E",			CT_CPU_486 | CT_CPU_CYRIX},
+//	{"SMSW",		"r/m16",					"0F 01 /4",			CT_CPU_286 | CT_CPU_PRIV},
+	{"SQRTPD",		"xmmreg,r/m128",			"po 0F 51 /r",		CT_CPU_SSE2},
+	{"SQRTPS",		"xmmreg,r/m128",			"0F 51 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"SQRTSD",		"xmmreg,xmmreg/mem64",		"p2 0F 51 /r",		CT_CPU_SSE2},
+	{"SQRTSS",		"xmmreg,xmmreg/mem32",		"p3 0F 51 /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+	{"STC",			"",							"F9",				CT_CPU_8086},
+	{"STD",			"",							"FD",				CT_CPU_8086},
+	{"STI",			"",							"FB",				CT_CPU_8086},
+	{"STMXCSR",		"mem32",					"0F AE /3",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"STOSB",		"",							"AA",				CT_CPU_8086},
+	{"STOSW",		"",							"po AB",			CT_CPU_8086},
+	{"STOSD",		"",							"po AB",			CT_CPU_386},
+	{"STOSQ",		"",							"pw AB",			CT_CPU_X64},
+//	{"STR",			"r/m16",					"0F 00 /1",			CT_CPU_286 | CT_CPU_PRIV},
+	{"SUB",			"r/m8,reg8",				"28 /r",			CT_CPU_8086},
+	{"SUB",			"r/m16,reg16",				"po 29 /r",			CT_CPU_8086},
+	{"SUB",			"r/m32,reg32",				"po 29 /r",			CT_CPU_386},
+	{"SUB",			"reg8,r/m8",				"2A /r",			CT_CPU_8086},
+	{"SUB",			"reg16,r/m16",				"po 2B /r",			CT_CPU_8086},
+	{"SUB",			"reg32,r/m32",				"po 2B /r",			CT_CPU_386},
+	{"SUB",			"r/m8,imm8",				"80 /5 ib",			CT_CPU_8086},
+	{"SUB",			"r/m16,imm16",				"po 81 /5 iw",		CT_CPU_8086},
+	{"SUB",			"r/m32,imm32",				"po 81 /5 id",		CT_CPU_386},
+	{"SUB",			"r/m16,imm8",				"po 83 /5 ib",		CT_CPU_8086},
+	{"SUB",			"r/m32,imm8",				"po 83 /5 ib",		CT_CPU_386},
+	{"SUB",			"AL,imm8",					"2C ib",			CT_CPU_8086},
+	{"SUB",			"AX,imm16",					"po 2D iw",			CT_CPU_8086},
+	{"SUB",			"EAX,imm32",				"po 2D id",			CT_CPU_386},
+	{"SUBPD",		"xmmreg,r/m128",			"po 0F 5C /r",		CT_CPU_SSE2},
+	{"SUBPS",		"xmmreg,r/m128",			"0F 5C /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"SUBSD",		"xmmreg,xmmreg/mem64",		"p2 0F 5C /r",		CT_CPU_SSE2},
+	{"SUBSS",		"xmmreg,xmmreg/mem32",		"p3 0F 5C /r",		CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"SVDC",		"mem80,segreg",				"0F 78 /r",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
+//	{"SVLDT",		"mem80",					"0F 7A /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
+//	{"SVTS",		"mem80",					"0F 7C /0",			CT_CPU_486 | CT_CPU_CYRIX | CT_CPU_SMM},
+//	{"SYSCALL",		"",							"0F 05",			CT_CPU_P6 | CT_CPU_AMD},
+	{"SYSCALL",		"",							"0F 05",			CT_CPU_X64},
+	{"SYSENTER",	"",							"0F 34",			CT_CPU_P6},
+//	{"SYSEXIT",		"",							"0F 36",			CT_CPU_P6 | CT_CPU_PRIV},
+//	{"SYSRET",		"",							"0F 07",			CT_CPU_P6 | CT_CPU_AMD | CT_CPU_PRIV},
+	{"TEST",		"r/m8,reg8",				"84 /r",			CT_CPU_8086},
+	{"TEST",		"r/m16,reg16",				"po 85 /r",			CT_CPU_8086},
+	{"TEST",		"r/m32,reg32",				"po 85 /r",			CT_CPU_386},
+	{"TEST",		"r/m8,imm8",				"F6 /0 ib",			CT_CPU_8086},
+	{"TEST",		"r/m16,imm16",				"po F7 /0 iw",		CT_CPU_8086},
+	{"TEST",		"r/m32,imm32",				"po F7 /0 id",		CT_CPU_386},
+	{"TEST",		"AL,imm8",					"A8 ib",			CT_CPU_8086},
+	{"TEST",		"AX,imm16",					"po A9 iw",			CT_CPU_8086},
+	{"TEST",		"EAX,imm32",				"po A9 id",			CT_CPU_386},
+	{"TZCNT",		"reg16,r/m16",				"po p3 0F BC /r",	CT_CPU_BMI1},
+	{"TZCNT",		"reg32,r/m32",				"p3 0F BC /r",		CT_CPU_BMI1},
+	{"UCOMISD",		"xmmreg,xmmreg/mem64",		"po 0F 2E /r",		CT_CPU_SSE2},
+	{"UCOMISS",		"xmmreg,xmmreg/mem32",		"0F 2E /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"UD2",			"",							"0F 0B",			CT_CPU_286},
+//	{"UMOV",		"r/m8,reg8",				"0F 10 /r",			CT_CPU_386 | CT_CPU_UNDOC},
+//	{"UMOV",		"r/m16,reg16",				"po 0F 11 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+//	{"UMOV",		"r/m32,reg32",				"po 0F 11 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+//	{"UMOV",		"reg8,r/m8",				"0F 12 /r",			CT_CPU_386 | CT_CPU_UNDOC},
+//	{"UMOV",		"reg16,r/m16",				"po 0F 13 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+//	{"UMOV",		"reg32,r/m32",				"po 0F 13 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+	{"UNPCKHPD",	"xmmreg,r/m128",			"po 0F 15 /r",		CT_CPU_SSE2},
+	{"UNPCKHPS",	"xmmreg,r/m128",			"0F 15 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+	{"UNPCKLPD",	"xmmreg,r/m128",			"po 0F 14 /r",		CT_CPU_SSE2},
+	{"UNPCKLPS",	"xmmreg,r/m128",			"0F 14 /r",			CT_CPU_KATMAI | CT_CPU_SSE},
+//	{"VERR",		"r/m16",					"0F 00 /4",			CT_CPU_286 | CT_CPU_PRIV},
+//	{"VERW",		"r/m16",					"0F 00 /5",			CT_CPU_286 | CT_CPU_PRIV},
+	{"VADDPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 58 /r",	CT_CPU_AVX},
+	{"VADDPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 58 /r",	CT_CPU_AVX},
+	{"VADDPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 58 /r",	CT_CPU_AVX512F},
+	{"VADDPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 58 /r",		CT_CPU_AVX},
+	{"VADDPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 58 /r",	CT_CPU_AVX},
+	{"VADDPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 58 /r",	CT_CPU_AVX512F},
+	{"VADDSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 58 /r",	CT_CPU_AVX},
+	{"VADDSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 58 /r",	CT_CPU_AVX},
+	{"VADDSUBPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F D0 /r",	CT_CPU_AVX},
+	{"VADDSUBPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F D0 /r",	CT_CPU_AVX},
+	{"VADDSUBPS",	"xmmreg,xmmreg,r/m128",		"v2 p2 0F D0 /r",	CT_CPU_AVX},
+	{"VADDSUBPS",	"ymmreg,ymmreg,r/m256",		"v2 vl p2 0F D0 /r",	CT_CPU_AVX},
+	{"VAESDEC",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 DE /r",	CT_CPU_AVX | CT_CPU_AES},
+	{"VAESDECLAST",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 DF /r",	CT_CPU_AVX | CT_CPU_AES},
+	{"VAESENC",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 DC /r",	CT_CPU_AVX | CT_CPU_AES},
+	{"VAESENCLAST",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 DD /r",	CT_CPU_AVX | CT_CPU_AES},
+	{"VAESIMC",		"xmmreg,r/m128",			"v0 po 0F 38 DB /r",	CT_CPU_AVX | CT_CPU_AES},
+	{"VAESKEYGENASSIST",	"xmmreg,r/m128,imm8",	"v0 po 0F 3A DF /r ib",	CT_CPU_AVX | CT_CPU_AES},
+	{"VALIGND",		"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t4 po 0F 3A 03 /r ib",	CT_CPU_AVX512F},
+	{"VALIGNQ",		"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F 3A 03 /r ib",	CT_CPU_AVX512F},
+	{"VANDNPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 55 /r",	CT_CPU_AVX},
+	{"VANDNPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 55 /r",	CT_CPU_AVX},
+	{"VANDNPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 55 /r",		CT_CPU_AVX},
+	{"VANDNPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 55 /r",	CT_CPU_AVX},
+	{"VANDPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 54 /r",	CT_CPU_AVX},
+	{"VANDPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 54 /r",	CT_CPU_AVX},
+	{"VANDPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 54 /r",		CT_CPU_AVX},
+	{"VANDPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 54 /r",	CT_CPU_AVX},
+	{"VBLENDMPD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 65 /r",	CT_CPU_AVX512F},
+	{"VBLENDMPS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 65 /r",	CT_CPU_AVX512F},
+	{"VBLENDPD",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 0D /r ib",	CT_CPU_AVX},
+	{"VBLENDPD",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 0D /r ib",	CT_CPU_AVX},
+	{"VBLENDPS",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 0C /r ib",	CT_CPU_AVX},
+	{"VBLENDPS",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 0C /r ib",	CT_CPU_AVX},
+	{"VBLENDVPD",	"xmmreg,xmmreg,r/m128,xmmreg",	"v2 po 0F 3A 4B /r is",	CT_CPU_AVX},
+	{"VBLENDVPD",	"ymmreg,ymmreg,r/m256,ymmreg",	"v2 vl po 0F 3A 4B /r is",	CT_CPU_AVX},
+	{"VBLENDVPS",	"xmmreg,xmmreg,r/m128,xmmreg",	"v2 po 0F 3A 4A /r is",	CT_CPU_AVX},
+	{"VBLENDVPS",	"ymmreg,ymmreg,r/m256,ymmreg",	"v2 vl po 0F 3A 4A /r is",	CT_CPU_AVX},
+	{"VBROADCASTF128",	"ymmreg,mem128",		"v0 vl po 0F 38 1A /r",	CT_CPU_AVX},
+	{"VBROADCASTF32X4",	"zmmreg,mem128",		"x0 xl po 0F 38 1A /r",	CT_CPU_AVX512F},
+	{"VBROADCASTF64X4",	"zmmreg,mem256",		"x0 xl po pw 0F 38 1B /r",	CT_CPU_AVX512F},
+	{"VBROADCASTI128",	"ymmreg,mem128",		"v0 vl po 0F 38 5A /r",	CT_CPU_AVX2},
+	{"VBROADCASTI32X4",	"zmmreg,mem128",		"x0 xl po 0F 38 5A /r",	CT_CPU_AVX512F},
+	{"VBROADCASTI64X4",	"zmmreg,mem256",		"x0 xl po pw 0F 38 5B /r",	CT_CPU_AVX512F},
+	{"VBROADCASTSD",	"ymmreg,mem64",			"v0 vl po 0F 38 19 /r",	CT_CPU_AVX},
+	{"VBROADCASTSD",	"ymmreg,xmmreg",		"v0 vl po 0F 38 19 /r",	CT_CPU_AVX2},
+	{"VBROADCASTSD",	"zmmreg,xmmreg/mem64",	"x0 xl po pw 0F 38 19 /r",	CT_CPU_AVX512F},
+	{"VBROADCASTSS",	"xmmreg,mem32",			"v0 po 0F 38 18 /r",	CT_CPU_AVX},
+	{"VBROADCASTSS",	"ymmreg,mem32",			"v0 vl po 0F 38 18 /r",	CT_CPU_AVX},
+	{"VBROADCASTSS",	"xmmreg,xmmreg",		"v0 po 0F 38 18 /r",	CT_CPU_AVX2},
+	{"VBROADCASTSS",	"ymmreg,xmmreg",		"v0 vl po 0F 38 18 /r",	CT_CPU_AVX2},
+	{"VBROADCASTSS",	"zmmreg,xmmreg/mem32",	"x0 xl po 0F 38 18 /r",	CT_CPU_AVX512F},
+	{"VCMPEQPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 00",	CT_CPU_AVX},
+	{"VCMPEQPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 00",	CT_CPU_AVX},
+	{"VCMPEQPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 00",	CT_CPU_AVX512F},
+	{"VCMPEQPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 00",	CT_CPU_AVX},
+	{"VCMPEQPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 00",	CT_CPU_AVX},
+	{"VCMPEQPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 00",	CT_CPU_AVX512F},
+	{"VCMPEQSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 00",	CT_CPU_AVX},
+	{"VCMPEQSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 00",	CT_CPU_AVX},
+	{"VCMPEQ_UQPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 08",	CT_CPU_AVX},
+	{"VCMPEQ_UQPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 08",	CT_CPU_AVX},
+	{"VCMPEQ_UQPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 08",	CT_CPU_AVX512F},
+	{"VCMPEQ_UQPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 08",	CT_CPU_AVX},
+	{"VCMPEQ_UQPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 08",	CT_CPU_AVX},
+	{"VCMPEQ_UQPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 08",	CT_CPU_AVX512F},
+	{"VCMPEQ_UQSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 08",	CT_CPU_AVX},
+	{"VCMPEQ_UQSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 08",	CT_CPU_AVX},
+	{"VCMPFALSEPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 0B",	CT_CPU_AVX},
+	{"VCMPFALSEPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 0B",	CT_CPU_AVX},
+	{"VCMPFALSEPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 0B",	CT_CPU_AVX512F},
+	{"VCMPFALSEPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 0B",	CT_CPU_AVX},
+	{"VCMPFALSEPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 0B",	CT_CPU_AVX},
+	{"VCMPFALSEPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 0B",	CT_CPU_AVX512F},
+	{"VCMPFALSESD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 0B",	CT_CPU_AVX},
+	{"VCMPFALSESS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 0B",	CT_CPU_AVX},
+	{"VCMPGEPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 0D",	CT_CPU_AVX},
+	{"VCMPGEPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 0D",	CT_CPU_AVX},
+	{"VCMPGEPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 0D",	CT_CPU_AVX512F},
+	{"VCMPGEPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 0D",	CT_CPU_AVX},
+	{"VCMPGEPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 0D",	CT_CPU_AVX},
+	{"VCMPGEPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 0D",	CT_CPU_AVX512F},
+	{"VCMPGESD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 0D",	CT_CPU_AVX},
+	{"VCMPGESS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 0D",	CT_CPU_AVX},
+	{"VCMPGTPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 0E",	CT_CPU_AVX},
+	{"VCMPGTPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 0E",	CT_CPU_AVX},
+	{"VCMPGTPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 0E",	CT_CPU_AVX512F},
+	{"VCMPGTPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 0E",	CT_CPU_AVX},
+	{"VCMPGTPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 0E",	CT_CPU_AVX},
+	{"VCMPGTPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 0E",	CT_CPU_AVX512F},
+	{"VCMPGTSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 0E",	CT_CPU_AVX},
+	{"VCMPGTSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 0E",	CT_CPU_AVX},
+	{"VCMPLEPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 02",	CT_CPU_AVX},
+	{"VCMPLEPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 02",	CT_CPU_AVX},
+	{"VCMPLEPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 02",	CT_CPU_AVX512F},
+	{"VCMPLEPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 02",	CT_CPU_AVX},
+	{"VCMPLEPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 02",	CT_CPU_AVX},
+	{"VCMPLEPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 02",	CT_CPU_AVX512F},
+	{"VCMPLESD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 02",	CT_CPU_AVX},
+	{"VCMPLESS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 02",	CT_CPU_AVX},
+	{"VCMPLTPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 01",	CT_CPU_AVX},
+	{"VCMPLTPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 01",	CT_CPU_AVX},
+	{"VCMPLTPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 01",	CT_CPU_AVX512F},
+	{"VCMPLTPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 01",	CT_CPU_AVX},
+	{"VCMPLTPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 01",	CT_CPU_AVX},
+	{"VCMPLTPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 01",	CT_CPU_AVX512F},
+	{"VCMPLTSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 01",	CT_CPU_AVX},
+	{"VCMPLTSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 01",	CT_CPU_AVX},
+	{"VCMPNEQPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 04",	CT_CPU_AVX},
+	{"VCMPNEQPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 04",	CT_CPU_AVX},
+	{"VCMPNEQPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 04",	CT_CPU_AVX512F},
+	{"VCMPNEQPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 04",	CT_CPU_AVX},
+	{"VCMPNEQPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 04",	CT_CPU_AVX},
+	{"VCMPNEQPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 04",	CT_CPU_AVX512F},
+	{"VCMPNEQSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 04",	CT_CPU_AVX},
+	{"VCMPNEQSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 04",	CT_CPU_AVX},
+	{"VCMPNEQ_OQPS",	"xmmreg,xmmreg,r/m128",	"v2 0F C2 /r 0C",	CT_CPU_AVX},
+	{"VCMPNEQ_OQPS",	"ymmreg,ymmreg,r/m256",	"v2 vl 0F C2 /r 0C",	CT_CPU_AVX},
+	{"VCMPNEQ_OQPS",	"kreg,zmmreg,r/m512",	"x2 xl t4 0F C2 /r 0C",	CT_CPU_AVX512F},
+	{"VCMPNEQ_OQPD",	"xmmreg,xmmreg,r/m128",	"v2 po 0F C2 /r 0C",	CT_CPU_AVX},
+	{"VCMPNEQ_OQPD",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F C2 /r 0C",	CT_CPU_AVX},
+	{"VCMPNEQ_OQPD",	"kreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F C2 /r 0C",	CT_CPU_AVX512F},
+	{"VCMPNEQ_OQSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 0C",	CT_CPU_AVX},
+	{"VCMPNEQ_OQSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 0C",	CT_CPU_AVX},
+	{"VCMPNGEPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 09",	CT_CPU_AVX},
+	{"VCMPNGEPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 09",	CT_CPU_AVX},
+	{"VCMPNGEPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 09",	CT_CPU_AVX512F},
+	{"VCMPNGEPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 09",	CT_CPU_AVX},
+	{"VCMPNGEPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 09",	CT_CPU_AVX},
+	{"VCMPNGEPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 09",	CT_CPU_AVX512F},
+	{"VCMPNGESD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 09",	CT_CPU_AVX},
+	{"VCMPNGESS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 09",	CT_CPU_AVX},
+	{"VCMPNGTPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 0A",	CT_CPU_AVX},
+	{"VCMPNGTPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 0A",	CT_CPU_AVX},
+	{"VCMPNGTPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 0A",	CT_CPU_AVX512F},
+	{"VCMPNGTPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 0A",	CT_CPU_AVX},
+	{"VCMPNGTPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 0A",	CT_CPU_AVX},
+	{"VCMPNGTPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 0A",	CT_CPU_AVX512F},
+	{"VCMPNGTSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 0A",	CT_CPU_AVX},
+	{"VCMPNGTSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 0A",	CT_CPU_AVX},
+	{"VCMPNLEPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 06",	CT_CPU_AVX},
+	{"VCMPNLEPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 06",	CT_CPU_AVX},
+	{"VCMPNLEPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 06",	CT_CPU_AVX512F},
+	{"VCMPNLEPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 06",	CT_CPU_AVX},
+	{"VCMPNLEPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 06",	CT_CPU_AVX},
+	{"VCMPNLEPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 06",	CT_CPU_AVX512F},
+	{"VCMPNLESD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 06",	CT_CPU_AVX},
+	{"VCMPNLESS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 06",	CT_CPU_AVX},
+	{"VCMPNLTPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 05",	CT_CPU_AVX},
+	{"VCMPNLTPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 05",	CT_CPU_AVX},
+	{"VCMPNLTPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 05",	CT_CPU_AVX512F},
+	{"VCMPNLTPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 05",	CT_CPU_AVX},
+	{"VCMPNLTPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 05",	CT_CPU_AVX},
+	{"VCMPNLTPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 05",	CT_CPU_AVX512F},
+	{"VCMPNLTSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 05",	CT_CPU_AVX},
+	{"VCMPNLTSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 05",	CT_CPU_AVX},
+	{"VCMPORDPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 07",	CT_CPU_AVX},
+	{"VCMPORDPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 07",	CT_CPU_AVX},
+	{"VCMPORDPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 07",	CT_CPU_AVX512F},
+	{"VCMPORDPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 07",	CT_CPU_AVX},
+	{"VCMPORDPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 07",	CT_CPU_AVX},
+	{"VCMPORDPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 07",	CT_CPU_AVX512F},
+	{"VCMPORDSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 07",	CT_CPU_AVX},
+	{"VCMPORDSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 07",	CT_CPU_AVX},
+	{"VCMPPD",		"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F C2 /r ib",	CT_CPU_AVX},
+	{"VCMPPD",		"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F C2 /r ib",	CT_CPU_AVX},
+	{"VCMPPD",		"kreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F C2 /r ib",	CT_CPU_AVX512F},
+	{"VCMPPS",		"xmmreg,xmmreg,r/m128,imm8",	"v2 0F C2 /r ib",	CT_CPU_AVX},
+	{"VCMPPS",		"ymmreg,ymmreg,r/m256,imm8",	"v2 vl 0F C2 /r ib",	CT_CPU_AVX},
+	{"VCMPPS",		"kreg,zmmreg,r/m512,imm8",	"x2 xl t4 0F C2 /r ib",	CT_CPU_AVX512F},
+	{"VCMPSD",		"xmmreg,xmmreg,xmmreg/mem64,imm8",	"v2 p2 0F C2 /r ib",	CT_CPU_AVX},
+	{"VCMPSS",		"xmmreg,xmmreg,xmmreg/mem32,imm8",	"v2 p3 0F C2 /r ib",	CT_CPU_AVX},
+	{"VCMPTRUEPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 0F",	CT_CPU_AVX},
+	{"VCMPTRUEPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 0F",	CT_CPU_AVX},
+	{"VCMPTRUEPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 0F",	CT_CPU_AVX512F},
+	{"VCMPTRUEPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 0F",	CT_CPU_AVX},
+	{"VCMPTRUEPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 0F",	CT_CPU_AVX},
+	{"VCMPTRUEPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 0F",	CT_CPU_AVX512F},
+	{"VCMPTRUESD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 0F",	CT_CPU_AVX},
+	{"VCMPTRUESS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 0F",	CT_CPU_AVX},
+	{"VCMPUNORDPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F C2 /r 03",	CT_CPU_AVX},
+	{"VCMPUNORDPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F C2 /r 03",	CT_CPU_AVX},
+	{"VCMPUNORDPD",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F C2 /r 03",	CT_CPU_AVX512F},
+	{"VCMPUNORDPS",	"xmmreg,xmmreg,r/m128",		"v2 0F C2 /r 03",	CT_CPU_AVX},
+	{"VCMPUNORDPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F C2 /r 03",	CT_CPU_AVX},
+	{"VCMPUNORDPS",	"kreg,zmmreg,r/m512",		"x2 xl t4 0F C2 /r 03",	CT_CPU_AVX512F},
+	{"VCMPUNORDSD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F C2 /r 03",	CT_CPU_AVX},
+	{"VCMPUNORDSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F C2 /r 03",	CT_CPU_AVX},
+	{"VCOMISD",		"xmmreg,xmmreg/mem64",		"v0 po 0F 2F /r",	CT_CPU_AVX},
+	{"VCOMISS",		"xmmreg,xmmreg/mem32",		"v0 0F 2F /r",		CT_CPU_AVX},
+	{"VCVTDQ2PD",	"xmmreg,xmmreg/mem64",		"v0 p3 0F E6 /r",	CT_CPU_AVX},
+	{"VCVTDQ2PD",	"ymmreg,r/m128",			"v0 vl p3 0F E6 /r",	CT_CPU_AVX},
+	{"VCVTDQ2PD",	"zmmreg,r/m256",			"x0 xl p3 0F E6 /r",	CT_CPU_AVX512F},
+	{"VCVTDQ2PS",	"xmmreg,r/m128",			"v0 0F 5B /r",		CT_CPU_AVX},
+	{"VCVTDQ2PS",	"ymmreg,r/m256",			"v0 vl 0F 5B /r",	CT_CPU_AVX},
+	{"VCVTDQ2PS",	"zmmreg,r/m512",			"x0 xl t4 0F 5B /r",	CT_CPU_AVX512F},
+	{"VCVTPD2DQ",	"xmmreg,r/m128",			"v0 p2 0F E6 /r",	CT_CPU_AVX},
+	{"VCVTPD2DQ",	"xmmreg,r/m256",			"v0 vl p2 0F E6 /r",	CT_CPU_AVX},
+	{"VCVTPD2DQ",	"ymmreg,r/m512",			"x0 xl t8 p2 pw 0F E6 /r",	CT_CPU_AVX512F},
+	{"VCVTPD2PS",	"xmmreg,r/m128",			"v0 po 0F 5A /r",	CT_CPU_AVX},
+	{"VCVTPD2PS",	"xmmreg,r/m256",			"v0 vl po 0F 5A /r",	CT_CPU_AVX},
+	{"VCVTPD2PS",	"ymmreg,r/m512",			"x0 xl t8 po pw 0F 5A /r",	CT_CPU_AVX512F},
+	{"VCVTPS2DQ",	"xmmreg,r/m128",			"v0 po 0F 5B /r",	CT_CPU_AVX},
+	{"VCVTPS2DQ",	"ymmreg,r/m256",			"v0 vl po 0F 5B /r",	CT_CPU_AVX},
+	{"VCVTPS2DQ",	"zmmreg,r/m512",			"x0 xl t4 po 0F 5B /r",	CT_CPU_AVX512F},
+	{"VCVTPS2PD",	"xmmreg,xmmreg/mem64",		"v0 0F 5A /r",		CT_CPU_AVX},
+	{"VCVTPS2PD",	"ymmreg,r/m128",			"v0 vl 0F 5A /r",	CT_CPU_AVX},
+	{"VCVTPS2PD",	"zmmreg,r/m256",			"x0 xl 0F 5A /r",	CT_CPU_AVX512F},
+	{"VCVTPS2UDQ",	"zmmreg,r/m512",			"x0 xl t4 0F 79 /r",	CT_CPU_AVX512F},
+	{"VCVTSD2SI",	"reg32,xmmreg/mem64",		"v0 p2 0F 2D /r",	CT_CPU_AVX},
+	{"VCVTSD2SI",	"reg64,xmmreg/mem64",		"v0 p2 pw 0F 2D /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VCVTSD2SS",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 5A /r",	CT_CPU_AVX},
+	{"VCVTSI2SD",	"xmmreg,xmmreg,r/m32",		"v2 p2 0F 2A /r",	CT_CPU_AVX},
+	{"VCVTSI2SD",	"xmmreg,xmmreg,reg64/mem64",	"v2 p2 pw 0F 2A /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VCVTSI2SS",	"xmmreg,xmmreg,r/m32",		"v2 p3 0F 2A /r",	CT_CPU_AVX},
+	{"VCVTSI2SS",	"xmmreg,xmmreg,reg64/mem64",	"v2 p3 pw 0F 2A /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VCVTSS2SD",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 5A /r",	CT_CPU_AVX},
+	{"VCVTSS2SI",	"reg32,xmmreg/mem32",		"v0 p3 0F 2D /r",	CT_CPU_AVX},
+	{"VCVTSS2SI",	"reg64,xmmreg/mem32",		"v0 p3 pw 0F 2D /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VCVTTPD2DQ",	"xmmreg,r/m128",			"v0 po 0F E6 /r",	CT_CPU_AVX},
+	{"VCVTTPD2DQ",	"xmmreg,r/m256",			"v0 vl po 0F E6 /r",	CT_CPU_AVX},
+	{"VCVTTPD2DQ",	"ymmreg,r/m512",			"x0 xl t8 po pw 0F E6 /r",	CT_CPU_AVX512F},
+	{"VCVTTPS2DQ",	"xmmreg,r/m128",			"v0 p3 0F 5B /r",	CT_CPU_AVX},
+	{"VCVTTPS2DQ",	"ymmreg,r/m256",			"v0 vl p3 0F 5B /r",	CT_CPU_AVX},
+	{"VCVTTPS2DQ",	"zmmreg,r/m512",			"x0 xl t4 p3 0F 5B /r",	CT_CPU_AVX512F},
+	{"VCVTTPS2UDQ",	"zmmreg,r/m512",			"x0 xl t4 0F 78 /r",	CT_CPU_AVX512F},
+	{"VCVTTSD2SI",	"reg32,xmmreg/mem64",		"v0 p2 0F 2C /r",	CT_CPU_AVX},
+	{"VCVTTSD2SI",	"reg64,xmmreg/mem64",		"v0 p2 pw 0F 2C /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VCVTTSS2SI",	"reg32,xmmreg/mem32",		"v0 p3 0F 2C /r",	CT_CPU_AVX},
+	{"VCVTTSS2SI",	"reg64,xmmreg/mem32",		"v0 p3 pw 0F 2C /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VCVTUDQ2PD",	"zmmreg,r/m256",			"x0 xl p3 0F 7A /r",	CT_CPU_AVX512F},
+	{"VCVTUDQ2PS",	"zmmreg,r/m512",			"x0 xl t4 p2 0F 7A /r",	CT_CPU_AVX512F},
+	{"VDIVPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 5E /r",	CT_CPU_AVX},
+	{"VDIVPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 5E /r",	CT_CPU_AVX},
+	{"VDIVPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 5E /r",	CT_CPU_AVX512F},
+	{"VDIVPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 5E /r",		CT_CPU_AVX},
+	{"VDIVPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 5E /r",	CT_CPU_AVX},
+	{"VDIVPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 5E /r",	CT_CPU_AVX512F},
+	{"VDIVSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 5E /r",	CT_CPU_AVX},
+	{"VDIVSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 5E /r",	CT_CPU_AVX},
+	{"VDPPD",		"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 41 /r ib",	CT_CPU_AVX},
+	{"VDPPS",		"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 40 /r ib",	CT_CPU_AVX},
+	{"VDPPS",		"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 40 /r ib",	CT_CPU_AVX},
+	{"VEXTRACTF128",	"r/m128,ymmreg,imm8",	"v0 vl po 0F 3A 19 /r ib",	CT_CPU_AVX},
+	{"VEXTRACTF32X4",	"r/m128,zmmreg,imm8",	"x0 xl po 0F 3A 19 /r ib",	CT_CPU_AVX512F},
+	{"VEXTRACTF64X4",	"r/m256,zmmreg,imm8",	"x0 xl po pw 0F 3A 1B /r ib",	CT_CPU_AVX512F},
+	{"VEXTRACTI128",	"r/m128,ymmreg,imm8",	"v0 vl po 0F 3A 39 /r ib",	CT_CPU_AVX2},
+	{"VEXTRACTI32X4",	"r/m128,zmmreg,imm8",	"x0 xl po 0F 3A 39 /r ib",	CT_CPU_AVX512F},
+	{"VEXTRACTI64X4",	"r/m256,zmmreg,imm8",	"x0 xl po pw 0F 3A 3B /r ib",	CT_CPU_AVX512F},
+	{"VEXTRACTPS",	"r/m32,xmmreg,imm8",		"v0 po 0F 3A 17 /r ib",	CT_CPU_AVX},
+	{"VFMADD132PD",	"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 98 /r",	CT_CPU_FMA},
+	{"VFMADD132PD",	"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 98 /r",	CT_CPU_FMA},
+	{"VFMADD132PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 98 /r",	CT_CPU_AVX512F},
+	{"VFMADD132PS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 98 /r",	CT_CPU_FMA},
+	{"VFMADD132PS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 98 /r",	CT_CPU_FMA},
+	{"VFMADD132PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 98 /r",	CT_CPU_AVX512F},
+	{"VFMADD132SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 99 /r",	CT_CPU_FMA},
+	{"VFMADD132SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 99 /r",	CT_CPU_FMA},
+	{"VFMADD213PD",	"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 A8 /r",	CT_CPU_FMA},
+	{"VFMADD213PD",	"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 A8 /r",	CT_CPU_FMA},
+	{"VFMADD213PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 A8 /r",	CT_CPU_AVX512F},
+	{"VFMADD213PS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 A8 /r",	CT_CPU_FMA},
+	{"VFMADD213PS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 A8 /r",	CT_CPU_FMA},
+	{"VFMADD213PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 A8 /r",	CT_CPU_AVX512F},
+	{"VFMADD213SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 A9 /r",	CT_CPU_FMA},
+	{"VFMADD213SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 A9 /r",	CT_CPU_FMA},
+	{"VFMADD231PD",	"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 B8 /r",	CT_CPU_FMA},
+	{"VFMADD231PD",	"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 B8 /r",	CT_CPU_FMA},
+	{"VFMADD231PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 B8 /r",	CT_CPU_AVX512F},
+	{"VFMADD231PS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 B8 /r",	CT_CPU_FMA},
+	{"VFMADD231PS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 B8 /r",	CT_CPU_FMA},
+	{"VFMADD231PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 B8 /r",	CT_CPU_AVX512F},
+	{"VFMADD231SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 B9 /r",	CT_CPU_FMA},
+	{"VFMADD231SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 B9 /r",	CT_CPU_FMA},
+	{"VFMADDSUB132PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 96 /r",	CT_CPU_FMA},
+	{"VFMADDSUB132PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 96 /r",	CT_CPU_FMA},
+	{"VFMADDSUB132PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 96 /r",	CT_CPU_AVX512F},
+	{"VFMADDSUB132PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 96 /r",	CT_CPU_FMA},
+	{"VFMADDSUB132PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 96 /r",	CT_CPU_FMA},
+	{"VFMADDSUB132PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 96 /r",	CT_CPU_AVX512F},
+	{"VFMADDSUB213PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 A6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB213PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 A6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB213PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 A6 /r",	CT_CPU_AVX512F},
+	{"VFMADDSUB213PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 A6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB213PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 A6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB213PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 A6 /r",	CT_CPU_AVX512F},
+	{"VFMADDSUB231PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 B6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB231PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 B6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB231PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 B6 /r",	CT_CPU_AVX512F},
+	{"VFMADDSUB231PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 B6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB231PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 B6 /r",	CT_CPU_FMA},
+	{"VFMADDSUB231PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 B6 /r",	CT_CPU_AVX512F},
+	{"VFMSUB132PD",	"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 9A /r",	CT_CPU_FMA},
+	{"VFMSUB132PD",	"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 9A /r",	CT_CPU_FMA},
+	{"VFMSUB132PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 9A /r",	CT_CPU_AVX512F},
+	{"VFMSUB132PS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 9A /r",	CT_CPU_FMA},
+	{"VFMSUB132PS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 9A /r",	CT_CPU_FMA},
+	{"VFMSUB132PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 9A /r",	CT_CPU_AVX512F},
+	{"VFMSUB132SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 9B /r",	CT_CPU_FMA},
+	{"VFMSUB132SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 9B /r",	CT_CPU_FMA},
+	{"VFMSUB213PD",	"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 AA /r",	CT_CPU_FMA},
+	{"VFMSUB213PD",	"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 AA /r",	CT_CPU_FMA},
+	{"VFMSUB213PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 AA /r",	CT_CPU_AVX512F},
+	{"VFMSUB213PS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 AA /r",	CT_CPU_FMA},
+	{"VFMSUB213PS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 AA /r",	CT_CPU_FMA},
+	{"VFMSUB213PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 AA /r",	CT_CPU_AVX512F},
+	{"VFMSUB213SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 AB /r",	CT_CPU_FMA},
+	{"VFMSUB213SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 AB /r",	CT_CPU_FMA},
+	{"VFMSUB231PD",	"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 BA /r",	CT_CPU_FMA},
+	{"VFMSUB231PD",	"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 BA /r",	CT_CPU_FMA},
+	{"VFMSUB231PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 BA /r",	CT_CPU_AVX512F},
+	{"VFMSUB231PS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 BA /r",	CT_CPU_FMA},
+	{"VFMSUB231PS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 BA /r",	CT_CPU_FMA},
+	{"VFMSUB231PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 BA /r",	CT_CPU_AVX512F},
+	{"VFMSUB231SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 BB /r",	CT_CPU_FMA},
+	{"VFMSUB231SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 BB /r",	CT_CPU_FMA},
+	{"VFMSUBADD132PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 97 /r",	CT_CPU_FMA},
+	{"VFMSUBADD132PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 97 /r",	CT_CPU_FMA},
+	{"VFMSUBADD132PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 97 /r",	CT_CPU_AVX512F},
+	{"VFMSUBADD132PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 97 /r",	CT_CPU_FMA},
+	{"VFMSUBADD132PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 97 /r",	CT_CPU_FMA},
+	{"VFMSUBADD132PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 97 /r",	CT_CPU_AVX512F},
+	{"VFMSUBADD213PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 A7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD213PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 A7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD213PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 A7 /r",	CT_CPU_AVX512F},
+	{"VFMSUBADD213PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 A7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD213PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 A7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD213PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 A7 /r",	CT_CPU_AVX512F},
+	{"VFMSUBADD231PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 B7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD231PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 B7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD231PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 B7 /r",	CT_CPU_AVX512F},
+	{"VFMSUBADD231PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 B7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD231PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 B7 /r",	CT_CPU_FMA},
+	{"VFMSUBADD231PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 B7 /r",	CT_CPU_AVX512F},
+	{"VFNMADD132PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 9C /r",	CT_CPU_FMA},
+	{"VFNMADD132PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 9C /r",	CT_CPU_FMA},
+	{"VFNMADD132PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 9C /r",	CT_CPU_AVX512F},
+	{"VFNMADD132PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 9C /r",	CT_CPU_FMA},
+	{"VFNMADD132PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 9C /r",	CT_CPU_FMA},
+	{"VFNMADD132PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 9C /r",	CT_CPU_AVX512F},
+	{"VFNMADD132SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 9D /r",	CT_CPU_FMA},
+	{"VFNMADD132SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 9D /r",	CT_CPU_FMA},
+	{"VFNMADD213PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 AC /r",	CT_CPU_FMA},
+	{"VFNMADD213PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 AC /r",	CT_CPU_FMA},
+	{"VFNMADD213PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 AC /r",	CT_CPU_AVX512F},
+	{"VFNMADD213PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 AC /r",	CT_CPU_FMA},
+	{"VFNMADD213PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 AC /r",	CT_CPU_FMA},
+	{"VFNMADD213PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 AC /r",	CT_CPU_AVX512F},
+	{"VFNMADD213SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 AD /r",	CT_CPU_FMA},
+	{"VFNMADD213SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 AD /r",	CT_CPU_FMA},
+	{"VFNMADD231PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 BC /r",	CT_CPU_FMA},
+	{"VFNMADD231PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 BC /r",	CT_CPU_FMA},
+	{"VFNMADD231PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 BC /r",	CT_CPU_AVX512F},
+	{"VFNMADD231PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 BC /r",	CT_CPU_FMA},
+	{"VFNMADD231PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 BC /r",	CT_CPU_FMA},
+	{"VFNMADD231PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 BC /r",	CT_CPU_AVX512F},
+	{"VFNMADD231SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 BD /r",	CT_CPU_FMA},
+	{"VFNMADD231SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 BD /r",	CT_CPU_FMA},
+	{"VFNMSUB132PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 9E /r",	CT_CPU_FMA},
+	{"VFNMSUB132PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 9E /r",	CT_CPU_FMA},
+	{"VFNMSUB132PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 9E /r",	CT_CPU_AVX512F},
+	{"VFNMSUB132PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 9E /r",	CT_CPU_FMA},
+	{"VFNMSUB132PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 9E /r",	CT_CPU_FMA},
+	{"VFNMSUB132PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 9E /r",	CT_CPU_AVX512F},
+	{"VFNMSUB132SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 9F /r",	CT_CPU_FMA},
+	{"VFNMSUB132SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 9F /r",	CT_CPU_FMA},
+	{"VFNMSUB213PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 AE /r",	CT_CPU_FMA},
+	{"VFNMSUB213PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 AE /r",	CT_CPU_FMA},
+	{"VFNMSUB213PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 AE /r",	CT_CPU_AVX512F},
+	{"VFNMSUB213PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 AE /r",	CT_CPU_FMA},
+	{"VFNMSUB213PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 AE /r",	CT_CPU_FMA},
+	{"VFNMSUB213PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 AE /r",	CT_CPU_AVX512F},
+	{"VFNMSUB213SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 AF /r",	CT_CPU_FMA},
+	{"VFNMSUB213SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 AF /r",	CT_CPU_FMA},
+	{"VFNMSUB231PD",	"xmmreg,xmmreg,r/m128",	"v2 po pw 0F 38 BE /r",	CT_CPU_FMA},
+	{"VFNMSUB231PD",	"ymmreg,ymmreg,r/m256",	"v2 vl po pw 0F 38 BE /r",	CT_CPU_FMA},
+	{"VFNMSUB231PD",	"zmmreg,zmmreg,r/m512",	"x2 xl t8 po pw 0F 38 BE /r",	CT_CPU_AVX512F},
+	{"VFNMSUB231PS",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 38 BE /r",	CT_CPU_FMA},
+	{"VFNMSUB231PS",	"ymmreg,ymmreg,r/m256",	"v2 vl po 0F 38 BE /r",	CT_CPU_FMA},
+	{"VFNMSUB231PS",	"zmmreg,zmmreg,r/m512",	"x2 xl t4 po 0F 38 BE /r",	CT_CPU_AVX512F},
+	{"VFNMSUB231SD",	"xmmreg,xmmreg,xmmreg/mem64",	"v2 po pw 0F 38 BF /r",	CT_CPU_FMA},
+	{"VFNMSUB231SS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 po 0F 38 BF /r",	CT_CPU_FMA},
+	{"VGATHERDPD",	"xmmreg,vm32x,xmmreg",		"v3 po pw 0F 38 92 /r",	CT_CPU_AVX2},
+	{"VGATHERDPD",	"ymmreg,vm32x,ymmreg",		"v3 vl po pw 0F 38 92 /r",	CT_CPU_AVX2},
+	{"VGATHERDPS",	"xmmreg,vm32x,xmmreg",		"v3 po 0F 38 92 /r",	CT_CPU_AVX2},
+	{"VGATHERDPS",	"ymmreg,vm32y,ymmreg",		"v3 vl po 0F 38 92 /r",	CT_CPU_AVX2},
+	{"VGATHERQPD",	"xmmreg,vm64x,xmmreg",		"v3 po pw 0F 38 93 /r",	CT_CPU_AVX2},
+	{"VGATHERQPD",	"ymmreg,vm64y,ymmreg",		"v3 vl po pw 0F 38 93 /r",	CT_CPU_AVX2},
+	{"VGATHERQPS",	"xmmreg,vm64x,xmmreg",		"v3 po 0F 38 93 /r",	CT_CPU_AVX2},
+	{"VGATHERQPS",	"xmmreg,vm64y,xmmreg",		"v3 vl po 0F 38 93 /r",	CT_CPU_AVX2},
+	{"VHADDPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 7C /r",	CT_CPU_AVX},
+	{"VHADDPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 7C /r",	CT_CPU_AVX},
+	{"VHADDPS",		"xmmreg,xmmreg,r/m128",		"v2 p2 0F 7C /r",	CT_CPU_AVX},
+	{"VHADDPS",		"ymmreg,ymmreg,r/m256",		"v2 vl p2 0F 7C /r",	CT_CPU_AVX},
+	{"VHSUBPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 7D /r",	CT_CPU_AVX},
+	{"VHSUBPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 7D /r",	CT_CPU_AVX},
+	{"VHSUBPS",		"xmmreg,xmmreg,r/m128",		"v2 p2 0F 7D /r",	CT_CPU_AVX},
+	{"VHSUBPS",		"ymmreg,ymmreg,r/m256",		"v2 vl p2 0F 7D /r",	CT_CPU_AVX},
+	{"VINSERTF128",	"ymmreg,ymmreg,r/m128,imm8",	"v2 vl po 0F 3A 18 /r ib",	CT_CPU_AVX},
+	{"VINSERTF32X4",	"zmmreg,zmmreg,r/m128,imm8",	"x2 xl po 0F 3A 18 /r ib",	CT_CPU_AVX512F},
+	{"VINSERTF64X4",	"zmmreg,zmmreg,r/m256,imm8",	"x2 xl po pw 0F 3A 1A /r ib",	CT_CPU_AVX512F},
+	{"VINSERTI128",	"ymmreg,ymmreg,r/m128,imm8",	"v2 vl po 0F 3A 38 /r ib",	CT_CPU_AVX2},
+	{"VINSERTI32X4",	"zmmreg,zmmreg,r/m128,imm8",	"x2 xl po 0F 3A 38 /r ib",	CT_CPU_AVX512F},
+	{"VINSERTI64X4",	"zmmreg,zmmreg,r/m256,imm8",	"x2 xl po pw 0F 3A 3A /r ib",	CT_CPU_AVX512F},
+	{"VINSERTPS",	"xmmreg,xmmreg,xmmreg/mem32,imm8",	"v2 po 0F 3A 21 /r ib",	CT_CPU_AVX},
+	{"VLDDQU",		"xmmreg,mem128",			"v0 p2 0F F0 /r",	CT_CPU_AVX},
+	{"VLDDQU",		"ymmreg,mem256",			"v0 vl p2 0F F0 /r",	CT_CPU_AVX},
+	{"VLDMXCSR",	"mem32",					"v0 0F AE /2",		CT_CPU_AVX},
+	{"VMASKMOVPD",	"xmmreg,xmmreg,mem128",		"v2 po 0F 38 2D /r",	CT_CPU_AVX},
+	{"VMASKMOVPD",	"ymmreg,ymmreg,mem256",		"v2 vl po 0F 38 2D /r",	CT_CPU_AVX},
+	{"VMASKMOVPD",	"mem128,xmmreg,xmmreg",		"v2 po 0F 38 2F /r",	CT_CPU_AVX},
+	{"VMASKMOVPD",	"mem256,ymmreg,ymmreg",		"v2 vl po 0F 38 2F /r",	CT_CPU_AVX},
+	{"VMASKMOVPS",	"xmmreg,xmmreg,mem128",		"v2 po 0F 38 2C /r",	CT_CPU_AVX},
+	{"VMASKMOVPS",	"ymmreg,ymmreg,mem256",		"v2 vl po 0F 38 2C /r",	CT_CPU_AVX},
+	{"VMASKMOVPS",	"mem128,xmmreg,xmmreg",		"v2 po 0F 38 2E /r",	CT_CPU_AVX},
+	{"VMASKMOVPS",	"mem256,ymmreg,ymmreg",		"v2 vl po 0F 38 2E /r",	CT_CPU_AVX},
+	{"VMAXPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 5F /r",	CT_CPU_AVX},
+	{"VMAXPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 5F /r",	CT_CPU_AVX},
+	{"VMAXPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 5F /r",	CT_CPU_AVX512F},
+	{"VMAXPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 5F /r",		CT_CPU_AVX},
+	{"VMAXPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 5F /r",	CT_CPU_AVX},
+	{"VMAXPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 5F /r",	CT_CPU_AVX512F},
+	{"VMAXSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 5F /r",	CT_CPU_AVX},
+	{"VMAXSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 5F /r",	CT_CPU_AVX},
+	{"VMINPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 5D /r",	CT_CPU_AVX},
+	{"VMINPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 5D /r",	CT_CPU_AVX},
+	{"VMINPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 5D /r",	CT_CPU_AVX512F},
+	{"VMINPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 5D /r",		CT_CPU_AVX},
+	{"VMINPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 5D /r",	CT_CPU_AVX},
+	{"VMINPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 5D /r",	CT_CPU_AVX512F},
+	{"VMINSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 5D /r",	CT_CPU_AVX},
+	{"VMINSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 5D /r",	CT_CPU_AVX},
+	{"VMOVAPD",		"xmmreg,r/m128",			"v0 po 0F 28 /r",	CT_CPU_AVX},
+	{"VMOVAPD",		"ymmreg,r/m256",			"v0 vl po 0F 28 /r",	CT_CPU_AVX},
+	{"VMOVAPD",		"r/m128,xmmreg",			"v0 po 0F 29 /r",	CT_CPU_AVX},
+	{"VMOVAPD",		"r/m256,ymmreg",			"v0 vl po 0F 29 /r",	CT_CPU_AVX},
+	{"VMOVAPD",		"zmmreg,r/m512",			"x0 xl po pw 0F 28 /r",	CT_CPU_AVX512F},
+	{"VMOVAPD",		"r/m512,zmmreg",			"x0 xl po pw 0F 29 /r",	CT_CPU_AVX512F},
+	{"VMOVAPS",		"xmmreg,r/m128",			"v0 0F 28 /r",		CT_CPU_AVX},
+	{"VMOVAPS",		"ymmreg,r/m256",			"v0 vl 0F 28 /r",	CT_CPU_AVX},
+	{"VMOVAPS",		"r/m128,xmmreg",			"v0 0F 29 /r",		CT_CPU_AVX},
+	{"VMOVAPS",		"r/m256,ymmreg",			"v0 vl 0F 29 /r",	CT_CPU_AVX},
+	{"VMOVAPS",		"zmmreg,r/m512",			"x0 xl 0F 28 /r",	CT_CPU_AVX512F},
+	{"VMOVAPS",		"r/m512,zmmreg",			"x0 xl 0F 29 /r",	CT_CPU_AVX512F},
+	{"VMOVD",		"xmmreg,r/m32",				"v0 po 0F 6E /r",	CT_CPU_AVX},
+	{"VMOVD",		"r/m32,xmmreg",				"v0 po 0F 7E /r",	CT_CPU_AVX},
+	{"VMOVDDUP",	"xmmreg,xmmreg/mem64",		"v0 p2 0F 12 /r",	CT_CPU_AVX},
+	{"VMOVDDUP",	"ymmreg,r/m256",			"v0 vl p2 0F 12 /r",	CT_CPU_AVX},
+	{"VMOVDQA",		"xmmreg,r/m128",			"v0 po 0F 6F /r",	CT_CPU_AVX},
+	{"VMOVDQA",		"ymmreg,r/m256",			"v0 vl po 0F 6F /r",	CT_CPU_AVX},
+	{"VMOVDQA",		"r/m128,xmmreg",			"v0 po 0F 7F /r",	CT_CPU_AVX},
+	{"VMOVDQA",		"r/m256,ymmreg",			"v0 vl po 0F 7F /r",	CT_CPU_AVX},
+	{"VMOVDQA32",	"zmmreg,r/m512",			"x0 xl po 0F 6F /r",	CT_CPU_AVX512F},
+	{"VMOVDQA32",	"r/m512,zmmreg",			"x0 xl po 0F 7F /r",	CT_CPU_AVX512F},
+	{"VMOVDQA64",	"zmmreg,r/m512",			"x0 xl po pw 0F 6F /r",	CT_CPU_AVX512F},
+	{"VMOVDQA64",	"r/m512,zmmreg",			"x0 xl po pw 0F 7F /r",	CT_CPU_AVX512F},
+	{"VMOVDQU",		"xmmreg,r/m128",			"v0 p3 0F 6F /r",	CT_CPU_AVX},
+	{"VMOVDQU",		"ymmreg,r/m256",			"v0 vl p3 0F 6F /r",	CT_CPU_AVX},
+	{"VMOVDQU",		"r/m128,xmmreg",			"v0 p3 0F 7F /r",	CT_CPU_AVX},
+	{"VMOVDQU",		"r/m256,ymmreg",			"v0 vl p3 0F 7F /r",	CT_CPU_AVX},
+	{"VMOVDQU16",	"zmmreg,r/m512",			"x0 xl p2 pw 0F 6F /r",	CT_CPU_AVX512BW},
+	{"VMOVDQU16",	"r/m512,zmmreg",			"x0 xl p2 pw 0F 7F /r",	CT_CPU_AVX512BW},
+	{"VMOVDQU32",	"zmmreg,r/m512",			"x0 xl p3 0F 6F /r",	CT_CPU_AVX512F},
+	{"VMOVDQU32",	"r/m512,zmmreg",			"x0 xl p3 0F 7F /r",	CT_CPU_AVX512F},
+	{"VMOVDQU64",	"zmmreg,r/m512",			"x0 xl p3 pw 0F 6F /r",	CT_CPU_AVX512F},
+	{"VMOVDQU64",	"r/m512,zmmreg",			"x0 xl p3 pw 0F 7F /r",	CT_CPU_AVX512F},
+	{"VMOVDQU8",	"zmmreg,r/m512",			"x0 xl p2 0F 6F /r",	CT_CPU_AVX512BW},
+	{"VMOVDQU8",	"r/m512,zmmreg",			"x0 xl p2 0F 7F /r",	CT_CPU_AVX512BW},
+	{"VMOVHLPS",	"xmmreg,xmmreg,xmmreg",		"v2 0F 12 /r",		CT_CPU_AVX},
+	{"VMOVHPD",		"xmmreg,xmmreg,mem64",		"v2 po 0F 16 /r",	CT_CPU_AVX},
+	{"VMOVHPD",		"mem64,xmmreg",				"v0 po 0F 17 /r",	CT_CPU_AVX},
+	{"VMOVHPS",		"xmmreg,xmmreg,mem64",		"v2 0F 16 /r",		CT_CPU_AVX},
+	{"VMOVHPS",		"mem64,xmmreg",				"v0 0F 17 /r",		CT_CPU_AVX},
+	{"VMOVLHPS",	"xmmreg,xmmreg,xmmreg",		"v2 0F 16 /r",		CT_CPU_AVX},
+	{"VMOVLPD",		"xmmreg,xmmreg,mem64",		"v2 po 0F 12 /r",	CT_CPU_AVX},
+	{"VMOVLPD",		"mem64,xmmreg",				"v0 po 0F 13 /r",	CT_CPU_AVX},
+	{"VMOVLPS",		"xmmreg,xmmreg,mem64",		"v2 0F 12 /r",		CT_CPU_AVX},
+	{"VMOVLPS",		"mem64,xmmreg",				"v0 0F 13 /r",		CT_CPU_AVX},
+	{"VMOVMSKPD",	"reg32,xmmreg",				"v0 po 0F 50 /r",	CT_CPU_AVX},
+	{"VMOVMSKPD",	"reg32,ymmreg",				"v0 vl po 0F 50 /r",	CT_CPU_AVX},
+	{"VMOVMSKPS",	"reg32,xmmreg",				"v0 0F 50 /r",		CT_CPU_AVX},
+	{"VMOVMSKPS",	"reg32,ymmreg",				"v0 vl 0F 50 /r",	CT_CPU_AVX},
+	{"VMOVNTDQ",	"mem128,xmmreg",			"v0 po 0F E7 /r",	CT_CPU_AVX},
+	{"VMOVNTDQ",	"mem256,ymmreg",			"v0 vl po 0F E7 /r",	CT_CPU_AVX},
+	{"VMOVNTDQ",	"mem512,zmmreg",			"x0 xl po 0F E7 /r",	CT_CPU_AVX512F},
+	{"VMOVNTDQA",	"xmmreg,mem128",			"v0 po 0F 38 2A /r",	CT_CPU_AVX},
+	{"VMOVNTDQA",	"ymmreg,mem256",			"v0 vl po 0F 38 2A /r",	CT_CPU_AVX2},
+	{"VMOVNTDQA",	"zmmreg,mem512",			"x0 xl po 0F 38 2A /r",	CT_CPU_AVX512F},
+	{"VMOVNTPD",	"mem128,xmmreg",			"v0 po 0F 2B /r",	CT_CPU_AVX},
+	{"VMOVNTPD",	"mem256,ymmreg",			"v0 vl po 0F 2B /r",	CT_CPU_AVX},
+	{"VMOVNTPD",	"mem512,zmmreg",			"x0 xl po pw 0F 2B /r",	CT_CPU_AVX512F},
+	{"VMOVNTPS",	"mem128,xmmreg",			"v0 0F 2B /r",		CT_CPU_AVX},
+	{"VMOVNTPS",	"mem256,ymmreg",			"v0 vl 0F 2B /r",	CT_CPU_AVX},
+	{"VMOVNTPS",	"mem512,zmmreg",			"x0 xl 0F 2B /r",	CT_CPU_AVX512F},
+	{"VMOVQ",		"xmmreg,xmmreg/mem64",		"v0 p3 0F 7E /r",	CT_CPU_AVX},
+	{"VMOVQ",		"xmmreg/mem64,xmmreg",		"v0 po 0F D6 /r",	CT_CPU_AVX},
+	{"VMOVQ",		"xmmreg,reg64/mem64",		"v0 po pw 0F 6E /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VMOVQ",		"reg64/mem64,xmmreg",		"v0 po pw 0F 7E /r",	CT_CPU_AVX | CT_CPU_X64},
+	{"VMOVSD",		"xmmreg,xmmreg,xmmreg",		"v2 p2 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVSD",		"xmmreg,mem64",				"v0 p2 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVSD",		"mem64,xmmreg",				"v0 p2 0F 11 /r",	CT_CPU_AVX},
+	{"VMOVSHDUP",	"xmmreg,r/m128",			"v0 p3 0F 16 /r",	CT_CPU_AVX},
+	{"VMOVSHDUP",	"ymmreg,r/m256",			"v0 vl p3 0F 16 /r",	CT_CPU_AVX},
+	{"VMOVSLDUP",	"xmmreg,r/m128",			"v0 p3 0F 12 /r",	CT_CPU_AVX},
+	{"VMOVSLDUP",	"ymmreg,r/m256",			"v0 vl p3 0F 12 /r",	CT_CPU_AVX},
+	{"VMOVSS",		"xmmreg,xmmreg,xmmreg",		"v2 p3 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVSS",		"xmmreg,mem32",				"v0 p3 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVSS",		"mem32,xmmreg",				"v0 p3 0F 11 /r",	CT_CPU_AVX},
+	{"VMOVUPD",		"xmmreg,r/m128",			"v0 po 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVUPD",		"ymmreg,r/m256",			"v0 vl po 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVUPD",		"r/m128,xmmreg",			"v0 po 0F 11 /r",	CT_CPU_AVX},
+	{"VMOVUPD",		"r/m256,ymmreg",			"v0 vl po 0F 11 /r",	CT_CPU_AVX},
+	{"VMOVUPD",		"zmmreg,r/m512",			"x0 xl po pw 0F 10 /r",	CT_CPU_AVX512F},
+	{"VMOVUPD",		"r/m512,zmmreg",			"x0 xl po pw 0F 11 /r",	CT_CPU_AVX512F},
+	{"VMOVUPS",		"xmmreg,r/m128",			"v0 0F 10 /r",		CT_CPU_AVX},
+	{"VMOVUPS",		"ymmreg,r/m256",			"v0 vl 0F 10 /r",	CT_CPU_AVX},
+	{"VMOVUPS",		"r/m128,xmmreg",			"v0 0F 11 /r",		CT_CPU_AVX},
+	{"VMOVUPS",		"r/m256,ymmreg",			"v0 vl 0F 11 /r",	CT_CPU_AVX},
+	{"VMOVUPS",		"zmmreg,r/m512",			"x0 xl 0F 10 /r",	CT_CPU_AVX512F},
+	{"VMOVUPS",		"r/m512,zmmreg",			"x0 xl 0F 11 /r",	CT_CPU_AVX512F},
+	{"VMPSADBW",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 42 /r ib",	CT_CPU_AVX},
+	{"VMPSADBW",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 42 /r ib",	CT_CPU_AVX2},
+	{"VMULPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 59 /r",	CT_CPU_AVX},
+	{"VMULPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 59 /r",	CT_CPU_AVX},
+	{"VMULPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 59 /r",	CT_CPU_AVX512F},
+	{"VMULPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 59 /r",		CT_CPU_AVX},
+	{"VMULPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 59 /r",	CT_CPU_AVX},
+	{"VMULPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 59 /r",	CT_CPU_AVX512F},
+	{"VMULSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 59 /r",	CT_CPU_AVX},
+	{"VMULSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 59 /r",	CT_CPU_AVX},
+	{"VORPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 56 /r",	CT_CPU_AVX},
+	{"VORPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 56 /r",	CT_CPU_AVX},
+	{"VORPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 56 /r",		CT_CPU_AVX},
+	{"VORPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 56 /r",	CT_CPU_AVX},
+	{"VPABSB",		"xmmreg,r/m128",			"v0 po 0F 38 1C /r",	CT_CPU_AVX},
+	{"VPABSB",		"ymmreg,r/m256",			"v0 vl po 0F 38 1C /r",	CT_CPU_AVX2},
+	{"VPABSB",		"zmmreg,r/m512",			"x0 xl po 0F 38 1C /r",	CT_CPU_AVX512BW},
+	{"VPABSD",		"xmmreg,r/m128",			"v0 po 0F 38 1E /r",	CT_CPU_AVX},
+	{"VPABSD",		"ymmreg,r/m256",			"v0 vl po 0F 38 1E /r",	CT_CPU_AVX2},
+	{"VPABSD",		"zmmreg,r/m512",			"x0 xl t4 po 0F 38 1E /r",	CT_CPU_AVX512F},
+	{"VPABSQ",		"zmmreg,r/m512",			"x0 xl t8 po pw 0F 38 1F /r",	CT_CPU_AVX512F},
+	{"VPABSW",		"xmmreg,r/m128",			"v0 po 0F 38 1D /r",	CT_CPU_AVX},
+	{"VPABSW",		"ymmreg,r/m256",			"v0 vl po 0F 38 1D /r",	CT_CPU_AVX2},
+	{"VPABSW",		"zmmreg,r/m512",			"x0 xl po 0F 38 1D /r",	CT_CPU_AVX512BW},
+	{"VPACKSSDW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 6B /r",	CT_CPU_AVX},
+	{"VPACKSSDW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 6B /r",	CT_CPU_AVX2},
+	{"VPACKSSDW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 6B /r",	CT_CPU_AVX512BW},
+	{"VPACKSSWB",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 63 /r",	CT_CPU_AVX},
+	{"VPACKSSWB",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 63 /r",	CT_CPU_AVX2},
+	{"VPACKSSWB",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 63 /r",	CT_CPU_AVX512BW},
+	{"VPACKUSDW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 2B /r",	CT_CPU_AVX},
+	{"VPACKUSDW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 2B /r",	CT_CPU_AVX2},
+	{"VPACKUSDW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 2B /r",	CT_CPU_AVX512BW},
+	{"VPACKUSWB",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 67 /r",	CT_CPU_AVX},
+	{"VPACKUSWB",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 67 /r",	CT_CPU_AVX2},
+	{"VPACKUSWB",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 67 /r",	CT_CPU_AVX512BW},
+	{"VPADDB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F FC /r",	CT_CPU_AVX},
+	{"VPADDB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F FC /r",	CT_CPU_AVX2},
+	{"VPADDB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F FC /r",	CT_CPU_AVX512BW},
+	{"VPADDD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F FE /r",	CT_CPU_AVX},
+	{"VPADDD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F FE /r",	CT_CPU_AVX2},
+	{"VPADDD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F FE /r",	CT_CPU_AVX512F},
+	{"VPADDQ",		"xmmreg,xmmreg,r/m128",		"v2 po 0F D4 /r",	CT_CPU_AVX},
+	{"VPADDQ",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F D4 /r",	CT_CPU_AVX2},
+	{"VPADDQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F D4 /r",	CT_CPU_AVX512F},
+	{"VPADDSB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F EC /r",	CT_CPU_AVX},
+	{"VPADDSB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F EC /r",	CT_CPU_AVX2},
+	{"VPADDSB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F EC /r",	CT_CPU_AVX512BW},
+	{"VPADDSW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F ED /r",	CT_CPU_AVX},
+	{"VPADDSW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F ED /r",	CT_CPU_AVX2},
+	{"VPADDSW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F ED /r",	CT_CPU_AVX512BW},
+	{"VPADDUSB",	"xmmreg,xmmreg,r/m128",		"v2 po 0F DC /r",	CT_CPU_AVX},
+	{"VPADDUSB",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F DC /r",	CT_CPU_AVX2},
+	{"VPADDUSB",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F DC /r",	CT_CPU_AVX512BW},
+	{"VPADDUSW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F DD /r",	CT_CPU_AVX},
+	{"VPADDUSW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F DD /r",	CT_CPU_AVX2},
+	{"VPADDUSW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F DD /r",	CT_CPU_AVX512BW},
+	{"VPADDW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F FD /r",	CT_CPU_AVX},
+	{"VPADDW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F FD /r",	CT_CPU_AVX2},
+	{"VPADDW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F FD /r",	CT_CPU_AVX512BW},
+	{"VPALIGNR",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 0F /r ib",	CT_CPU_AVX},
+	{"VPALIGNR",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 0F /r ib",	CT_CPU_AVX2},
+	{"VPALIGNR",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl po 0F 3A 0F /r ib",	CT_CPU_AVX512BW},
+	{"VPAND",		"xmmreg,xmmreg,r/m128",		"v2 po 0F DB /r",	CT_CPU_AVX},
+	{"VPAND",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F DB /r",	CT_CPU_AVX2},
+	{"VPANDD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F DB /r",	CT_CPU_AVX512F},
+	{"VPANDN",		"xmmreg,xmmreg,r/m128",		"v2 po 0F DF /r",	CT_CPU_AVX},
+	{"VPANDN",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F DF /r",	CT_CPU_AVX2},
+	{"VPANDND",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F DF /r",	CT_CPU_AVX512F},
+	{"VPANDNQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F DF /r",	CT_CPU_AVX512F},
+	{"VPANDQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F DB /r",	CT_CPU_AVX512F},
+	{"VPAVGB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E0 /r",	CT_CPU_AVX},
+	{"VPAVGB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F E0 /r",	CT_CPU_AVX2},
+	{"VPAVGB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F E0 /r",	CT_CPU_AVX512BW},
+	{"VPAVGW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E3 /r",	CT_CPU_AVX},
+	{"VPAVGW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F E3 /r",	CT_CPU_AVX2},
+	{"VPAVGW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F E3 /r",	CT_CPU_AVX512BW},
+	{"VPBLENDD",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 02 /r ib",	CT_CPU_AVX2},
+	{"VPBLENDD",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 02 /r ib",	CT_CPU_AVX2},
+	{"VPBLENDMB",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 66 /r",	CT_CPU_AVX512BW},
+	{"VPBLENDMD",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 64 /r",	CT_CPU_AVX512F},
+	{"VPBLENDMQ",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 64 /r",	CT_CPU_AVX512F},
+	{"VPBLENDMW",	"zmmreg,zmmreg,r/m512",		"x2 xl po pw 0F 38 66 /r",	CT_CPU_AVX512BW},
+	{"VPBLENDVB",	"xmmreg,xmmreg,r/m128,xmmreg",	"v2 po 0F 3A 4C /r is",	CT_CPU_AVX},
+	{"VPBLENDVB",	"ymmreg,ymmreg,r/m256,ymmreg",	"v2 vl po 0F 3A 4C /r is",	CT_CPU_AVX2},
+	{"VPBLENDW",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 0E /r ib",	CT_CPU_AVX},
+	{"VPBLENDW",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 0E /r ib",	CT_CPU_AVX2},
+	{"VPBROADCASTB",	"xmmreg,xmmreg/mem8",	"v0 po 0F 38 78 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTB",	"ymmreg,xmmreg/mem8",	"v0 vl po 0F 38 78 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTB",	"zmmreg,xmmreg/mem8",	"x0 xl po 0F 38 78 /r",	CT_CPU_AVX512BW},
+	{"VPBROADCASTB",	"zmmreg,reg32",			"x0 xl po 0F 38 7A /r",	CT_CPU_AVX512BW},
+	{"VPBROADCASTD",	"xmmreg,xmmreg/mem32",	"v0 po 0F 38 58 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTD",	"ymmreg,xmmreg/mem32",	"v0 vl po 0F 38 58 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTD",	"zmmreg,xmmreg/mem32",	"x0 xl po 0F 38 58 /r",	CT_CPU_AVX512F},
+	{"VPBROADCASTD",	"zmmreg,reg32",			"x0 xl po 0F 38 7C /r",	CT_CPU_AVX512F},
+	{"VPBROADCASTQ",	"xmmreg,xmmreg/mem64",	"v0 po 0F 38 59 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTQ",	"ymmreg,xmmreg/mem64",	"v0 vl po 0F 38 59 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTQ",	"zmmreg,xmmreg/mem64",	"x0 xl po pw 0F 38 59 /r",	CT_CPU_AVX512F},
+	{"VPBROADCASTQ",	"zmmreg,reg64",			"x0 xl po pw 0F 38 7C /r",	CT_CPU_AVX512F | CT_CPU_X64},
+	{"VPBROADCASTW",	"xmmreg,xmmreg/mem16",	"v0 po 0F 38 79 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTW",	"ymmreg,xmmreg/mem16",	"v0 vl po 0F 38 79 /r",	CT_CPU_AVX2},
+	{"VPBROADCASTW",	"zmmreg,xmmreg/mem16",	"x0 xl po 0F 38 79 /r",	CT_CPU_AVX512BW},
+	{"VPBROADCASTW",	"zmmreg,reg32",			"x0 xl po 0F 38 7B /r",	CT_CPU_AVX512BW},
+	{"VPCLMULHQHQDQ",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 3A 44 /r 11",	CT_CPU_AVX | CT_CPU_PCLMUL},
+	{"VPCLMULHQLQDQ",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 3A 44 /r 01",	CT_CPU_AVX | CT_CPU_PCLMUL},
+	{"VPCLMULLQHQDQ",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 3A 44 /r 10",	CT_CPU_AVX | CT_CPU_PCLMUL},
+	{"VPCLMULLQLQDQ",	"xmmreg,xmmreg,r/m128",	"v2 po 0F 3A 44 /r 00",	CT_CPU_AVX | CT_CPU_PCLMUL},
+	{"VPCLMULQDQ",	"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F 3A 44 /r ib",	CT_CPU_AVX | CT_CPU_PCLMUL},
+	{"VPCMPB",		"kreg,zmmreg,r/m512,imm8",	"x2 xl po 0F 3A 3F /r ib",	CT_CPU_AVX512BW},
+	{"VPCMPD",		"kreg,zmmreg,r/m512,imm8",	"x2 xl t4 po 0F 3A 1F /r ib",	CT_CPU_AVX512F},
+	{"VPCMPEQB",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 74 /r",	CT_CPU_AVX},
+	{"VPCMPEQB",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 74 /r",	CT_CPU_AVX2},
+	{"VPCMPEQB",	"kreg,zmmreg,r/m512",		"x2 xl po 0F 74 /r",	CT_CPU_AVX512BW},
+	{"VPCMPEQD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 76 /r",	CT_CPU_AVX},
+	{"VPCMPEQD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 76 /r",	CT_CPU_AVX2},
+	{"VPCMPEQD",	"kreg,zmmreg,r/m512",		"x2 xl t4 po 0F 76 /r",	CT_CPU_AVX512F},
+	{"VPCMPEQQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 29 /r",	CT_CPU_AVX},
+	{"VPCMPEQQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 29 /r",	CT_CPU_AVX2},
+	{"VPCMPEQQ",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 29 /r",	CT_CPU_AVX512F},
+	{"VPCMPEQW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 75 /r",	CT_CPU_AVX},
+	{"VPCMPEQW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 75 /r",	CT_CPU_AVX2},
+	{"VPCMPEQW",	"kreg,zmmreg,r/m512",		"x2 xl po 0F 75 /r",	CT_CPU_AVX512BW},
+	{"VPCMPESTRI",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 61 /r ib",	CT_CPU_AVX},
+	{"VPCMPESTRM",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 60 /r ib",	CT_CPU_AVX},
+	{"VPCMPGTB",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 64 /r",	CT_CPU_AVX},
+	{"VPCMPGTB",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 64 /r",	CT_CPU_AVX2},
+	{"VPCMPGTB",	"kreg,zmmreg,r/m512",		"x2 xl po 0F 64 /r",	CT_CPU_AVX512BW},
+	{"VPCMPGTD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 66 /r",	CT_CPU_AVX},
+	{"VPCMPGTD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 66 /r",	CT_CPU_AVX2},
+	{"VPCMPGTD",	"kreg,zmmreg,r/m512",		"x2 xl t4 po 0F 66 /r",	CT_CPU_AVX512F},
+	{"VPCMPGTQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 37 /r",	CT_CPU_AVX},
+	{"VPCMPGTQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 37 /r",	CT_CPU_AVX2},
+	{"VPCMPGTQ",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 37 /r",	CT_CPU_AVX512F},
+	{"VPCMPGTW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 65 /r",	CT_CPU_AVX},
+	{"VPCMPGTW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 65 /r",	CT_CPU_AVX2},
+	{"VPCMPGTW",	"kreg,zmmreg,r/m512",		"x2 xl po 0F 65 /r",	CT_CPU_AVX512BW},
+	{"VPCMPISTRI",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 63 /r ib",	CT_CPU_AVX},
+	{"VPCMPISTRM",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 62 /r ib",	CT_CPU_AVX},
+	{"VPCMPQ",		"kreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F 3A 1F /r ib",	CT_CPU_AVX512F},
+	{"VPCMPUB",		"kreg,zmmreg,r/m512,imm8",	"x2 xl po 0F 3A 3E /r ib",	CT_CPU_AVX512BW},
+	{"VPCMPUD",		"kreg,zmmreg,r/m512,imm8",	"x2 xl t4 po 0F 3A 1E /r ib",	CT_CPU_AVX512F},
+	{"VPCMPUQ",		"kreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F 3A 1E /r ib",	CT_CPU_AVX512F},
+	{"VPCMPUW",		"kreg,zmmreg,r/m512,imm8",	"x2 xl po pw 0F 3A 3E /r ib",	CT_CPU_AVX512BW},
+	{"VPCMPW",		"kreg,zmmreg,r/m512,imm8",	"x2 xl po pw 0F 3A 3F /r ib",	CT_CPU_AVX512BW},
+	{"VPERM2F128",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 06 /r ib",	CT_CPU_AVX},
+	{"VPERM2I128",	"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F 3A 46 /r ib",	CT_CPU_AVX2},
+	{"VPERMD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 36 /r",	CT_CPU_AVX2},
+	{"VPERMD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 36 /r",	CT_CPU_AVX512F},
+	{"VPERMI2D",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 76 /r",	CT_CPU_AVX512F},
+	{"VPERMI2PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 77 /r",	CT_CPU_AVX512F},
+	{"VPERMI2PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 77 /r",	CT_CPU_AVX512F},
+	{"VPERMI2Q",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 76 /r",	CT_CPU_AVX512F},
+	{"VPERMILPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 0D /r",	CT_CPU_AVX},
+	{"VPERMILPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 0D /r",	CT_CPU_AVX},
+	{"VPERMILPD",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 05 /r ib",	CT_CPU_AVX},
+	{"VPERMILPD",	"ymmreg,r/m256,imm8",		"v0 vl po 0F 3A 05 /r ib",	CT_CPU_AVX},
+	{"VPERMILPD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 0D /r",	CT_CPU_AVX512F},
+	{"VPERMILPD",	"zmmreg,r/m512,imm8",		"x0 xl t8 po pw 0F 3A 05 /r ib",	CT_CPU_AVX512F},
+	{"VPERMILPS",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 0C /r",	CT_CPU_AVX},
+	{"VPERMILPS",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 0C /r",	CT_CPU_AVX},
+	{"VPERMILPS",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 04 /r ib",	CT_CPU_AVX},
+	{"VPERMILPS",	"ymmreg,r/m256,imm8",		"v0 vl po 0F 3A 04 /r ib",	CT_CPU_AVX},
+	{"VPERMILPS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 0C /r",	CT_CPU_AVX512F},
+	{"VPERMILPS",	"zmmreg,r/m512,imm8",		"x0 xl t4 po 0F 3A 04 /r ib",	CT_CPU_AVX512F},
+	{"VPERMPD",		"ymmreg,r/m256,imm8",		"v0 vl po pw 0F 3A 01 /r ib",	CT_CPU_AVX2},
+	{"VPERMPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 16 /r",	CT_CPU_AVX512F},
+	{"VPERMPD",		"zmmreg,r/m512,imm8",		"x0 xl t8 po pw 0F 3A 01 /r ib",	CT_CPU_AVX512F},
+	{"VPERMPS",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 16 /r",	CT_CPU_AVX2},
+	{"VPERMPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 16 /r",	CT_CPU_AVX512F},
+	{"VPERMQ",		"ymmreg,r/m256,imm8",		"v0 vl po pw 0F 3A 00 /r ib",	CT_CPU_AVX2},
+	{"VPERMQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 36 /r",	CT_CPU_AVX512F},
+	{"VPERMQ",		"zmmreg,r/m512,imm8",		"x0 xl t8 po pw 0F 3A 00 /r ib",	CT_CPU_AVX512F},
+	{"VPERMT2D",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 7E /r",	CT_CPU_AVX512F},
+	{"VPERMT2PD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 7F /r",	CT_CPU_AVX512F},
+	{"VPERMT2PS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 7F /r",	CT_CPU_AVX512F},
+	{"VPERMT2Q",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 7E /r",	CT_CPU_AVX512F},
+	{"VPERMW",		"zmmreg,zmmreg,r/m512",		"x2 xl po pw 0F 38 8D /r",	CT_CPU_AVX512BW},
+	{"VPEXTRB",		"reg32/mem8,xmmreg,imm8",	"v0 po 0F 3A 14 /r ib",	CT_CPU_AVX},
+	{"VPEXTRD",		"r/m32,xmmreg,imm8",		"v0 po 0F 3A 16 /r ib",	CT_CPU_AVX},
+	{"VPEXTRQ",		"reg64/mem64,xmmreg,imm8",	"v0 po pw 0F 3A 16 /r ib",	CT_CPU_AVX | CT_CPU_X64},
+	{"VPEXTRW",		"reg32,xmmreg,imm8",		"v0 po 0F C5 /r ib",	CT_CPU_AVX},
+	{"VPEXTRW",		"mem16,xmmreg,imm8",		"v0 po 0F 3A 15 /r ib",	CT_CPU_AVX},
+	{"VPGATHERDD",	"xmmreg,vm32x,xmmreg",		"v3 po 0F 38 90 /r",	CT_CPU_AVX2},
+	{"VPGATHERDD",	"ymmreg,vm32y,ymmreg",		"v3 vl po 0F 38 90 /r",	CT_CPU_AVX2},
+	{"VPGATHERDQ",	"xmmreg,vm32x,xmmreg",		"v3 po pw 0F 38 90 /r",	CT_CPU_AVX2},
+	{"VPGATHERDQ",	"ymmreg,vm32x,ymmreg",		"v3 vl po pw 0F 38 90 /r",	CT_CPU_AVX2},
+	{"VPGATHERQD",	"xmmreg,vm64x,xmmreg",		"v3 po 0F 38 91 /r",	CT_CPU_AVX2},
+	{"VPGATHERQD",	"xmmreg,vm64y,xmmreg",		"v3 vl po 0F 38 91 /r",	CT_CPU_AVX2},
+	{"VPGATHERQQ",	"xmmreg,vm64x,xmmreg",		"v3 po pw 0F 38 91 /r",	CT_CPU_AVX2},
+	{"VPGATHERQQ",	"ymmreg,vm64y,ymmreg",		"v3 vl po pw 0F 38 91 /r",	CT_CPU_AVX2},
+	{"VPHADDD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 02 /r",	CT_CPU_AVX},
+	{"VPHADDD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 02 /r",	CT_CPU_AVX2},
+	{"VPHADDSW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 03 /r",	CT_CPU_AVX},
+	{"VPHADDSW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 03 /r",	CT_CPU_AVX2},
+	{"VPHADDW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 01 /r",	CT_CPU_AVX},
+	{"VPHADDW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 01 /r",	CT_CPU_AVX2},
+	{"VPHMINPOSUW",	"xmmreg,r/m128",			"v0 po 0F 38 41 /r",	CT_CPU_AVX},
+	{"VPHSUBD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 06 /r",	CT_CPU_AVX},
+	{"VPHSUBD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 06 /r",	CT_CPU_AVX2},
+	{"VPHSUBSW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 07 /r",	CT_CPU_AVX},
+	{"VPHSUBSW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 07 /r",	CT_CPU_AVX2},
+	{"VPHSUBW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 05 /r",	CT_CPU_AVX},
+	{"VPHSUBW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 05 /r",	CT_CPU_AVX2},
+	{"VPINSRB",		"xmmreg,xmmreg,reg32/mem8,imm8",	"v2 po 0F 3A 20 /r ib",	CT_CPU_AVX},
+	{"VPINSRD",		"xmmreg,xmmreg,r/m32,imm8",	"v2 po 0F 3A 22 /r ib",	CT_CPU_AVX},
+	{"VPINSRQ",		"xmmreg,xmmreg,reg64/mem64,imm8",	"v2 po pw 0F 3A 22 /r ib",	CT_CPU_AVX | CT_CPU_X64},
+	{"VPINSRW",		"xmmreg,xmmreg,r/m16,imm8",	"v2 po 0F C4 /r ib",	CT_CPU_AVX},
+	{"VPINSRW",		"xmmreg,xmmreg,reg32,imm8",	"v2 po 0F C4 /r ib",	CT_CPU_AVX},
+	{"VPMADDUBSW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 04 /r",	CT_CPU_AVX},
+	{"VPMADDUBSW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 04 /r",	CT_CPU_AVX2},
+	{"VPMADDUBSW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 04 /r",	CT_CPU_AVX512BW},
+	{"VPMADDWD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F F5 /r",	CT_CPU_AVX},
+	{"VPMADDWD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F F5 /r",	CT_CPU_AVX2},
+	{"VPMADDWD",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F F5 /r",	CT_CPU_AVX512BW},
+	{"VPMASKMOVD",	"xmmreg,xmmreg,mem128",		"v2 po 0F 38 8C /r",	CT_CPU_AVX2},
+	{"VPMASKMOVD",	"ymmreg,ymmreg,mem256",		"v2 vl po 0F 38 8C /r",	CT_CPU_AVX2},
+	{"VPMASKMOVD",	"mem128,xmmreg,xmmreg",		"v2 po 0F 38 8E /r",	CT_CPU_AVX2},
+	{"VPMASKMOVD",	"mem256,ymmreg,ymmreg",		"v2 vl po 0F 38 8E /r",	CT_CPU_AVX2},
+	{"VPMASKMOVQ",	"xmmreg,xmmreg,mem128",		"v2 po pw 0F 38 8C /r",	CT_CPU_AVX2},
+	{"VPMASKMOVQ",	"ymmreg,ymmreg,mem256",		"v2 vl po pw 0F 38 8C /r",	CT_CPU_AVX2},
+	{"VPMASKMOVQ",	"mem128,xmmreg,xmmreg",		"v2 po pw 0F 38 8E /r",	CT_CPU_AVX2},
+	{"VPMASKMOVQ",	"mem256,ymmreg,ymmreg",		"v2 vl po pw 0F 38 8E /r",	CT_CPU_AVX2},
+	{"VPMAXSB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 3C /r",	CT_CPU_AVX},
+	{"VPMAXSB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 3C /r",	CT_CPU_AVX2},
+	{"VPMAXSB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 3C /r",	CT_CPU_AVX512BW},
+	{"VPMAXSD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 3D /r",	CT_CPU_AVX},
+	{"VPMAXSD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 3D /r",	CT_CPU_AVX2},
+	{"VPMAXSD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 3D /r",	CT_CPU_AVX512F},
+	{"VPMAXSQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 3D /r",	CT_CPU_AVX512F},
+	{"VPMAXSW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F EE /r",	CT_CPU_AVX},
+	{"VPMAXSW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F EE /r",	CT_CPU_AVX2},
+	{"VPMAXSW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F EE /r",	CT_CPU_AVX512BW},
+	{"VPMAXUB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F DE /r",	CT_CPU_AVX},
+	{"VPMAXUB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F DE /r",	CT_CPU_AVX2},
+	{"VPMAXUB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F DE /r",	CT_CPU_AVX512BW},
+	{"VPMAXUD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 3F /r",	CT_CPU_AVX},
+	{"VPMAXUD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 3F /r",	CT_CPU_AVX2},
+	{"VPMAXUD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 3F /r",	CT_CPU_AVX512F},
+	{"VPMAXUQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 3F /r",	CT_CPU_AVX512F},
+	{"VPMAXUW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 3E /r",	CT_CPU_AVX},
+	{"VPMAXUW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 3E /r",	CT_CPU_AVX2},
+	{"VPMAXUW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 3E /r",	CT_CPU_AVX512BW},
+	{"VPMINSB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 38 /r",	CT_CPU_AVX},
+	{"VPMINSB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 38 /r",	CT_CPU_AVX2},
+	{"VPMINSB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 38 /r",	CT_CPU_AVX512BW},
+	{"VPMINSD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 39 /r",	CT_CPU_AVX},
+	{"VPMINSD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 39 /r",	CT_CPU_AVX2},
+	{"VPMINSD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 39 /r",	CT_CPU_AVX512F},
+	{"VPMINSQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 39 /r",	CT_CPU_AVX512F},
+	{"VPMINSW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F EA /r",	CT_CPU_AVX},
+	{"VPMINSW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F EA /r",	CT_CPU_AVX2},
+	{"VPMINSW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F EA /r",	CT_CPU_AVX512BW},
+	{"VPMINUB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F DA /r",	CT_CPU_AVX},
+	{"VPMINUB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F DA /r",	CT_CPU_AVX2},
+	{"VPMINUB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F DA /r",	CT_CPU_AVX512BW},
+	{"VPMINUD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 3B /r",	CT_CPU_AVX},
+	{"VPMINUD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 3B /r",	CT_CPU_AVX2},
+	{"VPMINUD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 3B /r",	CT_CPU_AVX512F},
+	{"VPMINUQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 3B /r",	CT_CPU_AVX512F},
+	{"VPMINUW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 3A /r",	CT_CPU_AVX},
+	{"VPMINUW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 3A /r",	CT_CPU_AVX2},
+	{"VPMINUW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 3A /r",	CT_CPU_AVX512BW},
+	{"VPMOVB2M",	"kreg,zmmreg",				"x0 xl p3 0F 38 29 /r",	CT_CPU_AVX512BW},
+	{"VPMOVDB",		"r/m128,zmmreg",			"x0 xl p3 0F 38 31 /r",	CT_CPU_AVX512F},
+	{"VPMOVDW",		"r/m256,zmmreg",			"x0 xl p3 0F 38 33 /r",	CT_CPU_AVX512F},
+	{"VPMOVM2B",	"zmmreg,kreg",				"x0 xl p3 0F 38 28 /r",	CT_CPU_AVX512BW},
+	{"VPMOVM2W",	"zmmreg,kreg",				"x0 xl p3 pw 0F 38 28 /r",	CT_CPU_AVX512BW},
+	{"VPMOVMSKB",	"reg32,xmmreg",				"v0 po 0F D7 /r",	CT_CPU_AVX},
+	{"VPMOVMSKB",	"reg32,ymmreg",				"v0 vl po 0F D7 /r",	CT_CPU_AVX2},
+	{"VPMOVQB",		"xmmreg/mem64,zmmreg",		"x0 xl p3 0F 38 32 /r",	CT_CPU_AVX512F},
+	{"VPMOVQD",		"r/m256,zmmreg",			"x0 xl p3 0F 38 35 /r",	CT_CPU_AVX512F},
+	{"VPMOVQW",		"r/m128,zmmreg",			"x0 xl p3 0F 38 34 /r",	CT_CPU_AVX512F},
+	{"VPMOVSXBD",	"xmmreg,xmmreg/mem32",		"v0 po 0F 38 21 /r",	CT_CPU_AVX},
+	{"VPMOVSXBD",	"ymmreg,xmmreg/mem64",		"v0 vl po 0F 38 21 /r",	CT_CPU_AVX2},
+	{"VPMOVSXBD",	"zmmreg,r/m128",			"x0 xl po 0F 38 21 /r",	CT_CPU_AVX512F},
+	{"VPMOVSXBQ",	"xmmreg,xmmreg/mem16",		"v0 po 0F 38 22 /r",	CT_CPU_AVX},
+	{"VPMOVSXBQ",	"ymmreg,xmmreg/mem32",		"v0 vl po 0F 38 22 /r",	CT_CPU_AVX2},
+	{"VPMOVSXBQ",	"zmmreg,xmmreg/mem64",		"x0 xl po 0F 38 22 /r",	CT_CPU_AVX512F},
+	{"VPMOVSXBW",	"xmmreg,xmmreg/mem64",		"v0 po 0F 38 20 /r",	CT_CPU_AVX},
+	{"VPMOVSXBW",	"ymmreg,r/m128",			"v0 vl po 0F 38 20 /r",	CT_CPU_AVX2},
+	{"VPMOVSXBW",	"zmmreg,r/m256",			"x0 xl po 0F 38 20 /r",	CT_CPU_AVX512BW},
+	{"VPMOVSXDQ",	"xmmreg,xmmreg/mem64",		"v0 po 0F 38 25 /r",	CT_CPU_AVX},
+	{"VPMOVSXDQ",	"ymmreg,r/m128",			"v0 vl po 0F 38 25 /r",	CT_CPU_AVX2},
+	{"VPMOVSXDQ",	"zmmreg,r/m256",			"x0 xl po 0F 38 25 /r",	CT_CPU_AVX512F},
+	{"VPMOVSXWD",	"xmmreg,xmmreg/mem64",		"v0 po 0F 38 23 /r",	CT_CPU_AVX},
+	{"VPMOVSXWD",	"ymmreg,r/m128",			"v0 vl po 0F 38 23 /r",	CT_CPU_AVX2},
+	{"VPMOVSXWD",	"zmmreg,r/m256",			"x0 xl po 0F 38 23 /r",	CT_CPU_AVX512F},
+	{"VPMOVSXWQ",	"xmmreg,xmmreg/mem32",		"v0 po 0F 38 24 /r",	CT_CPU_AVX},
+	{"VPMOVSXWQ",	"ymmreg,xmmreg/mem64",		"v0 vl po 0F 38 24 /r",	CT_CPU_AVX2},
+	{"VPMOVSXWQ",	"zmmreg,r/m128",			"x0 xl po 0F 38 24 /r",	CT_CPU_AVX512F},
+	{"VPMOVW2M",	"kreg,zmmreg",				"x0 xl p3 pw 0F 38 29 /r",	CT_CPU_AVX512BW},
+	{"VPMOVWB",		"r/m256,zmmreg",			"x0 xl p3 0F 38 30 /r",	CT_CPU_AVX512BW},
+	{"VPMOVZXBD",	"xmmreg,xmmreg/mem32",		"v0 po 0F 38 31 /r",	CT_CPU_AVX},
+	{"VPMOVZXBD",	"ymmreg,xmmreg/mem64",		"v0 vl po 0F 38 31 /r",	CT_CPU_AVX2},
+	{"VPMOVZXBD",	"zmmreg,r/m128",			"x0 xl po 0F 38 31 /r",	CT_CPU_AVX512F},
+	{"VPMOVZXBQ",	"xmmreg,xmmreg/mem16",		"v0 po 0F 38 32 /r",	CT_CPU_AVX},
+	{"VPMOVZXBQ",	"ymmreg,xmmreg/mem32",		"v0 vl po 0F 38 32 /r",	CT_CPU_AVX2},
+	{"VPMOVZXBQ",	"zmmreg,xmmreg/mem64",		"x0 xl po 0F 38 32 /r",	CT_CPU_AVX512F},
+	{"VPMOVZXBW",	"xmmreg,xmmreg/mem64",		"v0 po 0F 38 30 /r",	CT_CPU_AVX},
+	{"VPMOVZXBW",	"ymmreg,r/m128",			"v0 vl po 0F 38 30 /r",	CT_CPU_AVX2},
+	{"VPMOVZXBW",	"zmmreg,r/m256",			"x0 xl po 0F 38 30 /r",	CT_CPU_AVX512BW},
+	{"VPMOVZXDQ",	"xmmreg,xmmreg/mem64",		"v0 po 0F 38 35 /r",	CT_CPU_AVX},
+	{"VPMOVZXDQ",	"ymmreg,r/m128",			"v0 vl po 0F 38 35 /r",	CT_CPU_AVX2},
+	{"VPMOVZXDQ",	"zmmreg,r/m256",			"x0 xl po 0F 38 35 /r",	CT_CPU_AVX512F},
+	{"VPMOVZXWD",	"xmmreg,xmmreg/mem64",		"v0 po 0F 38 33 /r",	CT_CPU_AVX},
+	{"VPMOVZXWD",	"ymmreg,r/m128",			"v0 vl po 0F 38 33 /r",	CT_CPU_AVX2},
+	{"VPMOVZXWD",	"zmmreg,r/m256",			"x0 xl po 0F 38 33 /r",	CT_CPU_AVX512F},
+	{"VPMOVZXWQ",	"xmmreg,xmmreg/mem32",		"v0 po 0F 38 34 /r",	CT_CPU_AVX},
+	{"VPMOVZXWQ",	"ymmreg,xmmreg/mem64",		"v0 vl po 0F 38 34 /r",	CT_CPU_AVX2},
+	{"VPMOVZXWQ",	"zmmreg,r/m128",			"x0 xl po 0F 38 34 /r",	CT_CPU_AVX512F},
+	{"VPMULDQ",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 28 /r",	CT_CPU_AVX},
+	{"VPMULDQ",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 28 /r",	CT_CPU_AVX2},
+	{"VPMULDQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 28 /r",	CT_CPU_AVX512F},
+	{"VPMULHRSW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 0B /r",	CT_CPU_AVX},
+	{"VPMULHRSW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 0B /r",	CT_CPU_AVX2},
+	{"VPMULHUW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F E4 /r",	CT_CPU_AVX},
+	{"VPMULHUW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F E4 /r",	CT_CPU_AVX2},
+	{"VPMULHUW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F E4 /r",	CT_CPU_AVX512BW},
+	{"VPMULHW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E5 /r",	CT_CPU_AVX},
+	{"VPMULHW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F E5 /r",	CT_CPU_AVX2},
+	{"VPMULHW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F E5 /r",	CT_CPU_AVX512BW},
+	{"VPMULLD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 40 /r",	CT_CPU_AVX},
+	{"VPMULLD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 40 /r",	CT_CPU_AVX2},
+	{"VPMULLD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 40 /r",	CT_CPU_AVX512F},
+	{"VPMULLW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F D5 /r",	CT_CPU_AVX},
+	{"VPMULLW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F D5 /r",	CT_CPU_AVX2},
+	{"VPMULLW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F D5 /r",	CT_CPU_AVX512BW},
+	{"VPMULUDQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F F4 /r",	CT_CPU_AVX},
+	{"VPMULUDQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F F4 /r",	CT_CPU_AVX2},
+	{"VPMULUDQ",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F F4 /r",	CT_CPU_AVX512F},
+	{"VPOR",		"xmmreg,xmmreg,r/m128",		"v2 po 0F EB /r",	CT_CPU_AVX},
+	{"VPOR",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F EB /r",	CT_CPU_AVX2},
+	{"VPORD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F EB /r",	CT_CPU_AVX512F},
+	{"VPORQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F EB /r",	CT_CPU_AVX512F},
+	{"VPROLD",		"zmmreg,r/m512,imm8",		"x1 xl t4 po 0F 72 /1 ib",	CT_CPU_AVX512F},
+	{"VPROLQ",		"zmmreg,r/m512,imm8",		"x1 xl t8 po pw 0F 72 /1 ib",	CT_CPU_AVX512F},
+	{"VPROLVD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 15 /r",	CT_CPU_AVX512F},
+	{"VPROLVQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 15 /r",	CT_CPU_AVX512F},
+	{"VPRORD",		"zmmreg,r/m512,imm8",		"x1 xl t4 po 0F 72 /0 ib",	CT_CPU_AVX512F},
+	{"VPRORQ",		"zmmreg,r/m512,imm8",		"x1 xl t8 po pw 0F 72 /0 ib",	CT_CPU_AVX512F},
+	{"VPRORVD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 14 /r",	CT_CPU_AVX512F},
+	{"VPRORVQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 14 /r",	CT_CPU_AVX512F},
+	{"VPSADBW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F F6 /r",	CT_CPU_AVX},
+	{"VPSADBW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F F6 /r",	CT_CPU_AVX2},
+	{"VPSADBW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F F6 /r",	CT_CPU_AVX512BW},
+	{"VPSHUFB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 00 /r",	CT_CPU_AVX},
+	{"VPSHUFB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 00 /r",	CT_CPU_AVX2},
+	{"VPSHUFB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 38 00 /r",	CT_CPU_AVX512BW},
+	{"VPSHUFD",		"xmmreg,r/m128,imm8",		"v0 po 0F 70 /r ib",	CT_CPU_AVX},
+	{"VPSHUFD",		"ymmreg,r/m256,imm8",		"v0 vl po 0F 70 /r ib",	CT_CPU_AVX2},
+	{"VPSHUFD",		"zmmreg,r/m512,imm8",		"x0 xl t4 po 0F 70 /r ib",	CT_CPU_AVX512F},
+	{"VPSHUFHW",	"xmmreg,r/m128,imm8",		"v0 p3 0F 70 /r ib",	CT_CPU_AVX},
+	{"VPSHUFHW",	"ymmreg,r/m256,imm8",		"v0 vl p3 0F 70 /r ib",	CT_CPU_AVX2},
+	{"VPSHUFHW",	"zmmreg,r/m512,imm8",		"x0 xl p3 0F 70 /r ib",	CT_CPU_AVX512BW},
+	{"VPSHUFLW",	"xmmreg,r/m128,imm8",		"v0 p2 0F 70 /r ib",	CT_CPU_AVX},
+	{"VPSHUFLW",	"ymmreg,r/m256,imm8",		"v0 vl p2 0F 70 /r ib",	CT_CPU_AVX2},
+	{"VPSHUFLW",	"zmmreg,r/m512,imm8",		"x0 xl p2 0F 70 /r ib",	CT_CPU_AVX512BW},
+	{"VPSIGNB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 08 /r",	CT_CPU_AVX},
+	{"VPSIGNB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 08 /r",	CT_CPU_AVX2},
+	{"VPSIGND",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 0A /r",	CT_CPU_AVX},
+	{"VPSIGND",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 0A /r",	CT_CPU_AVX2},
+	{"VPSIGNW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 09 /r",	CT_CPU_AVX},
+	{"VPSIGNW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 09 /r",	CT_CPU_AVX2},
+	{"VPSLLD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F F2 /r",	CT_CPU_AVX},
+	{"VPSLLD",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F F2 /r",	CT_CPU_AVX2},
+	{"VPSLLD",		"xmmreg,xmmreg,imm8",		"v1 po 0F 72 /6 ib",	CT_CPU_AVX},
+	{"VPSLLD",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 72 /6 ib",	CT_CPU_AVX2},
+	{"VPSLLD",		"zmmreg,zmmreg,r/m128",		"x2 xl po 0F F2 /r",	CT_CPU_AVX512F},
+	{"VPSLLD",		"zmmreg,r/m512,imm8",		"x1 xl t4 po 0F 72 /6 ib",	CT_CPU_AVX512F},
+	{"VPSLLDQ",		"xmmreg,xmmreg,imm8",		"v1 po 0F 73 /7 ib",	CT_CPU_AVX},
+	{"VPSLLDQ",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 73 /7 ib",	CT_CPU_AVX2},
+	{"VPSLLDQ",		"zmmreg,r/m512,imm8",		"x1 xl po 0F 73 /7 ib",	CT_CPU_AVX512BW},
+	{"VPSLLQ",		"xmmreg,xmmreg,r/m128",		"v2 po 0F F3 /r",	CT_CPU_AVX},
+	{"VPSLLQ",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F F3 /r",	CT_CPU_AVX2},
+	{"VPSLLQ",		"xmmreg,xmmreg,imm8",		"v1 po 0F 73 /6 ib",	CT_CPU_AVX},
+	{"VPSLLQ",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 73 /6 ib",	CT_CPU_AVX2},
+	{"VPSLLQ",		"zmmreg,zmmreg,r/m128",		"x2 xl po pw 0F F3 /r",	CT_CPU_AVX512F},
+	{"VPSLLQ",		"zmmreg,r/m512,imm8",		"x1 xl t8 po pw 0F 73 /6 ib",	CT_CPU_AVX512F},
+	{"VPSLLVD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 47 /r",	CT_CPU_AVX2},
+	{"VPSLLVD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 47 /r",	CT_CPU_AVX2},
+	{"VPSLLVD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 47 /r",	CT_CPU_AVX512F},
+	{"VPSLLVQ",		"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 47 /r",	CT_CPU_AVX2},
+	{"VPSLLVQ",		"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 47 /r",	CT_CPU_AVX2},
+	{"VPSLLVQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 47 /r",	CT_CPU_AVX512F},
+	{"VPSLLVW",		"zmmreg,zmmreg,r/m512",		"x2 xl po pw 0F 38 12 /r",	CT_CPU_AVX512BW},
+	{"VPSLLW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F F1 /r",	CT_CPU_AVX},
+	{"VPSLLW",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F F1 /r",	CT_CPU_AVX2},
+	{"VPSLLW",		"xmmreg,xmmreg,imm8",		"v1 po 0F 71 /6 ib",	CT_CPU_AVX},
+	{"VPSLLW",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 71 /6 ib",	CT_CPU_AVX2},
+	{"VPSLLW",		"zmmreg,zmmreg,r/m128",		"x2 xl po 0F F1 /r",	CT_CPU_AVX512BW},
+	{"VPSLLW",		"zmmreg,r/m512,imm8",		"x1 xl po 0F 71 /6 ib",	CT_CPU_AVX512BW},
+	{"VPSRAD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E2 /r",	CT_CPU_AVX},
+	{"VPSRAD",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F E2 /r",	CT_CPU_AVX2},
+	{"VPSRAD",		"xmmreg,xmmreg,imm8",		"v1 po 0F 72 /4 ib",	CT_CPU_AVX},
+	{"VPSRAD",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 72 /4 ib",	CT_CPU_AVX2},
+	{"VPSRAD",		"zmmreg,zmmreg,r/m128",		"x2 xl po 0F E2 /r",	CT_CPU_AVX512F},
+	{"VPSRAD",		"zmmreg,r/m512,imm8",		"x1 xl t4 po 0F 72 /4 ib",	CT_CPU_AVX512F},
+	{"VPSRAQ",		"zmmreg,zmmreg,r/m128",		"x2 xl po pw 0F E2 /r",	CT_CPU_AVX512F},
+	{"VPSRAQ",		"zmmreg,r/m512,imm8",		"x1 xl t8 po pw 0F 72 /4 ib",	CT_CPU_AVX512F},
+	{"VPSRAVD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 46 /r",	CT_CPU_AVX2},
+	{"VPSRAVD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 46 /r",	CT_CPU_AVX2},
+	{"VPSRAVD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 46 /r",	CT_CPU_AVX512F},
+	{"VPSRAVQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 46 /r",	CT_CPU_AVX512F},
+	{"VPSRAVW",		"zmmreg,zmmreg,r/m512",		"x2 xl po pw 0F 38 11 /r",	CT_CPU_AVX512BW},
+	{"VPSRAW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E1 /r",	CT_CPU_AVX},
+	{"VPSRAW",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F E1 /r",	CT_CPU_AVX2},
+	{"VPSRAW",		"xmmreg,xmmreg,imm8",		"v1 po 0F 71 /4 ib",	CT_CPU_AVX},
+	{"VPSRAW",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 71 /4 ib",	CT_CPU_AVX2},
+	{"VPSRAW",		"zmmreg,zmmreg,r/m128",		"x2 xl po 0F E1 /r",	CT_CPU_AVX512BW},
+	{"VPSRAW",		"zmmreg,r/m512,imm8",		"x1 xl po 0F 71 /4 ib",	CT_CPU_AVX512BW},
+	{"VPSRLD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F D2 /r",	CT_CPU_AVX},
+	{"VPSRLD",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F D2 /r",	CT_CPU_AVX2},
+	{"VPSRLD",		"xmmreg,xmmreg,imm8",		"v1 po 0F 72 /2 ib",	CT_CPU_AVX},
+	{"VPSRLD",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 72 /2 ib",	CT_CPU_AVX2},
+	{"VPSRLD",		"zmmreg,zmmreg,r/m128",		"x2 xl po 0F D2 /r",	CT_CPU_AVX512F},
+	{"VPSRLD",		"zmmreg,r/m512,imm8",		"x1 xl t4 po 0F 72 /2 ib",	CT_CPU_AVX512F},
+	{"VPSRLDQ",		"xmmreg,xmmreg,imm8",		"v1 po 0F 73 /3 ib",	CT_CPU_AVX},
+	{"VPSRLDQ",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 73 /3 ib",	CT_CPU_AVX2},
+	{"VPSRLDQ",		"zmmreg,r/m512,imm8",		"x1 xl po 0F 73 /3 ib",	CT_CPU_AVX512BW},
+	{"VPSRLQ",		"xmmreg,xmmreg,r/m128",		"v2 po 0F D3 /r",	CT_CPU_AVX},
+	{"VPSRLQ",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F D3 /r",	CT_CPU_AVX2},
+	{"VPSRLQ",		"xmmreg,xmmreg,imm8",		"v1 po 0F 73 /2 ib",	CT_CPU_AVX},
+	{"VPSRLQ",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 73 /2 ib",	CT_CPU_AVX2},
+	{"VPSRLQ",		"zmmreg,zmmreg,r/m128",		"x2 xl po pw 0F D3 /r",	CT_CPU_AVX512F},
+	{"VPSRLQ",		"zmmreg,r/m512,imm8",		"x1 xl t8 po pw 0F 73 /2 ib",	CT_CPU_AVX512F},
+	{"VPSRLVD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 38 45 /r",	CT_CPU_AVX2},
+	{"VPSRLVD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 38 45 /r",	CT_CPU_AVX2},
+	{"VPSRLVD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 45 /r",	CT_CPU_AVX512F},
+	{"VPSRLVQ",		"xmmreg,xmmreg,r/m128",		"v2 po pw 0F 38 45 /r",	CT_CPU_AVX2},
+	{"VPSRLVQ",		"ymmreg,ymmreg,r/m256",		"v2 vl po pw 0F 38 45 /r",	CT_CPU_AVX2},
+	{"VPSRLVQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 45 /r",	CT_CPU_AVX512F},
+	{"VPSRLVW",		"zmmreg,zmmreg,r/m512",		"x2 xl po pw 0F 38 10 /r",	CT_CPU_AVX512BW},
+	{"VPSRLW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F D1 /r",	CT_CPU_AVX},
+	{"VPSRLW",		"ymmreg,ymmreg,r/m128",		"v2 vl po 0F D1 /r",	CT_CPU_AVX2},
+	{"VPSRLW",		"xmmreg,xmmreg,imm8",		"v1 po 0F 71 /2 ib",	CT_CPU_AVX},
+	{"VPSRLW",		"ymmreg,ymmreg,imm8",		"v1 vl po 0F 71 /2 ib",	CT_CPU_AVX2},
+	{"VPSRLW",		"zmmreg,zmmreg,r/m128",		"x2 xl po 0F D1 /r",	CT_CPU_AVX512BW},
+	{"VPSRLW",		"zmmreg,r/m512,imm8",		"x1 xl po 0F 71 /2 ib",	CT_CPU_AVX512BW},
+	{"VPSUBB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F F8 /r",	CT_CPU_AVX},
+	{"VPSUBB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F F8 /r",	CT_CPU_AVX2},
+	{"VPSUBB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F F8 /r",	CT_CPU_AVX512BW},
+	{"VPSUBD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F FA /r",	CT_CPU_AVX},
+	{"VPSUBD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F FA /r",	CT_CPU_AVX2},
+	{"VPSUBD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F FA /r",	CT_CPU_AVX512F},
+	{"VPSUBQ",		"xmmreg,xmmreg,r/m128",		"v2 po 0F FB /r",	CT_CPU_AVX},
+	{"VPSUBQ",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F FB /r",	CT_CPU_AVX2},
+	{"VPSUBQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F FB /r",	CT_CPU_AVX512F},
+	{"VPSUBSB",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E8 /r",	CT_CPU_AVX},
+	{"VPSUBSB",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F E8 /r",	CT_CPU_AVX2},
+	{"VPSUBSB",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F E8 /r",	CT_CPU_AVX512BW},
+	{"VPSUBSW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F E9 /r",	CT_CPU_AVX},
+	{"VPSUBSW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F E9 /r",	CT_CPU_AVX2},
+	{"VPSUBSW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F E9 /r",	CT_CPU_AVX512BW},
+	{"VPSUBUSB",	"xmmreg,xmmreg,r/m128",		"v2 po 0F D8 /r",	CT_CPU_AVX},
+	{"VPSUBUSB",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F D8 /r",	CT_CPU_AVX2},
+	{"VPSUBUSB",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F D8 /r",	CT_CPU_AVX512BW},
+	{"VPSUBUSW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F D9 /r",	CT_CPU_AVX},
+	{"VPSUBUSW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F D9 /r",	CT_CPU_AVX2},
+	{"VPSUBUSW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F D9 /r",	CT_CPU_AVX512BW},
+	{"VPSUBW",		"xmmreg,xmmreg,r/m128",		"v2 po 0F F9 /r",	CT_CPU_AVX},
+	{"VPSUBW",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F F9 /r",	CT_CPU_AVX2},
+	{"VPSUBW",		"zmmreg,zmmreg,r/m512",		"x2 xl po 0F F9 /r",	CT_CPU_AVX512BW},
+	{"VPTERNLOGD",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t4 po 0F 3A 25 /r ib",	CT_CPU_AVX512F},
+	{"VPTERNLOGQ",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F 3A 25 /r ib",	CT_CPU_AVX512F},
+	{"VPTEST",		"xmmreg,r/m128",			"v0 po 0F 38 17 /r",	CT_CPU_AVX},
+	{"VPTEST",		"ymmreg,r/m256",			"v0 vl po 0F 38 17 /r",	CT_CPU_AVX},
+	{"VPTESTMB",	"kreg,zmmreg,r/m512",		"x2 xl po 0F 38 26 /r",	CT_CPU_AVX512BW},
+	{"VPTESTMD",	"kreg,zmmreg,r/m512",		"x2 xl t4 po 0F 38 27 /r",	CT_CPU_AVX512F},
+	{"VPTESTMQ",	"kreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 38 27 /r",	CT_CPU_AVX512F},
+	{"VPTESTMW",	"kreg,zmmreg,r/m512",		"x2 xl po pw 0F 38 26 /r",	CT_CPU_AVX512BW},
+	{"VPTESTNMB",	"kreg,zmmreg,r/m512",		"x2 xl p3 0F 38 26 /r",	CT_CPU_AVX512BW},
+	{"VPTESTNMD",	"kreg,zmmreg,r/m512",		"x2 xl t4 p3 0F 38 27 /r",	CT_CPU_AVX512F},
+	{"VPTESTNMQ",	"kreg,zmmreg,r/m512",		"x2 xl t8 p3 pw 0F 38 27 /r",	CT_CPU_AVX512F},
+	{"VPTESTNMW",	"kreg,zmmreg,r/m512",		"x2 xl p3 pw 0F 38 26 /r",	CT_CPU_AVX512BW},
+	{"VPUNPCKHBW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 68 /r",	CT_CPU_AVX},
+	{"VPUNPCKHBW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 68 /r",	CT_CPU_AVX2},
+	{"VPUNPCKHBW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 68 /r",	CT_CPU_AVX512BW},
+	{"VPUNPCKHDQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 6A /r",	CT_CPU_AVX},
+	{"VPUNPCKHDQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 6A /r",	CT_CPU_AVX2},
+	{"VPUNPCKHDQ",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 6A /r",	CT_CPU_AVX512F},
+	{"VPUNPCKHQDQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 6D /r",	CT_CPU_AVX},
+	{"VPUNPCKHQDQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 6D /r",	CT_CPU_AVX2},
+	{"VPUNPCKHQDQ",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 6D /r",	CT_CPU_AVX512F},
+	{"VPUNPCKHWD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 69 /r",	CT_CPU_AVX},
+	{"VPUNPCKHWD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 69 /r",	CT_CPU_AVX2},
+	{"VPUNPCKHWD",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 69 /r",	CT_CPU_AVX512BW},
+	{"VPUNPCKLBW",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 60 /r",	CT_CPU_AVX},
+	{"VPUNPCKLBW",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 60 /r",	CT_CPU_AVX2},
+	{"VPUNPCKLBW",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 60 /r",	CT_CPU_AVX512BW},
+	{"VPUNPCKLDQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 62 /r",	CT_CPU_AVX},
+	{"VPUNPCKLDQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 62 /r",	CT_CPU_AVX2},
+	{"VPUNPCKLDQ",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F 62 /r",	CT_CPU_AVX512F},
+	{"VPUNPCKLQDQ",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 6C /r",	CT_CPU_AVX},
+	{"VPUNPCKLQDQ",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 6C /r",	CT_CPU_AVX2},
+	{"VPUNPCKLQDQ",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 6C /r",	CT_CPU_AVX512F},
+	{"VPUNPCKLWD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 61 /r",	CT_CPU_AVX},
+	{"VPUNPCKLWD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 61 /r",	CT_CPU_AVX2},
+	{"VPUNPCKLWD",	"zmmreg,zmmreg,r/m512",		"x2 xl po 0F 61 /r",	CT_CPU_AVX512BW},
+	{"VPXOR",		"xmmreg,xmmreg,r/m128",		"v2 po 0F EF /r",	CT_CPU_AVX},
+	{"VPXOR",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F EF /r",	CT_CPU_AVX2},
+	{"VPXORD",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 po 0F EF /r",	CT_CPU_AVX512F},
+	{"VPXORQ",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F EF /r",	CT_CPU_AVX512F},
+	{"VRCP14PD",	"zmmreg,r/m512",			"x0 xl t8 po pw 0F 38 4C /r",	CT_CPU_AVX512F},
+	{"VRCP14PS",	"zmmreg,r/m512",			"x0 xl t4 po 0F 38 4C /r",	CT_CPU_AVX512F},
+	{"VRCPPS",		"xmmreg,r/m128",			"v0 0F 53 /r",		CT_CPU_AVX},
+	{"VRCPPS",		"ymmreg,r/m256",			"v0 vl 0F 53 /r",	CT_CPU_AVX},
+	{"VRCPSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 53 /r",	CT_CPU_AVX},
+	{"VROUNDPD",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 09 /r ib",	CT_CPU_AVX},
+	{"VROUNDPD",	"ymmreg,r/m256,imm8",		"v0 vl po 0F 3A 09 /r ib",	CT_CPU_AVX},
+	{"VROUNDPS",	"xmmreg,r/m128,imm8",		"v0 po 0F 3A 08 /r ib",	CT_CPU_AVX},
+	{"VROUNDPS",	"ymmreg,r/m256,imm8",		"v0 vl po 0F 3A 08 /r ib",	CT_CPU_AVX},
+	{"VROUNDSD",	"xmmreg,xmmreg,xmmreg/mem64,imm8",	"v2 po 0F 3A 0B /r ib",	CT_CPU_AVX},
+	{"VROUNDSS",	"xmmreg,xmmreg,xmmreg/mem32,imm8",	"v2 po 0F 3A 0A /r ib",	CT_CPU_AVX},
+	{"VRSQRT14PD",	"zmmreg,r/m512",			"x0 xl t8 po pw 0F 38 4E /r",	CT_CPU_AVX512F},
+	{"VRSQRT14PS",	"zmmreg,r/m512",			"x0 xl t4 po 0F 38 4E /r",	CT_CPU_AVX512F},
+	{"VRSQRTPS",	"xmmreg,r/m128",			"v0 0F 52 /r",		CT_CPU_AVX},
+	{"VRSQRTPS",	"ymmreg,r/m256",			"v0 vl 0F 52 /r",	CT_CPU_AVX},
+	{"VRSQRTSS",	"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 52 /r",	CT_CPU_AVX},
+	{"VSHUFF32X4",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t4 po 0F 3A 23 /r ib",	CT_CPU_AVX512F},
+	{"VSHUFF64X2",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F 3A 23 /r ib",	CT_CPU_AVX512F},
+	{"VSHUFI32X4",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t4 po 0F 3A 43 /r ib",	CT_CPU_AVX512F},
+	{"VSHUFI64X2",	"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F 3A 43 /r ib",	CT_CPU_AVX512F},
+	{"VSHUFPD",		"xmmreg,xmmreg,r/m128,imm8",	"v2 po 0F C6 /r ib",	CT_CPU_AVX},
+	{"VSHUFPD",		"ymmreg,ymmreg,r/m256,imm8",	"v2 vl po 0F C6 /r ib",	CT_CPU_AVX},
+	{"VSHUFPD",		"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t8 po pw 0F C6 /r ib",	CT_CPU_AVX512F},
+	{"VSHUFPS",		"xmmreg,xmmreg,r/m128,imm8",	"v2 0F C6 /r ib",	CT_CPU_AVX},
+	{"VSHUFPS",		"ymmreg,ymmreg,r/m256,imm8",	"v2 vl 0F C6 /r ib",	CT_CPU_AVX},
+	{"VSHUFPS",		"zmmreg,zmmreg,r/m512,imm8",	"x2 xl t4 0F C6 /r ib",	CT_CPU_AVX512F},
+	{"VSQRTPD",		"xmmreg,r/m128",			"v0 po 0F 51 /r",	CT_CPU_AVX},
+	{"VSQRTPD",		"ymmreg,r/m256",			"v0 vl po 0F 51 /r",	CT_CPU_AVX},
+	{"VSQRTPD",		"zmmreg,r/m512",			"x0 xl t8 po pw 0F 51 /r",	CT_CPU_AVX512F},
+	{"VSQRTPS",		"xmmreg,r/m128",			"v0 0F 51 /r",		CT_CPU_AVX},
+	{"VSQRTPS",		"ymmreg,r/m256",			"v0 vl 0F 51 /r",	CT_CPU_AVX},
+	{"VSQRTPS",		"zmmreg,r/m512",			"x0 xl t4 0F 51 /r",	CT_CPU_AVX512F},
+	{"VSQRTSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 51 /r",	CT_CPU_AVX},
+	{"VSQRTSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 51 /r",	CT_CPU_AVX},
+	{"VSTMXCSR",	"mem32",					"v0 0F AE /3",		CT_CPU_AVX},
+	{"VSUBPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 5C /r",	CT_CPU_AVX},
+	{"VSUBPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 5C /r",	CT_CPU_AVX},
+	{"VSUBPD",		"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 5C /r",	CT_CPU_AVX512F},
+	{"VSUBPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 5C /r",		CT_CPU_AVX},
+	{"VSUBPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 5C /r",	CT_CPU_AVX},
+	{"VSUBPS",		"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 5C /r",	CT_CPU_AVX512F},
+	{"VSUBSD",		"xmmreg,xmmreg,xmmreg/mem64",	"v2 p2 0F 5C /r",	CT_CPU_AVX},
+	{"VSUBSS",		"xmmreg,xmmreg,xmmreg/mem32",	"v2 p3 0F 5C /r",	CT_CPU_AVX},
+	{"VTESTPD",		"xmmreg,r/m128",			"v0 po 0F 38 0F /r",	CT_CPU_AVX},
+	{"VTESTPD",		"ymmreg,r/m256",			"v0 vl po 0F 38 0F /r",	CT_CPU_AVX},
+	{"VTESTPS",		"xmmreg,r/m128",			"v0 po 0F 38 0E /r",	CT_CPU_AVX},
+	{"VTESTPS",		"ymmreg,r/m256",			"v0 vl po 0F 38 0E /r",	CT_CPU_AVX},
+	{"VUCOMISD",	"xmmreg,xmmreg/mem64",		"v0 po 0F 2E /r",	CT_CPU_AVX},
+	{"VUCOMISS",	"xmmreg,xmmreg/mem32",		"v0 0F 2E /r",		CT_CPU_AVX},
+	{"VUNPCKHPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 15 /r",	CT_CPU_AVX},
+	{"VUNPCKHPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 15 /r",	CT_CPU_AVX},
+	{"VUNPCKHPD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 15 /r",	CT_CPU_AVX512F},
+	{"VUNPCKHPS",	"xmmreg,xmmreg,r/m128",		"v2 0F 15 /r",		CT_CPU_AVX},
+	{"VUNPCKHPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F 15 /r",	CT_CPU_AVX},
+	{"VUNPCKHPS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 15 /r",	CT_CPU_AVX512F},
+	{"VUNPCKLPD",	"xmmreg,xmmreg,r/m128",		"v2 po 0F 14 /r",	CT_CPU_AVX},
+	{"VUNPCKLPD",	"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 14 /r",	CT_CPU_AVX},
+	{"VUNPCKLPD",	"zmmreg,zmmreg,r/m512",		"x2 xl t8 po pw 0F 14 /r",	CT_CPU_AVX512F},
+	{"VUNPCKLPS",	"xmmreg,xmmreg,r/m128",		"v2 0F 14 /r",		CT_CPU_AVX},
+	{"VUNPCKLPS",	"ymmreg,ymmreg,r/m256",		"v2 vl 0F 14 /r",	CT_CPU_AVX},
+	{"VUNPCKLPS",	"zmmreg,zmmreg,r/m512",		"x2 xl t4 0F 14 /r",	CT_CPU_AVX512F},
+	{"VXORPD",		"xmmreg,xmmreg,r/m128",		"v2 po 0F 57 /r",	CT_CPU_AVX},
+	{"VXORPD",		"ymmreg,ymmreg,r/m256",		"v2 vl po 0F 57 /r",	CT_CPU_AVX},
+	{"VXORPS",		"xmmreg,xmmreg,r/m128",		"v2 0F 57 /r",		CT_CPU_AVX},
+	{"VXORPS",		"ymmreg,ymmreg,r/m256",		"v2 vl 0F 57 /r",	CT_CPU_AVX},
+	{"VZEROALL",	"",							"v0 vl 0F 77",		CT_CPU_AVX},
+	{"VZEROUPPER",	"",							"v0 0F 77",			CT_CPU_AVX},
+	{"WAIT",		"",							"9B",				CT_CPU_8086},
+	{"WBINVD",		"",							"0F 09",			CT_CPU_486},
+	{"WRMSR",		"",							"0F 30",			CT_CPU_PENT},
+//	{"WRSHR",		"",							"0F 37",			CT_CPU_P6 | CT_CPU_CYRIX | CT_CPU_SMM},
+	{"XADD",		"r/m8,reg8",				"0F C0 /r",			CT_CPU_486},
+	{"XADD",		"r/m16,reg16",				"po 0F C1 /r",		CT_CPU_486},
+	{"XADD",		"r/m32,reg32",				"po 0F C1 /r",		CT_CPU_386 | CT_CPU_486},
+//	{"XBTS",		"reg16,r/m16",				"po 0F A6 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+//	{"XBTS",		"reg32,r/m32",				"po 0F A6 /r",		CT_CPU_386 | CT_CPU_UNDOC},
+	{"XCHG",		"reg8,r/m8",				"86 /r",			CT_CPU_8086},
+	{"XCHG",		"reg16,r/m8",				"po 87 /r",			CT_CPU_8086},
+	{"XCHG",		"reg32,r/m32",				"po 87 /r",			CT_CPU_386},
+	{"XCHG",		"r/m8,reg8",				"86 /r",			CT_CPU_8086},
+	{"XCHG",		"r/m16,reg16",				"po 87 /r",			CT_CPU_8086},
+	{"XCHG",		"r/m32,reg32",				"po 87 /r",			CT_CPU_386},
+	{"XCHG",		"AX,reg16",					"po 90 +r",			CT_CPU_8086},
+	{"XCHG",		"EAX,reg32",				"po 90 +r",			CT_CPU_386},
+	{"XCHG",		"reg16,AX",					"po 90 +r",			CT_CPU_8086},
+	{"XCHG",		"reg32,EAX",				"po 90 +r",			CT_CPU_386},
+	{"XLATB",		"",							"D7",				CT_CPU_8086},
+	{"XOR",			"r/m8,reg8",				"30 /r",			CT_CPU_8086},
+	{"XOR",			"r/m16,reg16",				"po 31 /r",			CT_CPU_8086},
+	{"XOR",			"r/m32,reg32",				"po 31 /r",			CT_CPU_386},
+	{"XOR",			"reg8,r/m8",				"32 /r",			CT_CPU_8086},
+	{"XOR",			"reg16,r/m16",				"po 33 /r",			CT_CPU_8086},
+	{"XOR",			"reg32,r/m32",				"po 33 /r",			CT_CPU_386},
+	{"XOR",			"r/m8,imm8",				"80 /6 ib",			CT_CPU_8086},
+	{"XOR",			"r/m16,imm16",				"po 81 /6 iw",		CT_CPU_8086},
+	{"XOR",			"r/m32,imm32",				"po 81 /6 id",		CT_CPU_386},
+	{"XOR",			"r/m16,imm8",				"po 83 /6 ib",		CT_CPU_8086},
+	{"XOR",			"r/m32,imm8",				"po 83 /6 ib",		CT_CPU_386},
+	{"XOR",			"AL,imm8",					"34 ib",			CT_CPU_8086},
+	{"XOR",			"AX,imm16",					"po 35 iw",			CT_CPU_8086},
+	{"XOR",			"EAX,imm32",				"po 35 id",			CT_CPU_386},
+	{"XORPD",		"xmmreg,r/m128",			"po 0F 57 /r",		CT_CPU_SSE2},
+	{"XORPS",		"xmmreg,r/m128",			"0F 57 /r",			CT_CPU_KATMAI | CT_CPU_SSE}
+};
+
+
+#define CINSTSET_SIZE	(sizeof(cinstruction_set) / sizeof(CInstSyntax))
+
+// the shared index: rows are never moved, nodes of one mnemonic are
+// laid out next to each other in table order
+static const CInstSyntax *cinstset_rows[CINSTSET_SIZE];
+static CInstruction cinstset_nodes[CINSTSET_SIZE];
+static CInstructionEntry cinstset_entries[CINSTSET_SIZE];
+static CInstTable cinstset_tables[CINSTSET_SIZE];
+static CInstructionSet cinstset_instance;
+
+// perfect hash: a mnemonic picks a bucket with one hash, the bucket's
+// displacement moves its second hash to a slot no other mnemonic uses
+#define CINSTSET_SLOTS	(CINSTSET_SIZE * 4)
+static const CInstructionEntry *cinstset_slots[CINSTSET_SLOTS];
+static unsigned short cinstset_displace[CINSTSET_SIZE];
+
+
+static int cinstset_compare_syntax(const void *element1, const void *element2)
+{
+	const CInstSyntax *s1 = *(const CInstSyntax**)element1;
+	const CInstSyntax *s2 = *(const CInstSyntax**)element2;
+	int hr = stricmp(s1->mnemonic, s2->mnemonic);
+	if (hr != 0) return hr;
+	// keep table order for the same mnemonic, first match wins
+	return (s1 < s2)? -1 : ((s1 > s2)? 1 : 0);
+}
+
+// two case folded hashes of a mnemonic in one pass
+static void cinstset_hash(const char *name, unsigned int *h1, unsigned int *h2)
+{
+	unsigned int a = 5381, b = 2166136261u;
+	for (; *name; name++) {
+		unsigned int ch = (unsigned char)*name;
+		if (ch >= 'a' && ch <= 'z') ch -= 'a' - 'A';
+		a = ((a << 5) + a) + ch;
+		b = (b ^ ch) * 16777619u;
+	}
+	*h1 = a;
+	*h2 = b;
+}
+
+static unsigned int cinstset_slot(unsigned int h1, unsigned int h2, 
+	unsigned int d)
+{
+	return h2 + d * ((h1 >> 16) | 1);
+}
+
+int cinstset_num_instructions(void)
+{
+	return (int)CINSTSET_SIZE;
+}
+
+int cinstset_num_mnemonics(void)
+{
+	return cinstset_shared()->nmnemonic;
+}
+
+// place every bucket, largest first, at the smallest displacement
+// whose slots are all free. returns -1 if some bucket cannot be placed
+static int cinstset_place(CInstructionSet *self, unsigned int nslot, 
+	unsigned int nbucket)
+{
+	static unsigned int hash1[CINSTSET_SIZE];
+	static unsigned int hash2[CINSTSET_SIZE];
+	static int order[CINSTSET_SIZE];
+	static int start[CINSTSET_SIZE + 1];
+	static int members[CINSTSET_SIZE];
+	unsigned int slots[CINSTSET_SIZE];
+	int n = self->nmnemonic;
+	int i, j, k, size, maxsize;
+
+	memset(cinstset_slots, 0, sizeof(cinstset_slots));
+	memset(start, 0, sizeof(start));
+
+	// group mnemonics by bucket: start[b]..start[b + 1] in members
+	for (i = 0; i < n; i++) {
+		cinstset_hash(self->instructionMap[i].mnemonic, &hash1[i], &hash2[i]);
+		start[(hash1[i] & (nbucket - 1)) + 1]++;
+	}
+	for (i = 0, maxsize = 0; i < (int)nbucket; i++) {
+		if (start[i + 1] > maxsize) maxsize = start[i + 1];
+		start[i + 1] += start[i];
+	}
+	for (i = 0; i < (int)nbucket; i++) order[i] = start[i];
+	for (i = 0; i < n; i++) 
+		members[order[hash1[i] & (nbucket - 1)]++] = i;
+
+	// buckets with more members go first
+	for (size = maxsize, k = 0; size > 0; size--) {
+		for (i = 0; i < (int)nbucket; i++) 
+			if (start[i + 1] - start[i] == size) order[k++] = i;
+	}
+
+	for (i = 0; i < k; i++) {
+		int bucket = order[i];
+		int first = start[bucket];
+		int count = start[bucket + 1] - first;
+		unsigned int d;
+		for (d = 0; d < 65536; d++) {
+			for (j = 0; j < count; j++) {
+				int m = members[first + j], t;
+				unsigned int pos = cinstset_slot(hash1[m], hash2[m], d);
+				pos &= nslot - 1;
+				if (cinstset_slots[pos]) break;
+				for (t = 0; t < j; t++) 
+					if (slots[t] == pos) break;
+				if (t < j) break;
+				slots[j] = pos;
+			}
+			if (j == count) break;
+		}
+		if (d >= 65536) return -1;
+		cinstset_displace[bucket] = (unsigned short)d;
+		for (j = 0; j < count; j++) 
+			cinstset_slots[slots[j]] = &self->instructionMap[members[first + j]];
+	}
+
+	return 0;
+}
+
+static void cinstset_build_hash(CInstructionSet *self)
+{
+	unsigned int nslot, nbucket;
+
+	for (nslot = 16; nslot < (unsigned int)self->nmnemonic * 2; nslot <<= 1);
+	for (nbucket = 1; nbucket * 4 < (unsigned int)self->nmnemonic; 
+		nbucket <<= 1);
+
+	// a bigger table is always easier, the first try should do
+	while (cinstset_place(self, nslot, nbucket) != 0) {
+		nslot <<= 1;
+		assert(nslot <= CINSTSET_SLOTS);
+	}
+
+	self->slots = cinstset_slots;
+	self->displace = cinstset_displace;
+	self->slotmask = nslot - 1;
+	self->bucketmask = nbucket - 1;
+}
+
+static void cinstset_build(void)
+{
+	CInstructionSet *self = &cinstset_instance;
+	int count = (int)CINSTSET_SIZE;
+	int i, j, rows;
+
+	for (i = 0; i < count; i++) 
+		cinstset_rows[i] = &cinstruction_set[i];
+
+	qsort(cinstset_rows, count, sizeof(CInstSyntax*), 
+		cinstset_compare_syntax);
+
+	self->maxrows = 0;
+
+	for (i = 0, j = 0, rows = 0; i < count; i++) {
+		cinst_init(&cinstset_nodes[i], cinstset_rows[i]);
+		if (i > 0 && stricmp(cinstset_rows[i - 1]->mnemonic, 
+			cinstset_rows[i]->mnemonic) == 0) {
+			cinstset_nodes[i - 1].next = &cinstset_nodes[i];
+			if (++rows > self->maxrows) self->maxrows = rows;
+			continue;
+		}
+		cinstset_entries[j].mnemonic = cinstset_rows[i]->mnemonic;
+		cinstset_entries[j].instruction = &cinstset_nodes[i];
+		j++;
+		rows = 1;
+		if (rows > self->maxrows) self->maxrows = rows;
+	}
+
+	// rows are chained now, compile one decision table per mnemonic
+	for (i = 0; i < j; i++) {
+		cinst_table_init(&cinstset_tables[i], cinstset_entries[i].instruction);
+		cinstset_entries[i].table = &cinstset_tables[i];
+	}
+
+	self->instructionMap = cinstset_entries;
+	self->instructions = cinstset_nodes;
+	self->nmnemonic = j;
+	self->ninstruction = count;
+
+	cinstset_build_hash(self);
+}
+
+
+//---------------------------------------------------------------------
+// build once
+//---------------------------------------------------------------------
+#if defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(WIN64)
+#include <windows.h>
+
+const CInstructionSet *cinstset_shared(void)
+{
+	static volatile LONG state = 0;
+	if (state != 2) {
+		if (InterlockedCompareExchange(&state, 1, 0) == 0) {
+			cinstset_build();
+			InterlockedExchange(&state, 2);
+		}	else {
+			while (state != 2) Sleep(0);
+		}
+	}
+	return &cinstset_instance;
+}
+
+#else
+#include <pthread.h>
+
+const CInstructionSet *cinstset_shared(void)
+{
+	static pthread_once_t once = PTHREAD_ONCE_INIT;
+	pthread_once(&once, cinstset_build);
+	return &cinstset_instance;
+}
+
+#endif
+
+
+const CInstTable *cinstset_query(const CInstructionSet *self, 
+	const char *name)
+{
+	const CInstructionEntry *entry;
+	unsigned int h1, h2, d;
+
+	assert(self && name);
+	assert(self->slots);
+
+	cinstset_hash(name, &h1, &h2);
+	d = self->displace[h1 & self->bucketmask];
+	entry = self->slots[cinstset_slot(h1, h2, d) & self->slotmask];
+
+	if (entry == NULL || stricmp(entry->mnemonic, name) != 0) {
+		return NULL;
+	}
+
+	return entry->table;
+}
+
+
@@ -1,52 +1,66 @@
-//=====================================================================
-//
-// cinstset.h - 
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CINSTSET_H__
-#define __CINSTSET_H__
-
-#include "cinstruct.h"
-
-
-struct CInstructionEntry
-{
-	const char *mnemonic;
-	CInstruction *instruction;
-};
-
-typedef struct CInstructionEntry CInstructionEntry;
-
-struct CInstructionSet
-{
-	CInstructionEntry *instructionMap;
-};
-
-typedef struct CInstructionSet CInstructionSet;
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-extern CInstSyntax cinstruction_set[];
-
-int cinstset_num_instructions(void);
-int cinstset_num_mnemonics(void);
-
-CInstructionSet *cinstset_create(void);
-void cinstset_release(CInstructionSet *self);
-
-CInstruction *cinstset_query(const CInstructionSet *self, const char *name);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
-
+//=====================================================================
+//
+// cinstset.h - 
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CINSTSET_H__
+#define __CINSTSET_H__
+
+#include "cinstruct.h"
+
+
+struct CInstructionEntry
+{
+	const char *mnemonic;
+	CInstruction *instruction;
+	const CInstTable *table;
+};
+
+typedef struct CInstructionEntry CInstructionEntry;
+
+// process-wide instruction index, built once and shared by all parsers
+struct CInstructionSet
+{
+	CInstructionEntry *instructionMap;
+	CInstruction *instructions;
+	int nmnemonic;
+	int ninstruction;
+	int maxrows;			// most rows sharing one mnemonic
+	const CInstructionEntry **slots;	// perfect hash of mnemonics
+	unsigned short *displace;			// per bucket slot displacement
+	unsigned int slotmask;
+	unsigned int bucketmask;
+};
+
+typedef struct CInstructionSet CInstructionSet;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const CInstSyntax cinstruction_set[];
+
+int cinstset_num_instructions(void);
+int cinstset_num_mnemonics(void);
+
+// get the shared instruction set, the first call builds the index 
+// (thread safe), the set lives until process exits
+const CInstructionSet *cinstset_shared(void);
+
+// returns the decision table of a mnemonic, NULL if not found (it is
+// silent, callers report the error). tables are shared and read-only
+const CInstTable *cinstset_query(const CInstructionSet *self, 
+	const char *name);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
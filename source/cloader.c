@@ -1,178 +1,371 @@
-//=====================================================================
-//
-// cloader.c - source loader
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#include "cloader.h"
-
-//---------------------------------------------------------------------
-// CLink interface
-//---------------------------------------------------------------------
-static CLink *clink_create(const CEncoding *encoding)
-{
-	CLink *link;
-
-	link = (CLink*)malloc(sizeof(CLink));
-	assert(link);
-
-	iqueue_init(&link->head);
-	cencoding_new_copy(&link->encoding, encoding);
-	link->offset = 0;
-	link->size = 0;
-
-	return link;
-}
-
-static void clink_release(CLink *link)
-{
-	assert(link);
-	cencoding_destroy(&link->encoding);
-}
-
-
-//---------------------------------------------------------------------
-// CLoader interface
-//---------------------------------------------------------------------
-CLoader *cloader_create(void)
-{
-	CLoader *loader;
-	loader = (CLoader*)malloc(sizeof(CLoader));
-	assert(loader);
-	iqueue_init(&loader->head);
-	loader->error = (char*)malloc(1024);
-	assert(loader->error);
-	loader->error[0] = 0;
-	loader->errcode = 0;
-	loader->linear = 0;
-	loader->output = NULL;
-	loader->lineno = 0;
-	return loader;
-}
-
-void cloader_reset(CLoader *loader)
-{
-	assert(loader);
-	while (!iqueue_is_empty(&loader->head)) {
-		CLink *link = iqueue_entry(loader->head.next, CLink, head);
-		iqueue_del(&link->head);
-		clink_release(link);
-	}
-	loader->error[0] = 0;
-	loader->errcode = 0;
-	loader->linear = 0;
-	loader->output = NULL;
-	loader->lineno = 0;
-}
-
-void cloader_release(CLoader *loader)
-{
-	assert(loader);
-	cloader_reset(loader);
-	if (loader->error) {
-		free(loader->error);
-		loader->error = NULL;
-	}
-}
-
-int cloader_new_encoding(CLoader *loader, const CEncoding *encoding)
-{
-	CLink *link;
-	link = clink_create(encoding);
-	assert(link);
-	link->lineno = ++loader->lineno;
-	iqueue_add_tail(&link->head, &loader->head);
-	return 0;
-}
-
-int cloader_get_codesize(CLoader *loader)
-{
-	struct IQUEUEHEAD *p;
-	int size = 0;
-	assert(loader);
-	for (p = loader->head.next; p != &loader->head; p = p->next) {
-		CLink *link = iqueue_entry(p, CLink, head);
-		size += cencoding_length(&link->encoding);
-	}
-	return size;
-}
-
-unsigned long cloader_resolve_label(CLoader *loader, const char *label)
-{
-	struct IQUEUEHEAD *p;
-	for (p = loader->head.next; p != &loader->head; p = p->next) {
-		CLink *link = iqueue_entry(p, CLink, head);
-		CEncoding *encoding = &link->encoding;
-		if (cencoding_get_label(encoding)) {
-			if (strcmp(encoding->label, label) == 0) {
-				return (long)link->offset;
-			}
-		}
-	}
-	return 0;
-}
-
-int cloader_output(CLoader *loader, unsigned char *output)
-{
-	struct IQUEUEHEAD *p;
-	assert(loader);
-
-	loader->output = output;
-	loader->linear = (cuint32)output;
-
-	// encoding instructions
-	for (p = loader->head.next; p != &loader->head; p = p->next) {
-		CLink *link = iqueue_entry(p, CLink, head);
-		CEncoding *encoding = &link->encoding;
-		int size;
-		size = cencoding_write_code(encoding, loader->output);
-		link->offset = loader->linear;
-		link->size = size;
-		loader->linear += size;
-		loader->output += size;
-	}
-
-	// resolve labels
-	for (p = loader->head.next; p != &loader->head; p = p->next) {
-		CLink *link = iqueue_entry(p, CLink, head);
-		CEncoding *encoding = &link->encoding;
-		unsigned char *offset = (unsigned char*)link->offset;
-		if (cencoding_get_reference(encoding)) {
-			const char *label = cencoding_get_reference(encoding);
-			long linear = cloader_resolve_label(loader, label);
-			if (linear == 0) {
-				strncpy(loader->error, "not find label: ", 40);
-				strncat(loader->error, label, 100);
-				loader->errcode = link->lineno;
-				return -1;
-			}
-			if (encoding->relative == 0) {
-				cencoding_set_immediate(encoding, linear);
-			}
-			else {
-				long diff = linear - (link->offset + link->size);
-				cencoding_set_jump_offset(encoding, diff);
-			}
-			cencoding_write_code(encoding, offset);
-		}
-	}
-	
-	return 0;
-}
-
-
-void cloader_print(const CLoader *loader)
-{
-	struct IQUEUEHEAD *p;
-	static char line[400];
-	for (p = loader->head.next; p != &loader->head; p = p->next) {
-		CLink *link = iqueue_entry(p, CLink, head);
-		CEncoding *encoding = &link->encoding;
-		cencoding_to_string(encoding, line);
-		printf("%s\n", line);
-	}
-}
-
-
+//=====================================================================
+//
+// cloader.c - source loader
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cloader.h"
+
+//---------------------------------------------------------------------
+// CLink interface
+//---------------------------------------------------------------------
+// links and their strings live in the loader pool, they are dropped
+// all together by cloader_reset
+static CLink *clink_create(CMemPool *pool, const CEncoding *encoding)
+{
+	CLink *link;
+
+	link = (CLink*)cmempool_alloc(pool, sizeof(CLink));
+	assert(link);
+
+	iqueue_init(&link->head);
+	link->encoding = *encoding;
+	if (encoding->label) {
+		link->encoding.label = cmempool_strdup(pool, encoding->label);
+	}
+	if (encoding->reference) {
+		link->encoding.reference = cmempool_strdup(pool, encoding->reference);
+	}
+	if (encoding->data) {
+		link->encoding.data = (char*)cmempool_memdup(pool, encoding->data, 
+			encoding->size);
+	}
+	link->offset = 0;
+	link->size = 0;
+	link->hnext = NULL;
+
+	return link;
+}
+
+
+//---------------------------------------------------------------------
+// CLoader interface
+//---------------------------------------------------------------------
+CLoader *cloader_create(void)
+{
+	CLoader *loader;
+	loader = (CLoader*)malloc(sizeof(CLoader));
+	assert(loader);
+	iqueue_init(&loader->head);
+	loader->pool = cmempool_create(0);
+	assert(loader->pool);
+	loader->error = (char*)malloc(1024);
+	assert(loader->error);
+	loader->error[0] = 0;
+	loader->errcode = 0;
+	loader->linear = 0;
+	loader->output = NULL;
+	loader->size = 0;
+	loader->lineno = 0;
+	loader->bits = 32;
+	loader->labels = NULL;
+	loader->hashsize = 0;
+	loader->numlabel = 0;
+	loader->externs = 0;
+	return loader;
+}
+
+void cloader_reset(CLoader *loader)
+{
+	assert(loader);
+	iqueue_init(&loader->head);
+	cmempool_reset(loader->pool);
+	loader->error[0] = 0;
+	loader->errcode = 0;
+	loader->linear = 0;
+	loader->output = NULL;
+	loader->size = 0;
+	loader->lineno = 0;
+	if (loader->labels) {
+		memset(loader->labels, 0, sizeof(CLink*) * loader->hashsize);
+	}
+	loader->numlabel = 0;
+}
+
+void cloader_release(CLoader *loader)
+{
+	assert(loader);
+	cloader_reset(loader);
+	if (loader->error) {
+		free(loader->error);
+		loader->error = NULL;
+	}
+	if (loader->labels) {
+		free(loader->labels);
+		loader->labels = NULL;
+	}
+	loader->hashsize = 0;
+	if (loader->pool) {
+		cmempool_release(loader->pool);
+		loader->pool = NULL;
+	}
+	free(loader);
+}
+
+
+//---------------------------------------------------------------------
+// label hash table
+//---------------------------------------------------------------------
+static unsigned int cloader_hash(const char *label)
+{
+	unsigned int hash = 5381;
+	for (; *label; label++) 
+		hash = ((hash << 5) + hash) + (unsigned char)*label;
+	return hash;
+}
+
+CLink *cloader_find_label(const CLoader *loader, const char *label)
+{
+	CLink *link;
+	if (loader->numlabel == 0) return NULL;
+	link = loader->labels[cloader_hash(label) & (loader->hashsize - 1)];
+	for (; link; link = link->hnext) {
+		if (strcmp(link->encoding.label, label) == 0) 
+			return link;
+	}
+	return NULL;
+}
+
+static void cloader_rehash(CLoader *loader, int newsize)
+{
+	CLink **labels;
+	int i;
+
+	labels = (CLink**)malloc(sizeof(CLink*) * newsize);
+	assert(labels);
+	memset(labels, 0, sizeof(CLink*) * newsize);
+
+	for (i = 0; i < loader->hashsize; i++) {
+		while (loader->labels[i]) {
+			CLink *link = loader->labels[i];
+			unsigned int pos = cloader_hash(link->encoding.label);
+			loader->labels[i] = link->hnext;
+			pos &= (unsigned int)(newsize - 1);
+			link->hnext = labels[pos];
+			labels[pos] = link;
+		}
+	}
+
+	if (loader->labels) free(loader->labels);
+	loader->labels = labels;
+	loader->hashsize = newsize;
+}
+
+static void cloader_add_label(CLoader *loader, CLink *link)
+{
+	unsigned int pos;
+	if (loader->numlabel * 2 >= loader->hashsize) {
+		cloader_rehash(loader, (loader->hashsize > 0)? 
+			loader->hashsize * 2 : 64);
+	}
+	pos = cloader_hash(link->encoding.label);
+	pos &= (unsigned int)(loader->hashsize - 1);
+	link->hnext = loader->labels[pos];
+	loader->labels[pos] = link;
+	loader->numlabel++;
+}
+
+int cloader_new_encoding(CLoader *loader, const CEncoding *encoding)
+{
+	const char *label = cencoding_get_label(encoding);
+	CLink *link;
+
+	loader->lineno++;
+
+	if (label && cloader_find_label(loader, label)) {
+		strncpy(loader->error, "label redefined: ", 40);
+		strncat(loader->error, label, 100);
+		loader->errcode = loader->lineno;
+		return -1;
+	}
+
+	link = clink_create(loader->pool, encoding);
+	assert(link);
+	link->lineno = loader->lineno;
+	iqueue_add_tail(&link->head, &loader->head);
+
+	if (label) {
+		cloader_add_label(loader, link);
+	}
+
+	return 0;
+}
+
+int cloader_get_codesize(const CLoader *loader)
+{
+	const struct IQUEUEHEAD *p;
+	int size = 0;
+	assert(loader);
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		const CLink *link = iqueue_entry(p, CLink, head);
+		// resizable jumps are counted in their largest form
+		if (link->encoding.relax) {
+			CEncoding encoding = link->encoding;
+			cencoding_set_jump(&encoding, CJUMP_NEAR);
+			size += cencoding_length(&encoding);
+		}	else {
+			size += cencoding_length(&link->encoding);
+		}
+	}
+	return size;
+}
+
+// calculate offset and size of every link written at linear address
+static void cloader_layout(CLoader *loader, cuintptr linear)
+{
+	struct IQUEUEHEAD *p;
+	cuintptr start = linear;
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		link->offset = linear;
+		link->size = cencoding_length_at(&link->encoding, linear);
+		linear += link->size;
+	}
+	loader->size = (long)(linear - start);
+}
+
+// branch relaxation: every resizable jump starts in rel8 form and is
+// grown to rel32 while its displacement does not fit in a byte. jumps
+// only grow, so the layout reaches a fixed point.
+static void cloader_relax(CLoader *loader, cuintptr linear)
+{
+	struct IQUEUEHEAD *p;
+	int changed;
+
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		if (link->encoding.relax) {
+			cencoding_set_jump(&link->encoding, CJUMP_SHORT);
+		}
+	}
+
+	do {
+		changed = 0;
+		cloader_layout(loader, linear);
+		for (p = loader->head.next; p != &loader->head; p = p->next) {
+			CLink *link = iqueue_entry(p, CLink, head);
+			CEncoding *encoding = &link->encoding;
+			CLink *target;
+			cint64 diff;
+			if (encoding->relax == 0) continue;
+			if (cencoding_get_jump(encoding) != CJUMP_SHORT) continue;
+			target = cloader_find_label(loader, encoding->reference);
+			if (target == NULL) {		// external target, keep rel32
+				cencoding_set_jump(encoding, CJUMP_NEAR);
+				changed = 1;
+				continue;
+			}
+			diff = (cint64)target->offset - 
+				(cint64)(link->offset + link->size);
+			if ((signed char)diff != diff) {
+				cencoding_set_jump(encoding, CJUMP_NEAR);
+				changed = 1;
+			}
+		}
+	}	while (changed);
+}
+
+int cloader_output(CLoader *loader, unsigned char *output)
+{
+	struct IQUEUEHEAD *p;
+	assert(loader);
+
+	cloader_relax(loader, (cuintptr)output);
+
+	loader->output = output;
+	loader->linear = (cuintptr)output;
+
+	// encoding instructions
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		CEncoding *encoding = &link->encoding;
+		int size;
+		size = cencoding_write_code(encoding, loader->output);
+		link->offset = loader->linear;
+		link->size = size;
+		loader->linear += size;
+		loader->output += size;
+	}
+
+	// resolve labels
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		CEncoding *encoding = &link->encoding;
+		unsigned char *offset = (unsigned char*)link->offset;
+		if (cencoding_get_reference(encoding)) {
+			const char *label = cencoding_get_reference(encoding);
+			CLink *target = cloader_find_label(loader, label);
+			cuintptr linear;
+			if (target == NULL && loader->externs) {
+				continue;
+			}
+			if (target == NULL) {
+				strncpy(loader->error, "not find label: ", 40);
+				strncat(loader->error, label, 100);
+				loader->errcode = link->lineno;
+				return -1;
+			}
+			linear = target->offset;
+			if (encoding->refdisp) {
+				// keep the addend of the source for later output
+				CEncoding temp = *encoding;
+				cint64 value = (cint64)linear + encoding->displacement;
+				if (encoding->riprel) {
+					value -= (cint64)(link->offset + link->size);
+				}
+				// 32-bit code wraps, 64-bit code sign extends disp32
+				if (loader->bits == 64 && (cint32)value != value) {
+					strncpy(loader->error, "displacement out of range: ", 40);
+					strncat(loader->error, label, 100);
+					loader->errcode = link->lineno;
+					return -1;
+				}
+				temp.displacement = (cint32)value;
+				cencoding_write_code(&temp, offset);
+				continue;
+			}
+			if (encoding->relative == 0) {
+				if (loader->bits == 64 && 
+					cencoding_immediate_size(encoding) == 4 &&
+					(cint64)(cint32)linear != (cint64)linear) {
+					strncpy(loader->error, "address out of 32-bit range: ", 40);
+					strncat(loader->error, label, 100);
+					loader->errcode = link->lineno;
+					return -1;
+				}
+				cencoding_set_immediate(encoding, (cint64)linear);
+			}
+			else {
+				cint64 diff = (cint64)linear - 
+					(cint64)(link->offset + link->size);
+				if ((cint32)diff != diff ||
+					cencoding_set_jump_offset(encoding, (int)diff) != 0) {
+					strncpy(loader->error, "jump out of range: ", 40);
+					strncat(loader->error, label, 100);
+					loader->errcode = link->lineno;
+					return -1;
+				}
+			}
+			cencoding_write_code(encoding, offset);
+		}
+	}
+	
+	return 0;
+}
+
+
+void cloader_print(const CLoader *loader)
+{
+	struct IQUEUEHEAD *p;
+	char line[400];
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		CEncoding *encoding = &link->encoding;
+		cencoding_to_string(encoding, line);
+		printf("%s\n", line);
+	}
+}
+
+
@@ -1,168 +1,184 @@
-//=====================================================================
-//
-// cloader.h - source loader
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CLOADER_H__
-#define __CLOADER_H__
-
-#include "cencoding.h"
-
-
-/*====================================================================*/
-/* QUEUE DEFINITION                                                   */
-/*====================================================================*/
-#ifndef __IQUEUE_DEF__
-#define __IQUEUE_DEF__
-
-struct IQUEUEHEAD {
-	struct IQUEUEHEAD *next, *prev;
-};
-
-typedef struct IQUEUEHEAD iqueue_head;
-
-
-/*--------------------------------------------------------------------*/
-/* queue init                                                         */
-/*--------------------------------------------------------------------*/
-#define IQUEUE_HEAD_INIT(name) { &(name), &(name) }
-#define IQUEUE_HEAD(name) \
-	struct IQUEUEHEAD name = IQUEUE_HEAD_INIT(name)
-
-#define IQUEUE_INIT(ptr) ( \
-	(ptr)->next = (ptr), (ptr)->prev = (ptr))
-
-#define IOFFSETOF(TYPE, MEMBER) ((unsigned long) &((TYPE *)0)->MEMBER)
-
-#define ICONTAINEROF(ptr, type, member) ( \
-		(type*)( ((char*)((type*)ptr)) - IOFFSETOF(type, member)) )
-
-#define IQUEUE_ENTRY(ptr, type, member) ICONTAINEROF(ptr, type, member)
-
-
-/*--------------------------------------------------------------------*/
-/* queue operation                                                    */
-/*--------------------------------------------------------------------*/
-#define IQUEUE_ADD(node, head) ( \
-	(node)->prev = (head), (node)->next = (head)->next, \
-	(head)->next->prev = (node), (head)->next = (node))
-
-#define IQUEUE_ADD_TAIL(node, head) ( \
-	(node)->prev = (head)->prev, (node)->next = (head), \
-	(head)->prev->next = (node), (head)->prev = (node))
-
-#define IQUEUE_DEL_BETWEEN(p, n) ((n)->prev = (p), (p)->next = (n))
-
-#define IQUEUE_DEL(entry) (\
-	(entry)->next->prev = (entry)->prev, \
-	(entry)->prev->next = (entry)->next, \
-	(entry)->next = 0, (entry)->prev = 0)
-
-#define IQUEUE_DEL_INIT(entry) do { \
-	IQUEUE_DEL(entry); IQUEUE_INIT(entry); } while (0)
-
-#define IQUEUE_IS_EMPTY(entry) ((entry) == (entry)->next)
-
-#define iqueue_init		IQUEUE_INIT
-#define iqueue_entry	IQUEUE_ENTRY
-#define iqueue_add		IQUEUE_ADD
-#define iqueue_add_tail	IQUEUE_ADD_TAIL
-#define iqueue_del		IQUEUE_DEL
-#define iqueue_del_init	IQUEUE_DEL_INIT
-#define iqueue_is_empty IQUEUE_IS_EMPTY
-
-#define IQUEUE_FOREACH(iterator, head, TYPE, MEMBER) \
-	for ((iterator) = iqueue_entry((head)->next, TYPE, MEMBER); \
-		&((iterator)->MEMBER) != (head); \
-		(iterator) = iqueue_entry((iterator)->MEMBER.next, TYPE, MEMBER))
-
-#define iqueue_foreach(iterator, head, TYPE, MEMBER) \
-	IQUEUE_FOREACH(iterator, head, TYPE, MEMBER)
-
-#define iqueue_foreach_entry(pos, head) \
-	for( (pos) = (head)->next; (pos) != (head) ; (pos) = (pos)->next )
-	
-
-#define __iqueue_splice(list, head) do {	\
-		iqueue_head *first = (list)->next, *last = (list)->prev; \
-		iqueue_head *at = (head)->next; \
-		(first)->prev = (head), (head)->next = (first);		\
-		(last)->next = (at), (at)->prev = (last); }	while (0)
-
-#define iqueue_splice(list, head) do { \
-	if (!iqueue_is_empty(list)) __iqueue_splice(list, head); } while (0)
-
-#define iqueue_splice_init(list, head) do {	\
-	iqueue_splice(list, head);	iqueue_init(list); } while (0)
-
-
-#ifdef _MSC_VER
-#pragma warning(disable:4311)
-#pragma warning(disable:4312)
-#pragma warning(disable:4996)
-#endif
-
-#endif
-
-
-//---------------------------------------------------------------------
-// CLink
-//---------------------------------------------------------------------
-struct CLink
-{
-	struct IQUEUEHEAD head;
-	CEncoding encoding;
-	unsigned long offset;
-	int size;
-	int lineno;
-};
-
-typedef struct CLink CLink;
-
-
-//---------------------------------------------------------------------
-// CLoader Structure
-//---------------------------------------------------------------------
-struct CLoader
-{
-	struct IQUEUEHEAD head;		// link head;
-	char *error;
-	int errcode;
-	int lineno;
-	unsigned long linear;
-	unsigned char *output;
-};
-
-typedef struct CLoader CLoader;
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-//---------------------------------------------------------------------
-// CLoader interface
-//---------------------------------------------------------------------
-CLoader *cloader_create(void);
-
-void cloader_release(CLoader *loader);
-
-void cloader_reset(CLoader *loader);
-
-int cloader_new_encoding(CLoader *loader, const CEncoding *encoding);
-
-int cloader_get_codesize(CLoader *loader);
-
-int cloader_output(CLoader *loader, unsigned char *output);
-
-void cloader_print(const CLoader *loader);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
-
+//=====================================================================
+//
+// cloader.h - source loader
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CLOADER_H__
+#define __CLOADER_H__
+
+#include "cencoding.h"
+#include "cmempool.h"
+
+
+/*====================================================================*/
+/* QUEUE DEFINITION                                                   */
+/*====================================================================*/
+#ifndef __IQUEUE_DEF__
+#define __IQUEUE_DEF__
+
+struct IQUEUEHEAD {
+	struct IQUEUEHEAD *next, *prev;
+};
+
+typedef struct IQUEUEHEAD iqueue_head;
+
+
+/*--------------------------------------------------------------------*/
+/* queue init                                                         */
+/*--------------------------------------------------------------------*/
+#define IQUEUE_HEAD_INIT(name) { &(name), &(name) }
+#define IQUEUE_HEAD(name) \
+	struct IQUEUEHEAD name = IQUEUE_HEAD_INIT(name)
+
+#define IQUEUE_INIT(ptr) ( \
+	(ptr)->next = (ptr), (ptr)->prev = (ptr))
+
+#define IOFFSETOF(TYPE, MEMBER) ((unsigned long) &((TYPE *)0)->MEMBER)
+
+#define ICONTAINEROF(ptr, type, member) ( \
+		(type*)( ((char*)((type*)ptr)) - IOFFSETOF(type, member)) )
+
+#define IQUEUE_ENTRY(ptr, type, member) ICONTAINEROF(ptr, type, member)
+
+
+/*--------------------------------------------------------------------*/
+/* queue operation                                                    */
+/*--------------------------------------------------------------------*/
+#define IQUEUE_ADD(node, head) ( \
+	(node)->prev = (head), (node)->next = (head)->next, \
+	(head)->next->prev = (node), (head)->next = (node))
+
+#define IQUEUE_ADD_TAIL(node, head) ( \
+	(node)->prev = (head)->prev, (node)->next = (head), \
+	(head)->prev->next = (node), (head)->prev = (node))
+
+#define IQUEUE_DEL_BETWEEN(p, n) ((n)->prev = (p), (p)->next = (n))
+
+#define IQUEUE_DEL(entry) (\
+	(entry)->next->prev = (entry)->prev, \
+	(entry)->prev->next = (entry)->next, \
+	(entry)->next = 0, (entry)->prev = 0)
+
+#define IQUEUE_DEL_INIT(entry) do { \
+	IQUEUE_DEL(entry); IQUEUE_INIT(entry); } while (0)
+
+#define IQUEUE_IS_EMPTY(entry) ((entry) == (entry)->next)
+
+#define iqueue_init		IQUEUE_INIT
+#define iqueue_entry	IQUEUE_ENTRY
+#define iqueue_add		IQUEUE_ADD
+#define iqueue_add_tail	IQUEUE_ADD_TAIL
+#define iqueue_del		IQUEUE_DEL
+#define iqueue_del_init	IQUEUE_DEL_INIT
+#define iqueue_is_empty IQUEUE_IS_EMPTY
+
+#define IQUEUE_FOREACH(iterator, head, TYPE, MEMBER) \
+	for ((iterator) = iqueue_entry((head)->next, TYPE, MEMBER); \
+		&((iterator)->MEMBER) != (head); \
+		(iterator) = iqueue_entry((iterator)->MEMBER.next, TYPE, MEMBER))
+
+#define iqueue_foreach(iterator, head, TYPE, MEMBER) \
+	IQUEUE_FOREACH(iterator, head, TYPE, MEMBER)
+
+#define iqueue_foreach_entry(pos, head) \
+	for( (pos) = (head)->next; (pos) != (head) ; (pos) = (pos)->next )
+	
+
+#define __iqueue_splice(list, head) do {	\
+		iqueue_head *first = (list)->next, *last = (list)->prev; \
+		iqueue_head *at = (head)->next; \
+		(first)->prev = (head), (head)->next = (first);		\
+		(last)->next = (at), (at)->prev = (last); }	while (0)
+
+#define iqueue_splice(list, head) do { \
+	if (!iqueue_is_empty(list)) __iqueue_splice(list, head); } while (0)
+
+#define iqueue_splice_init(list, head) do {	\
+	iqueue_splice(list, head);	iqueue_init(list); } while (0)
+
+
+#ifdef _MSC_VER
+#pragma warning(disable:4311)
+#pragma warning(disable:4312)
+#pragma warning(disable:4996)
+#endif
+
+#endif
+
+
+//---------------------------------------------------------------------
+// CLink
+//---------------------------------------------------------------------
+struct CLink
+{
+	struct IQUEUEHEAD head;
+	CEncoding encoding;
+	cuintptr offset;
+	int size;
+	int lineno;
+	struct CLink *hnext;		// next link in the same label bucket
+};
+
+typedef struct CLink CLink;
+
+
+//---------------------------------------------------------------------
+// CLoader Structure
+//---------------------------------------------------------------------
+struct CLoader
+{
+	struct IQUEUEHEAD head;		// link head;
+	char *error;
+	int errcode;
+	int lineno;
+	int bits;					// code size: 32 or 64
+	cuintptr linear;
+	unsigned char *output;
+	long size;					// code size of the last layout
+	CLink **labels;				// label hash table
+	int hashsize;
+	int numlabel;
+	int externs;				// leave undefined references unresolved
+	CMemPool *pool;				// links, labels and data
+};
+
+typedef struct CLoader CLoader;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// CLoader interface
+//---------------------------------------------------------------------
+CLoader *cloader_create(void);
+
+void cloader_release(CLoader *loader);
+
+void cloader_reset(CLoader *loader);
+
+// append encoding, returns -1 if its label is already defined
+int cloader_new_encoding(CLoader *loader, const CEncoding *encoding);
+
+// upper bound of code size: resizable jumps are counted in rel32 form
+// and ALIGN in full, the links are not changed
+int cloader_get_codesize(const CLoader *loader);
+
+// write code, loader->size is the size written
+int cloader_output(CLoader *loader, unsigned char *output);
+
+// find the link defining label, NULL for undefined label
+CLink *cloader_find_label(const CLoader *loader, const char *label);
+
+void cloader_print(const CLoader *loader);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
@@ -0,0 +1,103 @@
+//=====================================================================
+//
+// cmempool.c - bump memory pool
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cmempool.h"
+
+#define CMEMPOOL_CHUNKSIZE	16384
+#define CMEMPOOL_ALIGN		8
+#define CMEMPOOL_HEADER		((long)((sizeof(CMemChunk) + \
+	CMEMPOOL_ALIGN - 1) & ~(CMEMPOOL_ALIGN - 1)))
+
+
+//---------------------------------------------------------------------
+// CMemPool interface
+//---------------------------------------------------------------------
+CMemPool *cmempool_create(long chunksize)
+{
+	CMemPool *pool;
+	pool = (CMemPool*)malloc(sizeof(CMemPool));
+	assert(pool);
+	pool->head = NULL;
+	pool->current = NULL;
+	pool->chunksize = (chunksize > 0)? chunksize : CMEMPOOL_CHUNKSIZE;
+	return pool;
+}
+
+void cmempool_release(CMemPool *pool)
+{
+	assert(pool);
+	while (pool->head) {
+		CMemChunk *chunk = pool->head;
+		pool->head = chunk->next;
+		free(chunk);
+	}
+	pool->current = NULL;
+	free(pool);
+}
+
+void cmempool_reset(CMemPool *pool)
+{
+	assert(pool);
+	// chunks after head are rewound when allocation reaches them
+	pool->current = pool->head;
+	if (pool->head) pool->head->used = 0;
+}
+
+void *cmempool_alloc(CMemPool *pool, long size)
+{
+	CMemChunk *chunk;
+	char *ptr;
+
+	assert(pool);
+
+	chunk = pool->current;
+
+	if (size <= 0) size = 1;
+	size = (size + CMEMPOOL_ALIGN - 1) & ~((long)CMEMPOOL_ALIGN - 1);
+
+	while (chunk && chunk->used + size > chunk->size) {
+		chunk = chunk->next;
+		if (chunk) chunk->used = 0;
+	}
+
+	if (chunk == NULL) {
+		long need = (size > pool->chunksize)? size : pool->chunksize;
+		chunk = (CMemChunk*)malloc(CMEMPOOL_HEADER + need);
+		assert(chunk);
+		chunk->size = need;
+		chunk->used = 0;
+		if (pool->current) {
+			chunk->next = pool->current->next;
+			pool->current->next = chunk;
+		}	else {
+			chunk->next = pool->head;
+			pool->head = chunk;
+		}
+	}
+
+	pool->current = chunk;
+	ptr = (char*)chunk + CMEMPOOL_HEADER + chunk->used;
+	chunk->used += size;
+
+	return ptr;
+}
+
+void *cmempool_memdup(CMemPool *pool, const void *data, long size)
+{
+	char *ptr = (char*)cmempool_alloc(pool, size + 1);
+	memcpy(ptr, data, size);
+	ptr[size] = 0;
+	return ptr;
+}
+
+char *cmempool_strdup(CMemPool *pool, const char *text)
+{
+	return (char*)cmempool_memdup(pool, text, (long)strlen(text));
+}
+
+
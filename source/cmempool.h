@@ -0,0 +1,74 @@
+//=====================================================================
+//
+// cmempool.h - bump memory pool
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CMEMPOOL_H__
+#define __CMEMPOOL_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+//---------------------------------------------------------------------
+// CMemChunk - one malloc block, data follows the header
+//---------------------------------------------------------------------
+struct CMemChunk
+{
+	struct CMemChunk *next;
+	long size;
+	long used;
+};
+
+typedef struct CMemChunk CMemChunk;
+
+
+//---------------------------------------------------------------------
+// CMemPool
+//---------------------------------------------------------------------
+struct CMemPool
+{
+	CMemChunk *head;
+	CMemChunk *current;
+	long chunksize;
+};
+
+typedef struct CMemPool CMemPool;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// interface
+//---------------------------------------------------------------------
+
+// create pool, chunksize is the size of each block (0: 16KB)
+CMemPool *cmempool_create(long chunksize);
+
+// free every chunk
+void cmempool_release(CMemPool *pool);
+
+// drop everything allocated, chunks are kept for reuse
+void cmempool_reset(CMemPool *pool);
+
+// allocate memory, 8 bytes aligned, never fails
+void *cmempool_alloc(CMemPool *pool, long size);
+
+// copy a block / a string into the pool
+void *cmempool_memdup(CMemPool *pool, const void *data, long size);
+char *cmempool_strdup(CMemPool *pool, const char *text);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
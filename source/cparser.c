@@ -1,1036 +1,1796 @@
-//=====================================================================
-//
-// cparser.c - source parser
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#include "cparser.h"
-
-#ifdef _MSC_VER
-#pragma warning(disable: 4996)
-#endif
-
-#define IMAX_DATA 65536
-
-CParser *cparser_create(void)
-{
-	CParser *parser;
-	parser = (CParser*)malloc(sizeof(CParser));
-	assert(parser);
-	parser->token = cscanner_create();
-	assert(parser->token);
-	parser->instruction = NULL;
-	parser->instructionset = cinstset_create();
-	csynth_init(&parser->synthesizer);
-	parser->data = (char*)malloc(IMAX_DATA);
-	assert(parser->data);
-	parser->error = (char*)malloc(1024);
-	assert(parser->error);
-	parser->error[0] = 0;
-	parser->errcode = 0;
-	parser->vars = NULL;
-	parser->inproc = 0;
-	parser->stack = 0;
-	return parser;
-}
-
-void cparser_release(CParser *parser)
-{
-	assert(parser);
-	if (parser->token) {
-		cscanner_release(parser->token);
-		parser->token = NULL;
-	}
-	if (parser->instructionset) {
-		cinstset_release(parser->instructionset);
-		parser->instructionset = NULL;
-	}
-	if (parser->error) {
-		free(parser->error);
-		parser->error = NULL;
-	}
-	if (parser->data) {
-		free(parser->data);
-		parser->data = NULL;
-	}
-	while (parser->vars) {
-		CVariable *var = parser->vars;
-		parser->vars = parser->vars->next;
-		free(var->name);
-		free(var);
-	}
-	csynth_destroy(&parser->synthesizer);
-	free(parser);
-}
-
-void cparser_reset(CParser *parser)
-{
-	cscanner_macro_reset(parser->token);
-	while (parser->vars) {
-		CVariable *var = parser->vars;
-		parser->vars = parser->vars->next;
-		free(var->name);
-		free(var);
-	}
-	parser->inproc = 0;
-	parser->stack = 0;
-}
-
-static int cparser_parse_label(CParser *parser);
-static int cparser_parse_mnemonic(CParser *parser);
-static int cparser_parse_specifier(CParser *parser);
-static int cparser_parse_first_operand(CParser *parser);
-static int cparser_parse_second_operand(CParser *parser);
-static int cparser_parse_third_operand(CParser *parser);
-static COperand cparser_parse_immediate(CParser *parser);
-static COperand cparser_parse_register(CParser *parser);
-static COperand cparser_parse_memory_reference(CParser *parser);
-
-static int cparser_parse_data(CParser *parser);
-static int cparser_parse_align(CParser *parser);
-static int cparser_parse_prefix(CParser *parser);
-
-static int cparser_parse_proc(CParser *parser);
-
-static void cparser_error(CParser *parser, const char *error, int code)
-{
-	strncpy(parser->error, error, 100);
-	parser->errcode = code;
-}
-
-const CEncoding *cparser_parse_line(CParser *parser, const char *source)
-{
-	int retval;
-
-	if (source == NULL) {
-		cparser_error(parser, "empty source line", 1);
-		return NULL;
-	}
-
-	retval = cscanner_set_source(parser->token, source);
-
-	if (retval != 0) {
-		cparser_error(parser, parser->token->error, 2);
-		return NULL;
-	}
-
-	parser->instruction = NULL;
-	csynth_reset(&parser->synthesizer);
-
-	parser->error[0] = 0;
-	parser->errcode = 0;
-
-	// parse label
-	if (!cscanner_is_endl(parser->token)) {
-		if (cparser_parse_label(parser)) {
-			cparser_error(parser, "label error", 3);
-			return NULL;
-		}
-	}
-
-	// parse inline data
-	if (!cscanner_is_endl(parser->token)) {
-		if (cparser_parse_data(parser)) {
-			return NULL;
-		}
-		if (parser->synthesizer.encoding.data != NULL) {
-			return &parser->synthesizer.encoding;
-		}
-	}
-
-	// parse align
-	if (!cscanner_is_endl(parser->token)) {
-		if (cparser_parse_align(parser)) {
-			return NULL;
-		}
-		if (parser->synthesizer.encoding.align != 0) {
-			return &parser->synthesizer.encoding;
-		}
-	}
-
-	// parse proc
-	if (!cscanner_is_endl(parser->token)) {
-		if (cparser_parse_proc(parser)) {
-			return NULL;
-		}
-	}
-
-	// parse repnz, repz
-	if (!cscanner_is_endl(parser->token)) {
-		if (cparser_parse_prefix(parser)) {
-			return NULL;
-		}
-	}
-
-	// parse mnemonic
-	if (!cscanner_is_endl(parser->token)) {
-		if (cparser_parse_mnemonic(parser)) {
-			cparser_error(parser, "mnemonic syntax error", 4);
-			return NULL;
-		}
-
-		if (!parser->instruction) {
-			cparser_error(parser, "mnemonic error", 5);
-			return NULL;
-		}
-
-		if (cparser_parse_first_operand(parser)) {
-			if (parser->errcode == 0) 
-				cparser_error(parser, "first operand error", 6);
-			return NULL;
-		}
-
-		if (cparser_parse_second_operand(parser)) {
-			if (parser->errcode == 0)
-				cparser_error(parser, "second operand error", 7);
-			return NULL;
-		}
-
-		if (cparser_parse_third_operand(parser)) {
-			if (parser->errcode == 0)
-				cparser_error(parser, "third operand error", 8);
-			return NULL;
-		}
-	}
-
-	if (parser->instruction) {
-		do {
-			if (cinst_match_syntax(parser->instruction)) {
-				break;
-			}
-			parser->instruction = parser->instruction->next;
-		}	while (parser->instruction);
-
-		if (parser->instruction == NULL) {
-			cparser_error(parser, "operands mismatch", 9);
-			return NULL;
-		}
-#if 0
-		printf("%s (%s) (%s) specifier=%d\n",
-			parser->instruction->syntax->mnemonic,
-			parser->instruction->syntax->operands,
-			parser->instruction->syntax->encoding,
-			parser->instruction->specifier);
-#endif
-	}
-
-	return csynth_encode_instruction(&parser->synthesizer, 
-		parser->instruction);
-}
-
-
-static int cparser_parse_label(CParser *parser)
-{
-	const CTOKEN *current = cscanner_token_current(parser->token);
-	const CTOKEN *next = cscanner_token_lookahead(parser->token);
-	if (ctoken_is_ident(current) && ctoken_get_char(next) == ':') {
-		csynth_define_label(&parser->synthesizer, current->str);
-		cscanner_token_advance(parser->token, 2);
-	}
-	else if (ctoken_get_char(current) == '.' && ctoken_is_ident(next)) {
-		csynth_define_label(&parser->synthesizer, next->str);
-		cscanner_token_advance(parser->token, 2);
-	}
-	return 0;
-}
-
-static int cparser_parse_mnemonic(CParser *parser)
-{
-	const char *name = cscanner_get_string(parser->token);
-	parser->instruction = cinstset_query(parser->instructionset, name);
-	if (parser->instruction) {
-		cinst_match_mnemonic(parser->instruction, name);
-		cscanner_token_advance(parser->token, 1);
-	}	else {
-		cparser_error(parser, "Mnemonic not recognised", 10);
-		return -1;
-	}
-	return 0;
-}
-
-static int cparser_parse_specifier(CParser *parser)
-{
-	enum CSpecifierType type = CS_UNKNOWN;
-
-	if (cscanner_is_ident(parser->token)) {
-		type = cspecifier_scan(cscanner_get_string(parser->token));
-	}
-
-	cinst_match_specifier(parser->instruction, type);
-
-	if (type != CS_UNKNOWN) {
-		cscanner_token_advance(parser->token, 1);
-	}
-
-	return 0;
-}
-
-static int cparser_parse_first_operand(CParser *parser)
-{
-	COperand firstOperand = CINIT;
-
-	assert(parser->instruction);
-
-	cparser_parse_specifier(parser);
-
-	if (cscanner_is_endl(parser->token)) {
-	}
-	else if (cscanner_is_operator(parser->token)) {
-		switch (cscanner_get_char(parser->token)) {
-		case '[':
-			firstOperand = cparser_parse_memory_reference(parser);
-			if (parser->errcode) return -5;
-			break;
-		case '+':
-		case '-':
-		case '~':
-			firstOperand = cparser_parse_immediate(parser);
-			break;
-		default:
-			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
-			return -1;
-			break;
-		}
-	}
-	else if (cscanner_is_int(parser->token)) {
-		firstOperand = cparser_parse_immediate(parser);
-		if (parser->errcode) return -5;
-	}
-	else if (cscanner_is_ident(parser->token)) {
-		firstOperand = cparser_parse_register(parser);
-		if (parser->errcode) return -5;
-	}
-	else {
-		cparser_error(parser, "Invalid destination operand", 11);
-		return -2;
-	}
-
-	cinst_match_first_operand(parser->instruction, &firstOperand);
-	csynth_encode_first_operand(&parser->synthesizer, &firstOperand);
-
-	return 0;
-}
-
-static int cparser_parse_second_operand(CParser *parser)
-{
-	COperand secondOperand = CINIT;
-	assert(parser->instruction);
-
-	if (cscanner_get_char(parser->token) == ',') {
-		cscanner_token_advance(parser->token, 1);
-	}	
-	else if (!cscanner_is_endl(parser->token)) {
-		cparser_error(parser, "Operands must be separated by comma", 12);
-		return -3;
-	}
-	else {
-		cinst_match_second_operand(parser->instruction, &secondOperand);
-		return 0;
-	}
-
-	cparser_parse_specifier(parser);
-
-	if (cscanner_is_endl(parser->token)) {
-	}
-	else if (cscanner_is_operator(parser->token)) {
-		switch (cscanner_get_char(parser->token)) {
-		case '[':
-			secondOperand = cparser_parse_memory_reference(parser);
-			if (parser->errcode) return -5;
-			break;
-		case '+':
-		case '-':
-		case '~':
-			secondOperand = cparser_parse_immediate(parser);
-			if (parser->errcode) return -5;
-			break;
-		default:
-			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
-			return -1;
-			break;
-		}
-	}
-	else if (cscanner_is_int(parser->token)) {
-		secondOperand = cparser_parse_immediate(parser);
-		if (parser->errcode) return -5;
-	}
-	else if (cscanner_is_ident(parser->token)) {
-		secondOperand = cparser_parse_register(parser);
-		if (parser->errcode) return -5;
-	}
-	else {
-		cparser_error(parser, "Invalid source operand", 13);
-		return -2;
-	}
-
-	cinst_match_second_operand(parser->instruction, &secondOperand);
-	csynth_encode_second_operand(&parser->synthesizer, &secondOperand);
-
-	return 0;
-}
-
-static int cparser_parse_third_operand(CParser *parser)
-{
-	COperand thirdOperand = CINIT;
-
-	assert(parser->instruction);
-
-	if (cscanner_get_char(parser->token) == ',') {
-		cscanner_token_advance(parser->token, 1);
-	}
-	else if (!cscanner_is_endl(parser->token)) {
-		cparser_error(parser, "Operands must be separated by comma", 14);
-		return -3;
-	}
-	else {
-		cinst_match_third_operand(parser->instruction, &thirdOperand);
-		return 0;
-	}
-
-	if (cscanner_is_endl(parser->token)) {
-	}
-	else if (cscanner_is_operator(parser->token)) {
-		switch (cscanner_get_char(parser->token)) {
-		case '+':
-		case '-':
-		case '~':
-			thirdOperand = cparser_parse_immediate(parser);
-			if (parser->errcode) return -5;
-			break;
-		default:
-			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
-			return -1;
-			break;
-		}
-	}
-	else if (cscanner_is_int(parser->token)) {
-		thirdOperand = cparser_parse_immediate(parser);
-		if (parser->errcode) return -5;
-	}
-	else {
-		cparser_error(parser, "Too many operands", 15);
-		return -2;
-	}
-
-	cinst_match_third_operand(parser->instruction, &thirdOperand);
-	csynth_encode_third_operand(&parser->synthesizer, &thirdOperand);
-
-	return 0;
-}
-
-static COperand cparser_parse_immediate(CParser *parser)
-{
-	COperand imm = CINIT;
-	if (cscanner_is_operator(parser->token)) {
-		int ch = cscanner_get_char(parser->token);
-		if (ch == '+') {
-			cscanner_token_advance(parser->token, 1);
-			imm.value = +cscanner_get_value(parser->token);
-		}
-		else if (ch == '-') {
-			cscanner_token_advance(parser->token, 1);
-			imm.value = -cscanner_get_value(parser->token);
-		}
-		else if (ch == '~') {
-			cscanner_token_advance(parser->token, 1);
-			imm.value = ~cscanner_get_value(parser->token);
-		}
-		else {
-			cparser_error(parser, "error operator", 16);
-			return imm;
-		}
-	}
-	else if (cscanner_is_int(parser->token)) {
-		imm.value = cscanner_get_value(parser->token);
-	}
-	else {
-		cparser_error(parser, "immediate error", 17);
-		return imm;
-	}
-
-	if ((unsigned char)imm.value == imm.value) {
-		imm.type = O_IMM8;
-	}
-	else if ((unsigned short)imm.value == imm.value) {
-		imm.type = O_IMM16;
-	}
-	else {
-		imm.type = O_IMM32;
-	}
-
-	cscanner_token_advance(parser->token, 1);
-
-	return imm;
-}
-
-static COperand cparser_parse_register(CParser *parser)
-{
-	COperand reg = CINIT;
-	const char *name;
-
-	name = cscanner_get_string(parser->token);
-	reg = coperand_scan_reg(name);
-
-	// It's not a register, so it must be a reference
-	if (reg.type == O_UNKNOWN) {
-		csynth_reference_label(&parser->synthesizer, name);
-		// first operand should be immediate
-		reg.type = O_IMM8;	// also matchs IMM32
-		cinst_match_first_operand(parser->instruction, &reg);
-	}
-
-	cscanner_token_advance(parser->token, 1);
-
-	return reg;
-}
-
-static COperand cparser_parse_memory_reference(CParser *parser)
-{
-	COperand mem = CINIT;
-
-	for (; ; ) {
-		const CTOKEN *next;
-		const CTOKEN *prev;
-		const CTOKEN *token;
-		int type;
-
-		type = cscanner_token_lookahead(parser->token)->type;
-		if (type == CTokenENDL || type == CTokenENDF) break;
-
-		prev = cscanner_token_current(parser->token);
-		cscanner_token_advance(parser->token, 1);
-		next = cscanner_token_lookahead(parser->token);
-		token = cscanner_token_current(parser->token);
-
-		if (token->type == CTokenIDENT) {
-			COperand reg = coperand_scan_reg(token->str);
-			if (reg.type == O_UNKNOWN) {
-				cparser_error(parser, "unknow reg reference", 18);
-				return reg;
-			}
-			if (ctoken_get_char(prev) == '*' || ctoken_get_char(next) == '*')
-			{
-				csynth_encode_index(&parser->synthesizer, &reg);
-			}
-			else 
-			{
-				csynth_encode_base(&parser->synthesizer, &reg);
-			}
-		}
-		else if (token->type == CTokenOPERATOR) {
-			switch (ctoken_get_char(token)) {
-			case ']':
-				mem.type = O_MEM;
-				cscanner_token_advance(parser->token, 1);
-				return mem;
-				break;
-			case '+':
-				if ((prev->type != CTokenINT && prev->type != CTokenIDENT) ||
-					(next->type != CTokenINT && next->type != CTokenIDENT)) {
-					cparser_error(parser, 
-						"Syntax error '+' in memory reference", 19);
-					return mem;
-				}
-				break;
-			case '-':
-				if ((prev->type != CTokenINT && prev->type != CTokenIDENT &&
-					ctoken_get_char(prev) != '[') ||
-					next->type != CTokenINT) {
-					cparser_error(parser, 
-						"Syntax error '-' in memory reference", 20);
-					return mem;
-				}
-				break;
-			case '*':
-				if ((prev->type != CTokenINT || next->type != CTokenIDENT) &&
-					(next->type != CTokenINT || prev->type != CTokenIDENT)) {
-					cparser_error(parser,
-						"Syntax error '*' in memory reference", 21);
-					return mem;
-				}
-				break;
-			default:
-				cparser_error(parser, 
-					"Unexpected punctuator in memory reference", 22);
-				return mem;
-				break;
-			}
-		}
-		else if (token->type == CTokenINT) {
-			int prevch = ctoken_get_char(prev);
-			int nextch = ctoken_get_char(next);
-			int value = ctoken_get_int(token);
-			if (prevch == '*' || nextch == '*') {
-				if (value == 1 || value == 2 || value == 4 || value == 8) {
-					csynth_encode_scale(&parser->synthesizer, value);
-				}	else {
-					cparser_error(parser, 
-						"Invalid scale in memory reference", 23);
-					return mem;
-				}
-			}
-			else if (prevch == '-') {
-				csynth_encode_displacement(&parser->synthesizer, -value);
-			}
-			else if (prevch == '+' || nextch == '+') {
-				csynth_encode_displacement(&parser->synthesizer, value);
-			}
-			else if (prevch == '[' && nextch == ']') {
-				cparser_error(parser,
-					"Invalid number in memory reference", 30);
-				return mem;
-			}
-			else {
-				cparser_error(parser, 
-					"Invalid number in memory reference", 24);
-				return mem;
-			}
-		}
-		else {
-			cparser_error(parser, 
-				"Unexpected token in memory reference", 25);
-			return mem;
-		}
-	}
-
-	cparser_error(parser, "Unexpected end of line in memory reference", 26);
-
-	return mem;
-}
-
-
-static int cparser_parse_data(CParser *parser)
-{
-	const char *name;
-	long pos = 0;
-	int size = -1;
-
-	if (cscanner_is_ident(parser->token) == 0) {
-		return 0;
-	}
-
-	name = cscanner_get_string(parser->token);
-
-	if (stricmp(name, "DB") == 0) size = 1;
-	else if (stricmp(name, "DW") == 0) size = 2;
-	else if (stricmp(name, "DD") == 0) size = 4;
-
-	if (size < 0) return 0;
-
-	cscanner_token_advance(parser->token, 1);
-
-	for (pos = 0; ; ) {
-		unsigned char *ptr = (unsigned char*)parser->data;
-		const CTOKEN *token;
-
-		if (cscanner_is_endl(parser->token)) break;
-
-		token = cscanner_token_current(parser->token);
-
-		if (token->type == CTokenINT) {
-			cuint32 value = (cuint32)token->intval;
-			if (pos + size >= IMAX_DATA) {
-				cparser_error(parser, "data too long", 41);
-				return -1;
-			}
-			if (size == 1) {
-				ptr[pos++] = (unsigned char)((value >>  0) & 0xff);
-			}
-			else if (size == 2) {
-				ptr[pos++] = (unsigned char)((value >>  0) & 0xff);
-				ptr[pos++] = (unsigned char)((value >>  8) & 0xff);
-			}
-			else if (size == 4) {
-				ptr[pos++] = (unsigned char)((value >>  0) & 0xff);
-				ptr[pos++] = (unsigned char)((value >>  8) & 0xff);
-				ptr[pos++] = (unsigned char)((value >> 16) & 0xff);
-				ptr[pos++] = (unsigned char)((value >> 24) & 0xff);
-			}
-		}
-		else if (token->type == CTokenSTR) {
-			const char *text = token->str;
-			long size, i, c;
-			char hex[3];
-			size = (long)strlen(text);
-			for (i = 0; i < size; ) {
-				if (i + 1 >= IMAX_DATA) {
-					cparser_error(parser, "data too long", 41);
-					return -2;
-				}
-				if (text[i] == '\\') {
-					switch (text[i + 1])
-					{
-					case '\\': ptr[pos++] = '\\'; i += 2; break;
-					case 'n' : ptr[pos++] = '\n'; i += 2; break;
-					case 'r' : ptr[pos++] = '\r'; i += 2; break;
-					case 't' : ptr[pos++] = '\t'; i += 2; break;
-					case '0' : ptr[pos++] = '\0'; i += 2; break;
-					case '?' : ptr[pos++] = '?'; i += 2; break;
-					case '\'': ptr[pos++] = '\''; i += 2; break;
-					case '\"': ptr[pos++] = '\"'; i += 2; break;
-					case 'a' : ptr[pos++] = '\a'; i += 2; break;
-					case 'b' : ptr[pos++] = '\b'; i += 2; break;
-					case 'f' : ptr[pos++] = '\f'; i += 2; break;
-					case 'v' : ptr[pos++] = '\v'; i += 2; break;
-					case 'x' :
-						i += 2;
-						hex[0] = text[i++];
-						hex[1] = text[i++];
-						hex[2] = 0;
-						c = strtol(hex, NULL, 16);
-						ptr[pos++] = (unsigned char)(c & 255);
-						break;
-					default:
-						cparser_error(parser, "string format error", 42);
-						return -3;
-						break;
-					}
-				}
-				else if (text[i] == '\'') {
-					if (text[i + 1] == '\'') {
-						ptr[pos++] = '\'';
-						i += 2;
-					}	else {
-						ptr[pos++] = '\'';
-						i += 1;
-					}
-				}
-				else if (text[i] == '\"') {
-					if (text[i + 1] == '\"') {
-						ptr[pos++] = '\"';
-						i += 2;
-					}	else {
-						ptr[pos++] = '\"';
-						i += 1;
-					}
-				}
-				else {
-					ptr[pos++] = (unsigned char)text[i++];
-				}
-			}
-		}
-		else {
-			cparser_error(parser, "unrecongnize data", 43);
-			return -4;
-		}
-
-		cscanner_token_advance(parser->token, 1);
-
-		if (!cscanner_is_endl(parser->token)) {
-			if (cscanner_get_char(parser->token) != ',') {
-				cparser_error(parser, "expected comma", 40);
-				return -3;
-			}
-			cscanner_token_advance(parser->token, 1);
-		}
-	}
-
-	if (pos > 0) {
-		cencoding_set_data(&parser->synthesizer.encoding, parser->data, pos);
-	}
-
-	return 0;
-}
-
-
-static int cparser_parse_prefix(CParser *parser)
-{
-	const char *name;
-
-	if (cscanner_is_ident(parser->token) == 0) {
-		return 0;
-	}
-
-	name = cscanner_get_string(parser->token);
-
-	if (stricmp(name, "REP") == 0 ||
-		stricmp(name, "REPE") == 0 ||
-		stricmp(name, "REPZ") == 0) {
-		if (csynth_encode_prefix(&parser->synthesizer, 0xf3)) {
-			cparser_error(parser, parser->synthesizer.error, 70);
-			return -1;
-		}
-		cscanner_token_advance(parser->token, 1);
-	}
-	else if (stricmp(name, "REPNE") == 0 || stricmp(name, "REPNZ") == 0) {
-		parser->synthesizer.prefix = 0xf2;
-		if (csynth_encode_prefix(&parser->synthesizer, 0xf2)) {
-			cparser_error(parser, parser->synthesizer.error, 71);
-			return -2;
-		}
-		cscanner_token_advance(parser->token, 1);
-	}
-	else if (stricmp(name, "LOCK") == 0) {
-		if (csynth_encode_prefix(&parser->synthesizer, 0xf0)) {
-			cparser_error(parser, parser->synthesizer.error, 72);
-			return -3;
-		}
-		cscanner_token_advance(parser->token, 1);
-	}
-
-	return 0;
-}
-
-static int cparser_parse_align(CParser *parser)
-{
-	const char *name;
-
-	if (cscanner_is_ident(parser->token) == 0) {
-		return 0;
-	}
-
-	name = cscanner_get_string(parser->token);
-	
-	if (stricmp(name, "ALIGN") == 0) {
-		int align = 4;
-		cscanner_token_advance(parser->token, 1);
-		if (cscanner_is_int(parser->token)) {
-			align = cscanner_get_value(parser->token);
-		}
-		while (!cscanner_is_endf(parser->token)) {
-			cscanner_token_advance(parser->token, 1);
-		}
-		if (align < 1) {
-			cparser_error(parser, "error align size", 80);
-			return -1;
-		}
-		parser->synthesizer.encoding.align = align;
-	}
-
-	return 0;
-}
-
-static int cparser_parse_size(CParser *parser)
-{
-	const CTOKEN *token = cscanner_token_current(parser->token);
-	cscanner_token_advance(parser->token, 1);
-	if (token->type == CTokenIDENT) {
-		if (stricmp(token->str, "BYTE") == 0) return 1;
-		if (stricmp(token->str, "CHAR") == 0) return 1;
-		if (stricmp(token->str, "INT8") == 0) return 1;
-		if (stricmp(token->str, "UINT8") == 0) return 1;
-		if (stricmp(token->str, "WORD") == 0) return 2;
-		if (stricmp(token->str, "SHORT") == 0) return 2;
-		if (stricmp(token->str, "USHORT") == 0) return 2;
-		if (stricmp(token->str, "INT16") == 0) return 2;
-		if (stricmp(token->str, "UINT16") == 0) return 2;
-		if (stricmp(token->str, "DWORD") == 0) return 4;
-		if (stricmp(token->str, "INT") == 0) return 4;
-		if (stricmp(token->str, "UINT") == 0) return 4;
-		if (stricmp(token->str, "LONG") == 0) return 4;
-		if (stricmp(token->str, "ULONG") == 0) return 4;
-		if (stricmp(token->str, "INT32") == 0) return 4;
-		if (stricmp(token->str, "UINT32") == 0) return 4;
-	}
-	return 0;
-}
-
-static int cparser_parse_newvar(CParser *parser, const char *name, int stack)
-{
-	char *macro = (char*)parser->data;
-	CVariable *var;
-
-	if (stricmp(name, "RET") == 0) {
-		sprintf(macro, "'%s' conflicted with keyword", name);
-		cparser_error(parser, macro, 96);
-		return -1;
-	}
-
-	for (var = parser->vars; var; var = var->next) {
-		if (strcmp(var->name, name) == 0) {
-			sprintf(macro, "'%s' redefined", name);
-			cparser_error(parser, macro, 97);
-			return -2;
-		}
-	}
-
-	if (stack >= 0) sprintf(macro, "[EBP + %d]", stack);
-	else sprintf(macro, "[EBP - %d]", -stack);
-
-	if (cscanner_macro_set(parser->token, name, macro)) {
-		sprintf(macro, "name '%s' redefined", name);
-		cparser_error(parser, macro, 95);
-		return -3;
-	}
-
-	var = (CVariable*)malloc(sizeof(CVariable));
-	assert(var);
-	var->name = strdup(name);
-	assert(var->name);
-	var->pos = stack;
-
-	var->next = parser->vars;
-	parser->vars = var;
-
-	return 0;
-}
-
-static int cparser_parse_proc(CParser *parser)
-{
-	unsigned char instruction[20];
-	const char *name;
-
-	if (cscanner_is_ident(parser->token) == 0) {
-		return 0;
-	}
-
-	name = cscanner_get_string(parser->token);
-
-	if (stricmp(name, "PROC") == 0) {
-		const char *replace = "DB 0x8B, 0xE5, 0x5D, 0xC3\n";
-		int stack = 8;
-
-		if (parser->inproc) {
-			cparser_error(parser, "cannot define proc in a proc block", 90);
-			return -1;
-		}
-		parser->inproc = 1;
-		parser->stack = 0;
-
-		// replace ret to "mov esp, ebp; pop ebp; ret"
-		cscanner_macro_set(parser->token, "ret", replace);
-		cscanner_macro_set(parser->token, "RET", replace);
-		cscanner_macro_set(parser->token, "Ret", replace);
-		cscanner_macro_set(parser->token, "rEt", replace);
-		cscanner_macro_set(parser->token, "reT", replace);
-		cscanner_macro_set(parser->token, "rET", replace);
-		cscanner_macro_set(parser->token, "ReT", replace);
-		cscanner_macro_set(parser->token, "REt", replace);
-
-		cscanner_token_advance(parser->token, 1);
-
-		for (stack = 8; !cscanner_is_endl(parser->token); ) {
-			const CTOKEN *token = cscanner_token_current(parser->token);
-			const CTOKEN *next = cscanner_token_lookahead(parser->token);
-			char *macro = (char*)parser->data;
-			if (ctoken_get_char(token) == ',') {
-				cscanner_token_advance(parser->token, 1);
-			}
-			else if (token->type == CTokenIDENT && next->ch == ':') {
-				int size;
-				cscanner_token_advance(parser->token, 2);
-				size = cparser_parse_size(parser);
-				if (size == 0) {
-					cparser_error(parser, "variable type unknown", 93);
-					return -1;
-				}
-				if (cparser_parse_newvar(parser, token->str, stack)) {
-					return -4;
-				}
-				stack += size;
-			}
-			else {
-				if (token->type == CTokenIDENT) {
-					sprintf(macro, "parameter '%s' error", token->str);
-				}	else {
-					sprintf(macro, "parameter error");
-				}
-				cparser_error(parser, macro, 93);
-				return -3;
-			}
-		}
-
-		instruction[0] = 0x55;		// push ebp
-		instruction[1] = 0x8B;		// mov ebp, esp
-		instruction[2] = 0xEC;
-
-		cencoding_set_data(&parser->synthesizer.encoding, instruction, 3);
-	}
-	else if (stricmp(name, "LOCAL") == 0) {
-		int localsize = 0;
-		int IS;
-
-		cscanner_token_advance(parser->token, 1);
-
-		if (parser->inproc == 0) {
-			cparser_error(parser, "local is forbbiden outside a proc", 90);
-			return -5;
-		}
-
-		for (; !cscanner_is_endl(parser->token); ) {
-			const CTOKEN *token = cscanner_token_current(parser->token);
-			const CTOKEN *next = cscanner_token_lookahead(parser->token);
-			char *macro = (char*)parser->data;
-			if (ctoken_get_char(token) == ',') {
-				cscanner_token_advance(parser->token, 1);
-			}
-			else if (token->type == CTokenIDENT && next->ch == ':') {
-				int pos, size;
-				cscanner_token_advance(parser->token, 2);
-				size = cparser_parse_size(parser);
-				if (size == 0) {
-					cparser_error(parser, "variable type unknown", 93);
-					return -1;
-				}
-				pos = -(parser->stack + size);
-				if (cparser_parse_newvar(parser, token->str, pos)) {
-					return -6;
-				}
-				parser->stack += size;
-				localsize += size;
-				//printf("LOCAL %s=[EBP+(%d)]\n", token->str, pos);
-			}
-			else {
-				if (token->type == CTokenIDENT) {
-					sprintf(macro, "parameter '%s' error", token->str);
-				}	else {
-					sprintf(macro, "parameter error");
-				}
-				cparser_error(parser, macro, 92);
-				return -3;
-			}
-		}
-
-		if (localsize <= 127) {
-			instruction[0] = 0x83;		// sub esp, imm8
-			instruction[1] = 0xEC;
-			instruction[2] = (unsigned char)(localsize & 0xff);
-			IS = 3;
-		}	else {
-			instruction[0] = 0x81;		// sub esp, imm32
-			instruction[1] = 0xEC;
-			instruction[2] = (unsigned char)((localsize >>  0) & 0xff);
-			instruction[3] = (unsigned char)((localsize >>  8) & 0xff);
-			instruction[4] = (unsigned char)((localsize >> 16) & 0xff);
-			instruction[5] = (unsigned char)((localsize >> 24) & 0xff);
-			IS = 6;
-		}
-
-		cencoding_set_data(&parser->synthesizer.encoding, instruction, IS);
-	}
-	else if (stricmp(name, "ENDP") == 0) {
-		if (parser->inproc == 0) {
-			cparser_error(parser, "not find proc definition", 91);
-			return -2;
-		}
-		parser->inproc = 0;
-		parser->stack = 0;
-		while (parser->vars) {
-			CVariable *var = parser->vars;
-			parser->vars = parser->vars->next;
-			cscanner_macro_del(parser->token, var->name);
-			free(var->name);
-			free(var);
-		}
-		cscanner_macro_del(parser->token, "ret");
-		cscanner_macro_del(parser->token, "RET");
-		cscanner_macro_del(parser->token, "Ret");
-		cscanner_macro_del(parser->token, "rEt");
-		cscanner_macro_del(parser->token, "reT");
-		cscanner_macro_del(parser->token, "rET");
-		cscanner_macro_del(parser->token, "ReT");
-		cscanner_macro_del(parser->token, "REt");
-	}
-	else {
-		return 0;
-	}
-
-	while (!cscanner_is_endf(parser->token)) {
-		cscanner_token_advance(parser->token, 1);
-	}
-	
-	return 0;
-}
-
+//=====================================================================
+//
+// cparser.c - source parser
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cparser.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4996)
+#endif
+
+#define IMAX_DATA 65536
+
+CParser *cparser_create(void)
+{
+	CParser *parser;
+	parser = (CParser*)malloc(sizeof(CParser));
+	assert(parser);
+	parser->token = cscanner_create();
+	assert(parser->token);
+	parser->instruction = NULL;
+	parser->instructionset = cinstset_shared();
+	parser->table = NULL;
+	parser->match = 0;
+	parser->specifier = 0;
+	parser->size = CS_UNKNOWN;
+	parser->bits = 32;
+	parser->wide = 0;
+	parser->narrow = 0;
+	parser->qword = 0;
+	parser->reg32 = 0;
+	parser->reg64 = 0;
+	csynth_init(&parser->synthesizer);
+	parser->data = (char*)malloc(IMAX_DATA);
+	assert(parser->data);
+	parser->error = (char*)malloc(1024);
+	assert(parser->error);
+	parser->error[0] = 0;
+	parser->errcode = 0;
+	parser->vars = NULL;
+	parser->inproc = 0;
+	parser->stack = 0;
+	return parser;
+}
+
+void cparser_release(CParser *parser)
+{
+	assert(parser);
+	if (parser->token) {
+		cscanner_release(parser->token);
+		parser->token = NULL;
+	}
+	parser->instructionset = NULL;
+	if (parser->error) {
+		free(parser->error);
+		parser->error = NULL;
+	}
+	if (parser->data) {
+		free(parser->data);
+		parser->data = NULL;
+	}
+	while (parser->vars) {
+		CVariable *var = parser->vars;
+		parser->vars = parser->vars->next;
+		free(var->name);
+		free(var);
+	}
+	csynth_destroy(&parser->synthesizer);
+	free(parser);
+}
+
+void cparser_reset(CParser *parser)
+{
+	cscanner_macro_reset(parser->token);
+	while (parser->vars) {
+		CVariable *var = parser->vars;
+		parser->vars = parser->vars->next;
+		free(var->name);
+		free(var);
+	}
+	parser->inproc = 0;
+	parser->stack = 0;
+}
+
+int cparser_set_mode(CParser *parser, int bits)
+{
+	if (bits != 32 && bits != 64) return -1;
+	parser->bits = bits;
+	parser->synthesizer.bits = bits;
+	return 0;
+}
+
+static int cparser_parse_label(CParser *parser);
+static int cparser_parse_mnemonic(CParser *parser);
+static const CInstruction *cparser_select(CParser *parser, 
+	unsigned int match);
+static int cparser_parse_specifier(CParser *parser);
+static void cparser_set_specifier(CParser *parser, 
+	enum CSpecifierType type);
+static void cparser_begin(CParser *parser);
+static const CEncoding *cparser_parse_current(CParser *parser);
+static const CEncoding *cparser_encode_instruction(CParser *parser);
+static int cparser_parse_first_operand(CParser *parser);
+static int cparser_parse_second_operand(CParser *parser);
+static int cparser_parse_third_operand(CParser *parser);
+static int cparser_parse_fourth_operand(CParser *parser);
+static COperand cparser_parse_immediate(CParser *parser);
+static COperand cparser_parse_register(CParser *parser);
+static void cparser_immediate_type(const CParser *parser, COperand *imm);
+static void cparser_register_size(CParser *parser, int index, 
+	COperand *reg);
+static COperand cparser_parse_memory_reference(CParser *parser);
+static int cparser_parse_opmask(CParser *parser);
+static int cparser_parse_broadcast(CParser *parser);
+
+static int cparser_parse_data(CParser *parser);
+static int cparser_parse_align(CParser *parser);
+static int cparser_parse_prefix(CParser *parser);
+
+static int cparser_parse_proc(CParser *parser);
+
+static void cparser_error(CParser *parser, const char *error, int code)
+{
+	strncpy(parser->error, error, 100);
+	parser->errcode = code;
+}
+
+const CEncoding *cparser_parse_line(CParser *parser, const char *source)
+{
+	if (source == NULL) {
+		cparser_error(parser, "empty source line", 1);
+		return NULL;
+	}
+
+	return cparser_parse_span(parser, source, (long)strlen(source));
+}
+
+const CEncoding *cparser_parse_span(CParser *parser, const char *source,
+	long length)
+{
+	int retval;
+
+	if (source == NULL) {
+		cparser_error(parser, "empty source line", 1);
+		return NULL;
+	}
+
+	retval = cscanner_set_source_span(parser->token, source, length);
+
+	if (retval != 0) {
+		cparser_error(parser, parser->token->error, 2);
+		return NULL;
+	}
+
+	return cparser_parse_current(parser);
+}
+
+int cparser_tokenize(CParser *parser, const char *source, long length)
+{
+	return cscanner_tokenize(parser->token, source, length);
+}
+
+const CEncoding *cparser_parse_tokens(CParser *parser, int line)
+{
+	if (cscanner_set_line(parser->token, line) != 0) {
+		cparser_error(parser, parser->token->error, 2);
+		return NULL;
+	}
+
+	return cparser_parse_current(parser);
+}
+
+// parse current line of the scanner
+static const CEncoding *cparser_parse_current(CParser *parser)
+{
+	cparser_begin(parser);
+
+	// parse label
+	if (!cscanner_is_endl(parser->token)) {
+		if (cparser_parse_label(parser)) {
+			cparser_error(parser, "label error", 3);
+			return NULL;
+		}
+	}
+
+	// parse inline data
+	if (!cscanner_is_endl(parser->token)) {
+		if (cparser_parse_data(parser)) {
+			return NULL;
+		}
+		if (parser->synthesizer.encoding.data != NULL) {
+			return &parser->synthesizer.encoding;
+		}
+	}
+
+	// parse align
+	if (!cscanner_is_endl(parser->token)) {
+		if (cparser_parse_align(parser)) {
+			return NULL;
+		}
+		if (parser->synthesizer.encoding.align != 0) {
+			return &parser->synthesizer.encoding;
+		}
+	}
+
+	// parse proc
+	if (!cscanner_is_endl(parser->token)) {
+		if (cparser_parse_proc(parser)) {
+			return NULL;
+		}
+	}
+
+	// parse repnz, repz
+	if (!cscanner_is_endl(parser->token)) {
+		if (cparser_parse_prefix(parser)) {
+			return NULL;
+		}
+	}
+
+	// parse mnemonic
+	if (!cscanner_is_endl(parser->token)) {
+		if (cparser_parse_mnemonic(parser)) {
+			if (parser->errcode == 0)
+				cparser_error(parser, "mnemonic syntax error", 4);
+			return NULL;
+		}
+
+		if (!parser->table) {
+			cparser_error(parser, "mnemonic error", 5);
+			return NULL;
+		}
+
+		if (cparser_parse_first_operand(parser)) {
+			if (parser->errcode == 0) 
+				cparser_error(parser, "first operand error", 6);
+			return NULL;
+		}
+
+		if (cparser_parse_second_operand(parser)) {
+			if (parser->errcode == 0)
+				cparser_error(parser, "second operand error", 7);
+			return NULL;
+		}
+
+		if (cparser_parse_third_operand(parser)) {
+			if (parser->errcode == 0)
+				cparser_error(parser, "third operand error", 8);
+			return NULL;
+		}
+
+		if (cparser_parse_fourth_operand(parser)) {
+			if (parser->errcode == 0)
+				cparser_error(parser, "fourth operand error", 8);
+			return NULL;
+		}
+	}
+
+	return cparser_encode_instruction(parser);
+}
+
+// state of a new line
+static void cparser_begin(CParser *parser)
+{
+	parser->instruction = NULL;
+	parser->table = NULL;
+	parser->wide = 0;
+	parser->narrow = 0;
+	parser->qword = 0;
+	parser->reg32 = 0;
+	parser->reg64 = 0;
+	csynth_reset(&parser->synthesizer);
+
+	parser->error[0] = 0;
+	parser->errcode = 0;
+}
+
+// operands are in, select the row and encode it
+static const CEncoding *cparser_encode_instruction(CParser *parser)
+{
+	const CEncoding *encoding;
+
+	if (parser->table) {
+		parser->instruction = cparser_select(parser, 
+			parser->match & parser->specifier);
+
+		if (parser->instruction == NULL) {
+			if (parser->errcode == 0)
+				cparser_error(parser, "operands mismatch", 9);
+			return NULL;
+		}
+#if 0
+		printf("%s (%s) (%s) specifier=%d\n",
+			parser->instruction->syntax->mnemonic,
+			parser->instruction->syntax->operands,
+			parser->instruction->syntax->encoding,
+			parser->instruction->specifier);
+#endif
+	}
+
+	encoding = csynth_encode_instruction(&parser->synthesizer, 
+		parser->instruction);
+
+	if (encoding == NULL) {
+		cparser_error(parser, parser->synthesizer.error, 31);
+	}
+
+	return encoding;
+}
+
+
+// REX.W for a row: a 64-bit register operand, or a QWORD memory operand
+// taken by a 32-bit integer row. stack rows are 64-bit without it.
+static int cparser_wide(const CParser *parser, int index)
+{
+	unsigned int bit = 1u << index;
+	if (parser->bits != 64 || (parser->table->stack64 & bit)) return 0;
+	if (parser->wide) return 1;
+	return parser->qword && (parser->table->promote & bit);
+}
+
+// row of immediates only, nothing but a specifier gives it a size
+static int cparser_immediate_only(const CInstruction *row)
+{
+	const enum COperandType types[3] = { row->firstOperand, 
+		row->secondOperand, row->thirdOperand };
+	int i;
+	if (row->firstOperand == O_VOID) return 0;
+	for (i = 0; i < 3; i++) {
+		if (types[i] != O_VOID && (types[i] & O_IMM) != types[i]) 
+			return 0;
+	}
+	return 1;
+}
+
+// row works on 64-bit operands, so its 32-bit immediate is sign extended
+static int cparser_operand64(const CParser *parser, int index)
+{
+	if (parser->bits != 64) return 0;
+	if (parser->table->stack64 & (1u << index)) return 1;
+	return cparser_wide(parser, index);
+}
+
+// several rows can take the same operands, e.g. "add eax, 1" matches
+// r/m32,imm32, r/m32,imm8 and EAX,imm32. the first row in table order
+// decides the operand size, among the rows of that size which can hold
+// the immediate the shortest encoding wins (ties keep table order). 
+// rows of immediates only, e.g. "push 300", are 16-bit for WORD in
+// 32-bit code and else of the default operand size. a label immediate is taken as a 
+// full address. 
+static const CInstruction *cparser_select(CParser *parser, 
+	unsigned int match)
+{
+	const CInstTable *table = parser->table;
+	const CInstruction *first;
+	const CInstruction *best;
+	const CEncoding *encoding;
+	CSynthesizer trial;
+	char error[128];
+	cint64 immediate;
+	int size, length, index, label, pass, i;
+
+	// rows the code size can't encode
+	if (parser->bits == 64) {
+		match &= ~table->legacy;
+		if (parser->narrow) match &= ~table->stack64;
+		if (parser->narrow && (parser->wide || parser->qword)) {
+			match &= ~table->promote;
+		}
+		// a 64-bit register goes to a row naming one or to a row REX.W
+		// widens, a 32-bit one never to a 64-bit position
+		for (i = 0; i < CINST_OPERANDS; i++) {
+			if (parser->reg32 & (1u << i)) match &= ~table->gpr64[i];
+			if (parser->reg64 & (1u << i)) {
+				match &= table->gpr64[i] | table->promote | table->stack64;
+			}
+		}
+	}	else {
+		match &= ~table->x64;
+	}
+
+	match &= table->all;
+	if (match == 0) return NULL;
+
+	for (index = 0; (match & (1u << index)) == 0; index++);
+	first = table->rows[index];
+
+	// a relative target means another thing in rel8 and rel32 forms,
+	// the loader sizes jumps to labels
+	if (strchr(cinst_getEncoding(first), '-')) {
+		parser->synthesizer.wide = cparser_wide(parser, index);
+		return first;
+	}
+
+	label = parser->synthesizer.encoding.reference && 
+		!parser->synthesizer.encoding.refdisp;
+
+	size = cinst_operand_size(first);
+	if (cparser_immediate_only(first)) {
+		size = (parser->size == CS_WORD && parser->bits != 64)? 16 : 32;
+	}
+	best = NULL;
+	length = 0;
+
+	// a label is a full address, on a 64-bit operand without a row to
+	// hold one ("add rcx, K") a sign extended imm32 the loader checks
+	for (pass = 0; pass < 2 && best == NULL; pass++) {
+		if (pass == 1 && label == 0) break;
+		for (i = 0; i < table->count; i++) {
+			const CInstruction *row = table->rows[i];
+			int wide = cparser_wide(parser, i);
+			if ((match & (1u << i)) == 0) continue;
+			if (cinst_operand_size(row) != size) continue;
+			immediate = parser->synthesizer.encoding.immediate;
+			if (label) {
+				immediate = (wide && pass == 0)? 
+					(cint64)0x7fffffffffffffffLL : 0x7fffffff;
+			}
+			if (!cinst_immediate_fits(row, immediate, 
+				cparser_operand64(parser, i))) continue;
+			trial = parser->synthesizer;
+			trial.error = error;
+			trial.wide = wide;
+			encoding = csynth_encode_instruction(&trial, row);
+			if (encoding == NULL) continue;
+			if (best == NULL || cencoding_length(encoding) < length) {
+				length = cencoding_length(encoding);
+				best = row;
+				index = i;
+			}
+		}
+	}
+
+	if (best == NULL) {
+		// a 64-bit operation sign extends its 32-bit immediate, there 
+		// is no row to truncate the value into
+		if (cparser_operand64(parser, index)) {
+			cparser_error(parser, "Immediate out of range", 28);
+			return NULL;
+		}
+		// nothing holds the value, keep the first row as it always was
+		best = first;
+	}
+
+	parser->synthesizer.wide = cparser_wide(parser, index);
+
+	return best;
+}
+
+static int cparser_parse_label(CParser *parser)
+{
+	const CTOKEN *current = cscanner_token_current(parser->token);
+	const CTOKEN *next = cscanner_token_lookahead(parser->token);
+	if (ctoken_is_ident(current) && ctoken_get_char(next) == ':') {
+		csynth_define_label(&parser->synthesizer, current->str);
+		cscanner_token_advance(parser->token, 2);
+	}
+	else if (ctoken_get_char(current) == '.' && ctoken_is_ident(next)) {
+		csynth_define_label(&parser->synthesizer, next->str);
+		cscanner_token_advance(parser->token, 2);
+	}
+	return 0;
+}
+
+static int cparser_parse_mnemonic(CParser *parser)
+{
+	const char *name = cscanner_get_string(parser->token);
+	parser->table = cinstset_query(parser->instructionset, name);
+	if (parser->table) {
+		parser->match = parser->table->all;
+		parser->specifier = parser->table->all;
+		cscanner_token_advance(parser->token, 1);
+	}	else {
+		char *text = (char*)parser->data;
+		sprintf(text, "Mnemonic '%.60s' not recognised", name);
+		cparser_error(parser, text, 10);
+		return -1;
+	}
+	return 0;
+}
+
+static int cparser_parse_specifier(CParser *parser)
+{
+	enum CSpecifierType type = CS_UNKNOWN;
+
+	if (cscanner_is_ident(parser->token)) {
+		const char *name = cscanner_get_string(parser->token);
+		type = cspecifier_scan(name);
+		// SHORT and NEAR share one specifier type, remember which
+		// distance was written for the jump
+		if (type == CS_NEAR) {
+			parser->synthesizer.jump = (stricmp(name, "SHORT") == 0)?
+				CJUMP_SHORT : CJUMP_NEAR;
+		}
+	}
+
+	cparser_set_specifier(parser, type);
+
+	if (type != CS_UNKNOWN) {
+		cscanner_token_advance(parser->token, 1);
+	}
+
+	return 0;
+}
+
+static void cparser_set_specifier(CParser *parser, 
+	enum CSpecifierType type)
+{
+	parser->specifier = cinst_table_specifier(parser->table, type);
+	parser->size = type;
+
+	// QWORD also names the 64-bit form of the 32-bit integer rows
+	if (parser->bits == 64 && type == CS_QWORD) {
+		parser->specifier |= parser->table->promote &
+			cinst_table_specifier(parser->table, CS_DWORD);
+	}
+}
+
+// rows accepting operand at position index. in 64-bit mode QWORD memory
+// also matches the 32-bit integer rows, REX.W makes them 64-bit
+static unsigned int cparser_match_operand(CParser *parser, int index,
+	COperand *operand)
+{
+	unsigned int match, promote;
+	COperand dword;
+
+	if (coperand_is_reg(operand)) {
+		cparser_register_size(parser, index, operand);
+	}
+
+	match = cinst_table_operand(parser->table, index, operand, 
+		parser->specifier);
+
+	if (parser->bits == 64 && operand->type == O_MEM64) {
+		dword = *operand;
+		dword.type = O_MEM32;
+		promote = parser->table->promote & cinst_table_operand(
+			parser->table, index, &dword, parser->specifier);
+		if (promote & ~match) parser->qword = 1;
+		match |= promote;
+	}
+
+	return match;
+}
+
+static int cparser_parse_first_operand(CParser *parser)
+{
+	COperand firstOperand = CINIT;
+
+	assert(parser->table);
+
+	cparser_parse_specifier(parser);
+
+	if (cscanner_is_endl(parser->token)) {
+	}
+	else if (cscanner_is_operator(parser->token)) {
+		switch (cscanner_get_char(parser->token)) {
+		case '[':
+			firstOperand = cparser_parse_memory_reference(parser);
+			if (parser->errcode) return -5;
+			break;
+		case '+':
+		case '-':
+		case '~':
+			firstOperand = cparser_parse_immediate(parser);
+			break;
+		default:
+			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
+			return -1;
+			break;
+		}
+	}
+	else if (cscanner_is_int(parser->token)) {
+		firstOperand = cparser_parse_immediate(parser);
+		if (parser->errcode) return -5;
+	}
+	else if (cscanner_is_ident(parser->token)) {
+		firstOperand = cparser_parse_register(parser);
+		if (parser->errcode) return -5;
+	}
+	else {
+		cparser_error(parser, "Invalid destination operand", 11);
+		return -2;
+	}
+
+	if (cparser_parse_opmask(parser)) {
+		return -6;
+	}
+
+	parser->match &= cparser_match_operand(parser, 0, &firstOperand);
+	csynth_encode_first_operand(&parser->synthesizer, &firstOperand);
+
+	return 0;
+}
+
+static int cparser_parse_second_operand(CParser *parser)
+{
+	COperand secondOperand = CINIT;
+	assert(parser->table);
+
+	if (cscanner_get_char(parser->token) == ',') {
+		cscanner_token_advance(parser->token, 1);
+	}	
+	else if (!cscanner_is_endl(parser->token)) {
+		cparser_error(parser, "Operands must be separated by comma", 12);
+		return -3;
+	}
+	else {
+		parser->match &= cinst_table_operand(parser->table, 1, 
+			&secondOperand, parser->specifier);
+		return 0;
+	}
+
+	cparser_parse_specifier(parser);
+
+	if (cscanner_is_endl(parser->token)) {
+	}
+	else if (cscanner_is_operator(parser->token)) {
+		switch (cscanner_get_char(parser->token)) {
+		case '[':
+			secondOperand = cparser_parse_memory_reference(parser);
+			if (parser->errcode) return -5;
+			break;
+		case '+':
+		case '-':
+		case '~':
+			secondOperand = cparser_parse_immediate(parser);
+			if (parser->errcode) return -5;
+			break;
+		default:
+			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
+			return -1;
+			break;
+		}
+	}
+	else if (cscanner_is_int(parser->token)) {
+		secondOperand = cparser_parse_immediate(parser);
+		if (parser->errcode) return -5;
+	}
+	else if (cscanner_is_ident(parser->token)) {
+		secondOperand = cparser_parse_register(parser);
+		if (parser->errcode) return -5;
+	}
+	else {
+		cparser_error(parser, "Invalid source operand", 13);
+		return -2;
+	}
+
+	parser->match &= cparser_match_operand(parser, 1, &secondOperand);
+	csynth_encode_second_operand(&parser->synthesizer, &secondOperand);
+
+	return 0;
+}
+
+static int cparser_parse_third_operand(CParser *parser)
+{
+	COperand thirdOperand = CINIT;
+
+	assert(parser->table);
+
+	if (cscanner_get_char(parser->token) == ',') {
+		cscanner_token_advance(parser->token, 1);
+	}
+	else if (!cscanner_is_endl(parser->token)) {
+		cparser_error(parser, "Operands must be separated by comma", 14);
+		return -3;
+	}
+	else {
+		parser->match &= cinst_table_operand(parser->table, 2, 
+			&thirdOperand, parser->specifier);
+		return 0;
+	}
+
+	cparser_parse_specifier(parser);
+
+	// "VADDPS ymm1, ymm2, [mem]": VEX forms take any operand here
+	if (cscanner_is_endl(parser->token)) {
+	}
+	else if (cscanner_is_operator(parser->token)) {
+		switch (cscanner_get_char(parser->token)) {
+		case '[':
+			thirdOperand = cparser_parse_memory_reference(parser);
+			if (parser->errcode) return -5;
+			break;
+		case '+':
+		case '-':
+		case '~':
+			thirdOperand = cparser_parse_immediate(parser);
+			if (parser->errcode) return -5;
+			break;
+		default:
+			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
+			return -1;
+			break;
+		}
+	}
+	else if (cscanner_is_int(parser->token)) {
+		thirdOperand = cparser_parse_immediate(parser);
+		if (parser->errcode) return -5;
+	}
+	else if (cscanner_is_ident(parser->token)) {
+		thirdOperand = cparser_parse_register(parser);
+		if (parser->errcode) return -5;
+	}
+	else {
+		cparser_error(parser, "Invalid third operand", 13);
+		return -2;
+	}
+
+	parser->match &= cparser_match_operand(parser, 2, &thirdOperand);
+	csynth_encode_third_operand(&parser->synthesizer, &thirdOperand);
+
+	return 0;
+}
+
+static int cparser_parse_fourth_operand(CParser *parser)
+{
+	COperand fourthOperand = CINIT;
+
+	assert(parser->table);
+
+	if (cscanner_get_char(parser->token) == ',') {
+		cscanner_token_advance(parser->token, 1);
+	}
+	else if (!cscanner_is_endl(parser->token)) {
+		cparser_error(parser, "Operands must be separated by comma", 14);
+		return -3;
+	}
+	else {
+		parser->match &= cinst_table_operand(parser->table, 3, 
+			&fourthOperand, parser->specifier);
+		return 0;
+	}
+
+	// an immediate, or the register of "/is4" forms
+	if (cscanner_is_endl(parser->token)) {
+	}
+	else if (cscanner_is_operator(parser->token)) {
+		switch (cscanner_get_char(parser->token)) {
+		case '+':
+		case '-':
+		case '~':
+			fourthOperand = cparser_parse_immediate(parser);
+			if (parser->errcode) return -5;
+			break;
+		default:
+			cparser_error(parser, "Unexpected punctuator after mnemonic", 1);
+			return -1;
+			break;
+		}
+	}
+	else if (cscanner_is_int(parser->token)) {
+		fourthOperand = cparser_parse_immediate(parser);
+		if (parser->errcode) return -5;
+	}
+	else if (cscanner_is_ident(parser->token)) {
+		fourthOperand = cparser_parse_register(parser);
+		if (parser->errcode) return -5;
+	}
+	else {
+		cparser_error(parser, "Invalid fourth operand", 13);
+		return -2;
+	}
+
+	if (!cscanner_is_endl(parser->token)) {
+		cparser_error(parser, "Too many operands", 15);
+		return -2;
+	}
+
+	parser->match &= cparser_match_operand(parser, 3, &fourthOperand);
+	csynth_encode_fourth_operand(&parser->synthesizer, &fourthOperand);
+
+	return 0;
+}
+
+static COperand cparser_parse_immediate(CParser *parser)
+{
+	COperand imm = CINIT;
+	if (cscanner_is_operator(parser->token)) {
+		int ch = cscanner_get_char(parser->token);
+		if (ch == '+') {
+			cscanner_token_advance(parser->token, 1);
+			imm.value = +cscanner_get_value(parser->token);
+		}
+		else if (ch == '-') {
+			cscanner_token_advance(parser->token, 1);
+			imm.value = -cscanner_get_value(parser->token);
+		}
+		else if (ch == '~') {
+			cscanner_token_advance(parser->token, 1);
+			imm.value = ~cscanner_get_value(parser->token);
+		}
+		else {
+			cparser_error(parser, "error operator", 16);
+			return imm;
+		}
+	}
+	else if (cscanner_is_int(parser->token)) {
+		imm.value = cscanner_get_value(parser->token);
+	}
+	else {
+		cparser_error(parser, "immediate error", 17);
+		return imm;
+	}
+
+	cparser_immediate_type(parser, &imm);
+	cscanner_token_advance(parser->token, 1);
+
+	return imm;
+}
+
+static void cparser_immediate_type(const CParser *parser, COperand *imm)
+{
+	// 32-bit code wraps values as it always did
+	if (parser->bits != 64) {
+		imm->value = (cint32)imm->value;
+	}
+
+	// negative values fit too, the row decides if it is sign extended
+	if (imm->value == 1) {
+		imm->type = O_ONE;		// also matches shift by one forms
+	}
+	else if (imm->value >= -128 && imm->value <= 255) {
+		imm->type = O_IMM8;
+	}
+	else if (imm->value >= -32768 && imm->value <= 65535) {
+		imm->type = O_IMM16;
+	}
+	else {
+		imm->type = O_IMM32;
+	}
+}
+
+// registers of 64-bit mode are ordinary identifiers in 32-bit code
+static COperand cparser_scan_register(const CParser *parser, 
+	const char *name)
+{
+	COperand reg = coperand_scan_reg(name);
+	if (parser->bits != 64 && coperand_is_x64(&reg)) {
+		reg.type = O_UNKNOWN;
+		reg.reg = REG_UNKNOWN;
+	}
+	return reg;
+}
+
+static COperand cparser_parse_register(CParser *parser)
+{
+	COperand reg = CINIT;
+	const char *name;
+
+	name = cscanner_get_string(parser->token);
+	reg = cparser_scan_register(parser, name);
+
+	// It's not a register, so it must be a reference
+	if (reg.type == O_UNKNOWN) {
+		csynth_reference_label(&parser->synthesizer, name);
+		// label is an immediate operand
+		reg.type = O_IMM8;	// also matchs IMM32
+	}
+
+	cscanner_token_advance(parser->token, 1);
+
+	return reg;
+}
+
+static void cparser_register_size(CParser *parser, int index, 
+	COperand *reg)
+{
+	if (parser->bits != 64) return;
+
+	// 64-bit registers match the 32-bit rows, REX.W widens them
+	switch (reg->type) {
+	case O_RAX: reg->type = O_EAX; break;
+	case O_RCX: reg->type = O_ECX; break;
+	case O_REG64: reg->type = O_REG32; break;
+	case O_EAX: 
+	case O_ECX: 
+	case O_REG32: 
+		parser->narrow = 1; 
+		parser->reg32 |= 1u << index;
+		return;
+	default: 
+		return;
+	}
+
+	parser->wide = 1;
+	parser->reg64 |= 1u << index;
+}
+
+// a size specifier narrows memory operand to rows of that size
+static enum COperandType cparser_memory_type(enum CSpecifierType size)
+{
+	switch (size) {
+	case CS_BYTE: return O_MEM8;
+	case CS_WORD: return O_MEM16;
+	case CS_DWORD: return O_MEM32;
+	case CS_QWORD: return O_MEM64;
+	case CS_XMMWORD: return O_MEM128;
+	case CS_YMMWORD: return O_MEM256;
+	case CS_ZMMWORD: return O_MEM512;
+	default: break;
+	}
+	return O_MEM;
+}
+
+// address register of 64-bit code: 1 for a 64-bit one, 2 for a 32-bit 
+// one (0x67 prefix), 0 for anything else
+static int cparser_address_size(const COperand *reg)
+{
+	if (reg->type & O_REG64) return 1;
+	if ((reg->type & O_REG32) == reg->type) return 2;
+	return 0;
+}
+
+static COperand cparser_parse_memory_reference(CParser *parser)
+{
+	COperand mem = CINIT;
+	enum COperandType vsib = O_UNKNOWN;
+	int address = 0;
+
+	for (; ; ) {
+		const CTOKEN *next;
+		const CTOKEN *prev;
+		const CTOKEN *token;
+		int type;
+
+		type = cscanner_token_lookahead(parser->token)->type;
+		if (type == CTokenENDL || type == CTokenENDF) break;
+
+		prev = cscanner_token_current(parser->token);
+		cscanner_token_advance(parser->token, 1);
+		next = cscanner_token_lookahead(parser->token);
+		token = cscanner_token_current(parser->token);
+
+		if (token->type == CTokenIDENT) {
+			COperand reg = cparser_scan_register(parser, token->str);
+			if (parser->bits == 64 && stricmp(token->str, "RIP") == 0) {
+				if (ctoken_get_char(prev) == '*' || 
+					ctoken_get_char(next) == '*') {
+					cparser_error(parser, "RIP can't be scaled", 18);
+					return mem;
+				}
+				if (csynth_encode_rip(&parser->synthesizer) != 0) {
+					cparser_error(parser, parser->synthesizer.error, 27);
+					return mem;
+				}
+				continue;
+			}
+			if (reg.type == O_XMMREG || reg.type == O_YMMREG) {
+				// vector index of gathers, [base + xmm * scale]
+				if (csynth_encode_index(&parser->synthesizer, &reg) != 0) {
+					cparser_error(parser, parser->synthesizer.error, 27);
+					return mem;
+				}
+				vsib = (reg.type == O_XMMREG)? O_VSIBX : O_VSIBY;
+				continue;
+			}
+			if (reg.type != O_UNKNOWN && parser->bits == 64) {
+				int size = cparser_address_size(&reg);
+				if (size == 0) {
+					cparser_error(parser, 
+						"Invalid register in memory reference", 29);
+					return mem;
+				}
+				if ((address | size) == 3) {
+					cparser_error(parser, 
+						"Mixed address sizes in memory reference", 29);
+					return mem;
+				}
+				address |= size;
+			}
+			if (reg.type == O_UNKNOWN) {
+				// not a register, address of a label as displacement
+				if (ctoken_get_char(prev) == '*' || 
+					ctoken_get_char(next) == '*') {
+					cparser_error(parser, "unknow reg reference", 18);
+					return reg;
+				}
+				if (csynth_reference_displacement(&parser->synthesizer,
+					token->str) != 0) {
+					cparser_error(parser, parser->synthesizer.error, 27);
+					return reg;
+				}
+			}
+			else if (ctoken_get_char(prev) == '*' || ctoken_get_char(next) == '*')
+			{
+				csynth_encode_index(&parser->synthesizer, &reg);
+			}
+			else 
+			{
+				csynth_encode_base(&parser->synthesizer, &reg);
+			}
+		}
+		else if (token->type == CTokenOPERATOR) {
+			switch (ctoken_get_char(token)) {
+			case ']':
+				mem.type = cparser_memory_type(parser->size);
+				if (vsib != O_UNKNOWN) {
+					mem.type = vsib;
+				}
+				else if (parser->bits == 64 && parser->size == CS_DWORD) {
+					parser->narrow = 1;
+				}
+				if (address == 2 && 
+					csynth_encode_prefix(&parser->synthesizer, 0x67)) {
+					cparser_error(parser, parser->synthesizer.error, 27);
+					return mem;
+				}
+				cscanner_token_advance(parser->token, 1);
+				// an element broadcast to the whole zmm register, a 
+				// write mask "{k1}" may follow a memory destination too
+				next = cscanner_token_lookahead(parser->token);
+				if (cscanner_get_char(parser->token) == '{' &&
+					next->type == CTokenIDENT && isdigit(next->str[0])) {
+					if (cparser_parse_broadcast(parser)) return mem;
+					mem.type = O_MEM512;
+				}
+				return mem;
+				break;
+			case '+':
+				if ((prev->type != CTokenINT && prev->type != CTokenIDENT) ||
+					(next->type != CTokenINT && next->type != CTokenIDENT)) {
+					cparser_error(parser, 
+						"Syntax error '+' in memory reference", 19);
+					return mem;
+				}
+				break;
+			case '-':
+				if ((prev->type != CTokenINT && prev->type != CTokenIDENT &&
+					ctoken_get_char(prev) != '[') ||
+					next->type != CTokenINT) {
+					cparser_error(parser, 
+						"Syntax error '-' in memory reference", 20);
+					return mem;
+				}
+				break;
+			case '*':
+				if ((prev->type != CTokenINT || next->type != CTokenIDENT) &&
+					(next->type != CTokenINT || prev->type != CTokenIDENT)) {
+					cparser_error(parser,
+						"Syntax error '*' in memory reference", 21);
+					return mem;
+				}
+				break;
+			default:
+				cparser_error(parser, 
+					"Unexpected punctuator in memory reference", 22);
+				return mem;
+				break;
+			}
+		}
+		else if (token->type == CTokenINT) {
+			int prevch = ctoken_get_char(prev);
+			int nextch = ctoken_get_char(next);
+			int value = ctoken_get_int(token);
+			if (prevch == '*' || nextch == '*') {
+				if (value == 1 || value == 2 || value == 4 || value == 8) {
+					csynth_encode_scale(&parser->synthesizer, value);
+				}	else {
+					cparser_error(parser, 
+						"Invalid scale in memory reference", 23);
+					return mem;
+				}
+			}
+			else if (prevch == '-') {
+				csynth_encode_displacement(&parser->synthesizer, -value);
+			}
+			else if (prevch == '+' || nextch == '+') {
+				csynth_encode_displacement(&parser->synthesizer, value);
+			}
+			else if (prevch == '[' && nextch == ']') {
+				cparser_error(parser,
+					"Invalid number in memory reference", 30);
+				return mem;
+			}
+			else {
+				cparser_error(parser, 
+					"Invalid number in memory reference", 24);
+				return mem;
+			}
+		}
+		else {
+			cparser_error(parser, 
+				"Unexpected token in memory reference", 25);
+			return mem;
+		}
+	}
+
+	cparser_error(parser, "Unexpected end of line in memory reference", 26);
+
+	return mem;
+}
+
+// "{k1}" or "{k1}{z}" after the destination of AVX-512 instructions
+static int cparser_parse_opmask(CParser *parser)
+{
+	COperand mask = CNOT_FOUND;
+	int zeroing = 0;
+
+	if (cscanner_get_char(parser->token) != '{') {
+		return 0;
+	}
+
+	cscanner_token_advance(parser->token, 1);
+	if (cscanner_is_ident(parser->token)) {
+		mask = cparser_scan_register(parser, 
+			cscanner_get_string(parser->token));
+		cscanner_token_advance(parser->token, 1);
+	}
+
+	if (cscanner_get_char(parser->token) != '}') {
+		cparser_error(parser, "Syntax error in write mask", 32);
+		return -1;
+	}
+	cscanner_token_advance(parser->token, 1);
+
+	if (cscanner_get_char(parser->token) == '{') {
+		cscanner_token_advance(parser->token, 1);
+		if (!cscanner_is_ident(parser->token) ||
+			stricmp(cscanner_get_string(parser->token), "z") != 0) {
+			cparser_error(parser, "Syntax error in write mask", 32);
+			return -2;
+		}
+		cscanner_token_advance(parser->token, 1);
+		if (cscanner_get_char(parser->token) != '}') {
+			cparser_error(parser, "Syntax error in write mask", 32);
+			return -3;
+		}
+		cscanner_token_advance(parser->token, 1);
+		zeroing = 1;
+	}
+
+	if (csynth_encode_opmask(&parser->synthesizer, &mask, zeroing) != 0) {
+		cparser_error(parser, parser->synthesizer.error, 33);
+		return -4;
+	}
+
+	return 0;
+}
+
+// "{1to16}" after a memory reference
+static int cparser_parse_broadcast(CParser *parser)
+{
+	const char *name;
+	int count = 0;
+
+	cscanner_token_advance(parser->token, 1);
+	name = cscanner_get_string(parser->token);
+
+	if (name[0] == '1' && (name[1] == 't' || name[1] == 'T')) {
+		count = atoi(name + 3);
+		cscanner_token_advance(parser->token, 1);
+	}
+
+	if (count == 0 || cscanner_get_char(parser->token) != '}') {
+		cparser_error(parser, "Syntax error in broadcast", 34);
+		return -1;
+	}
+	cscanner_token_advance(parser->token, 1);
+
+	if (csynth_encode_broadcast(&parser->synthesizer, count) != 0) {
+		cparser_error(parser, parser->synthesizer.error, 34);
+		return -2;
+	}
+
+	return 0;
+}
+
+
+//---------------------------------------------------------------------
+// instructions built without source text
+//---------------------------------------------------------------------
+
+// a register of the caller, checked as a scanned one would be
+static int cparser_check_register(CParser *parser, const COperand *reg)
+{
+	if (reg->type == O_UNKNOWN || !coperand_is_reg(reg)) {
+		cparser_error(parser, "Invalid register operand", 35);
+		return -1;
+	}
+	if (parser->bits != 64 && coperand_is_x64(reg)) {
+		cparser_error(parser, "Register needs 64-bit mode", 36);
+		return -2;
+	}
+	return 0;
+}
+
+// base or index register, address tells which sizes are in use
+static int cparser_check_address(CParser *parser, const COperand *reg,
+	int *address)
+{
+	int size;
+
+	if (cparser_check_register(parser, reg) != 0) {
+		return -1;
+	}
+
+	if (parser->bits == 64) {
+		size = cparser_address_size(reg);
+		if (size == 0) {
+			cparser_error(parser, 
+				"Invalid register in memory reference", 29);
+			return -2;
+		}
+		if ((*address | size) == 3) {
+			cparser_error(parser, 
+				"Mixed address sizes in memory reference", 29);
+			return -3;
+		}
+		*address |= size;
+	}
+
+	return 0;
+}
+
+// [label + base + index * scale + displacement]
+static COperand cparser_build_memory(CParser *parser, 
+	const CParserOperand *arg)
+{
+	CSynthesizer *synth = &parser->synthesizer;
+	const COperand *index = &arg->index;
+	COperand mem = CINIT;
+	int address = 0;
+
+	mem.type = cparser_memory_type(arg->size);
+
+	if (arg->base.type != O_UNKNOWN) {
+		if (cparser_check_address(parser, &arg->base, &address)) {
+			return mem;
+		}
+		csynth_encode_base(synth, &arg->base);
+	}
+
+	if (index->type != O_UNKNOWN) {
+		// vector index of gathers, [base + xmm * scale]
+		if (index->type == O_XMMREG || index->type == O_YMMREG) {
+			if (cparser_check_register(parser, index)) return mem;
+			mem.type = (index->type == O_XMMREG)? O_VSIBX : O_VSIBY;
+		}
+		else if (cparser_check_address(parser, index, &address)) {
+			return mem;
+		}
+		if (csynth_encode_index(synth, index) != 0 || 
+			csynth_encode_scale(synth, arg->scale? arg->scale : 1)) {
+			cparser_error(parser, synth->error, 27);
+			return mem;
+		}
+	}
+	else if (arg->scale > 1) {
+		cparser_error(parser, "Invalid scale in memory reference", 23);
+		return mem;
+	}
+
+	if (arg->label && 
+		csynth_reference_displacement(synth, arg->label) != 0) {
+		cparser_error(parser, synth->error, 27);
+		return mem;
+	}
+
+	csynth_encode_displacement(synth, arg->displacement);
+
+	if (parser->bits == 64 && arg->size == CS_DWORD) {
+		parser->narrow = 1;
+	}
+
+	if (address == 2 && csynth_encode_prefix(synth, 0x67)) {
+		cparser_error(parser, synth->error, 27);
+		return mem;
+	}
+
+	return mem;
+}
+
+static int cparser_build_operand(CParser *parser, int index, 
+	const CParserOperand *arg)
+{
+	CSynthesizer *synth = &parser->synthesizer;
+	COperand operand = CINIT;
+
+	if (arg != NULL) {
+		cparser_set_specifier(parser, arg->size);
+		if (arg->operand.type == O_MEM) {
+			operand = cparser_build_memory(parser, arg);
+		}
+		else if (arg->operand.type == O_UNKNOWN ||
+			!coperand_is_imm(&arg->operand)) {
+			if (cparser_check_register(parser, &arg->operand) == 0) {
+				operand = arg->operand;
+			}
+		}
+		else if (arg->label) {
+			if (csynth_reference_label(synth, arg->label) != 0) {
+				cparser_error(parser, synth->error, 27);
+			}
+			operand.type = O_IMM8;	// also matchs IMM32
+		}
+		else {
+			operand = arg->operand;
+			cparser_immediate_type(parser, &operand);
+		}
+		if (parser->errcode) return -1;
+	}
+	else if (index > 0) {
+		// missing operands after the first one are only matched
+		parser->match &= cinst_table_operand(parser->table, index, 
+			&operand, parser->specifier);
+		return 0;
+	}
+
+	parser->match &= cparser_match_operand(parser, index, &operand);
+
+	switch (index) {
+	case 0: csynth_encode_first_operand(synth, &operand); break;
+	case 1: csynth_encode_second_operand(synth, &operand); break;
+	case 2: csynth_encode_third_operand(synth, &operand); break;
+	default: csynth_encode_fourth_operand(synth, &operand); break;
+	}
+
+	return 0;
+}
+
+const CEncoding *cparser_encode(CParser *parser, const char *label, 
+	const char *mnemonic, const CParserOperand *operands, int count)
+{
+	int i;
+
+	cparser_begin(parser);
+
+	if (count < 0 || count > 4) {
+		cparser_error(parser, "Too many operands", 15);
+		return NULL;
+	}
+
+	if (label && csynth_define_label(&parser->synthesizer, label)) {
+		cparser_error(parser, "label error", 3);
+		return NULL;
+	}
+
+	if (mnemonic != NULL) {
+		parser->table = cinstset_query(parser->instructionset, mnemonic);
+		if (parser->table == NULL) {
+			char *text = (char*)parser->data;
+			sprintf(text, "Mnemonic '%.60s' not recognised", mnemonic);
+			cparser_error(parser, text, 10);
+			return NULL;
+		}
+		parser->match = parser->table->all;
+		parser->specifier = parser->table->all;
+		for (i = 0; i < 4; i++) {
+			if (cparser_build_operand(parser, i, 
+				(i < count)? &operands[i] : NULL) != 0) {
+				return NULL;
+			}
+		}
+	}
+
+	return cparser_encode_instruction(parser);
+}
+
+
+static int cparser_parse_data(CParser *parser)
+{
+	const char *name;
+	long pos = 0;
+	int size = -1;
+
+	if (cscanner_is_ident(parser->token) == 0) {
+		return 0;
+	}
+
+	name = cscanner_get_string(parser->token);
+
+	if (stricmp(name, "DB") == 0) size = 1;
+	else if (stricmp(name, "DW") == 0) size = 2;
+	else if (stricmp(name, "DD") == 0) size = 4;
+	else if (stricmp(name, "DQ") == 0) size = 8;
+
+	if (size < 0) return 0;
+
+	cscanner_token_advance(parser->token, 1);
+
+	for (pos = 0; ; ) {
+		unsigned char *ptr = (unsigned char*)parser->data;
+		const CTOKEN *token;
+
+		if (cscanner_is_endl(parser->token)) break;
+
+		token = cscanner_token_current(parser->token);
+
+		if (token->type == CTokenINT) {
+			cuint64 value = (cuint64)token->intval;
+			int i;
+			if (pos + size >= IMAX_DATA) {
+				cparser_error(parser, "data too long", 41);
+				return -1;
+			}
+			for (i = 0; i < size; i++) {
+				ptr[pos++] = (unsigned char)((value >> (i * 8)) & 0xff);
+			}
+		}
+		else if (token->type == CTokenSTR) {
+			const char *text = token->str;
+			long size, i, c;
+			char hex[3];
+			size = (long)strlen(text);
+			for (i = 0; i < size; ) {
+				if (i + 1 >= IMAX_DATA) {
+					cparser_error(parser, "data too long", 41);
+					return -2;
+				}
+				if (text[i] == '\\') {
+					switch (text[i + 1])
+					{
+					case '\\': ptr[pos++] = '\\'; i += 2; break;
+					case 'n' : ptr[pos++] = '\n'; i += 2; break;
+					case 'r' : ptr[pos++] = '\r'; i += 2; break;
+					case 't' : ptr[pos++] = '\t'; i += 2; break;
+					case '0' : ptr[pos++] = '\0'; i += 2; break;
+					case '?' : ptr[pos++] = '?'; i += 2; break;
+					case '\'': ptr[pos++] = '\''; i += 2; break;
+					case '\"': ptr[pos++] = '\"'; i += 2; break;
+					case 'a' : ptr[pos++] = '\a'; i += 2; break;
+					case 'b' : ptr[pos++] = '\b'; i += 2; break;
+					case 'f' : ptr[pos++] = '\f'; i += 2; break;
+					case 'v' : ptr[pos++] = '\v'; i += 2; break;
+					case 'x' :
+						i += 2;
+						hex[0] = text[i++];
+						hex[1] = text[i++];
+						hex[2] = 0;
+						c = strtol(hex, NULL, 16);
+						ptr[pos++] = (unsigned char)(c & 255);
+						break;
+					default:
+						cparser_error(parser, "string format error", 42);
+						return -3;
+						break;
+					}
+				}
+				else if (text[i] == '\'') {
+					if (text[i + 1] == '\'') {
+						ptr[pos++] = '\'';
+						i += 2;
+					}	else {
+						ptr[pos++] = '\'';
+						i += 1;
+					}
+				}
+				else if (text[i] == '\"') {
+					if (text[i + 1] == '\"') {
+						ptr[pos++] = '\"';
+						i += 2;
+					}	else {
+						ptr[pos++] = '\"';
+						i += 1;
+					}
+				}
+				else {
+					ptr[pos++] = (unsigned char)text[i++];
+				}
+			}
+		}
+		else {
+			cparser_error(parser, "unrecongnize data", 43);
+			return -4;
+		}
+
+		cscanner_token_advance(parser->token, 1);
+
+		if (!cscanner_is_endl(parser->token)) {
+			if (cscanner_get_char(parser->token) != ',') {
+				cparser_error(parser, "expected comma", 40);
+				return -3;
+			}
+			cscanner_token_advance(parser->token, 1);
+		}
+	}
+
+	if (pos > 0) {
+		cencoding_set_data(&parser->synthesizer.encoding, parser->data, pos);
+	}
+
+	return 0;
+}
+
+
+static int cparser_parse_prefix(CParser *parser)
+{
+	const char *name;
+
+	if (cscanner_is_ident(parser->token) == 0) {
+		return 0;
+	}
+
+	name = cscanner_get_string(parser->token);
+
+	if (stricmp(name, "REP") == 0 ||
+		stricmp(name, "REPE") == 0 ||
+		stricmp(name, "REPZ") == 0) {
+		if (csynth_encode_prefix(&parser->synthesizer, 0xf3)) {
+			cparser_error(parser, parser->synthesizer.error, 70);
+			return -1;
+		}
+		cscanner_token_advance(parser->token, 1);
+	}
+	else if (stricmp(name, "REPNE") == 0 || stricmp(name, "REPNZ") == 0) {
+		parser->synthesizer.prefix = 0xf2;
+		if (csynth_encode_prefix(&parser->synthesizer, 0xf2)) {
+			cparser_error(parser, parser->synthesizer.error, 71);
+			return -2;
+		}
+		cscanner_token_advance(parser->token, 1);
+	}
+	else if (stricmp(name, "LOCK") == 0) {
+		if (csynth_encode_prefix(&parser->synthesizer, 0xf0)) {
+			cparser_error(parser, parser->synthesizer.error, 72);
+			return -3;
+		}
+		cscanner_token_advance(parser->token, 1);
+	}
+
+	return 0;
+}
+
+static int cparser_parse_align(CParser *parser)
+{
+	const char *name;
+
+	if (cscanner_is_ident(parser->token) == 0) {
+		return 0;
+	}
+
+	name = cscanner_get_string(parser->token);
+	
+	if (stricmp(name, "ALIGN") == 0) {
+		int align = 4;
+		cscanner_token_advance(parser->token, 1);
+		if (cscanner_is_int(parser->token)) {
+			align = (int)cscanner_get_value(parser->token);
+		}
+		while (!cscanner_is_endf(parser->token)) {
+			cscanner_token_advance(parser->token, 1);
+		}
+		if (align < 1) {
+			cparser_error(parser, "error align size", 80);
+			return -1;
+		}
+		parser->synthesizer.encoding.align = align;
+	}
+
+	return 0;
+}
+
+static int cparser_parse_size(CParser *parser)
+{
+	const CTOKEN *token = cscanner_token_current(parser->token);
+	cscanner_token_advance(parser->token, 1);
+	if (token->type == CTokenIDENT) {
+		if (stricmp(token->str, "BYTE") == 0) return 1;
+		if (stricmp(token->str, "CHAR") == 0) return 1;
+		if (stricmp(token->str, "INT8") == 0) return 1;
+		if (stricmp(token->str, "UINT8") == 0) return 1;
+		if (stricmp(token->str, "WORD") == 0) return 2;
+		if (stricmp(token->str, "SHORT") == 0) return 2;
+		if (stricmp(token->str, "USHORT") == 0) return 2;
+		if (stricmp(token->str, "INT16") == 0) return 2;
+		if (stricmp(token->str, "UINT16") == 0) return 2;
+		if (stricmp(token->str, "DWORD") == 0) return 4;
+		if (stricmp(token->str, "INT") == 0) return 4;
+		if (stricmp(token->str, "UINT") == 0) return 4;
+		if (stricmp(token->str, "LONG") == 0) return 4;
+		if (stricmp(token->str, "ULONG") == 0) return 4;
+		if (stricmp(token->str, "INT32") == 0) return 4;
+		if (stricmp(token->str, "UINT32") == 0) return 4;
+		if (stricmp(token->str, "QWORD") == 0) return 8;
+		if (stricmp(token->str, "INT64") == 0) return 8;
+		if (stricmp(token->str, "UINT64") == 0) return 8;
+	}
+	return 0;
+}
+
+static int cparser_parse_newvar(CParser *parser, const char *name, int stack)
+{
+	char *macro = (char*)parser->data;
+	CVariable *var;
+
+	if (stricmp(name, "RET") == 0) {
+		sprintf(macro, "'%s' conflicted with keyword", name);
+		cparser_error(parser, macro, 96);
+		return -1;
+	}
+
+	for (var = parser->vars; var; var = var->next) {
+		if (strcmp(var->name, name) == 0) {
+			sprintf(macro, "'%s' redefined", name);
+			cparser_error(parser, macro, 97);
+			return -2;
+		}
+	}
+
+	if (parser->bits == 64) {
+		if (stack >= 0) sprintf(macro, "[RBP + %d]", stack);
+		else sprintf(macro, "[RBP - %d]", -stack);
+	}
+	else {
+		if (stack >= 0) sprintf(macro, "[EBP + %d]", stack);
+		else sprintf(macro, "[EBP - %d]", -stack);
+	}
+
+	if (cscanner_macro_set(parser->token, name, macro)) {
+		sprintf(macro, "name '%s' redefined", name);
+		cparser_error(parser, macro, 95);
+		return -3;
+	}
+
+	var = (CVariable*)malloc(sizeof(CVariable));
+	assert(var);
+	var->name = strdup(name);
+	assert(var->name);
+	var->pos = stack;
+
+	var->next = parser->vars;
+	parser->vars = var;
+
+	return 0;
+}
+
+static int cparser_parse_proc(CParser *parser)
+{
+	unsigned char instruction[20];
+	const char *name;
+
+	if (cscanner_is_ident(parser->token) == 0) {
+		return 0;
+	}
+
+	name = cscanner_get_string(parser->token);
+
+	if (stricmp(name, "PROC") == 0) {
+		const char *replace = "DB 0x8B, 0xE5, 0x5D, 0xC3\n";
+		int stack = 8;
+		int IS = 0;
+
+		// 64-bit code keeps 8-byte parameter slots above rbp
+		if (parser->bits == 64) {
+			replace = "DB 0x48, 0x8B, 0xE5, 0x5D, 0xC3\n";
+			stack = 16;
+		}
+
+		if (parser->inproc) {
+			cparser_error(parser, "cannot define proc in a proc block", 90);
+			return -1;
+		}
+		parser->inproc = 1;
+		parser->stack = 0;
+
+		// replace ret to "mov esp, ebp; pop ebp; ret"
+		cscanner_macro_set_nocase(parser->token, "ret", replace);
+
+		cscanner_token_advance(parser->token, 1);
+
+		for (; !cscanner_is_endl(parser->token); ) {
+			const CTOKEN *token = cscanner_token_current(parser->token);
+			const CTOKEN *next = cscanner_token_lookahead(parser->token);
+			char *macro = (char*)parser->data;
+			if (ctoken_get_char(token) == ',') {
+				cscanner_token_advance(parser->token, 1);
+			}
+			else if (token->type == CTokenIDENT && next->ch == ':') {
+				int size;
+				cscanner_token_advance(parser->token, 2);
+				size = cparser_parse_size(parser);
+				if (size == 0) {
+					cparser_error(parser, "variable type unknown", 93);
+					return -1;
+				}
+				if (cparser_parse_newvar(parser, token->str, stack)) {
+					return -4;
+				}
+				if (parser->bits == 64) size = (size + 7) & ~7;
+				stack += size;
+			}
+			else {
+				if (token->type == CTokenIDENT) {
+					sprintf(macro, "parameter '%s' error", token->str);
+				}	else {
+					sprintf(macro, "parameter error");
+				}
+				cparser_error(parser, macro, 93);
+				return -3;
+			}
+		}
+
+		instruction[IS++] = 0x55;		// push ebp
+		if (parser->bits == 64) {
+			instruction[IS++] = 0x48;	// REX.W, mov rbp, rsp
+		}
+		instruction[IS++] = 0x8B;		// mov ebp, esp
+		instruction[IS++] = 0xEC;
+
+		cencoding_set_data(&parser->synthesizer.encoding, instruction, IS);
+	}
+	else if (stricmp(name, "LOCAL") == 0) {
+		int localsize = 0;
+		int IS;
+
+		cscanner_token_advance(parser->token, 1);
+
+		if (parser->inproc == 0) {
+			cparser_error(parser, "local is forbbiden outside a proc", 90);
+			return -5;
+		}
+
+		for (; !cscanner_is_endl(parser->token); ) {
+			const CTOKEN *token = cscanner_token_current(parser->token);
+			const CTOKEN *next = cscanner_token_lookahead(parser->token);
+			char *macro = (char*)parser->data;
+			if (ctoken_get_char(token) == ',') {
+				cscanner_token_advance(parser->token, 1);
+			}
+			else if (token->type == CTokenIDENT && next->ch == ':') {
+				int pos, size;
+				cscanner_token_advance(parser->token, 2);
+				size = cparser_parse_size(parser);
+				if (size == 0) {
+					cparser_error(parser, "variable type unknown", 93);
+					return -1;
+				}
+				pos = -(parser->stack + size);
+				if (cparser_parse_newvar(parser, token->str, pos)) {
+					return -6;
+				}
+				parser->stack += size;
+				localsize += size;
+				//printf("LOCAL %s=[EBP+(%d)]\n", token->str, pos);
+			}
+			else {
+				if (token->type == CTokenIDENT) {
+					sprintf(macro, "parameter '%s' error", token->str);
+				}	else {
+					sprintf(macro, "parameter error");
+				}
+				cparser_error(parser, macro, 92);
+				return -3;
+			}
+		}
+
+		IS = 0;
+		if (parser->bits == 64) {
+			instruction[IS++] = 0x48;	// REX.W, sub rsp
+		}
+
+		if (localsize <= 127) {
+			instruction[IS++] = 0x83;		// sub esp, imm8
+			instruction[IS++] = 0xEC;
+			instruction[IS++] = (unsigned char)(localsize & 0xff);
+		}	else {
+			instruction[IS++] = 0x81;		// sub esp, imm32
+			instruction[IS++] = 0xEC;
+			instruction[IS++] = (unsigned char)((localsize >>  0) & 0xff);
+			instruction[IS++] = (unsigned char)((localsize >>  8) & 0xff);
+			instruction[IS++] = (unsigned char)((localsize >> 16) & 0xff);
+			instruction[IS++] = (unsigned char)((localsize >> 24) & 0xff);
+		}
+
+		cencoding_set_data(&parser->synthesizer.encoding, instruction, IS);
+	}
+	else if (stricmp(name, "ENDP") == 0) {
+		if (parser->inproc == 0) {
+			cparser_error(parser, "not find proc definition", 91);
+			return -2;
+		}
+		parser->inproc = 0;
+		parser->stack = 0;
+		while (parser->vars) {
+			CVariable *var = parser->vars;
+			parser->vars = parser->vars->next;
+			cscanner_macro_del(parser->token, var->name);
+			free(var->name);
+			free(var);
+		}
+		cscanner_macro_del(parser->token, "ret");
+	}
+	else {
+		return 0;
+	}
+
+	while (!cscanner_is_endf(parser->token)) {
+		cscanner_token_advance(parser->token, 1);
+	}
+	
+	return 0;
+}
+
@@ -1,72 +1,120 @@
-//=====================================================================
-//
-// cparser.h - source parser
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CPARSER_H__
-#define __CPARSER_H__
-
-#include "csynthesis.h"
-#include "cinstset.h"
-#include "cscanner.h"
-
-
-//---------------------------------------------------------------------
-// CVariable
-//---------------------------------------------------------------------
-struct CVariable
-{
-	char *name;
-	int pos;
-	struct CVariable *next;
-};
-
-typedef struct CVariable CVariable;
-
-
-//---------------------------------------------------------------------
-// CParser
-//---------------------------------------------------------------------
-struct CParser
-{
-	char *data;
-	char *error;
-	int errcode;
-	int inproc;
-	int stack;
-	CScanner *token;
-	CVariable *vars;
-	CInstruction *instruction;
-	CInstructionSet *instructionset;
-	CSynthesizer synthesizer;
-};
-
-typedef struct CParser CParser;
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-//---------------------------------------------------------------------
-// interfaces
-//---------------------------------------------------------------------
-CParser *cparser_create(void);
-void cparser_release(CParser *parser);
-
-void cparser_reset(CParser *parser);
-
-const CEncoding *cparser_parse_line(CParser *parser, const char *source);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-
-#endif
-
-
-
+//=====================================================================
+//
+// cparser.h - source parser
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CPARSER_H__
+#define __CPARSER_H__
+
+#include "csynthesis.h"
+#include "cinstset.h"
+#include "cscanner.h"
+
+
+//---------------------------------------------------------------------
+// CVariable
+//---------------------------------------------------------------------
+struct CVariable
+{
+	char *name;
+	int pos;
+	struct CVariable *next;
+};
+
+typedef struct CVariable CVariable;
+
+
+//---------------------------------------------------------------------
+// CParserOperand - operand of an instruction built without source
+//---------------------------------------------------------------------
+struct CParserOperand
+{
+	COperand operand;			// register, immediate (O_IMM) or O_MEM
+	enum CSpecifierType size;	// memory size, CS_UNKNOWN if implicit
+	COperand base;				// memory base, O_UNKNOWN for none
+	COperand index;				// memory index, O_UNKNOWN for none
+	int scale;
+	long displacement;
+	const char *label;			// label as immediate or displacement
+};
+
+typedef struct CParserOperand CParserOperand;
+
+
+//---------------------------------------------------------------------
+// CParser
+//---------------------------------------------------------------------
+struct CParser
+{
+	char *data;
+	char *error;
+	int errcode;
+	int inproc;
+	int stack;
+	CScanner *token;
+	CVariable *vars;
+	const CInstruction *instruction;
+	const CInstructionSet *instructionset;
+	const CInstTable *table;	// rows of current mnemonic
+	unsigned int match;			// rows still matching current line
+	unsigned int specifier;		// rows accepting last size specifier
+	enum CSpecifierType size;	// last size specifier written
+	int bits;					// code size: 32 or 64
+	int wide;					// 64-bit register operand on the line
+	int narrow;					// 32-bit register or DWORD memory operand
+	int qword;					// QWORD memory matched by 32-bit rows
+	unsigned int reg32;			// operand positions of 32-bit registers
+	unsigned int reg64;			// operand positions of 64-bit registers
+	CSynthesizer synthesizer;
+};
+
+typedef struct CParser CParser;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// interfaces
+//---------------------------------------------------------------------
+CParser *cparser_create(void);
+void cparser_release(CParser *parser);
+
+void cparser_reset(CParser *parser);
+
+// select 32-bit or 64-bit code, returns -1 for other sizes
+int cparser_set_mode(CParser *parser, int bits);
+
+const CEncoding *cparser_parse_line(CParser *parser, const char *source);
+
+// parse a line of length bytes in place, no '\0' needed
+const CEncoding *cparser_parse_span(CParser *parser, const char *source,
+	long length);
+
+// tokenize a block of lines in one pass, returns number of lines. they
+// are parsed in order by cparser_parse_tokens until the next call
+int cparser_tokenize(CParser *parser, const char *source, long length);
+
+// parse a line of the last cparser_tokenize, from 0
+const CEncoding *cparser_parse_tokens(CParser *parser, int line);
+
+// encode an instruction from operands built by the caller, it is matched
+// and encoded like a parsed line without scanning any text. label (can
+// be NULL) is defined at the instruction, a NULL mnemonic only defines
+// the label. at most 4 operands.
+const CEncoding *cparser_encode(CParser *parser, const char *label, 
+	const char *mnemonic, const CParserOperand *operands, int count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
+
+
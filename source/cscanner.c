@@ -1,763 +1,1244 @@
-//=====================================================================
-//
-// cscanner.c - source scanner
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#include "cscanner.h"
-
-#ifdef _MSC_VER
-#pragma warning(disable: 4996)
-#endif
-
-//---------------------------------------------------------------------
-// compatible
-//---------------------------------------------------------------------
-int cstricmp(const char *dst, const char *src) {
-	int ch1, ch2;
-	do {
-		if ( ((ch1 = (unsigned char)(*(dst++))) >= 'A') && (ch1 <= 'Z') )
-			ch1 += 0x20;
-		if ( ((ch2 = (unsigned char)(*(src++))) >= 'A') && (ch2 <= 'Z') )
-			ch2 += 0x20;
-	}	while ( ch1 && (ch1 == ch2) );
-	return(ch1 - ch2);
-}
-
-
-//---------------------------------------------------------------------
-// Token Reader
-//---------------------------------------------------------------------
-CTokenReader *ctoken_reader_create(int (*readch)(void*), void *fp)
-{
-	CTokenReader *reader;
-	reader = (CTokenReader*)malloc(sizeof(CTokenReader));
-	assert(reader);
-	reader->readch = readch;
-	reader->fp = fp;
-	reader->ch = ' ';
-	reader->unch = -1;
-	reader->saved = -1;
-	reader->lineno = 1;
-	reader->colno = 0;
-	reader->state = 0;
-	reader->buffer = (char*)malloc(CMAX_IDENT * 2);
-	assert(reader->buffer);
-	reader->error = (char*)malloc(8192);
-	assert(reader->error);
-	reader->pos = 0;
-	reader->keywords = NULL;
-	reader->eof = 0;
-	reader->error[0] = 0;
-	reader->errcode = 0;
-	return reader;
-}
-
-void ctoken_reader_release(CTokenReader *reader)
-{
-	assert(reader);
-	if (reader->buffer) {
-		free(reader->buffer);
-		reader->buffer = NULL;
-	}
-	if (reader->error) {
-		free(reader->error);
-		reader->error = NULL;
-	}
-	free(reader);
-}
-
-int ctoken_reader_getch(CTokenReader *reader)
-{
-	assert(reader);
-	if (reader->unch >= 0) {
-		reader->ch = reader->unch;
-		reader->unch = -1;
-	}	else {
-		reader->saved = reader->ch;
-		reader->ch = reader->readch(reader->fp);
-		if (reader->ch == '\n') reader->lineno++, reader->colno = 1;
-		else if (reader->ch >= 0) reader->colno++;
-	}
-	return reader->ch;
-}
-
-static int ctoken_reader_ungetch(CTokenReader *reader, int ch)
-{
-	assert(reader->unch < 0);
-	reader->unch = ch;
-	return 0;
-}
-
-static int ctoken_reader_skip_space(CTokenReader *reader)
-{
-	while (1) {
-		int skip = 0;
-		for (; isspace(reader->ch) && reader->ch != '\n'; skip++)
-			ctoken_reader_getch(reader);
-		if (reader->ch == ';' || reader->ch == '#') {
-			skip++;
-			while (reader->ch != '\n' && reader->ch >= 0) {
-				ctoken_reader_getch(reader);
-				skip++;
-			}
-		}	
-		else if (reader->ch == '/') {
-			ctoken_reader_getch(reader);
-			if (reader->ch == '/') {
-				skip++;
-				while (reader->ch != '\n' && reader->ch >= 0) {
-					ctoken_reader_getch(reader);
-					skip++;
-				}
-			}	else {
-				ctoken_reader_ungetch(reader, reader->ch);
-				reader->ch = '/';
-			}
-		}
-		if (skip == 0) break;
-	}
-	return 0;
-}
-
-static CTOKEN *ctoken_reader_read_string(CTokenReader *reader, int *state)
-{
-	CTOKEN *token = NULL;
-
-	if (reader->ch == '\'' || reader->ch == '\"') {
-		int mode = (reader->ch == '\"')? 0 : 1;
-		reader->pos = 0;
-		while (1) {
-			int ch = ctoken_reader_getch(reader);
-			if (ch == '\\') {
-				ctoken_reader_getch(reader);
-				reader->buffer[reader->pos++] = '\\';
-				reader->buffer[reader->pos++] = (char)reader->ch;
-			}	
-			else if (mode == 0 && ch == '\'') {
-				reader->buffer[reader->pos++] = '\'';
-			}
-			else if (mode == 1 && ch == '\"') {
-				reader->buffer[reader->pos++] = '\"';
-			}
-			else if (mode == 0 && ch == '\"') {
-				ch = ctoken_reader_getch(reader);
-				if (ch == '\"') {
-					reader->buffer[reader->pos++] = '\"';
-					reader->buffer[reader->pos++] = '\"';
-				}	else {
-					*state = 1;
-					reader->buffer[reader->pos] = 0;
-					token = ctoken_new_string(reader->buffer);
-					break;
-				}
-			}
-			else if (mode == 1 && ch == '\'') {
-				ch = ctoken_reader_getch(reader);
-				if (ch == '\'') {
-					reader->buffer[reader->pos++] = '\'';
-					reader->buffer[reader->pos++] = '\'';
-				}	else {
-					*state = 1;
-					reader->buffer[reader->pos] = 0;
-					token = ctoken_new_string(reader->buffer);
-					break;
-				}
-			}
-			else if (ch == '\n') {
-				*state = -1;
-				break;
-			}
-			else if (ch >= 0) {
-				reader->buffer[reader->pos++] = (char)ch;
-			}
-			else {			// ch < 0
-				*state = -2;
-				break;
-			}
-
-			if (reader->pos >= CMAX_IDENT) {
-				*state = -3;
-				strncpy(reader->error, "string too long", 64);
-				break;
-			}
-		}
-	}
-
-	return token;
-}
-
-static CTOKEN *ctoken_reader_read_number(CTokenReader *reader, int *state)
-{
-	int lineno = reader->lineno;
-	char *text = reader->buffer;
-	CTOKEN *token;
-	int ec1, ec2, pos;
-	long value;
-
-	if (reader->ch < '0' || reader->ch > '9') {
-		*state = 0;
-		return NULL;
-	}
-
-	for (reader->pos = 0; isalnum(reader->ch) || reader->ch == '.'; ) {
-		reader->buffer[reader->pos++] = (char)reader->ch;
-		ctoken_reader_getch(reader);
-		if (reader->pos >= CMAX_IDENT) {
-			strncpy(reader->error, "number too long", 64);
-			*state = -1;
-			reader->errcode = 1;
-			return NULL;
-		}
-	}
-
-	reader->buffer[reader->pos] = 0;
-	for (pos = reader->pos; pos > 0; pos--) {
-		if (isdigit(text[pos - 1]) || text[pos - 1] == '.') {
-			break;
-		}
-		else if (text[pos - 1] >= 'a' && text[pos - 1] <= 'f') {
-			break;
-		}
-		else if (text[pos - 1] >= 'A' && text[pos - 1] <= 'F') {
-			break;
-		}
-	}
-
-	if (reader->pos - pos > 2) {
-		strncpy(reader->error, "number format error", 64);
-		*state = -2;
-		reader->errcode = 2;
-		return NULL;
-	}
-
-	if (reader->pos - pos == 2) ec1 = text[pos], ec2 = text[pos + 1];
-	else if (reader->pos - pos == 1) ec1 = text[pos], ec2 = 0;
-	else ec1 = ec2 = 0;
-	text[pos] = 0;
-	
-	// hex
-	if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
-		value = (long)strtoul(text + 2, NULL, 16);
-		token = ctoken_new_int(value);
-	}	// hex
-	else if (ec1 == 'h' && ec2 == 0) {
-		value = (long)strtoul(text, NULL, 16);
-		token = ctoken_new_int(value);
-	}	// binary
-	else if (ec1 == 'b' && ec2 == 0) {
-		value = (long)strtoul(text, NULL, 2);
-		token = ctoken_new_int(value);
-	}	// octal
-	else if (ec1 == 'q' && ec2 == 0) {
-		value = (long)strtol(text, NULL, 8);
-		token = ctoken_new_int(value);
-	}	// decimal or float
-	else {
-		int decimal = 1;
-		int i;
-		for (i = 0; text[i]; i++) 
-			if (text[i] == '.') decimal = 0;
-		if (decimal) {
-			value = (long)strtoul(text, NULL, 10);
-			token = ctoken_new_int(value);
-		}	else {
-			float ff;
-			sscanf(text, "%f", &ff);
-			token = ctoken_new_float(ff);
-		}
-	}
-	token->lineno = lineno;
-	*state = 0;
-	return token;
-}
-
-CTOKEN *ctoken_reader_read(CTokenReader *reader)
-{
-	CTOKEN *token = NULL;
-
-	assert(reader);
-
-	// skip memo and space
-	ctoken_reader_skip_space(reader);
-
-	// this is a endl
-	if (reader->ch == '\n') {
-		int lineno = reader->lineno - 1;
-		token = ctoken_new_endl();
-		token->lineno = lineno;
-		ctoken_reader_getch(reader);
-		return token;
-	}
-
-	// this is a endf
-	if (reader->ch < 0) {
-		if (reader->eof++) return NULL;
-		token = ctoken_new_endf();
-		token->lineno = reader->lineno;
-		return token;
-	}
-
-	// this is a string 
-	if (reader->ch == '\'' || reader->ch == '\"') {
-		int lineno = reader->lineno;
-		int state;
-		token = ctoken_reader_read_string(reader, &state);
-		if (state < 0) {
-			strncpy(reader->error, "expected closing quotation mark", 100);
-			reader->errcode = 3;
-			return NULL;
-		}
-		token->lineno = lineno;
-		return token;
-	}
-
-	#define issym2f(c) ((c) == '_' || isalpha(c) || (c) == '$' || (c) == '@')
-	#define issym2x(c) ((c) == '_' || isalnum(c) || (c) == '$' || (c) == '@')
-
-	// this is a identity or a keyword
-	if (issym2f(reader->ch)) {
-		int lineno = reader->lineno;
-		for (reader->pos = 0; issym2x(reader->ch); ) {
-			reader->buffer[reader->pos++] = (char)reader->ch;
-			ctoken_reader_getch(reader);
-			if (reader->pos >= CMAX_IDENT) {
-				strncpy(reader->error, "ident too long", 100);
-				reader->errcode = 4;
-				return NULL;
-			}
-		}
-		reader->buffer[reader->pos] = 0;
-		if (reader->keywords) {
-			int i;
-			for (i = 0; reader->keywords[i]; i++) {
-				if (stricmp(reader->buffer, reader->keywords[i]) == 0) {
-					token = ctoken_new_keyword(i);
-					token->lineno = lineno;
-					return token;
-				}
-			}
-		}
-		token = ctoken_new_ident(reader->buffer);
-		token->lineno = lineno;
-		//printf("{%s:%d:%d}\n", token->str, token->lineno, reader->lineno);
-		return token;
-	}
-
-	#undef issym2f
-	#undef issym2x
-
-	// this is a number
-	if (reader->ch >= '0' && reader->ch <= '9') {
-		int lineno = reader->lineno;
-		int state;
-		//printf("number\n");
-		token = ctoken_reader_read_number(reader, &state);
-		if (state < 0) {
-			strncpy(reader->error, "number format error", 100);
-			reader->errcode = 5;
-			return NULL;
-		}
-		token->lineno = lineno;
-		return token;
-	}
-
-	// operators
-	token = ctoken_new_operator(reader->ch);
-	assert(token);
-	token->lineno = reader->lineno;
-	ctoken_reader_getch(reader);
-
-	return token;
-}
-
-
-//---------------------------------------------------------------------
-// token stream
-//---------------------------------------------------------------------
-static int ctoken_stream_text_getch(void *fp) {
-	char **ptr = (char**)fp;
-	if (**ptr == 0) return -1;
-	return *((*ptr)++);
-}
-
-static void ctoken_stream_free(CTOKEN *root) {
-	assert(root);
-	while (!ctoken_list_is_empty(root)) {
-		CTOKEN *token = root->next;
-		ctoken_list_del(token);
-		ctoken_delete(token);
-	}
-	ctoken_delete(root);
-}
-
-static CTOKEN *ctoken_stream_load(const char *text, char *error)
-{
-	CTokenReader *reader;
-	CTOKEN *root;
-	char *string;
-	int retval;
-
-	string = (char*)text;
-	reader = ctoken_reader_create(ctoken_stream_text_getch, &string);
-	assert(reader);
-
-	root = ctoken_new_endf();
-	assert(root);
-
-	for (retval = 0, *error = 0; ; ) {
-		CTOKEN *token;
-		token = ctoken_reader_read(reader);
-		if (token == NULL) {
-			if (error) strncpy(error, reader->error, 100);
-			retval = -1;
-			break;
-		}
-		if (token->type == CTokenENDF) {
-			break;
-		}
-		ctoken_list_add_tail(token, root);
-	}
-
-	ctoken_reader_release(reader);
-
-	if (retval != 0) {
-		ctoken_stream_free(root);
-		return NULL;
-	}
-
-	return root;
-}
-
-
-//---------------------------------------------------------------------
-// Scanner
-//---------------------------------------------------------------------
-CScanner *cscanner_create(void)
-{
-	CScanner *scan;
-	scan = (CScanner*)malloc(sizeof(CScanner));
-	assert(scan);
-	scan->root = NULL;
-	scan->link = NULL;
-	scan->source = NULL;
-	scan->length = 0;
-	scan->position = 0;
-	scan->reader = NULL;
-	scan->error = (char*)malloc(1024);
-	assert(scan->error);
-	scan->errcode = 0;
-	scan->macros = NULL;
-	scan->endf.type = CTokenENDF;
-	scan->endf.lineno = 0;
-	scan->endf.fileno = 0;
-	scan->jmplabel = 0;
-	return scan;
-}
-
-static void cscanner_token_reset(CScanner *scan)
-{
-	assert(scan);
-	if (scan->root) {
-		while (!ctoken_list_is_empty(scan->root)) {
-			CTOKEN *token = scan->root->next;
-			ctoken_list_del(token);
-			ctoken_delete(token);
-		}
-		ctoken_delete(scan->root);
-		scan->root = NULL;
-		scan->link = NULL;
-	}
-	if (scan->reader) {
-		ctoken_reader_release(scan->reader);
-		scan->reader = NULL;
-	}
-	scan->source = NULL;
-	scan->length = 0;
-	scan->position = 0;
-	scan->errcode = 0;
-}
-
-void cscanner_macro_reset(CScanner *scan)
-{
-	while (scan->macros) {
-		CMacro *macro = scan->macros;
-		scan->macros = scan->macros->next;
-		free(macro->ident);
-		free(macro->value);
-		free(macro);
-	}
-	scan->jmplabel = 0;
-}
-
-void cscanner_release(CScanner *scan)
-{
-	cscanner_token_reset(scan);
-	cscanner_macro_reset(scan);
-	if (scan->error) {
-		free(scan->error);
-		scan->error = NULL;
-	}
-	free(scan);
-}
-
-int cscanner_macro_set(CScanner *scan, const char *name, const char *value)
-{
-	CMacro *macro;
-
-	for (macro = scan->macros; macro; macro = macro->next) {
-		if (strcmp(macro->ident, name) == 0) {
-			return -1;
-		}
-	}
-
-	macro = (CMacro*)malloc(sizeof(CMacro));
-	assert(macro);
-
-	macro->ident = strdup(name);
-	macro->value = strdup(value);
-
-	assert(macro->ident);
-	assert(macro->value);
-
-	macro->next = scan->macros;
-	scan->macros = macro;
-
-	return 0;
-}
-
-int cscanner_macro_del(CScanner *scan, const char *name)
-{
-	CMacro *macro;
-	CMacro *prev;
-
-	for (macro = scan->macros, prev = NULL; macro; ) {
-		if (strcmp(macro->ident, name) == 0) {
-			break;
-		}
-		prev = macro;
-		macro = macro->next;
-	}
-
-	if (macro == NULL) {		// not find macro
-		return -1;
-	}
-
-	if (prev) prev->next = macro->next;
-	else scan->macros = macro->next;
-
-	free(macro->ident);
-	free(macro->value);
-	free(macro);
-
-	return 0;
-}
-
-const char *cscanner_macro_search(CScanner *scan, const char *name)
-{
-	CMacro *macro;
-	for (macro = scan->macros; macro; macro = macro->next) {
-		if (strcmp(macro->ident, name) == 0) {
-			return macro->value;
-		}
-	}
-
-	return NULL;
-}
-
-static int cscanner_reader_getch(void *fp) 
-{
-	CScanner *scan = (CScanner*)fp;
-	if (scan->source == NULL) return -1;
-	if (scan->position >= scan->length) return -1;
-	return scan->source[scan->position++];
-}
-
-int cscanner_set_source(CScanner *scan, const char *source)
-{
-	int retval = 0;
-
-	cscanner_token_reset(scan);
-	scan->source = source;
-	scan->length = (int)strlen(source);
-	scan->position = 0;
-	scan->reader = ctoken_reader_create(cscanner_reader_getch, scan);
-	
-	scan->root = ctoken_new_endf();
-	scan->link = scan->root;
-	scan->error[0] = 0;
-	scan->errcode = 0;
-
-	for (; ; ) {
-		CTOKEN *token;
-
-		token = ctoken_reader_read(scan->reader);
-
-		if (token == NULL) {
-			scan->lineno = scan->reader->lineno;
-			scan->errcode = scan->reader->errcode;
-			strncpy(scan->error, scan->reader->error, 80);
-			retval = -1;
-			break;
-		}
-
-		if (token->type == CTokenIDENT) {
-			const char *macro = cscanner_macro_search(scan, token->str);
-			if (macro != NULL) {
-				CTOKEN *ts = ctoken_stream_load(macro, scan->error);
-				if (ts == NULL) {
-					scan->lineno = scan->reader->lineno;
-					scan->errcode = 88;
-					retval = -2;
-					break;
-				}
-				while (!ctoken_list_is_empty(ts)) {
-					CTOKEN *next = ts->next;
-					if (next->type == CTokenENDF) break;
-					ctoken_list_del(next);
-					next->lineno = scan->lineno;
-					ctoken_list_add_tail(next, scan->root);
-				}
-				ctoken_stream_free(ts);
-				continue;
-			}	
-			else {
-				if (strcmp(token->str, "@@") == 0) {
-					scan->jmplabel++;
-					free(token->str);
-					token->str = (char*)malloc(20);
-					assert(token->str);
-					sprintf(token->str, "@@%d", scan->jmplabel);
-					//printf("label %d\n", scan->jmplabel);
-				}
-				else if (stricmp(token->str, "@b") == 0) {
-					free(token->str);
-					token->str = (char*)malloc(20);
-					assert(token->str);
-					sprintf(token->str, "@@%d", scan->jmplabel);
-				}
-				else if (stricmp(token->str, "@f") == 0) {
-					free(token->str);
-					token->str = (char*)malloc(20);
-					assert(token->str);
-					sprintf(token->str, "@@%d", scan->jmplabel + 1);
-				}
-			}
-		}
-
-		ctoken_list_add_tail(token, scan->root);
-		if (token->type == CTokenENDF) {
-			break;
-		}
-	}
-
-	if (retval != 0) {
-		cscanner_token_reset(scan);
-		return retval;
-	}
-
-	scan->link = scan->root->next;
-	scan->root->lineno = scan->root->prev->lineno;
-
-	return 0;
-}
-
-const CTOKEN *cscanner_token_current(const CScanner *scan)
-{
-	if (scan->root == NULL || scan->link == NULL) {
-		return &(scan->endf);
-	}
-	return scan->link;
-}
-
-const CTOKEN *cscanner_token_lookahead(const CScanner *scan)
-{
-	if (scan->root == NULL || scan->link == NULL) {
-		return &(scan->endf);
-	}
-	if (scan->link == scan->root) {
-		return &(scan->endf);
-	}
-	return scan->link->next;
-}
-
-const CTOKEN *cscanner_token_advance(CScanner *scan, int n)
-{
-	if (n < 0) n = 0;
-	if (scan->root == NULL || scan->link == NULL) {
-		return &(scan->endf);
-	}
-	while (n--) {
-		if (scan->link == scan->root) {
-			return &(scan->endf);
-		}
-		scan->link = scan->link->next;
-	}
-	return scan->link;
-}
-
-int cscanner_get_type(const CScanner *scan)
-{
-	return cscanner_token_current(scan)->type;
-}
-
-const char *cscanner_get_string(const CScanner *scan)
-{
-	const CTOKEN *token = cscanner_token_current(scan);
-	if (token->type != CTokenIDENT && token->type != CTokenSTR) {
-		return "";
-	}
-	return token->str;
-}
-
-int cscanner_get_char(const CScanner *scan)
-{
-	const CTOKEN *token = cscanner_token_current(scan);
-	if (token->type != CTokenOPERATOR) {
-		return '\0';
-	}
-	return token->ch;
-}
-
-int cscanner_get_value(const CScanner *scan)
-{
-	const CTOKEN *token = cscanner_token_current(scan);
-	if (token->type != CTokenINT) {
-		return 0;
-	}
-	return token->intval;
-}
-
-int cscanner_get_lineno(const CScanner *scan)
-{
-	const CTOKEN *token = cscanner_token_current(scan);
-	return token->lineno;
-}
-
-int cscanner_is_endl(const CScanner *scan) {
-	const CTOKEN *token = cscanner_token_current(scan);
-	return (token->type == CTokenENDF || token->type == CTokenENDL);
-}
-
-int cscanner_is_endf(const CScanner *scan) {
-	return cscanner_get_type(scan) == CTokenENDF;
-}
-
-int cscanner_is_ident(const CScanner *scan)  {
-	return cscanner_get_type(scan) == CTokenIDENT;
-}
-
-int cscanner_is_operator(const CScanner *scan) {
-	return cscanner_get_type(scan) == CTokenOPERATOR;
-}
-
-int cscanner_is_int(const CScanner *scan) {
-	return cscanner_get_type(scan) == CTokenINT;
-}
-
-int cscanner_is_string(const CScanner *scan) {
-	return cscanner_get_type(scan) == CTokenSTR;
-}
-
+//=====================================================================
+//
+// cscanner.c - source scanner
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "cscanner.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4996)
+#include <intrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CTOKEN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CTOKEN_SSE2
+#endif
+
+//---------------------------------------------------------------------
+// compatible
+//---------------------------------------------------------------------
+int cstricmp(const char *dst, const char *src) {
+	int ch1, ch2;
+	do {
+		if ( ((ch1 = (unsigned char)(*(dst++))) >= 'A') && (ch1 <= 'Z') )
+			ch1 += 0x20;
+		if ( ((ch2 = (unsigned char)(*(src++))) >= 'A') && (ch2 <= 'Z') )
+			ch2 += 0x20;
+	}	while ( ch1 && (ch1 == ch2) );
+	return(ch1 - ch2);
+}
+
+
+//---------------------------------------------------------------------
+// case folded string hash, keywords and macros share it
+//---------------------------------------------------------------------
+static unsigned int cscanner_hash(const char *name)
+{
+	unsigned int hash = 5381;
+	for (; *name; name++) {
+		int ch = (unsigned char)*name;
+		if (ch >= 'A' && ch <= 'Z') ch += 'a' - 'A';
+		hash = ((hash << 5) + hash) + (unsigned int)ch;
+	}
+	return hash;
+}
+
+
+//---------------------------------------------------------------------
+// Token Reader
+//---------------------------------------------------------------------
+CTokenReader *ctoken_reader_create(int (*readch)(void*), void *fp)
+{
+	CTokenReader *reader;
+	reader = (CTokenReader*)malloc(sizeof(CTokenReader));
+	assert(reader);
+	reader->readch = readch;
+	reader->fp = fp;
+	reader->text = NULL;
+	reader->end = NULL;
+	reader->ch = ' ';
+	reader->unch = -1;
+	reader->saved = -1;
+	reader->lineno = 1;
+	reader->colno = 0;
+	reader->state = 0;
+	reader->buffer = (char*)malloc(CMAX_IDENT * 2);
+	assert(reader->buffer);
+	reader->error = (char*)malloc(8192);
+	assert(reader->error);
+	reader->pos = 0;
+	reader->keywords = NULL;
+	reader->kbuilt = NULL;
+	reader->kindex = NULL;
+	reader->ksize = 0;
+	reader->pool = NULL;
+	reader->eof = 0;
+	reader->error[0] = 0;
+	reader->errcode = 0;
+	return reader;
+}
+
+void ctoken_reader_release(CTokenReader *reader)
+{
+	assert(reader);
+	if (reader->buffer) {
+		free(reader->buffer);
+		reader->buffer = NULL;
+	}
+	if (reader->error) {
+		free(reader->error);
+		reader->error = NULL;
+	}
+	if (reader->kindex) {
+		free(reader->kindex);
+		reader->kindex = NULL;
+	}
+	free(reader);
+}
+
+void ctoken_reader_reset(CTokenReader *reader, int (*readch)(void*), void *fp)
+{
+	assert(reader);
+	reader->readch = readch;
+	reader->fp = fp;
+	reader->text = NULL;
+	reader->end = NULL;
+	reader->ch = ' ';
+	reader->unch = -1;
+	reader->saved = -1;
+	reader->lineno = 1;
+	reader->colno = 0;
+	reader->state = 0;
+	reader->pos = 0;
+	reader->eof = 0;
+	reader->error[0] = 0;
+	reader->errcode = 0;
+}
+
+void ctoken_reader_set_text(CTokenReader *reader, const char *text, 
+	long length)
+{
+	ctoken_reader_reset(reader, NULL, NULL);
+	reader->text = text;
+	reader->end = text + length;
+	// from now on ch is text[-1] whenever nothing is pushed back
+	ctoken_reader_getch(reader);
+}
+
+// (re)build keyword index whenever reader->keywords is replaced
+static void ctoken_reader_keyword_index(CTokenReader *reader)
+{
+	int count, size, i;
+
+	if (reader->kindex) {
+		free(reader->kindex);
+		reader->kindex = NULL;
+	}
+	reader->kbuilt = reader->keywords;
+	reader->ksize = 0;
+
+	if (reader->keywords == NULL) return;
+
+	for (count = 0; reader->keywords[count]; count++);
+	for (size = 16; size < count * 2; size <<= 1);
+
+	reader->kindex = (int*)malloc(sizeof(int) * size);
+	assert(reader->kindex);
+	reader->ksize = size;
+
+	for (i = 0; i < size; i++) reader->kindex[i] = -1;
+
+	for (i = 0; i < count; i++) {
+		unsigned int pos = cscanner_hash(reader->keywords[i]);
+		for (pos &= size - 1; reader->kindex[pos] >= 0; ) {
+			if (stricmp(reader->keywords[reader->kindex[pos]], 
+				reader->keywords[i]) == 0) break;
+			pos = (pos + 1) & (size - 1);
+		}
+		// first one wins for duplicated keywords, as linear search did
+		if (reader->kindex[pos] < 0) reader->kindex[pos] = i;
+	}
+}
+
+// returns keyword index, -1 for none
+static int ctoken_reader_keyword(CTokenReader *reader, const char *name)
+{
+	unsigned int pos;
+	if (reader->kbuilt != reader->keywords) {
+		ctoken_reader_keyword_index(reader);
+	}
+	if (reader->kindex == NULL) return -1;
+	pos = cscanner_hash(name) & (reader->ksize - 1);
+	for (; reader->kindex[pos] >= 0; pos = (pos + 1) & (reader->ksize - 1)) {
+		int i = reader->kindex[pos];
+		if (stricmp(reader->keywords[i], name) == 0) return i;
+	}
+	return -1;
+}
+
+#define ctoken_reader_new(reader, type, data, size) \
+	ctoken_new_in((reader)->pool, type, data, size)
+
+int ctoken_reader_getch(CTokenReader *reader)
+{
+	assert(reader);
+	if (reader->unch >= 0) {
+		reader->ch = reader->unch;
+		reader->unch = -1;
+	}	else {
+		reader->saved = reader->ch;
+		if (reader->text == NULL) reader->ch = reader->readch(reader->fp);
+		else if (reader->text < reader->end) 
+			reader->ch = (unsigned char)*reader->text++;
+		else reader->ch = -1;
+		if (reader->ch == '\n') reader->lineno++, reader->colno = 1;
+		else if (reader->ch >= 0) reader->colno++;
+	}
+	return reader->ch;
+}
+
+static int ctoken_reader_ungetch(CTokenReader *reader, int ch)
+{
+	assert(reader->unch < 0);
+	reader->unch = ch;
+	return 0;
+}
+
+
+//---------------------------------------------------------------------
+// character classes, text mode finds runs 16 or 32 bytes at a time
+//---------------------------------------------------------------------
+#define CTOKEN_SPACE	1		// isspace() but '\n'
+#define CTOKEN_IDENT	2		// letters, digits, '_', '$' and '@'
+#define CTOKEN_NUMBER	4		// letters, digits and '.'
+
+static int ctoken_class(int ch)
+{
+	int lower = ch | 0x20;
+	if ((ch >= '0' && ch <= '9') || (lower >= 'a' && lower <= 'z'))
+		return CTOKEN_IDENT | CTOKEN_NUMBER;
+	if (ch == '_' || ch == '$' || ch == '@') return CTOKEN_IDENT;
+	if (ch == '.') return CTOKEN_NUMBER;
+	if (ch == ' ' || (ch >= '\t' && ch <= '\r' && ch != '\n')) 
+		return CTOKEN_SPACE;
+	return 0;
+}
+
+#if defined(CTOKEN_AVX2)
+#define CTOKEN_VECTOR		32
+#define ctoken_v			__m256i
+#define ctoken_v_load(p)	_mm256_loadu_si256((const __m256i*)(p))
+#define ctoken_v_set(c)		_mm256_set1_epi8((char)(c))
+#define ctoken_v_zero()		_mm256_setzero_si256()
+#define ctoken_v_eq(x, y)	_mm256_cmpeq_epi8(x, y)
+#define ctoken_v_or(x, y)	_mm256_or_si256(x, y)
+#define ctoken_v_and(x, y)	_mm256_and_si256(x, y)
+#define ctoken_v_max(x, y)	_mm256_max_epu8(x, y)
+#define ctoken_v_min(x, y)	_mm256_min_epu8(x, y)
+#define ctoken_v_mask(x)	((unsigned int)_mm256_movemask_epi8(x))
+#elif defined(CTOKEN_SSE2)
+#define CTOKEN_VECTOR		16
+#define ctoken_v			__m128i
+#define ctoken_v_load(p)	_mm_loadu_si128((const __m128i*)(p))
+#define ctoken_v_set(c)		_mm_set1_epi8((char)(c))
+#define ctoken_v_zero()		_mm_setzero_si128()
+#define ctoken_v_eq(x, y)	_mm_cmpeq_epi8(x, y)
+#define ctoken_v_or(x, y)	_mm_or_si128(x, y)
+#define ctoken_v_and(x, y)	_mm_and_si128(x, y)
+#define ctoken_v_max(x, y)	_mm_max_epu8(x, y)
+#define ctoken_v_min(x, y)	_mm_min_epu8(x, y)
+#define ctoken_v_mask(x)	((unsigned int)_mm_movemask_epi8(x))
+#endif
+
+#ifdef CTOKEN_VECTOR
+// bytes of x in [lo, hi], unsigned
+static ctoken_v ctoken_v_range(ctoken_v x, int lo, int hi)
+{
+	ctoken_v a = ctoken_v_eq(ctoken_v_max(x, ctoken_v_set(lo)), x);
+	ctoken_v b = ctoken_v_eq(ctoken_v_min(x, ctoken_v_set(hi)), x);
+	return ctoken_v_and(a, b);
+}
+
+static int ctoken_lowest_bit(unsigned int bits)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, bits);
+	return (int)index;
+#else
+	return __builtin_ctz(bits);
+#endif
+}
+#endif
+
+// first byte of [p, end) out of classes in mask
+static const char *ctoken_span(const char *p, const char *end, int mask)
+{
+#ifdef CTOKEN_VECTOR
+	for (; end - p >= CTOKEN_VECTOR; p += CTOKEN_VECTOR) {
+		ctoken_v x = ctoken_v_load(p);
+		ctoken_v m = ctoken_v_zero();
+		unsigned int bits;
+		if (mask & CTOKEN_SPACE) {
+			ctoken_v c = ctoken_v_range(x, '\t', '\r');
+			c = ctoken_v_and(c, ctoken_v_eq(ctoken_v_eq(x, 
+				ctoken_v_set('\n')), ctoken_v_zero()));
+			m = ctoken_v_or(c, ctoken_v_eq(x, ctoken_v_set(' ')));
+		}
+		if (mask & (CTOKEN_IDENT | CTOKEN_NUMBER)) {
+			ctoken_v lower = ctoken_v_or(x, ctoken_v_set(0x20));
+			m = ctoken_v_or(m, ctoken_v_range(x, '0', '9'));
+			m = ctoken_v_or(m, ctoken_v_range(lower, 'a', 'z'));
+		}
+		if (mask & CTOKEN_IDENT) {
+			m = ctoken_v_or(m, ctoken_v_eq(x, ctoken_v_set('_')));
+			m = ctoken_v_or(m, ctoken_v_eq(x, ctoken_v_set('$')));
+			m = ctoken_v_or(m, ctoken_v_eq(x, ctoken_v_set('@')));
+		}
+		if (mask & CTOKEN_NUMBER) {
+			m = ctoken_v_or(m, ctoken_v_eq(x, ctoken_v_set('.')));
+		}
+		bits = ~ctoken_v_mask(m);
+		if (CTOKEN_VECTOR == 16) bits &= 0xffff;
+		if (bits) return p + ctoken_lowest_bit(bits);
+	}
+#endif
+	for (; p < end && (ctoken_class((unsigned char)*p) & mask); p++);
+	return p;
+}
+
+// text mode with nothing pushed back, ch is at reader->text - 1
+#define ctoken_reader_inplace(reader) \
+	((reader)->text != NULL && (reader)->unch < 0 && (reader)->ch >= 0)
+
+// move to pos in text, as getch does a byte at a time
+static void ctoken_reader_seek(CTokenReader *reader, const char *pos)
+{
+	const char *start = reader->text - 1;
+	if (pos <= start) return;
+	reader->saved = (unsigned char)pos[-1];
+	reader->colno += (int)(pos - start) - 1;
+	if (pos < reader->end) {
+		reader->ch = (unsigned char)*pos;
+		reader->text = pos + 1;
+		if (reader->ch == '\n') reader->lineno++, reader->colno = 1;
+		else reader->colno++;
+	}	else {
+		reader->ch = -1;
+		reader->text = reader->end;
+	}
+}
+
+// copy a run of classes in mask to buffer, returns its size or -1
+static int ctoken_reader_run(CTokenReader *reader, int mask)
+{
+	if (ctoken_reader_inplace(reader)) {
+		const char *start = reader->text - 1;
+		const char *pos = ctoken_span(start, reader->end, mask);
+		reader->pos = (int)(pos - start);
+		if (reader->pos >= CMAX_IDENT) return -1;
+		memcpy(reader->buffer, start, reader->pos);
+		ctoken_reader_seek(reader, pos);
+	}	else {
+		for (reader->pos = 0; reader->ch >= 0 && 
+			(ctoken_class(reader->ch) & mask); ) {
+			reader->buffer[reader->pos++] = (char)reader->ch;
+			ctoken_reader_getch(reader);
+			if (reader->pos >= CMAX_IDENT) return -1;
+		}
+	}
+	reader->buffer[reader->pos] = 0;
+	return reader->pos;
+}
+
+// skip the rest of a line to '\n'
+static void ctoken_reader_skip_line(CTokenReader *reader)
+{
+	if (ctoken_reader_inplace(reader)) {
+		const char *start = reader->text - 1;
+		const char *pos = (const char*)memchr(start, '\n', 
+			reader->end - start);
+		ctoken_reader_seek(reader, pos? pos : reader->end);
+		return;
+	}
+	while (reader->ch != '\n' && reader->ch >= 0) {
+		ctoken_reader_getch(reader);
+	}
+}
+
+static int ctoken_reader_skip_space(CTokenReader *reader)
+{
+	while (1) {
+		int skip = 0;
+		if (ctoken_reader_inplace(reader) && 
+			(ctoken_class(reader->ch) & CTOKEN_SPACE)) {
+			const char *start = reader->text - 1;
+			ctoken_reader_seek(reader, ctoken_span(start, reader->end, 
+				CTOKEN_SPACE));
+			skip++;
+		}
+		for (; isspace(reader->ch) && reader->ch != '\n'; skip++)
+			ctoken_reader_getch(reader);
+		if (reader->ch == ';' || reader->ch == '#') {
+			skip++;
+			ctoken_reader_skip_line(reader);
+		}	
+		else if (reader->ch == '/') {
+			ctoken_reader_getch(reader);
+			if (reader->ch == '/') {
+				skip++;
+				ctoken_reader_skip_line(reader);
+			}	else {
+				ctoken_reader_ungetch(reader, reader->ch);
+				reader->ch = '/';
+			}
+		}
+		if (skip == 0) break;
+	}
+	return 0;
+}
+
+static CTOKEN *ctoken_reader_read_string(CTokenReader *reader, int *state)
+{
+	CTOKEN *token = NULL;
+
+	if (reader->ch == '\'' || reader->ch == '\"') {
+		int mode = (reader->ch == '\"')? 0 : 1;
+		reader->pos = 0;
+		while (1) {
+			int ch = ctoken_reader_getch(reader);
+			if (ch == '\\') {
+				ctoken_reader_getch(reader);
+				reader->buffer[reader->pos++] = '\\';
+				reader->buffer[reader->pos++] = (char)reader->ch;
+			}	
+			else if (mode == 0 && ch == '\'') {
+				reader->buffer[reader->pos++] = '\'';
+			}
+			else if (mode == 1 && ch == '\"') {
+				reader->buffer[reader->pos++] = '\"';
+			}
+			else if (mode == 0 && ch == '\"') {
+				ch = ctoken_reader_getch(reader);
+				if (ch == '\"') {
+					reader->buffer[reader->pos++] = '\"';
+					reader->buffer[reader->pos++] = '\"';
+				}	else {
+					*state = 1;
+					reader->buffer[reader->pos] = 0;
+					token = ctoken_reader_new(reader, CTokenSTR, 
+						reader->buffer, reader->pos);
+					break;
+				}
+			}
+			else if (mode == 1 && ch == '\'') {
+				ch = ctoken_reader_getch(reader);
+				if (ch == '\'') {
+					reader->buffer[reader->pos++] = '\'';
+					reader->buffer[reader->pos++] = '\'';
+				}	else {
+					*state = 1;
+					reader->buffer[reader->pos] = 0;
+					token = ctoken_reader_new(reader, CTokenSTR, 
+						reader->buffer, reader->pos);
+					break;
+				}
+			}
+			else if (ch == '\n') {
+				*state = -1;
+				break;
+			}
+			else if (ch >= 0) {
+				reader->buffer[reader->pos++] = (char)ch;
+			}
+			else {			// ch < 0
+				*state = -2;
+				break;
+			}
+
+			if (reader->pos >= CMAX_IDENT) {
+				*state = -3;
+				strncpy(reader->error, "string too long", 64);
+				break;
+			}
+		}
+	}
+
+	return token;
+}
+
+static CTOKEN *ctoken_reader_read_number(CTokenReader *reader, int *state)
+{
+	int lineno = reader->lineno;
+	char *text = reader->buffer;
+	CTOKEN *token;
+	int ec1, ec2, pos;
+	long value;
+
+	if (reader->ch < '0' || reader->ch > '9') {
+		*state = 0;
+		return NULL;
+	}
+
+	if (ctoken_reader_run(reader, CTOKEN_NUMBER) < 0) {
+		strncpy(reader->error, "number too long", 64);
+		*state = -1;
+		reader->errcode = 1;
+		return NULL;
+	}
+
+	// "1to16" of AVX-512 broadcasts, "{1to16}", is a name
+	pos = (int)strspn(text, "0123456789");
+	if (pos > 0 && (text[pos] == 't' || text[pos] == 'T') && 
+		(text[pos + 1] == 'o' || text[pos + 1] == 'O') &&
+		text[pos + 2] && strspn(text + pos + 2, "0123456789") == 
+		strlen(text + pos + 2)) {
+		token = ctoken_reader_new(reader, CTokenIDENT, text, reader->pos);
+		token->lineno = lineno;
+		*state = 0;
+		return token;
+	}
+
+	for (pos = reader->pos; pos > 0; pos--) {
+		if (isdigit(text[pos - 1]) || text[pos - 1] == '.') {
+			break;
+		}
+		else if (text[pos - 1] >= 'a' && text[pos - 1] <= 'f') {
+			break;
+		}
+		else if (text[pos - 1] >= 'A' && text[pos - 1] <= 'F') {
+			break;
+		}
+	}
+
+	if (reader->pos - pos > 2) {
+		strncpy(reader->error, "number format error", 64);
+		*state = -2;
+		reader->errcode = 2;
+		return NULL;
+	}
+
+	if (reader->pos - pos == 2) ec1 = text[pos], ec2 = text[pos + 1];
+	else if (reader->pos - pos == 1) ec1 = text[pos], ec2 = 0;
+	else ec1 = ec2 = 0;
+	text[pos] = 0;
+	
+	// hex
+	if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+		value = (long)strtoul(text + 2, NULL, 16);
+		token = ctoken_reader_new(reader, CTokenINT, &value, 
+			sizeof(long));
+	}	// hex
+	else if (ec1 == 'h' && ec2 == 0) {
+		value = (long)strtoul(text, NULL, 16);
+		token = ctoken_reader_new(reader, CTokenINT, &value, 
+			sizeof(long));
+	}	// binary
+	else if (ec1 == 'b' && ec2 == 0) {
+		value = (long)strtoul(text, NULL, 2);
+		token = ctoken_reader_new(reader, CTokenINT, &value, 
+			sizeof(long));
+	}	// octal
+	else if (ec1 == 'q' && ec2 == 0) {
+		value = (long)strtol(text, NULL, 8);
+		token = ctoken_reader_new(reader, CTokenINT, &value, 
+			sizeof(long));
+	}	// decimal or float
+	else {
+		int decimal = 1;
+		int i;
+		for (i = 0; text[i]; i++) 
+			if (text[i] == '.') decimal = 0;
+		if (decimal) {
+			value = (long)strtoul(text, NULL, 10);
+			token = ctoken_reader_new(reader, CTokenINT, &value, 
+				sizeof(long));
+		}	else {
+			float ff;
+			double fv;
+			sscanf(text, "%f", &ff);
+			fv = ff;
+			token = ctoken_reader_new(reader, CTokenFLOAT, &fv, 
+				sizeof(double));
+		}
+	}
+	token->lineno = lineno;
+	*state = 0;
+	return token;
+}
+
+CTOKEN *ctoken_reader_read(CTokenReader *reader)
+{
+	CTOKEN *token = NULL;
+
+	assert(reader);
+
+	// skip memo and space
+	ctoken_reader_skip_space(reader);
+
+	// this is a endl
+	if (reader->ch == '\n') {
+		int lineno = reader->lineno - 1;
+		token = ctoken_reader_new(reader, CTokenENDL, NULL, 0);
+		token->lineno = lineno;
+		ctoken_reader_getch(reader);
+		return token;
+	}
+
+	// this is a endf
+	if (reader->ch < 0) {
+		if (reader->eof++) return NULL;
+		token = ctoken_reader_new(reader, CTokenENDF, NULL, 0);
+		token->lineno = reader->lineno;
+		return token;
+	}
+
+	// this is a string 
+	if (reader->ch == '\'' || reader->ch == '\"') {
+		int lineno = reader->lineno;
+		int state;
+		token = ctoken_reader_read_string(reader, &state);
+		if (state < 0) {
+			strncpy(reader->error, "expected closing quotation mark", 100);
+			reader->errcode = 3;
+			return NULL;
+		}
+		token->lineno = lineno;
+		return token;
+	}
+
+	#define issym2f(c) ((c) == '_' || isalpha(c) || (c) == '$' || (c) == '@')
+
+	// this is a identity or a keyword
+	if (issym2f(reader->ch)) {
+		int lineno = reader->lineno;
+		if (ctoken_reader_run(reader, CTOKEN_IDENT) < 0) {
+			strncpy(reader->error, "ident too long", 100);
+			reader->errcode = 4;
+			return NULL;
+		}
+		if (reader->keywords) {
+			int i = ctoken_reader_keyword(reader, reader->buffer);
+			if (i >= 0) {
+				token = ctoken_reader_new(reader, CTokenKEYWORD, 
+					&i, sizeof(int));
+				token->lineno = lineno;
+				return token;
+			}
+		}
+		token = ctoken_reader_new(reader, CTokenIDENT, 
+			reader->buffer, reader->pos);
+		token->lineno = lineno;
+		//printf("{%s:%d:%d}\n", token->str, token->lineno, reader->lineno);
+		return token;
+	}
+
+	#undef issym2f
+
+	// this is a number
+	if (reader->ch >= '0' && reader->ch <= '9') {
+		int lineno = reader->lineno;
+		int state;
+		//printf("number\n");
+		token = ctoken_reader_read_number(reader, &state);
+		if (state < 0) {
+			strncpy(reader->error, "number format error", 100);
+			reader->errcode = 5;
+			return NULL;
+		}
+		token->lineno = lineno;
+		return token;
+	}
+
+	// operators
+	token = ctoken_reader_new(reader, CTokenOPERATOR, &reader->ch, 
+		sizeof(int));
+	assert(token);
+	token->lineno = reader->lineno;
+	ctoken_reader_getch(reader);
+
+	return token;
+}
+
+
+//---------------------------------------------------------------------
+// token stream
+//---------------------------------------------------------------------
+static int ctoken_stream_text_getch(void *fp) {
+	char **ptr = (char**)fp;
+	if (**ptr == 0) return -1;
+	return *((*ptr)++);
+}
+
+
+//---------------------------------------------------------------------
+// Scanner
+//---------------------------------------------------------------------
+CScanner *cscanner_create(void)
+{
+	CScanner *scan;
+	scan = (CScanner*)malloc(sizeof(CScanner));
+	assert(scan);
+	scan->root = NULL;
+	scan->link = NULL;
+	scan->source = NULL;
+	scan->length = 0;
+	scan->position = 0;
+	scan->pool = cmempool_create(0);
+	assert(scan->pool);
+	scan->reader = ctoken_reader_create(NULL, NULL);
+	assert(scan->reader);
+	scan->reader->pool = scan->pool;
+	scan->expander = ctoken_reader_create(NULL, NULL);
+	assert(scan->expander);
+	scan->expander->pool = scan->pool;
+	scan->tokens = cmempool_create(0);
+	assert(scan->tokens);
+	scan->lines = NULL;
+	scan->nlines = 0;
+	scan->maxlines = 0;
+	scan->lexerror = "";
+	scan->error = (char*)malloc(1024);
+	assert(scan->error);
+	scan->errcode = 0;
+	scan->macros = NULL;
+	scan->macrosize = 0;
+	scan->nmacro = 0;
+	scan->endf.type = CTokenENDF;
+	scan->endf.lineno = 0;
+	scan->endf.fileno = 0;
+	scan->jmplabel = 0;
+	return scan;
+}
+
+// tokens of the last line are dropped at once with the pool
+static void cscanner_token_reset(CScanner *scan)
+{
+	assert(scan);
+	cmempool_reset(scan->pool);
+	scan->root = NULL;
+	scan->link = NULL;
+	scan->source = NULL;
+	scan->length = 0;
+	scan->position = 0;
+	scan->errcode = 0;
+}
+
+void cscanner_macro_reset(CScanner *scan)
+{
+	int i;
+	for (i = 0; i < scan->macrosize; i++) {
+		while (scan->macros[i]) {
+			CMacro *macro = scan->macros[i];
+			scan->macros[i] = macro->next;
+			free(macro->ident);
+			free(macro->value);
+			free(macro);
+		}
+	}
+	scan->nmacro = 0;
+	scan->jmplabel = 0;
+}
+
+void cscanner_release(CScanner *scan)
+{
+	cscanner_token_reset(scan);
+	cscanner_macro_reset(scan);
+	if (scan->macros) {
+		free(scan->macros);
+		scan->macros = NULL;
+		scan->macrosize = 0;
+	}
+	if (scan->reader) {
+		ctoken_reader_release(scan->reader);
+		scan->reader = NULL;
+	}
+	if (scan->expander) {
+		ctoken_reader_release(scan->expander);
+		scan->expander = NULL;
+	}
+	if (scan->pool) {
+		cmempool_release(scan->pool);
+		scan->pool = NULL;
+	}
+	if (scan->tokens) {
+		cmempool_release(scan->tokens);
+		scan->tokens = NULL;
+	}
+	if (scan->lines) {
+		free(scan->lines);
+		scan->lines = NULL;
+	}
+	if (scan->error) {
+		free(scan->error);
+		scan->error = NULL;
+	}
+	free(scan);
+}
+
+static int cscanner_macro_match(const CMacro *macro, const char *name)
+{
+	if (macro->nocase) return stricmp(macro->ident, name) == 0;
+	return strcmp(macro->ident, name) == 0;
+}
+
+static void cscanner_macro_rehash(CScanner *scan, int newsize)
+{
+	CMacro **macros;
+	int i;
+
+	macros = (CMacro**)malloc(sizeof(CMacro*) * newsize);
+	assert(macros);
+	memset(macros, 0, sizeof(CMacro*) * newsize);
+
+	for (i = 0; i < scan->macrosize; i++) {
+		while (scan->macros[i]) {
+			CMacro *macro = scan->macros[i];
+			unsigned int pos = cscanner_hash(macro->ident);
+			scan->macros[i] = macro->next;
+			pos &= (unsigned int)(newsize - 1);
+			macro->next = macros[pos];
+			macros[pos] = macro;
+		}
+	}
+
+	if (scan->macros) free(scan->macros);
+	scan->macros = macros;
+	scan->macrosize = newsize;
+}
+
+static int cscanner_macro_add(CScanner *scan, const char *name, 
+	const char *value, int nocase)
+{
+	CMacro *macro;
+	unsigned int pos;
+
+	if (scan->nmacro * 2 >= scan->macrosize) {
+		cscanner_macro_rehash(scan, (scan->macrosize > 0)? 
+			scan->macrosize * 2 : 64);
+	}
+
+	pos = cscanner_hash(name) & (unsigned int)(scan->macrosize - 1);
+
+	// names clash when either side accepts the other's spelling
+	for (macro = scan->macros[pos]; macro; macro = macro->next) {
+		if (cscanner_macro_match(macro, name)) return -1;
+		if (nocase && stricmp(macro->ident, name) == 0) return -1;
+	}
+
+	macro = (CMacro*)malloc(sizeof(CMacro));
+	assert(macro);
+
+	macro->ident = strdup(name);
+	macro->value = strdup(value);
+	macro->nocase = nocase;
+
+	assert(macro->ident);
+	assert(macro->value);
+
+	macro->next = scan->macros[pos];
+	scan->macros[pos] = macro;
+	scan->nmacro++;
+
+	return 0;
+}
+
+int cscanner_macro_set(CScanner *scan, const char *name, const char *value)
+{
+	return cscanner_macro_add(scan, name, value, 0);
+}
+
+int cscanner_macro_set_nocase(CScanner *scan, const char *name, 
+	const char *value)
+{
+	return cscanner_macro_add(scan, name, value, 1);
+}
+
+int cscanner_macro_del(CScanner *scan, const char *name)
+{
+	CMacro *macro;
+	CMacro *prev;
+	unsigned int pos;
+
+	if (scan->nmacro == 0) return -1;
+
+	pos = cscanner_hash(name) & (unsigned int)(scan->macrosize - 1);
+
+	for (macro = scan->macros[pos], prev = NULL; macro; ) {
+		if (cscanner_macro_match(macro, name)) {
+			break;
+		}
+		prev = macro;
+		macro = macro->next;
+	}
+
+	if (macro == NULL) {		// not find macro
+		return -1;
+	}
+
+	if (prev) prev->next = macro->next;
+	else scan->macros[pos] = macro->next;
+
+	free(macro->ident);
+	free(macro->value);
+	free(macro);
+	scan->nmacro--;
+
+	return 0;
+}
+
+const char *cscanner_macro_search(CScanner *scan, const char *name)
+{
+	CMacro *macro;
+	unsigned int pos;
+	if (scan->nmacro == 0) return NULL;
+	pos = cscanner_hash(name) & (unsigned int)(scan->macrosize - 1);
+	for (macro = scan->macros[pos]; macro; macro = macro->next) {
+		if (cscanner_macro_match(macro, name)) {
+			return macro->value;
+		}
+	}
+
+	return NULL;
+}
+
+// append tokens of a macro value to current line
+static int cscanner_macro_expand(CScanner *scan, const char *text)
+{
+	CTokenReader *reader = scan->expander;
+	char *string = (char*)text;
+
+	ctoken_reader_reset(reader, ctoken_stream_text_getch, &string);
+
+	for (; ; ) {
+		CTOKEN *token = ctoken_reader_read(reader);
+		if (token == NULL) {
+			strncpy(scan->error, reader->error, 100);
+			return -1;
+		}
+		if (token->type == CTokenENDF) {
+			break;
+		}
+		token->lineno = scan->lineno;
+		ctoken_list_add_tail(token, scan->root);
+	}
+
+	return 0;
+}
+
+// start a new current line
+static void cscanner_line_begin(CScanner *scan)
+{
+	cscanner_token_reset(scan);
+	scan->root = ctoken_new_in(scan->pool, CTokenENDF, NULL, 0);
+	scan->link = scan->root;
+	scan->error[0] = 0;
+	scan->errcode = 0;
+}
+
+// add a token to current line, macros are expanded and anonymous 
+// labels numbered. the token itself is never changed
+static int cscanner_line_push(CScanner *scan, CTOKEN *token)
+{
+	if (token->type == CTokenIDENT) {
+		const char *macro = cscanner_macro_search(scan, token->str);
+		int label = -1;
+		if (macro != NULL) {
+			return cscanner_macro_expand(scan, macro);
+		}
+		if (strcmp(token->str, "@@") == 0) label = ++scan->jmplabel;
+		else if (stricmp(token->str, "@b") == 0) label = scan->jmplabel;
+		else if (stricmp(token->str, "@f") == 0) label = scan->jmplabel + 1;
+		if (label >= 0) {
+			char name[20];
+			int lineno = token->lineno;
+			sprintf(name, "@@%d", label);
+			token = ctoken_new_in(scan->pool, CTokenIDENT, name, 
+				(int)strlen(name));
+			token->lineno = lineno;
+		}
+	}
+	ctoken_list_add_tail(token, scan->root);
+	return 0;
+}
+
+// current line is complete
+static int cscanner_line_end(CScanner *scan, int retval)
+{
+	if (retval != 0) {
+		cscanner_token_reset(scan);
+		return retval;
+	}
+
+	scan->link = scan->root->next;
+	scan->root->lineno = scan->root->prev->lineno;
+
+	return 0;
+}
+
+int cscanner_set_source(CScanner *scan, const char *source)
+{
+	return cscanner_set_source_span(scan, source, (long)strlen(source));
+}
+
+int cscanner_set_source_span(CScanner *scan, const char *source, 
+	long length)
+{
+	int retval = 0;
+
+	cscanner_line_begin(scan);
+	scan->source = source;
+	scan->length = length;
+	ctoken_reader_set_text(scan->reader, source, length);
+
+	for (; ; ) {
+		CTOKEN *token;
+
+		token = ctoken_reader_read(scan->reader);
+
+		if (token == NULL) {
+			scan->lineno = scan->reader->lineno;
+			scan->errcode = scan->reader->errcode;
+			strncpy(scan->error, scan->reader->error, 80);
+			retval = -1;
+			break;
+		}
+
+		if (cscanner_line_push(scan, token) != 0) {
+			scan->lineno = scan->reader->lineno;
+			scan->errcode = 88;
+			retval = -2;
+			break;
+		}
+
+		if (token->type == CTokenENDF) {
+			break;
+		}
+	}
+
+	return cscanner_line_end(scan, retval);
+}
+
+// next tokens go to a new line, returns its root
+static CTOKEN *cscanner_tokenize_line(CScanner *scan)
+{
+	CTOKEN *root;
+	if (scan->nlines >= scan->maxlines) {
+		int newsize = (scan->maxlines > 0)? scan->maxlines * 2 : 256;
+		CTOKEN **lines = (CTOKEN**)realloc(scan->lines, 
+			sizeof(CTOKEN*) * newsize);
+		assert(lines);
+		scan->lines = lines;
+		scan->maxlines = newsize;
+	}
+	// size of a line root counts its anonymous labels
+	root = ctoken_new_in(scan->tokens, CTokenENDF, NULL, 0);
+	scan->lines[scan->nlines++] = root;
+	return root;
+}
+
+int cscanner_tokenize(CScanner *scan, const char *source, long length)
+{
+	CTokenReader *reader = scan->reader;
+	CTOKEN *root;
+
+	cscanner_token_reset(scan);
+	cmempool_reset(scan->tokens);
+	scan->nlines = 0;
+	scan->lexerror = "";
+
+	if (length <= 0) 
+		return 0;
+
+	// tokens are kept where the reader makes them, no copy is made
+	ctoken_reader_set_text(reader, source, length);
+	reader->pool = scan->tokens;
+	root = cscanner_tokenize_line(scan);
+
+	for (; ; ) {
+		CTOKEN *token = ctoken_reader_read(reader);
+
+		if (token == NULL) {
+			// the line is dropped, an error token takes its place
+			int errcode = reader->errcode;
+			root->next = root->prev = root;
+			token = ctoken_new_in(scan->tokens, CTokenERROR, &errcode, 
+				sizeof(int));
+			token->lineno = reader->lineno;
+			ctoken_list_add_tail(token, root);
+			scan->lexerror = cmempool_strdup(scan->tokens, reader->error);
+			break;
+		}
+
+		if (token->type == CTokenIDENT && token->str[0] == '@') {
+			root->size++;
+		}
+
+		if (token->type == CTokenENDL || token->type == CTokenENDF) {
+			int endf = (token->type == CTokenENDF || reader->ch < 0);
+			token->type = CTokenENDF;	// as a line of set_source ends
+			ctoken_list_add_tail(token, root);
+			root->lineno = token->lineno;
+			if (endf) break;
+			root = cscanner_tokenize_line(scan);
+			continue;
+		}
+
+		ctoken_list_add_tail(token, root);
+	}
+
+	reader->pool = scan->pool;
+
+	return scan->nlines;
+}
+
+int cscanner_set_line(CScanner *scan, int line)
+{
+	const CTOKEN *token;
+	CTOKEN *root;
+	int retval = 0;
+
+	cscanner_line_begin(scan);
+
+	if (line < 0 || line >= scan->nlines) {
+		strncpy(scan->error, "line out of range", 80);
+		scan->errcode = 89;
+		return cscanner_line_end(scan, -3);
+	}
+
+	root = scan->lines[line];
+	token = root->next;
+
+	if (token->type == CTokenERROR) {
+		scan->lineno = token->lineno;
+		scan->errcode = token->errcode;
+		strncpy(scan->error, scan->lexerror, 80);
+		return cscanner_line_end(scan, -1);
+	}
+
+	// nothing to expand, the line is walked where it is
+	if (scan->nmacro == 0 && root->size == 0) {
+		scan->root = root;
+		return cscanner_line_end(scan, 0);
+	}
+
+	// tokens are copied so that the line stays as it is
+	for (; token != root; token = token->next) {
+		CTOKEN *copy = (CTOKEN*)cmempool_alloc(scan->pool, sizeof(CTOKEN));
+		*copy = *token;
+		if (cscanner_line_push(scan, copy) != 0) {
+			scan->lineno = token->lineno;
+			scan->errcode = 88;
+			retval = -2;
+			break;
+		}
+	}
+
+	return cscanner_line_end(scan, retval);
+}
+
+const CTOKEN *cscanner_token_current(const CScanner *scan)
+{
+	if (scan->root == NULL || scan->link == NULL) {
+		return &(scan->endf);
+	}
+	return scan->link;
+}
+
+const CTOKEN *cscanner_token_lookahead(const CScanner *scan)
+{
+	if (scan->root == NULL || scan->link == NULL) {
+		return &(scan->endf);
+	}
+	if (scan->link == scan->root) {
+		return &(scan->endf);
+	}
+	return scan->link->next;
+}
+
+const CTOKEN *cscanner_token_advance(CScanner *scan, int n)
+{
+	if (n < 0) n = 0;
+	if (scan->root == NULL || scan->link == NULL) {
+		return &(scan->endf);
+	}
+	while (n--) {
+		if (scan->link == scan->root) {
+			return &(scan->endf);
+		}
+		scan->link = scan->link->next;
+	}
+	return scan->link;
+}
+
+int cscanner_get_type(const CScanner *scan)
+{
+	return cscanner_token_current(scan)->type;
+}
+
+const char *cscanner_get_string(const CScanner *scan)
+{
+	const CTOKEN *token = cscanner_token_current(scan);
+	if (token->type != CTokenIDENT && token->type != CTokenSTR) {
+		return "";
+	}
+	return token->str;
+}
+
+int cscanner_get_char(const CScanner *scan)
+{
+	const CTOKEN *token = cscanner_token_current(scan);
+	if (token->type != CTokenOPERATOR) {
+		return '\0';
+	}
+	return token->ch;
+}
+
+long cscanner_get_value(const CScanner *scan)
+{
+	const CTOKEN *token = cscanner_token_current(scan);
+	if (token->type != CTokenINT) {
+		return 0;
+	}
+	return token->intval;
+}
+
+int cscanner_get_lineno(const CScanner *scan)
+{
+	const CTOKEN *token = cscanner_token_current(scan);
+	return token->lineno;
+}
+
+int cscanner_is_endl(const CScanner *scan) {
+	const CTOKEN *token = cscanner_token_current(scan);
+	return (token->type == CTokenENDF || token->type == CTokenENDL);
+}
+
+int cscanner_is_endf(const CScanner *scan) {
+	return cscanner_get_type(scan) == CTokenENDF;
+}
+
+int cscanner_is_ident(const CScanner *scan)  {
+	return cscanner_get_type(scan) == CTokenIDENT;
+}
+
+int cscanner_is_operator(const CScanner *scan) {
+	return cscanner_get_type(scan) == CTokenOPERATOR;
+}
+
+int cscanner_is_int(const CScanner *scan) {
+	return cscanner_get_type(scan) == CTokenINT;
+}
+
+int cscanner_is_string(const CScanner *scan) {
+	return cscanner_get_type(scan) == CTokenSTR;
+}
+
@@ -1,133 +1,178 @@
-//=====================================================================
-//
-// cscanner.h - source scanner
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CSCANNER_H__
-#define __CSCANNER_H__
-
-#include "ctoken.h"
-
-
-#define CMAX_IDENT	8192
-
-//---------------------------------------------------------------------
-// CTokenReader (assembly)
-//---------------------------------------------------------------------
-struct CTokenReader
-{
-	int (*readch)(void *fp);
-	void *fp;
-	int ch;
-	int unch;
-	int saved;
-	char *buffer;
-	char *error;
-	char **keywords;
-	int state;
-	int pos;
-	int lineno;
-	int eof;
-	int colno;
-	int errcode;
-};
-
-typedef struct CTokenReader CTokenReader;
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-//---------------------------------------------------------------------
-// Assembly Token Reader
-//---------------------------------------------------------------------
-CTokenReader *ctoken_reader_create(int (*getch)(void*), void *fp);
-
-void ctoken_reader_release(CTokenReader *reader);
-
-CTOKEN *ctoken_reader_read(CTokenReader *reader);
-
-#ifdef __cplusplus
-}
-#endif
-
-
-//---------------------------------------------------------------------
-// CMacro
-//---------------------------------------------------------------------
-struct CMacro
-{
-	char *ident;
-	char *value;
-	struct CMacro *next;
-};
-
-typedef struct CMacro CMacro;
-
-//---------------------------------------------------------------------
-// CScanner
-//---------------------------------------------------------------------
-struct CScanner
-{
-	const char *source;
-	long length;
-	long position;
-	int errcode;
-	char *error;
-	int jmplabel;
-	int lineno;
-	CTOKEN endf;
-	CTOKEN *root;
-	CMacro *macros;
-	const CTOKEN *link;
-	CTokenReader *reader;
-};
-
-typedef struct CScanner CScanner;
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-//---------------------------------------------------------------------
-// Scanner
-//---------------------------------------------------------------------
-CScanner *cscanner_create(void);
-
-void cscanner_release(CScanner *scan);
-
-void cscanner_macro_reset(CScanner *scan);
-
-int cscanner_macro_set(CScanner *scan, const char *name, const char *value);
-int cscanner_macro_del(CScanner *scan, const char *name);
-
-int cscanner_set_source(CScanner *scan, const char *source);
-
-const CTOKEN *cscanner_token_current(const CScanner *scan);
-const CTOKEN *cscanner_token_lookahead(const CScanner *scan);
-const CTOKEN *cscanner_token_advance(CScanner *scan, int n);
-
-int cscanner_get_type(const CScanner *scan);
-const char *cscanner_get_string(const CScanner *scan);
-int cscanner_get_char(const CScanner *scan);
-int cscanner_get_value(const CScanner *scan);
-int cscanner_get_lineno(const CScanner *scan);
-
-int cscanner_is_endl(const CScanner *scan);
-int cscanner_is_endf(const CScanner *scan);
-int cscanner_is_ident(const CScanner *scan);
-int cscanner_is_operator(const CScanner *scan);
-int cscanner_is_int(const CScanner *scan);
-int cscanner_is_string(const CScanner *scan);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
-
-
+//=====================================================================
+//
+// cscanner.h - source scanner
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CSCANNER_H__
+#define __CSCANNER_H__
+
+#include "ctoken.h"
+
+
+#define CMAX_IDENT	8192
+
+//---------------------------------------------------------------------
+// CTokenReader (assembly)
+//---------------------------------------------------------------------
+struct CTokenReader
+{
+	int (*readch)(void *fp);
+	void *fp;
+	const char *text;	// text read in place, NULL to use readch
+	const char *end;
+	int ch;
+	int unch;
+	int saved;
+	char *buffer;
+	char *error;
+	char **keywords;
+	char **kbuilt;		// keywords the index was built from
+	int *kindex;		// open addressing index into keywords
+	int ksize;
+	CMemPool *pool;		// where tokens go, NULL for malloc
+	int state;
+	int pos;
+	int lineno;
+	int eof;
+	int colno;
+	int errcode;
+};
+
+typedef struct CTokenReader CTokenReader;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// Assembly Token Reader
+//---------------------------------------------------------------------
+CTokenReader *ctoken_reader_create(int (*getch)(void*), void *fp);
+
+void ctoken_reader_release(CTokenReader *reader);
+
+// restart reader on a new input, buffers are kept
+void ctoken_reader_reset(CTokenReader *reader, int (*getch)(void*), void *fp);
+
+// restart reader on length bytes of text, read without a callback
+void ctoken_reader_set_text(CTokenReader *reader, const char *text, 
+	long length);
+
+CTOKEN *ctoken_reader_read(CTokenReader *reader);
+
+// read next char into reader->ch, -1 for end of input
+int ctoken_reader_getch(CTokenReader *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+//---------------------------------------------------------------------
+// CMacro
+//---------------------------------------------------------------------
+struct CMacro
+{
+	char *ident;
+	char *value;
+	int nocase;				// ident matches in any case
+	struct CMacro *next;	// next macro in the same bucket
+};
+
+typedef struct CMacro CMacro;
+
+//---------------------------------------------------------------------
+// CScanner
+//---------------------------------------------------------------------
+struct CScanner
+{
+	const char *source;
+	long length;
+	long position;
+	int errcode;
+	char *error;
+	int jmplabel;
+	int lineno;
+	CTOKEN endf;
+	CTOKEN *root;
+	CMacro **macros;			// macro hash table
+	int macrosize;
+	int nmacro;
+	const CTOKEN *link;
+	CTokenReader *reader;
+	CTokenReader *expander;		// reader for macro values
+	CMemPool *pool;				// tokens of current line
+	CMemPool *tokens;			// tokens of cscanner_tokenize in order
+	CTOKEN **lines;				// root of each line in tokens
+	int nlines;
+	int maxlines;
+	const char *lexerror;		// message of a CTokenERROR in tokens
+};
+
+typedef struct CScanner CScanner;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// Scanner
+//---------------------------------------------------------------------
+CScanner *cscanner_create(void);
+
+void cscanner_release(CScanner *scan);
+
+void cscanner_macro_reset(CScanner *scan);
+
+int cscanner_macro_set(CScanner *scan, const char *name, const char *value);
+int cscanner_macro_del(CScanner *scan, const char *name);
+
+// define a macro which is expanded whatever case its name is written in
+int cscanner_macro_set_nocase(CScanner *scan, const char *name, 
+	const char *value);
+
+// returns macro value, NULL for undefined name
+const char *cscanner_macro_search(CScanner *scan, const char *name);
+
+int cscanner_set_source(CScanner *scan, const char *source);
+
+// source of length bytes, need not end with '\0'
+int cscanner_set_source_span(CScanner *scan, const char *source, 
+	long length);
+
+// tokenize many lines in one pass into scan->tokens, tokens of the last
+// call are dropped. returns number of lines, tokenizing stops after a
+// line with a lexical error, the error is returned by cscanner_set_line
+int cscanner_tokenize(CScanner *scan, const char *source, long length);
+
+// make a line of cscanner_tokenize (from 0) current, as set_source does
+int cscanner_set_line(CScanner *scan, int line);
+
+const CTOKEN *cscanner_token_current(const CScanner *scan);
+const CTOKEN *cscanner_token_lookahead(const CScanner *scan);
+const CTOKEN *cscanner_token_advance(CScanner *scan, int n);
+
+int cscanner_get_type(const CScanner *scan);
+const char *cscanner_get_string(const CScanner *scan);
+int cscanner_get_char(const CScanner *scan);
+long cscanner_get_value(const CScanner *scan);
+int cscanner_get_lineno(const CScanner *scan);
+
+int cscanner_is_endl(const CScanner *scan);
+int cscanner_is_endf(const CScanner *scan);
+int cscanner_is_ident(const CScanner *scan);
+int cscanner_is_operator(const CScanner *scan);
+int cscanner_is_int(const CScanner *scan);
+int cscanner_is_string(const CScanner *scan);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
+
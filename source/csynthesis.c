@@ -1,534 +1,1013 @@
-//=====================================================================
-//
-// csynthesis.c - source scanner
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-
-#include "csynthesis.h"
-
-#ifdef _MSC_VER
-#pragma warning(disable: 4996)
-#endif
-
-void csynth_init(CSynthesizer *synth)
-{
-	cencoding_init(&synth->encoding);
-	synth->error = (char*)malloc(1024);
-	assert(synth->error);
-	csynth_reset(synth);
-}
-
-void csynth_destroy(CSynthesizer *synth)
-{
-	cencoding_destroy(&synth->encoding);
-	if (synth->error) free(synth->error);
-	synth->error = NULL;
-	synth->errcode = 0;
-}
-
-void csynth_reset(CSynthesizer *synth)
-{
-	cencoding_reset(&synth->encoding);
-	synth->firstType = O_UNKNOWN;
-	synth->secondType = O_UNKNOWN;
-	synth->firstReg = REG_UNKNOWN;
-	synth->secondReg = REG_UNKNOWN;
-	synth->baseReg = REG_UNKNOWN;
-	synth->indexReg = REG_UNKNOWN;
-	synth->scale = 0;
-	synth->prefix = 0;
-	synth->error[0] = 0;
-	synth->errcode = 0;
-}
-
-static void csynth_error(CSynthesizer *synth, const char *error, int code)
-{
-	strncpy(synth->error, error, 100);
-	synth->errcode = code;
-}
-
-int csynth_define_label(CSynthesizer *synth, const char *label)
-{
-	if (synth->encoding.label != NULL) {
-		csynth_error(synth,  "Instruction can't have multiple label", 1);
-		return -1;
-	}
-	cencoding_set_label(&synth->encoding, label);
-	return 0;
-}
-
-int csynth_reference_label(CSynthesizer *synth, const char *label)
-{
-	if (synth->encoding.reference != NULL) {
-		csynth_error(synth,  "Instruction can't have multiple refrence", 2);
-		return -1;
-	}
-	cencoding_set_reference(&synth->encoding, label);
-	return 0;
-}
-
-int csynth_encode_first_operand(CSynthesizer *synth, 
-	const COperand *firstOperand)
-{
-	if (synth->firstType != O_UNKNOWN) {
-		csynth_error(synth,  "Instrucition destination already set", 3);
-		return -1;
-	}
-
-	synth->firstType = firstOperand->type;
-
-	if (coperand_is_reg(firstOperand) || coperand_is_mem(firstOperand)) {
-		synth->firstReg = firstOperand->reg;
-	}
-	else if (coperand_is_imm(firstOperand)) {
-		csynth_encode_immediate(synth, firstOperand->value);
-	}
-	else if (!coperand_is_void(firstOperand)) {
-		csynth_error(synth, "csynth_encode_first_operand: error", 4);
-		return -2;
-	}
-
-	return 0;
-}
-
-int csynth_encode_second_operand(CSynthesizer *synth, 
-	const COperand *secondOperand)
-{
-	if (synth->secondType != O_UNKNOWN) {
-		csynth_error(synth,  "Instrucition source already set", 4);
-		return -1;
-	}
-
-	synth->secondType = secondOperand->type;
-
-	if (coperand_is_reg(secondOperand) || coperand_is_mem(secondOperand)) {
-		synth->secondReg = secondOperand->reg;
-	}
-	else if (coperand_is_imm(secondOperand)) {
-		csynth_encode_immediate(synth, secondOperand->value);
-	}
-	else if (!coperand_is_void(secondOperand)) {
-		csynth_error(synth, "csynth_encode_second_operand: error", 5);
-		return -2;
-	}
-
-	return 0;
-}
-
-int csynth_encode_third_operand(CSynthesizer *synth, 
-	const COperand *thirdOperand)
-{
-	if (coperand_is_imm(thirdOperand)) {
-		csynth_encode_immediate(synth, thirdOperand->value);
-	}
-	else if (!coperand_is_void(thirdOperand)) {
-		csynth_error(synth, "csynth_encode_third_operand: error", 6);
-		return -3;
-	}
-	return 0;
-}
-
-int csynth_encode_base(CSynthesizer *synth, const COperand *base)
-{
-	if (synth->baseReg != REG_UNKNOWN) {
-		int retval;
-		// base already set, use as index with scale = 1
-		retval = csynth_encode_index(synth, base);
-		if (retval != 0) return -1;
-		retval = csynth_encode_scale(synth, 1);
-		if (retval != 0) return -2;
-		return 0;
-	}
-
-	synth->baseReg = base->reg;
-	return 0;
-}
-
-int csynth_encode_index(CSynthesizer *synth, const COperand *index)
-{
-	if (synth->indexReg != REG_UNKNOWN) {
-		csynth_error(synth, 
-			"Memory reference can't have multiple index registers", 7);
-		return -1;
-	}
-	synth->indexReg = index->reg;
-	return 0;
-}
-
-int csynth_encode_scale(CSynthesizer *synth, int scale)
-{
-	if (synth->scale != 0) {
-		csynth_error(synth, 
-			"Memory reference can't have multiple scale factors", 8);
-		return -1;
-	}
-	if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
-		csynth_error(synth, "Invalid scale value", 9);
-		return -2;
-	}
-	synth->scale = scale;
-	return 0;
-}
-
-int csynth_encode_immediate(CSynthesizer *synth, long immediate)
-{
-	if (synth->encoding.immediate != 0) {
-		csynth_error(synth, 
-			"Instruction can't have multiple immediate operands", 10);
-		return -1;
-	}
-	synth->encoding.immediate = (cint32)immediate;
-	return 0;
-}
-
-int csynth_encode_displacement(CSynthesizer *synth, long displacement)
-{
-	synth->encoding.displacement += (cint32)displacement;
-	return 0;
-}
-
-static int csynth_encode_mod_field(CSynthesizer *synth)
-{
-	synth->encoding.format.modRM = 1;
-	if (coperand_type_is_reg(synth->firstType) && (
-		coperand_type_is_reg(synth->secondType) ||
-		coperand_type_is_imm(synth->secondType) ||
-		coperand_type_is_void(synth->secondType))) {
-		synth->encoding.modRM.mod = MOD_REG;
-	}
-	else if ((coperand_type_is_mem(synth->firstType) ||
-			  coperand_type_is_mem(synth->secondType)) &&
-			 (coperand_type_is_reg(synth->firstType) ||
-			  coperand_type_is_reg(synth->secondType))) {
-		if (!synth->encoding.displacement) {
-			synth->encoding.modRM.mod = MOD_NO_DISP;
-		}
-		else if ((char)synth->encoding.displacement == 
-				synth->encoding.displacement) {
-			synth->encoding.modRM.mod = MOD_BYTE_DISP;
-			synth->encoding.format.D1 = 1;
-		}
-		else {
-			synth->encoding.modRM.mod = MOD_DWORD_DISP;
-			synth->encoding.format.D1 = 1;
-			synth->encoding.format.D2 = 1;
-			synth->encoding.format.D3 = 1;
-			synth->encoding.format.D4 = 1;
-		}
-	}
-	else {
-		csynth_error(synth, "mod field error", 30);
-		return -1;
-	}
-	return 0;
-}
-
-static int csynth_encode_sib_byte(CSynthesizer *synth)
-{
-	if (synth->scale == 0 && synth->indexReg == REG_UNKNOWN) {
-		if (synth->baseReg == REG_UNKNOWN || (
-			synth->encoding.modRM.r_m != E_ESP && 
-			synth->encoding.modRM.r_m != E_EBP)) {
-			if (synth->encoding.format.SIB) {
-				csynth_error(synth, "SIB byte error", 31);
-				return -1;
-			}
-			// No SIB byte needed
-			return 0;
-		}
-	}
-
-	// Indicates use of SIB in mod R/M
-	synth->encoding.format.SIB = 1;
-	synth->encoding.modRM.r_m = E_ESP;
-
-	if (synth->baseReg == E_EBP && synth->encoding.modRM.mod == MOD_NO_DISP)
-	{
-		synth->encoding.modRM.mod = MOD_BYTE_DISP;
-		synth->encoding.format.D1 = 1;
-	}
-
-	if (synth->indexReg == E_ESP) {
-		if (synth->scale != 1) {
-			csynth_error(synth, 
-				"ESP can't be scaled index in memory reference", 32);
-			return -2;
-		}
-		else {
-			enum CRegID tempReg;
-			tempReg = synth->indexReg;
-			synth->indexReg = synth->baseReg;
-			synth->baseReg = tempReg;
-		}
-	}
-
-	if (synth->baseReg == REG_UNKNOWN) {
-		synth->encoding.SIB.base = E_EBP;
-		synth->encoding.modRM.mod = MOD_NO_DISP;
-		synth->encoding.format.D1 = 1;
-		synth->encoding.format.D2 = 1;
-		synth->encoding.format.D3 = 1;
-		synth->encoding.format.D4 = 1;
-	}	else {
-		synth->encoding.SIB.base = synth->baseReg;
-	}
-	
-	if (synth->indexReg != REG_UNKNOWN) {
-		synth->encoding.SIB.index = synth->indexReg;
-	}	else {
-		synth->encoding.SIB.index = E_ESP;
-	}
-
-	switch (synth->scale)
-	{
-	case 0:
-	case 1:
-		synth->encoding.SIB.scale = SCALE_1;
-		break;
-	case 2:
-		synth->encoding.SIB.scale = SCALE_2;
-		break;
-	case 4:
-		synth->encoding.SIB.scale = SCALE_4;
-		break;
-	case 8:
-		synth->encoding.SIB.scale = SCALE_8;
-		break;
-	default:
-		csynth_error(synth, "scale number error", 33);
-		return -3;
-		break;
-	}
-
-	return 0;
-}
-
-int csynth_encode_prefix(CSynthesizer *synth, int code)
-{
-	if (cencoding_add_prefix(&synth->encoding, code)) {
-		csynth_error(synth, "cannot add prefix", 90);
-		return -1;
-	}
-	return 0;
-}
-
-const CEncoding *csynth_encode_instruction(CSynthesizer *synth, 
-	CInstruction *instruction)
-{
-	enum COperandType p1, p2;
-	const char *format;
-	unsigned long O;
-
-	if (!instruction) {
-		return &synth->encoding;
-	}
-
-	format = cinst_getEncoding(instruction);
-
-	if (!format) {
-		csynth_error(synth, "csynth_encode_instruction: internal error", 11);
-		return NULL;
-	}
-
-	#define IFORMAT_WORD(x, y) ( (((short)(x)) << 8) | ((short)(y)) )
-
-	while (*format) {
-		int head = ((short)format[1] | format[0] << 8);
-		switch (head)
-		{
-		case IFORMAT_WORD('p', '0'):
-			if (cencoding_add_prefix(&synth->encoding, 0xf0)) {
-				csynth_error(synth, "prefix error 0xf0", 40);
-				return NULL;
-			}
-			break;
-		case IFORMAT_WORD('p', '2'):
-			if (cencoding_add_prefix(&synth->encoding, 0xf2)) {
-				csynth_error(synth, "prefix error 0xf2", 41);
-				return NULL;
-			}
-			break;
-		case IFORMAT_WORD('p', '3'):
-			if (cencoding_add_prefix(&synth->encoding, 0xf3)) {
-				csynth_error(synth, "prefix error 0xf3", 42);
-				return NULL;
-			}
-			break;
-		case IFORMAT_WORD('p', 'o'):
-			if (!cinst_is_32bit(instruction)) {
-				if (cencoding_add_prefix(&synth->encoding, 0x66)) {
-					csynth_error(synth, "prefix error 0x66", 43);
-					return NULL;
-				}
-			}
-			break;
-		case IFORMAT_WORD('p', 'a'):
-			if (!cinst_is_32bit(instruction)) {
-				if (cencoding_add_prefix(&synth->encoding, 0x67)) {
-					csynth_error(synth, "prefix error 0x67", 44);
-					return NULL;
-				}
-			}
-			break;
-		case IFORMAT_WORD('+', 'r'):
-			if (synth->encoding.format.O1) {
-				if (coperand_type_is_reg(synth->firstType)) {
-					synth->encoding.O1 += synth->firstReg;
-				}
-				else if(coperand_type_is_reg(synth->secondType)) {
-					synth->encoding.O1 += synth->secondReg;
-				}
-				else {
-					csynth_error(synth, 
-						"'+r' not compatible with operands", 12);
-					return NULL;
-				}
-			}
-			else {
-				csynth_error(synth, "'+r' needs first opcode byte", 13);
-				return NULL;
-			}
-			break;
-		case IFORMAT_WORD('/', 'r'):
-			if (csynth_encode_mod_field(synth) != 0) {
-				return NULL;
-			}
-			p1 = cinst_getFirstOperand(instruction);
-			p2 = cinst_getSecondOperand(instruction);
-			if (coperand_type_is_reg(p1) && coperand_type_is_R_M(p2)) {
-				if (coperand_type_is_mem(synth->secondType)) {
-					synth->encoding.modRM.r_m = synth->baseReg;
-				}
-				else if (coperand_type_is_reg(synth->secondType)) {
-					synth->encoding.modRM.r_m = synth->secondReg;
-				}
-				else {
-					csynth_error(synth, "syntax error", 14);
-					return NULL;
-				}
-				synth->encoding.modRM.reg = synth->firstReg;
-			}
-			else if (coperand_type_is_R_M(p1) && coperand_type_is_reg(p2)) {
-				if (coperand_type_is_mem(synth->firstType)) {
-					synth->encoding.modRM.r_m = synth->baseReg;
-				}
-				else if (coperand_type_is_reg(synth->firstType)) {
-					synth->encoding.modRM.r_m = synth->firstReg;
-				}
-				else {
-					csynth_error(synth, "syntax error", 15);
-					return NULL;
-				}
-				synth->encoding.modRM.reg = synth->secondReg;
-			}
-			else {
-				csynth_error(synth, "format error", 16);
-				return NULL;
-			}
-			if (csynth_encode_sib_byte(synth) != 0) {
-				return NULL;
-			}
-			break;
-		case IFORMAT_WORD('/', '0'):
-		case IFORMAT_WORD('/', '1'):
-		case IFORMAT_WORD('/', '2'):
-		case IFORMAT_WORD('/', '3'):
-		case IFORMAT_WORD('/', '4'):
-		case IFORMAT_WORD('/', '5'):
-		case IFORMAT_WORD('/', '6'):
-		case IFORMAT_WORD('/', '7'):
-			if (csynth_encode_mod_field(synth) != 0) {
-				return NULL;
-			}
-			synth->encoding.modRM.reg = format[1] - '0';
-			if (coperand_type_is_mem(synth->firstType)) {
-				synth->encoding.modRM.r_m = synth->baseReg;
-			}
-			else if (coperand_type_is_reg(synth->firstType)) {
-				synth->encoding.modRM.r_m = synth->firstReg;
-			}
-			else {
-				csynth_error(synth, "syntax error", 17);
-				return NULL;
-			}
-			if (csynth_encode_sib_byte(synth) != 0) {
-				return NULL;
-			}
-			break;
-		case IFORMAT_WORD('i', 'd'):
-			synth->encoding.format.I1 = 1;
-			synth->encoding.format.I2 = 1;
-			synth->encoding.format.I3 = 1;
-			synth->encoding.format.I4 = 1;
-			synth->encoding.relative = 0;
-			break;
-		case IFORMAT_WORD('i', 'w'):
-			synth->encoding.format.I1 = 1;
-			synth->encoding.format.I2 = 1;
-			synth->encoding.relative = 0;
-			break;
-		case IFORMAT_WORD('i', 'b'):
-			synth->encoding.format.I1 = 1;
-			synth->encoding.relative = 0;
-			break;
-		case IFORMAT_WORD('-', 'b'):
-			synth->encoding.format.I1 = 1;
-			synth->encoding.relative = 1;
-			break;
-		case IFORMAT_WORD('-', 'i'):
-			synth->encoding.format.I1 = 1;
-			synth->encoding.format.I2 = 1;
-			synth->encoding.format.I3 = 1;
-			synth->encoding.format.I4 = 1;
-			synth->encoding.relative = 1;
-			break;
-		default:
-			O = strtoul(format, 0, 16);
-			if (O > 0xFF) {
-				csynth_error(synth, "format error", 18);
-				return NULL;
-			}
-			if (!synth->encoding.format.O1) {
-				synth->encoding.O1 = (cbyte)O;
-				synth->encoding.format.O1 = 1;
-			}
-			else if (synth->encoding.format.O2 == 0 &&
-					(synth->encoding.O1 == 0x0f ||
-					 synth->encoding.O1 == 0xd8 ||
-					 synth->encoding.O1 == 0xd9 ||
-					 synth->encoding.O1 == 0xda ||
-					 synth->encoding.O1 == 0xdb ||
-					 synth->encoding.O1 == 0xdc ||
-					 synth->encoding.O1 == 0xde ||
-					 synth->encoding.O1 == 0xdf)) {
-				synth->encoding.O2 = synth->encoding.O1;
-				synth->encoding.O1 = (cbyte)O;
-				synth->encoding.format.O2 = 1;
-			}
-			else {
-				csynth_error(synth, "synth error", 19);
-				return NULL;
-			}
-			break;
-		}
-
-		format += 2;
-		if (*format == ' ') {
-			format++;
-		}
-		else if (*format == '\0') {
-			break;
-		}
-		else {
-			csynth_error(synth, "instruction error", 20);
-			return NULL;
-		}
-		#undef IFORMAT_WORD
-	}
-
-	return &synth->encoding;
-}
-
+//=====================================================================
+//
+// csynthesis.c - source scanner
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+
+#include "csynthesis.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4996)
+#endif
+
+void csynth_init(CSynthesizer *synth)
+{
+	cencoding_init(&synth->encoding);
+	synth->error = (char*)malloc(1024);
+	assert(synth->error);
+	synth->bits = 32;
+	csynth_reset(synth);
+}
+
+void csynth_destroy(CSynthesizer *synth)
+{
+	cencoding_destroy(&synth->encoding);
+	if (synth->error) free(synth->error);
+	synth->error = NULL;
+	synth->errcode = 0;
+}
+
+void csynth_reset(CSynthesizer *synth)
+{
+	cencoding_reset(&synth->encoding);
+	synth->firstType = O_UNKNOWN;
+	synth->secondType = O_UNKNOWN;
+	synth->thirdType = O_UNKNOWN;
+	synth->fourthType = O_UNKNOWN;
+	synth->firstReg = REG_UNKNOWN;
+	synth->secondReg = REG_UNKNOWN;
+	synth->thirdReg = REG_UNKNOWN;
+	synth->fourthReg = REG_UNKNOWN;
+	synth->baseReg = REG_UNKNOWN;
+	synth->indexReg = REG_UNKNOWN;
+	synth->scale = 0;
+	synth->prefix = 0;
+	synth->jump = CJUMP_NONE;
+	synth->wide = 0;
+	synth->vex = 0;
+	synth->evex = 0;
+	synth->vvvv = 0;
+	synth->vl = 0;
+	synth->opmask = 0;
+	synth->zeroing = 0;
+	synth->broadcast = 0;
+	synth->element = 0;
+	synth->regHigh = 0;
+	synth->rmHigh = 0;
+	synth->error[0] = 0;
+	synth->errcode = 0;
+}
+
+static void csynth_error(CSynthesizer *synth, const char *error, int code)
+{
+	strncpy(synth->error, error, 100);
+	synth->errcode = code;
+}
+
+int csynth_define_label(CSynthesizer *synth, const char *label)
+{
+	if (synth->encoding.label != NULL) {
+		csynth_error(synth,  "Instruction can't have multiple label", 1);
+		return -1;
+	}
+	cencoding_set_label(&synth->encoding, label);
+	return 0;
+}
+
+int csynth_reference_label(CSynthesizer *synth, const char *label)
+{
+	if (synth->encoding.reference != NULL) {
+		csynth_error(synth,  "Instruction can't have multiple refrence", 2);
+		return -1;
+	}
+	cencoding_set_reference(&synth->encoding, label);
+	return 0;
+}
+
+// label address used as memory displacement: [label + reg]
+int csynth_reference_displacement(CSynthesizer *synth, const char *label)
+{
+	if (csynth_reference_label(synth, label) != 0) {
+		return -1;
+	}
+	synth->encoding.refdisp = 1;
+	return 0;
+}
+
+int csynth_encode_first_operand(CSynthesizer *synth, 
+	const COperand *firstOperand)
+{
+	if (synth->firstType != O_UNKNOWN) {
+		csynth_error(synth,  "Instrucition destination already set", 3);
+		return -1;
+	}
+
+	synth->firstType = firstOperand->type;
+
+	if (coperand_is_reg(firstOperand) || coperand_is_mem(firstOperand)) {
+		synth->firstReg = firstOperand->reg;
+	}
+	else if (coperand_is_imm(firstOperand)) {
+		csynth_encode_immediate(synth, firstOperand->value);
+	}
+	else if (!coperand_is_void(firstOperand)) {
+		csynth_error(synth, "csynth_encode_first_operand: error", 4);
+		return -2;
+	}
+
+	return 0;
+}
+
+int csynth_encode_second_operand(CSynthesizer *synth, 
+	const COperand *secondOperand)
+{
+	if (synth->secondType != O_UNKNOWN) {
+		csynth_error(synth,  "Instrucition source already set", 4);
+		return -1;
+	}
+
+	synth->secondType = secondOperand->type;
+
+	if (coperand_is_reg(secondOperand) || coperand_is_mem(secondOperand)) {
+		synth->secondReg = secondOperand->reg;
+	}
+	else if (coperand_is_imm(secondOperand)) {
+		csynth_encode_immediate(synth, secondOperand->value);
+	}
+	else if (!coperand_is_void(secondOperand)) {
+		csynth_error(synth, "csynth_encode_second_operand: error", 5);
+		return -2;
+	}
+
+	return 0;
+}
+
+int csynth_encode_third_operand(CSynthesizer *synth, 
+	const COperand *thirdOperand)
+{
+	if (synth->thirdType != O_UNKNOWN) {
+		csynth_error(synth,  "Instrucition third operand already set", 6);
+		return -1;
+	}
+
+	synth->thirdType = thirdOperand->type;
+
+	if (coperand_is_reg(thirdOperand) || coperand_is_mem(thirdOperand)) {
+		synth->thirdReg = thirdOperand->reg;
+	}
+	else if (coperand_is_imm(thirdOperand)) {
+		csynth_encode_immediate(synth, thirdOperand->value);
+	}
+	else if (!coperand_is_void(thirdOperand)) {
+		csynth_error(synth, "csynth_encode_third_operand: error", 6);
+		return -3;
+	}
+	return 0;
+}
+
+// immediate, or register of "/is4" forms like VBLENDVPS
+int csynth_encode_fourth_operand(CSynthesizer *synth, 
+	const COperand *fourthOperand)
+{
+	synth->fourthType = fourthOperand->type;
+
+	if (coperand_is_reg(fourthOperand)) {
+		synth->fourthReg = fourthOperand->reg;
+	}
+	else if (coperand_is_imm(fourthOperand)) {
+		csynth_encode_immediate(synth, fourthOperand->value);
+	}
+	else if (!coperand_is_void(fourthOperand)) {
+		csynth_error(synth, "csynth_encode_fourth_operand: error", 6);
+		return -3;
+	}
+	return 0;
+}
+
+int csynth_encode_base(CSynthesizer *synth, const COperand *base)
+{
+	if (synth->encoding.riprel) {
+		csynth_error(synth, "RIP can't be used with other registers", 34);
+		return -3;
+	}
+
+	if (synth->baseReg != REG_UNKNOWN) {
+		int retval;
+		// base already set, use as index with scale = 1
+		retval = csynth_encode_index(synth, base);
+		if (retval != 0) return -1;
+		retval = csynth_encode_scale(synth, 1);
+		if (retval != 0) return -2;
+		return 0;
+	}
+
+	synth->baseReg = base->reg;
+	return 0;
+}
+
+int csynth_encode_index(CSynthesizer *synth, const COperand *index)
+{
+	if (synth->encoding.riprel) {
+		csynth_error(synth, "RIP can't be used with other registers", 34);
+		return -2;
+	}
+	if (synth->indexReg != REG_UNKNOWN) {
+		csynth_error(synth, 
+			"Memory reference can't have multiple index registers", 7);
+		return -1;
+	}
+	synth->indexReg = index->reg;
+	return 0;
+}
+
+// [rip + disp32], displacement is relative to the next instruction
+int csynth_encode_rip(CSynthesizer *synth)
+{
+	if (synth->bits != 64) {
+		csynth_error(synth, "RIP-relative address needs 64-bit mode", 35);
+		return -1;
+	}
+	if (synth->baseReg != REG_UNKNOWN || synth->indexReg != REG_UNKNOWN ||
+		synth->encoding.riprel) {
+		csynth_error(synth, "RIP can't be used with other registers", 34);
+		return -2;
+	}
+	synth->encoding.riprel = 1;
+	return 0;
+}
+
+int csynth_encode_scale(CSynthesizer *synth, int scale)
+{
+	if (synth->scale != 0) {
+		csynth_error(synth, 
+			"Memory reference can't have multiple scale factors", 8);
+		return -1;
+	}
+	if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+		csynth_error(synth, "Invalid scale value", 9);
+		return -2;
+	}
+	synth->scale = scale;
+	return 0;
+}
+
+int csynth_encode_immediate(CSynthesizer *synth, cint64 immediate)
+{
+	if (synth->encoding.immediate != 0) {
+		csynth_error(synth, 
+			"Instruction can't have multiple immediate operands", 10);
+		return -1;
+	}
+	synth->encoding.immediate = immediate;
+	return 0;
+}
+
+int csynth_encode_displacement(CSynthesizer *synth, long displacement)
+{
+	synth->encoding.displacement += (cint32)displacement;
+	return 0;
+}
+
+// operand at position index (0-3) of the line
+static enum COperandType csynth_type(const CSynthesizer *synth, int index)
+{
+	if (index == 0) return synth->firstType;
+	if (index == 1) return synth->secondType;
+	if (index == 2) return synth->thirdType;
+	return synth->fourthType;
+}
+
+static enum CRegID csynth_reg(const CSynthesizer *synth, int index)
+{
+	if (index == 0) return synth->firstReg;
+	if (index == 1) return synth->secondReg;
+	if (index == 2) return synth->thirdReg;
+	return synth->fourthReg;
+}
+
+static enum COperandType csynth_row_type(const CInstruction *instruction,
+	int index)
+{
+	if (index == 0) return cinst_getFirstOperand(instruction);
+	if (index == 1) return cinst_getSecondOperand(instruction);
+	if (index == 2) return cinst_getThirdOperand(instruction);
+	return cinst_getFourthOperand(instruction);
+}
+
+// position of the n-th operand going to ModR/M, the operand held by 
+// VEX.vvvv is skipped: "VADDPS xmm1, xmm2, xmm3/m128" uses 1 and 3
+static int csynth_modrm_operand(const CSynthesizer *synth, int n)
+{
+	if (synth->vvvv != 0 && n + 1 >= synth->vvvv) n++;
+	return n;
+}
+
+static int csynth_is_memory(enum COperandType type)
+{
+	return type != O_UNKNOWN && coperand_type_is_mem(type);
+}
+
+// EVEX scales a disp8 by the size of the memory access, or by the 
+// element when broadcasting: [rax+256] of a zmm load is disp8 4
+static int csynth_disp8_scale(const CSynthesizer *synth, 
+	const CInstruction *instruction)
+{
+	int i;
+
+	if (!synth->evex) return 1;
+	if (synth->broadcast) return synth->element;
+
+	for (i = 0; i < CINST_OPERANDS; i++) {
+		if (!csynth_is_memory(csynth_type(synth, i))) continue;
+		switch (csynth_row_type(instruction, i) & O_MEM) {
+		case O_MEM16: return 2;
+		case O_MEM32: return 4;
+		case O_MEM64: return 8;
+		case O_MEM128: return 16;
+		case O_MEM256: return 32;
+		case O_MEM512: return 64;
+		default: return 1;
+		}
+	}
+
+	return 1;
+}
+
+static int csynth_encode_mod_field(CSynthesizer *synth, int scale)
+{
+	cint32 displacement = synth->encoding.displacement;
+
+	int memory = csynth_is_memory(synth->firstType) ||
+		csynth_is_memory(synth->secondType) ||
+		csynth_is_memory(synth->thirdType);
+
+	synth->encoding.format.modRM = 1;
+	if (coperand_type_is_reg(synth->firstType) && !memory) {
+		synth->encoding.modRM.mod = MOD_REG;
+	}
+	else if (memory) {
+		if (synth->encoding.refdisp) {		// address unknown yet
+			synth->encoding.modRM.mod = MOD_DWORD_DISP;
+			synth->encoding.format.D1 = 1;
+			synth->encoding.format.D2 = 1;
+			synth->encoding.format.D3 = 1;
+			synth->encoding.format.D4 = 1;
+		}
+		else if (!synth->encoding.displacement) {
+			synth->encoding.modRM.mod = MOD_NO_DISP;
+		}
+		else if (scale == 1 && (signed char)displacement == displacement) {
+			synth->encoding.modRM.mod = MOD_BYTE_DISP;
+			synth->encoding.format.D1 = 1;
+		}
+		else if (scale > 1 && synth->baseReg != REG_UNKNOWN &&
+				displacement % scale == 0 && 
+				(signed char)(displacement / scale) == displacement / scale) {
+			// without a base the SIB code goes back to disp32
+			synth->encoding.displacement = displacement / scale;
+			synth->encoding.modRM.mod = MOD_BYTE_DISP;
+			synth->encoding.format.D1 = 1;
+		}
+		else {
+			synth->encoding.modRM.mod = MOD_DWORD_DISP;
+			synth->encoding.format.D1 = 1;
+			synth->encoding.format.D2 = 1;
+			synth->encoding.format.D3 = 1;
+			synth->encoding.format.D4 = 1;
+		}
+	}
+	else {
+		csynth_error(synth, "mod field error", 30);
+		return -1;
+	}
+	return 0;
+}
+
+static int csynth_encode_sib_byte(CSynthesizer *synth)
+{
+	int absolute = 0;
+
+	if (synth->scale == 0 && synth->indexReg == REG_UNKNOWN) {
+		if (synth->baseReg == REG_UNKNOWN && 
+			synth->encoding.modRM.mod != MOD_REG) {
+			// a label alone is addressed from rip in 64-bit mode
+			if (synth->bits == 64 && synth->encoding.refdisp) {
+				synth->encoding.riprel = 1;
+			}
+			// mod 00 with r/m 101 means [disp32], or [rip + disp32] 
+			// in 64-bit mode, where [disp32] needs a SIB byte
+			absolute = (synth->bits == 64 && !synth->encoding.riprel);
+		}
+		if (synth->baseReg == REG_UNKNOWN && !absolute &&
+			synth->encoding.modRM.mod != MOD_REG) {
+			synth->encoding.modRM.mod = MOD_NO_DISP;
+			synth->encoding.modRM.r_m = E_EBP;
+			synth->encoding.format.D1 = 1;
+			synth->encoding.format.D2 = 1;
+			synth->encoding.format.D3 = 1;
+			synth->encoding.format.D4 = 1;
+			return 0;
+		}
+		if (!absolute && (synth->baseReg == REG_UNKNOWN || (
+			synth->encoding.modRM.r_m != E_ESP && 
+			synth->encoding.modRM.r_m != E_EBP))) {
+			if (synth->encoding.format.SIB) {
+				csynth_error(synth, "SIB byte error", 31);
+				return -1;
+			}
+			// No SIB byte needed
+			if (synth->baseReg != REG_UNKNOWN) {
+				synth->encoding.REX.B = (synth->baseReg >> 3) & 1;
+			}
+			return 0;
+		}
+	}
+
+	// Indicates use of SIB in mod R/M
+	synth->encoding.format.SIB = 1;
+	synth->encoding.modRM.r_m = E_ESP;
+
+	if (synth->baseReg != REG_UNKNOWN && (synth->baseReg & 7) == E_EBP && 
+		synth->encoding.modRM.mod == MOD_NO_DISP)
+	{
+		synth->encoding.modRM.mod = MOD_BYTE_DISP;
+		synth->encoding.format.D1 = 1;
+	}
+
+	// a vector index has no "none" encoding, xmm4 is xmm4
+	if (synth->indexReg == E_ESP && 
+		(synth->firstType & O_VSIB) == 0 && 
+		(synth->secondType & O_VSIB) == 0) {
+		if (synth->scale != 1) {
+			csynth_error(synth, 
+				"ESP can't be scaled index in memory reference", 32);
+			return -2;
+		}
+		else {
+			enum CRegID tempReg;
+			tempReg = synth->indexReg;
+			synth->indexReg = synth->baseReg;
+			synth->baseReg = tempReg;
+		}
+	}
+
+	if (synth->baseReg == REG_UNKNOWN) {
+		synth->encoding.SIB.base = E_EBP;
+		synth->encoding.modRM.mod = MOD_NO_DISP;
+		synth->encoding.format.D1 = 1;
+		synth->encoding.format.D2 = 1;
+		synth->encoding.format.D3 = 1;
+		synth->encoding.format.D4 = 1;
+	}	else {
+		synth->encoding.SIB.base = synth->baseReg;
+		synth->encoding.REX.B = (synth->baseReg >> 3) & 1;
+	}
+	
+	if (synth->indexReg != REG_UNKNOWN) {
+		synth->encoding.SIB.index = synth->indexReg;
+		synth->encoding.REX.X = (synth->indexReg >> 3) & 1;
+	}	else {
+		synth->encoding.SIB.index = E_ESP;
+	}
+
+	switch (synth->scale)
+	{
+	case 0:
+	case 1:
+		synth->encoding.SIB.scale = SCALE_1;
+		break;
+	case 2:
+		synth->encoding.SIB.scale = SCALE_2;
+		break;
+	case 4:
+		synth->encoding.SIB.scale = SCALE_4;
+		break;
+	case 8:
+		synth->encoding.SIB.scale = SCALE_8;
+		break;
+	default:
+		csynth_error(synth, "scale number error", 33);
+		return -3;
+		break;
+	}
+
+	return 0;
+}
+
+// byte register operand which is AH, CH, DH or BH (need = 0) or which
+// needs a REX prefix to be reached (need = 1)
+static int csynth_byte_register(enum COperandType type, enum CRegID reg,
+	int need)
+{
+	if (type == O_UNKNOWN || (type & O_REG8) != type) return 0;
+	if (need) return (reg & E_REX) != 0;
+	return reg >= E_AH && reg <= E_BH;
+}
+
+// REX prefix in 64-bit mode: W for 64-bit operand size, R, X and B 
+// extend the reg field, the SIB index and the base or r/m register
+static int csynth_encode_rex(CSynthesizer *synth)
+{
+	CEncoding *encoding = &synth->encoding;
+
+	if (synth->bits != 64) {
+		return 0;
+	}
+
+	if (synth->wide) {
+		encoding->REX.W = 1;
+	}
+
+	if (encoding->REX.b == 0 &&
+		!csynth_byte_register(synth->firstType, synth->firstReg, 1) &&
+		!csynth_byte_register(synth->secondType, synth->secondReg, 1)) {
+		return 0;
+	}
+
+	if (csynth_byte_register(synth->firstType, synth->firstReg, 0) ||
+		csynth_byte_register(synth->secondType, synth->secondReg, 0)) {
+		csynth_error(synth, "AH, BH, CH or DH can't be used with REX", 36);
+		return -1;
+	}
+
+	encoding->REX.prefix = 4;
+	encoding->format.REX = 1;
+
+	return 0;
+}
+
+int csynth_encode_prefix(CSynthesizer *synth, int code)
+{
+	if (cencoding_add_prefix(&synth->encoding, code)) {
+		csynth_error(synth, "cannot add prefix", 90);
+		return -1;
+	}
+	return 0;
+}
+
+int csynth_encode_opmask(CSynthesizer *synth, const COperand *mask, 
+	int zeroing)
+{
+	if (mask->type != O_KREG || mask->reg == 0) {
+		csynth_error(synth, "write mask must be k1 to k7", 25);
+		return -1;
+	}
+	if (synth->opmask != 0) {
+		csynth_error(synth, "Instruction can't have multiple masks", 25);
+		return -2;
+	}
+	synth->opmask = mask->reg;
+	synth->zeroing = zeroing;
+	return 0;
+}
+
+int csynth_encode_broadcast(CSynthesizer *synth, int count)
+{
+	if (synth->broadcast != 0) {
+		csynth_error(synth, "Instruction can't have multiple broadcasts", 26);
+		return -1;
+	}
+	if (count != 2 && count != 4 && count != 8 && count != 16) {
+		csynth_error(synth, "Invalid broadcast", 26);
+		return -2;
+	}
+	synth->broadcast = count;
+	return 0;
+}
+
+// VEX prefix from the legacy form: REX bits, the mandatory prefix and 
+// the opcode map are folded in, vvvv names the extra source register
+static int csynth_encode_vex(CSynthesizer *synth)
+{
+	CEncoding *encoding = &synth->encoding;
+	int vvvv = 0;
+
+	if (synth->vvvv != 0) {
+		if (!coperand_type_is_reg(csynth_type(synth, synth->vvvv - 1))) {
+			csynth_error(synth, "VEX.vvvv needs a register operand", 37);
+			return -1;
+		}
+		vvvv = csynth_reg(synth, synth->vvvv - 1) & 15;
+	}
+
+	if (synth->wide) {
+		encoding->REX.W = 1;
+	}
+
+	switch (cencoding_set_vex(encoding, vvvv, synth->vl)) {
+	case 0: 
+		break;
+	case -1:
+		csynth_error(synth, "prefix can't be used with VEX", 38);
+		return -1;
+	default:
+		csynth_error(synth, "VEX opcode needs 0F, 0F 38 or 0F 3A", 39);
+		return -1;
+	}
+
+	return 0;
+}
+
+// EVEX prefix of AVX-512, built like the VEX one. it adds bit 4 of the
+// registers (zmm16-31), the 512-bit length, masking and broadcast
+static int csynth_encode_evex(CSynthesizer *synth)
+{
+	CEncoding *encoding = &synth->encoding;
+	int vvvv = 0;
+
+	if (synth->vvvv != 0) {
+		if (!coperand_type_is_reg(csynth_type(synth, synth->vvvv - 1))) {
+			csynth_error(synth, "VEX.vvvv needs a register operand", 37);
+			return -1;
+		}
+		vvvv = csynth_reg(synth, synth->vvvv - 1) & 31;
+	}
+
+	if (synth->broadcast && 
+		synth->broadcast * synth->element != (16 << synth->vl)) {
+		csynth_error(synth, "broadcast doesn't match the instruction", 23);
+		return -1;
+	}
+
+	if (synth->zeroing && csynth_is_memory(synth->firstType)) {
+		csynth_error(synth, "{z} can't be used with memory destination", 24);
+		return -1;
+	}
+
+	if (synth->wide) {
+		encoding->REX.W = 1;
+	}
+
+	// r/m register is never a SIB index, X holds its bit 4
+	if (synth->rmHigh) {
+		encoding->REX.X = 1;
+	}
+
+	switch (cencoding_set_evex(encoding, synth->regHigh, vvvv, synth->vl,
+		synth->opmask, synth->zeroing, synth->broadcast != 0)) {
+	case 0: 
+		break;
+	case -1:
+		csynth_error(synth, "prefix can't be used with VEX", 38);
+		return -1;
+	default:
+		csynth_error(synth, "VEX opcode needs 0F, 0F 38 or 0F 3A", 39);
+		return -1;
+	}
+
+	return 0;
+}
+
+const CEncoding *csynth_encode_instruction(CSynthesizer *synth, 
+	const CInstruction *instruction)
+{
+	enum COperandType p1, p2, t1, t2;
+	enum CRegID r1, r2;
+	const char *format;
+	unsigned long O;
+	int m1, m2;
+
+	if (!instruction) {
+		return &synth->encoding;
+	}
+
+	format = cinst_getEncoding(instruction);
+
+	if (!format) {
+		csynth_error(synth, "csynth_encode_instruction: internal error", 11);
+		return NULL;
+	}
+
+	#define IFORMAT_WORD(x, y) ( (((short)(x)) << 8) | ((short)(y)) )
+
+	while (*format) {
+		int head = ((short)format[1] | format[0] << 8);
+		switch (head)
+		{
+		case IFORMAT_WORD('p', '0'):
+			if (cencoding_add_prefix(&synth->encoding, 0xf0)) {
+				csynth_error(synth, "prefix error 0xf0", 40);
+				return NULL;
+			}
+			break;
+		case IFORMAT_WORD('p', '2'):
+			if (cencoding_add_prefix(&synth->encoding, 0xf2)) {
+				csynth_error(synth, "prefix error 0xf2", 41);
+				return NULL;
+			}
+			break;
+		case IFORMAT_WORD('p', '3'):
+			if (cencoding_add_prefix(&synth->encoding, 0xf3)) {
+				csynth_error(synth, "prefix error 0xf3", 42);
+				return NULL;
+			}
+			break;
+		case IFORMAT_WORD('p', 'o'):
+			if (!cinst_is_32bit(instruction)) {
+				if (cencoding_add_prefix(&synth->encoding, 0x66)) {
+					csynth_error(synth, "prefix error 0x66", 43);
+					return NULL;
+				}
+			}
+			break;
+		case IFORMAT_WORD('p', 'a'):
+			if (!cinst_is_32bit(instruction)) {
+				if (cencoding_add_prefix(&synth->encoding, 0x67)) {
+					csynth_error(synth, "prefix error 0x67", 44);
+					return NULL;
+				}
+			}
+			break;
+		case IFORMAT_WORD('p', 'w'):
+			synth->encoding.REX.W = 1;
+			break;
+		case IFORMAT_WORD('v', '0'):
+		case IFORMAT_WORD('v', '1'):
+		case IFORMAT_WORD('v', '2'):
+		case IFORMAT_WORD('v', '3'):
+			synth->vex = 1;
+			synth->vvvv = format[1] - '0';
+			break;
+		case IFORMAT_WORD('v', 'l'):
+			synth->vl = 1;
+			break;
+		case IFORMAT_WORD('x', '0'):
+		case IFORMAT_WORD('x', '1'):
+		case IFORMAT_WORD('x', '2'):
+		case IFORMAT_WORD('x', '3'):
+			synth->evex = 1;
+			synth->vvvv = format[1] - '0';
+			break;
+		case IFORMAT_WORD('x', 'l'):
+			synth->vl = 2;
+			break;
+		case IFORMAT_WORD('t', '4'):
+		case IFORMAT_WORD('t', '8'):
+			synth->element = format[1] - '0';
+			break;
+		case IFORMAT_WORD('i', 's'):
+			if (!coperand_type_is_reg(synth->fourthType) || 
+				synth->encoding.format.I1) {
+				csynth_error(synth, "'is' needs a fourth register", 21);
+				return NULL;
+			}
+			synth->encoding.immediate = (synth->fourthReg & 15) << 4;
+			synth->encoding.format.I1 = 1;
+			synth->encoding.relative = 0;
+			break;
+		case IFORMAT_WORD('+', 'r'):
+			p1 = cinst_getFirstOperand(instruction);
+			if (synth->encoding.format.O1) {
+				// "XCHG EAX,reg32": the accumulator is implied by opcode
+				if (coperand_type_is_reg(synth->firstType) &&
+					p1 != O_AX && p1 != O_EAX) {
+					synth->encoding.O1 += synth->firstReg & 7;
+					synth->encoding.REX.B = (synth->firstReg >> 3) & 1;
+				}
+				else if(coperand_type_is_reg(synth->secondType)) {
+					synth->encoding.O1 += synth->secondReg & 7;
+					synth->encoding.REX.B = (synth->secondReg >> 3) & 1;
+				}
+				else {
+					csynth_error(synth, 
+						"'+r' not compatible with operands", 12);
+					return NULL;
+				}
+				// 90 is NOP in 64-bit mode, "XCHG EAX,EAX" must clear
+				// the upper half of RAX and takes 87 /r
+				if (synth->bits == 64 && synth->encoding.O1 == 0x90 &&
+					synth->firstType == O_EAX && synth->secondType == O_EAX) {
+					csynth_error(synth, "'+r' not compatible with operands", 12);
+					return NULL;
+				}
+			}
+			else {
+				csynth_error(synth, "'+r' needs first opcode byte", 13);
+				return NULL;
+			}
+			break;
+		case IFORMAT_WORD('/', 'r'):
+			if (csynth_encode_mod_field(synth, 
+				csynth_disp8_scale(synth, instruction)) != 0) {
+				return NULL;
+			}
+			m1 = csynth_modrm_operand(synth, 0);
+			m2 = csynth_modrm_operand(synth, 1);
+			p1 = csynth_row_type(instruction, m1);
+			p2 = csynth_row_type(instruction, m2);
+			t1 = csynth_type(synth, m1);
+			t2 = csynth_type(synth, m2);
+			r1 = csynth_reg(synth, m1);
+			r2 = csynth_reg(synth, m2);
+			if (coperand_type_is_reg(p1) && coperand_type_is_R_M(p2)) {
+				if (coperand_type_is_mem(t2)) {
+					synth->encoding.modRM.r_m = synth->baseReg;
+				}
+				else if (coperand_type_is_reg(t2)) {
+					synth->encoding.modRM.r_m = r2;
+					synth->encoding.REX.B = (r2 >> 3) & 1;
+					synth->rmHigh = (r2 >> 4) & 1;
+				}
+				else {
+					csynth_error(synth, "syntax error", 14);
+					return NULL;
+				}
+				synth->encoding.modRM.reg = r1;
+				synth->encoding.REX.R = (r1 >> 3) & 1;
+				synth->regHigh = (r1 >> 4) & 1;
+			}
+			else if (coperand_type_is_R_M(p1) && coperand_type_is_reg(p2)) {
+				if (coperand_type_is_mem(t1)) {
+					synth->encoding.modRM.r_m = synth->baseReg;
+				}
+				else if (coperand_type_is_reg(t1)) {
+					synth->encoding.modRM.r_m = r1;
+					synth->encoding.REX.B = (r1 >> 3) & 1;
+					synth->rmHigh = (r1 >> 4) & 1;
+				}
+				else {
+					csynth_error(synth, "syntax error", 15);
+					return NULL;
+				}
+				synth->encoding.modRM.reg = r2;
+				synth->encoding.REX.R = (r2 >> 3) & 1;
+				synth->regHigh = (r2 >> 4) & 1;
+			}
+			else {
+				csynth_error(synth, "format error", 16);
+				return NULL;
+			}
+			if (csynth_encode_sib_byte(synth) != 0) {
+				return NULL;
+			}
+			break;
+		case IFORMAT_WORD('/', '0'):
+		case IFORMAT_WORD('/', '1'):
+		case IFORMAT_WORD('/', '2'):
+		case IFORMAT_WORD('/', '3'):
+		case IFORMAT_WORD('/', '4'):
+		case IFORMAT_WORD('/', '5'):
+		case IFORMAT_WORD('/', '6'):
+		case IFORMAT_WORD('/', '7'):
+			if (csynth_encode_mod_field(synth, 
+				csynth_disp8_scale(synth, instruction)) != 0) {
+				return NULL;
+			}
+			synth->encoding.modRM.reg = format[1] - '0';
+			m1 = csynth_modrm_operand(synth, 0);
+			t1 = csynth_type(synth, m1);
+			r1 = csynth_reg(synth, m1);
+			if (coperand_type_is_mem(t1)) {
+				synth->encoding.modRM.r_m = synth->baseReg;
+			}
+			else if (coperand_type_is_reg(t1)) {
+				synth->encoding.modRM.r_m = r1;
+				synth->encoding.REX.B = (r1 >> 3) & 1;
+				synth->rmHigh = (r1 >> 4) & 1;
+			}
+			else {
+				csynth_error(synth, "syntax error", 17);
+				return NULL;
+			}
+			if (csynth_encode_sib_byte(synth) != 0) {
+				return NULL;
+			}
+			break;
+		case IFORMAT_WORD('i', 'd'):
+			synth->encoding.format.I1 = 1;
+			synth->encoding.format.I2 = 1;
+			synth->encoding.format.I3 = 1;
+			synth->encoding.format.I4 = 1;
+			synth->encoding.relative = 0;
+			break;
+		case IFORMAT_WORD('i', 'o'):
+			synth->encoding.format.I1 = 1;
+			synth->encoding.format.I2 = 1;
+			synth->encoding.format.I3 = 1;
+			synth->encoding.format.I4 = 1;
+			if (synth->wide) {
+				synth->encoding.format.I5 = 1;
+				synth->encoding.format.I6 = 1;
+				synth->encoding.format.I7 = 1;
+				synth->encoding.format.I8 = 1;
+			}
+			synth->encoding.relative = 0;
+			break;
+		case IFORMAT_WORD('i', 'w'):
+			synth->encoding.format.I1 = 1;
+			synth->encoding.format.I2 = 1;
+			synth->encoding.relative = 0;
+			break;
+		case IFORMAT_WORD('i', 'b'):
+			synth->encoding.format.I1 = 1;
+			synth->encoding.relative = 0;
+			break;
+		case IFORMAT_WORD('-', 'b'):
+			synth->encoding.format.I1 = 1;
+			synth->encoding.relative = 1;
+			break;
+		case IFORMAT_WORD('-', 'i'):
+			synth->encoding.format.I1 = 1;
+			synth->encoding.format.I2 = 1;
+			synth->encoding.format.I3 = 1;
+			synth->encoding.format.I4 = 1;
+			synth->encoding.relative = 1;
+			break;
+		default:
+			O = strtoul(format, 0, 16);
+			if (O > 0xFF) {
+				csynth_error(synth, "format error", 18);
+				return NULL;
+			}
+			if (synth->encoding.format.modRM) {
+				// a byte after ModR/M is an opcode suffix in the 
+				// immediate field, "0F C2 /r 00" of CMPEQPS
+				if (synth->encoding.format.I1) {
+					csynth_error(synth, "format error", 18);
+					return NULL;
+				}
+				synth->encoding.immediate = (cbyte)O;
+				synth->encoding.format.I1 = 1;
+			}
+			else if (!synth->encoding.format.O1) {
+				synth->encoding.O1 = (cbyte)O;
+				synth->encoding.format.O1 = 1;
+			}
+			else if (synth->encoding.format.O2 == 0 &&
+					(synth->encoding.O1 == 0x0f ||
+					 synth->encoding.O1 == 0xd8 ||
+					 synth->encoding.O1 == 0xd9 ||
+					 synth->encoding.O1 == 0xda ||
+					 synth->encoding.O1 == 0xdb ||
+					 synth->encoding.O1 == 0xdc ||
+					 synth->encoding.O1 == 0xde ||
+					 synth->encoding.O1 == 0xdf)) {
+				synth->encoding.O2 = synth->encoding.O1;
+				synth->encoding.O1 = (cbyte)O;
+				synth->encoding.format.O2 = 1;
+			}
+			else if (synth->encoding.format.O3 == 0 &&
+					synth->encoding.O2 == 0x0f) {
+				// three byte opcode, the 0F 38 and 0F 3A maps or "0F AE F0"
+				synth->encoding.O3 = synth->encoding.O2;
+				synth->encoding.O2 = synth->encoding.O1;
+				synth->encoding.O1 = (cbyte)O;
+				synth->encoding.format.O3 = 1;
+			}
+			else {
+				csynth_error(synth, "synth error", 19);
+				return NULL;
+			}
+			break;
+		}
+
+		format += 2;
+		if (*format == ' ') {
+			format++;
+		}
+		else if (*format == '\0') {
+			break;
+		}
+		else {
+			csynth_error(synth, "instruction error", 20);
+			return NULL;
+		}
+		#undef IFORMAT_WORD
+	}
+
+	if (!synth->evex && (synth->opmask || synth->broadcast)) {
+		csynth_error(synth, "{k} and {1toN} need an EVEX instruction", 22);
+		return NULL;
+	}
+
+	if (synth->evex) {
+		if (csynth_encode_evex(synth) != 0) {
+			return NULL;
+		}
+	}
+	else if (synth->vex) {
+		if (csynth_encode_vex(synth) != 0) {
+			return NULL;
+		}
+	}
+	else if (csynth_encode_rex(synth) != 0) {
+		return NULL;
+	}
+
+	// jumps to labels start in rel32 form, the loader will shrink them 
+	// to rel8 if possible, unless SHORT or NEAR is given explicitly
+	if (synth->encoding.reference && cencoding_get_jump(&synth->encoding)) {
+		if (synth->jump != CJUMP_NONE) {
+			cencoding_set_jump(&synth->encoding, synth->jump);
+		}	else {
+			cencoding_set_jump(&synth->encoding, CJUMP_NEAR);
+			synth->encoding.relax = 1;
+		}
+	}
+
+	return &synth->encoding;
+}
+
@@ -1,74 +1,100 @@
-//=====================================================================
-//
-// csynthesis.h - source scanner
-//
-// NOTE:
-// for more information, please see the readme file.
-//
-//=====================================================================
-#ifndef __CSYNTHESIS_H__
-#define __CSYNTHESIS_H__
-
-#include "cencoding.h"
-#include "ckeywords.h"
-#include "cinstruct.h"
-
-
-//---------------------------------------------------------------------
-// CSynthesizer
-//---------------------------------------------------------------------
-struct CSynthesizer
-{
-	CEncoding encoding;
-	enum COperandType firstType;
-	enum COperandType secondType;
-	enum CRegID firstReg;
-	enum CRegID secondReg;
-	enum CRegID baseReg;
-	enum CRegID indexReg;
-	int scale;
-	int prefix;
-	char *error;
-	int errcode;
-};
-
-typedef struct CSynthesizer CSynthesizer;
-
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-//---------------------------------------------------------------------
-// interface
-//---------------------------------------------------------------------
-void csynth_init(CSynthesizer *synth);
-void csynth_destroy(CSynthesizer *synth);
-void csynth_reset(CSynthesizer *synth);
-
-int csynth_define_label(CSynthesizer *synth, const char *label);
-int csynth_reference_label(CSynthesizer *synth, const char *label);
-
-int csynth_encode_first_operand(CSynthesizer *synth, const COperand *);
-int csynth_encode_second_operand(CSynthesizer *synth, const COperand *);
-int csynth_encode_third_operand(CSynthesizer *synth, const COperand *);
-
-int csynth_encode_base(CSynthesizer *synth, const COperand *base);
-int csynth_encode_index(CSynthesizer *synth, const COperand *index);
-
-int csynth_encode_scale(CSynthesizer *synth, int scale);
-int csynth_encode_immediate(CSynthesizer *synth, long immediate);
-int csynth_encode_displacement(CSynthesizer *synth, long displacement);
-
-int csynth_encode_prefix(CSynthesizer *synth, int code);
-
-const CEncoding *csynth_encode_instruction(CSynthesizer *, CInstruction*);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
-
+//=====================================================================
+//
+// csynthesis.h - source scanner
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CSYNTHESIS_H__
+#define __CSYNTHESIS_H__
+
+#include "cencoding.h"
+#include "ckeywords.h"
+#include "cinstruct.h"
+
+
+//---------------------------------------------------------------------
+// CSynthesizer
+//---------------------------------------------------------------------
+struct CSynthesizer
+{
+	CEncoding encoding;
+	enum COperandType firstType;
+	enum COperandType secondType;
+	enum COperandType thirdType;
+	enum COperandType fourthType;
+	enum CRegID firstReg;
+	enum CRegID secondReg;
+	enum CRegID thirdReg;
+	enum CRegID fourthReg;
+	enum CRegID baseReg;
+	enum CRegID indexReg;
+	int scale;
+	int prefix;
+	int jump;
+	int bits;			// 32 or 64, kept by csynth_reset
+	int wide;			// 64-bit operand size, REX.W
+	int vex;			// row is VEX encoded
+	int evex;			// row is EVEX encoded (AVX-512)
+	int vvvv;			// operand (1-3) held by VEX.vvvv, 0 for none
+	int vl;				// vector length, 1: 256-bit, 2: 512-bit
+	int opmask;			// write mask k1-k7 of "{k}", 0 for none
+	int zeroing;		// "{z}", masked elements are zeroed
+	int broadcast;		// N of "{1toN}" on the memory operand
+	int element;		// size of a broadcast element of the row
+	int regHigh;		// bit 4 of the ModR/M reg register (zmm16-31)
+	int rmHigh;			// bit 4 of the ModR/M r/m register
+	char *error;
+	int errcode;
+};
+
+typedef struct CSynthesizer CSynthesizer;
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// interface
+//---------------------------------------------------------------------
+void csynth_init(CSynthesizer *synth);
+void csynth_destroy(CSynthesizer *synth);
+void csynth_reset(CSynthesizer *synth);
+
+int csynth_define_label(CSynthesizer *synth, const char *label);
+int csynth_reference_label(CSynthesizer *synth, const char *label);
+int csynth_reference_displacement(CSynthesizer *synth, const char *label);
+
+int csynth_encode_first_operand(CSynthesizer *synth, const COperand *);
+int csynth_encode_second_operand(CSynthesizer *synth, const COperand *);
+int csynth_encode_third_operand(CSynthesizer *synth, const COperand *);
+int csynth_encode_fourth_operand(CSynthesizer *synth, const COperand *);
+
+int csynth_encode_base(CSynthesizer *synth, const COperand *base);
+int csynth_encode_index(CSynthesizer *synth, const COperand *index);
+int csynth_encode_rip(CSynthesizer *synth);
+
+int csynth_encode_scale(CSynthesizer *synth, int scale);
+int csynth_encode_immediate(CSynthesizer *synth, cint64 immediate);
+int csynth_encode_displacement(CSynthesizer *synth, long displacement);
+
+int csynth_encode_prefix(CSynthesizer *synth, int code);
+
+// AVX-512 decorators: "{k1}{z}" of the destination, "{1to16}" of memory
+int csynth_encode_opmask(CSynthesizer *synth, const COperand *mask, 
+	int zeroing);
+int csynth_encode_broadcast(CSynthesizer *synth, int count);
+
+const CEncoding *csynth_encode_instruction(CSynthesizer *, 
+	const CInstruction *);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
@@ -0,0 +1,217 @@
+//=====================================================================
+//
+// ctemplate.c - compiled code template with patchable constants
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#include "ctemplate.h"
+
+
+//---------------------------------------------------------------------
+// internal
+//---------------------------------------------------------------------
+static int ctemplate_add_param(CTemplate *self, const char *name)
+{
+	int index = ctemplate_param(self, name);
+	int size;
+	if (index >= 0) return index;
+	size = (int)strlen(name);
+	self->params = (char**)realloc(self->params,
+		sizeof(char*) * (self->nparam + 1));
+	assert(self->params);
+	self->params[self->nparam] = (char*)malloc(size + 1);
+	assert(self->params[self->nparam]);
+	memcpy(self->params[self->nparam], name, size + 1);
+	return self->nparam++;
+}
+
+static void ctemplate_add_patch(CTemplate *self, const CTemplatePatch *patch)
+{
+	self->patches = (CTemplatePatch*)realloc(self->patches,
+		sizeof(CTemplatePatch) * (self->npatch + 1));
+	assert(self->patches);
+	self->patches[self->npatch++] = *patch;
+}
+
+static void ctemplate_store(unsigned char *ptr, cint64 value, int size)
+{
+	for (; size > 0; size--, ptr++) {
+		*ptr = (unsigned char)(value & 0xff);
+		value >>= 8;
+	}
+}
+
+// an absolute field takes a signed or an unsigned value of its width
+static int ctemplate_fits(cint64 value, int size)
+{
+	cint64 low, high;
+	if (size >= 8) return 1;
+	high = ((cint64)1 << (size * 8)) - 1;
+	low = -((cint64)1 << (size * 8 - 1));
+	return value >= low && value <= high;
+}
+
+
+//---------------------------------------------------------------------
+// interface
+//---------------------------------------------------------------------
+CTemplate *ctemplate_create(CLoader *loader, long codesize)
+{
+	struct IQUEUEHEAD *p;
+	CTemplate *self;
+	cuintptr base;
+	int align = 1;
+
+	assert(loader);
+
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		if (link->encoding.align > align) align = link->encoding.align;
+	}
+
+	self = (CTemplate*)malloc(sizeof(CTemplate));
+	assert(self);
+
+	self->block = (unsigned char*)malloc(codesize + align);
+	assert(self->block);
+	self->image = self->block + (align -
+		(long)((cuintptr)self->block % align)) % align;
+	self->size = codesize;
+	self->align = align;
+	self->params = NULL;
+	self->nparam = 0;
+	self->patches = NULL;
+	self->npatch = 0;
+
+	memset(self->image, 0xcc, codesize);
+
+	// undefined labels are left as zero and recorded below
+	loader->externs = 1;
+
+	if (cloader_output(loader, self->image) != 0) {
+		loader->externs = 0;
+		ctemplate_release(self);
+		return NULL;
+	}
+
+	loader->externs = 0;
+	base = (cuintptr)self->image;
+
+	// codesize is a bound, short jumps leave the image smaller
+	self->size = loader->size;
+
+	for (p = loader->head.next; p != &loader->head; p = p->next) {
+		CLink *link = iqueue_entry(p, CLink, head);
+		CEncoding *encoding = &link->encoding;
+		const char *label = cencoding_get_reference(encoding);
+		int isize = cencoding_immediate_size(encoding);
+		CTemplatePatch patch;
+		CLink *target;
+
+		if (label == NULL) continue;
+
+		patch.next = (long)(link->offset - base) + link->size;
+
+		if (encoding->refdisp) {
+			patch.size = cencoding_displacement_size(encoding);
+			patch.offset = patch.next - isize - patch.size;
+			patch.relative = encoding->riprel;
+			patch.addend = encoding->displacement;
+		}	else {
+			patch.size = isize;
+			patch.offset = patch.next - isize;
+			patch.relative = encoding->relative;
+			patch.addend = 0;
+		}
+
+		// disp32, REX.W imm32 and PUSH imm32 of 64-bit code
+		patch.sign = loader->bits == 64 && patch.size == 4 && 
+			(encoding->refdisp || (encoding->format.REX && 
+			encoding->REX.W) || (encoding->O1 == 0x68 && 
+			!encoding->format.O2));
+
+		target = cloader_find_label(loader, label);
+
+		if (target != NULL) {
+			// relative fields inside the image never change
+			if (patch.relative) continue;
+			patch.param = -1;
+			patch.target = (long)(target->offset - base);
+		}	else {
+			patch.param = ctemplate_add_param(self, label);
+			patch.target = 0;
+		}
+
+		ctemplate_add_patch(self, &patch);
+	}
+
+	return self;
+}
+
+void ctemplate_release(CTemplate *self)
+{
+	int i;
+	assert(self);
+	for (i = 0; i < self->nparam; i++) {
+		free(self->params[i]);
+	}
+	if (self->params) free(self->params);
+	if (self->patches) free(self->patches);
+	if (self->block) free(self->block);
+	self->params = NULL;
+	self->patches = NULL;
+	self->block = NULL;
+	free(self);
+}
+
+int ctemplate_param(const CTemplate *self, const char *name)
+{
+	int i;
+	for (i = 0; i < self->nparam; i++) {
+		if (strcmp(self->params[i], name) == 0) return i;
+	}
+	return -1;
+}
+
+long ctemplate_instance(const CTemplate *self, unsigned char *code,
+	const cint64 *values)
+{
+	cuintptr base = (cuintptr)code;
+	int i;
+
+	if (base % self->align)
+		return -1;
+
+	memcpy(code, self->image, self->size);
+
+	for (i = 0; i < self->npatch; i++) {
+		const CTemplatePatch *patch = &self->patches[i];
+		cint64 value;
+		if (patch->param < 0) {
+			value = (cint64)(base + patch->target);
+		}	else {
+			value = (values != NULL)? values[patch->param] : 0;
+		}
+		value += patch->addend;
+		if (patch->relative) {
+			value -= (cint64)(base + patch->next);
+			if (patch->size == 1 && (signed char)value != value)
+				return -1;
+			if (patch->size == 4 && (cint32)value != value)
+				return -1;
+		}
+		else if (patch->sign && (cint32)value != value) {
+			return -1;
+		}
+		else if (ctemplate_fits(value, patch->size) == 0) {
+			return -1;
+		}
+		ctemplate_store(code + patch->offset, value, patch->size);
+	}
+
+	return self->size;
+}
+
+
@@ -0,0 +1,81 @@
+//=====================================================================
+//
+// ctemplate.h - compiled code template with patchable constants
+//
+// NOTE:
+// for more information, please see the readme file.
+//
+//=====================================================================
+#ifndef __CTEMPLATE_H__
+#define __CTEMPLATE_H__
+
+#include "cloader.h"
+
+
+//---------------------------------------------------------------------
+// CTemplatePatch - one site to rewrite when instancing
+//---------------------------------------------------------------------
+struct CTemplatePatch
+{
+	long offset;		// offset of the field in image
+	int size;			// field size in bytes
+	int relative;		// field is relative to the end of instruction
+	long next;			// offset of next instruction in image
+	int param;			// parameter index, -1 for internal label
+	long target;		// image offset of internal label
+	long addend;		// displacement added to the value
+	int sign;			// 32-bit field sign extended to 64 bits
+};
+
+typedef struct CTemplatePatch CTemplatePatch;
+
+
+//---------------------------------------------------------------------
+// CTemplate
+//---------------------------------------------------------------------
+struct CTemplate
+{
+	unsigned char *block;
+	unsigned char *image;
+	long size;
+	int align;
+	char **params;
+	int nparam;
+	CTemplatePatch *patches;
+	int npatch;
+};
+
+typedef struct CTemplate CTemplate;
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//---------------------------------------------------------------------
+// interface
+//---------------------------------------------------------------------
+
+// build template from an encoded loader, codesize comes from
+// cloader_get_codesize(). labels referenced but never defined become
+// named parameters. returns NULL and fills loader->error on error.
+CTemplate *ctemplate_create(CLoader *loader, long codesize);
+
+void ctemplate_release(CTemplate *self);
+
+// get parameter index by name, returns -1 if not found
+int ctemplate_param(const CTemplate *self, const char *name);
+
+// write code into memory with parameter values (index by parameter),
+// code must be aligned to self->align. returns code size or -1 (also
+// for a value which doesn't fit its field)
+long ctemplate_instance(const CTemplate *self, unsigned char *code,
+	const cint64 *values);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+
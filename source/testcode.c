@@ -0,0 +1,816 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "casmpure.h"
+
+#if defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(WIN64)
+#include <windows.h>
+#define TEST_WIN32
+#else
+#include <pthread.h>
+#endif
+
+
+//---------------------------------------------------------------------
+// regression tests: code bytes against known-good output (checked
+// with objdump), compiled code is executed only in the host mode.
+//---------------------------------------------------------------------
+static int failures = 0;
+
+#define HOST_BITS	((int)sizeof(void*) * 8)
+
+static void report(const char *name, int ok, const char *detail)
+{
+	if (ok) {
+		printf("ok      %s\n", name);
+	}	else {
+		printf("FAILED  %s: %s\n", name, detail);
+		failures++;
+	}
+}
+
+static void hexdump(char *output, const unsigned char *code, long size)
+{
+	long i;
+	for (i = 0; i < size; i++) 
+		sprintf(output + i * 3, "%02X ", code[i]);
+	output[(size > 0)? size * 3 - 1 : 0] = 0;
+}
+
+// compile source and compare the code with expect bytes
+static void testBytes(const char *name, int bits, const char *source,
+	const unsigned char *expect, long length)
+{
+	static unsigned char code[65536];
+	static char detail[65536 * 3 + 64];
+	CAssembler *casm;
+	long size, i;
+	int ok;
+
+	casm = casm_create();
+	casm_set_mode(casm, bits);
+	casm_source(casm, source);
+
+	size = casm_compile(casm, NULL, 0);
+
+	if (size < 0 || size > (long)sizeof(code)) {
+		report(name, 0, casm->error);
+		casm_release(casm);
+		return;
+	}
+
+	size = casm_compile(casm, code, size);
+
+	// code is followed by 10 bytes of int3
+	ok = (size == length + 10);
+	for (i = 0; ok && i < size; i++) {
+		if (code[i] != ((i < length)? expect[i] : 0xcc)) ok = 0;
+	}
+
+	if (!ok) {
+		strcpy(detail, "got ");
+		hexdump(detail + 4, code, size);
+	}
+
+	report(name, ok, detail);
+	casm_release(casm);
+}
+
+// same with expect as hex text "B8 01 00 00 00"
+static void testCode(const char *name, int bits, const char *source,
+	const char *expect)
+{
+	unsigned char bytes[1024];
+	long length = 0;
+	const char *p;
+	for (p = expect; *p; ) {
+		if (*p == ' ') { p++; continue; }
+		bytes[length++] = (unsigned char)strtol(p, NULL, 16);
+		p += 2;
+	}
+	testBytes(name, bits, source, bytes, length);
+}
+
+// source must not compile, labels are only resolved by the output pass
+static void testError(const char *name, int bits, const char *source)
+{
+	unsigned char code[1024];
+	CAssembler *casm;
+	long size;
+
+	casm = casm_create();
+	casm_set_mode(casm, bits);
+	casm_source(casm, source);
+
+	size = casm_compile(casm, NULL, 0);
+	if (size >= 0 && size <= (long)sizeof(code)) {
+		size = casm_compile(casm, code, size);
+	}
+
+	report(name, size < 0, "compiled without error");
+	casm_release(casm);
+}
+
+
+//---------------------------------------------------------------------
+// instruction encodings
+//---------------------------------------------------------------------
+struct TestCase
+{
+	const char *name;
+	int bits;
+	const char *source;
+	const char *expect;
+};
+
+static const struct TestCase TestEncodings[] = {
+	// shortest row, sized memory operands
+	{ "add eax, 1", 32, "add eax, 1", "83 C0 01" },
+	{ "add eax, 1000", 32, "add eax, 1000", "05 E8 03 00 00" },
+	{ "add al, 5", 32, "add al, 5", "04 05" },
+	{ "shr ebx, 1", 32, "shr ebx, 1", "D1 EB" },
+	{ "add dword [esi], 1", 32, "add dword [esi], 1", "83 06 01" },
+	{ "cmp byte [esi], 0", 32, "cmp byte [esi], 0", "80 3E 00" },
+	{ "test ecx, 0x100", 32, "test ecx, 0x100", "F7 C1 00 01 00 00" },
+	{ "mov sib", 32, "mov eax, [ebx + esi*4 + 8]", "8B 44 B3 08" },
+	{ "push 300", 32, "push 300", "68 2C 01 00 00" },
+	{ "push dword 300", 32, "push dword 300", "68 2C 01 00 00" },
+	{ "push word 300", 32, "push word 300", "66 68 2C 01" },
+	{ "push -1", 32, "push -1", "6A FF" },
+	{ "xchg eax, ecx", 32, "xchg eax, ecx", "91" },
+	{ "xchg ecx, eax", 32, "xchg ecx, eax", "91" },
+	{ "xchg eax, eax", 32, "xchg eax, eax", "90" },
+
+	// 16-bit forms of 386 rows
+	{ "bt word imm", 32, "bt word [esi], 3", "66 0F BA 26 03" },
+	{ "bts word imm", 32, "bts word [esi], 3", "66 0F BA 2E 03" },
+	{ "bt dword imm", 32, "bt dword [esi], 3", "0F BA 26 03" },
+	{ "shld word", 32, "shld word [esi], ax, 3", "66 0F A4 06 03" },
+	{ "shrd ax, cl", 32, "shrd ax, bx, cl", "66 0F AD D8" },
+	{ "movzx ax", 32, "movzx ax, bl", "66 0F B6 C3" },
+	{ "movzx eax, bx", 32, "movzx eax, bx", "0F B7 C3" },
+	// x86-64
+	{ "mov rax, imm64", 64, "mov rax, 0x1122334455667788", "48 B8 88 77 66 55 44 33 22 11" },
+	{ "add r9d, ecx", 64, "add r9d, ecx", "41 01 C9" },
+	{ "push r12", 64, "push r12", "41 54" },
+	{ "mov rip", 64, "mov rax, [rip + 16]", "48 8B 05 10 00 00 00" },
+	{ "movsxd rdx, ecx", 64, "movsxd rdx, ecx", "48 63 D1" },
+	{ "mov spl", 64, "mov spl, 1", "40 B4 01" },
+	{ "mov r15, [r14 + 8]", 64, "mov r15, [r14 + 8]", "4D 8B 7E 08" },
+	{ "add rax, -1", 64, "add rax, -1", "48 83 C0 FF" },
+	{ "xchg eax, eax 64", 64, "xchg eax, eax", "87 C0" },
+	{ "xchg r8d, eax", 64, "xchg r8d, eax", "41 90" },
+	{ "bswap ecx", 32, "bswap ecx", "0F C9" },
+	{ "bswap rcx", 64, "bswap rcx", "48 0F C9" },
+	{ "cmova eax, ecx", 32, "cmova eax, ecx", "0F 47 C1" },
+	{ "xadd [rax], rcx", 64, "xadd [rax], rcx", "48 0F C1 08" },
+	{ "movzx rax, bl", 64, "movzx rax, bl", "48 0F B6 C3" },
+	{ "cvtsi2sd xmm0, rax", 64, "cvtsi2sd xmm0, rax", "F2 48 0F 2A C0" },
+	{ "cvtsi2sd xmm0, eax", 64, "cvtsi2sd xmm0, eax", "F2 0F 2A C0" },
+	{ "cvttss2si r9, xmm1", 64, "cvttss2si r9, xmm1", "F3 4C 0F 2C C9" },
+	// SSE2, SSSE3, SSE4
+	{ "paddq", 32, "paddq xmm1, xmm2", "66 0F D4 CA" },
+	{ "movdqa", 32, "movdqa xmm0, [eax]", "66 0F 6F 00" },
+	{ "cvtsd2si", 32, "cvtsd2si eax, xmm1", "F2 0F 2D C1" },
+	{ "pshufb", 32, "pshufb xmm0, xmm1", "66 0F 38 00 C1" },
+	{ "pinsrd", 32, "pinsrd xmm1, eax, 2", "66 0F 3A 22 C8 02" },
+	{ "paddq xmm9", 64, "paddq xmm9, [r8]", "66 45 0F D4 08" },
+	{ "movq xmm0, rax", 64, "movq xmm0, rax", "66 48 0F 6E C0" },
+	{ "movq rcx, xmm3", 64, "movq rcx, xmm3", "66 48 0F 7E D9" },
+	{ "movq xmm9, r10", 64, "movq xmm9, r10", "66 4D 0F 6E CA" },
+	{ "movq xmm0, [rax]", 64, "movq xmm0, [rax]", "F3 0F 7E 00" },
+	{ "pinsrq", 64, "pinsrq xmm1, rax, 1", "66 48 0F 3A 22 C8 01" },
+	{ "pinsrq mem", 64, "pinsrq xmm9, [r8], 0", "66 4D 0F 3A 22 08 00" },
+	{ "pextrq", 64, "pextrq rcx, xmm3, 1", "66 48 0F 3A 16 D9 01" },
+	// VEX, EVEX
+	{ "vaddps ymm", 32, "vaddps ymm0, ymm1, ymm2", "C5 F4 58 C2" },
+	{ "vfmadd231ps", 32, "vfmadd231ps xmm1, xmm2, xmm3", "C4 E2 69 B8 CB" },
+	{ "vaddps ymm12", 64, "vaddps ymm12, ymm1, [r9]", "C4 41 74 58 21" },
+	{ "vmovq xmm3, rcx", 64, "vmovq xmm3, rcx", "C4 E1 F9 6E D9" },
+	{ "vmovq r9, xmm12", 64, "vmovq r9, xmm12", "C4 41 F9 7E E1" },
+	{ "vmovq xmm1, [rax]", 64, "vmovq xmm1, [rax]", "C5 FA 7E 08" },
+	{ "vpinsrq", 64, "vpinsrq xmm1, xmm2, rax, 1", "C4 E3 E9 22 C8 01" },
+	{ "vpextrq", 64, "vpextrq rax, xmm2, 1", "C4 E3 F9 16 D0 01" },
+	{ "kmovq k2, rdx", 64, "kmovq k2, rdx", "C4 E1 FB 92 D2" },
+	{ "kmovq rdx, k2", 64, "kmovq rdx, k2", "C4 E1 FB 93 D2" },
+	{ "kmovd k2, edx", 64, "kmovd k2, edx", "C5 FB 92 D2" },
+	{ "vpbroadcastq zmm5, rdx", 64, "vpbroadcastq zmm5, rdx", "62 F2 FD 48 7C EA" },
+	{ "vaddps zmm", 32, "vaddps zmm0, zmm1, zmm2", "62 F1 74 48 58 C2" },
+	{ "vaddps zmm18", 64, "vaddps zmm16, zmm17, zmm18", "62 A1 74 40 58 C2" },
+	// BMI, ADX, AES-NI, SHA
+	{ "andn", 32, "andn eax, ebx, ecx", "C4 E2 60 F2 C1" },
+	{ "popcnt", 32, "popcnt eax, ecx", "F3 0F B8 C1" },
+	{ "adcx", 32, "adcx eax, ecx", "66 0F 38 F6 C1" },
+	{ "andn rax", 64, "andn rax, rbx, rcx", "C4 E2 E0 F2 C1" },
+	{ "andn eax", 64, "andn eax, ebx, ecx", "C4 E2 60 F2 C1" },
+	{ "bextr r8", 64, "bextr r8, [rbx], r9", "C4 62 B0 F7 03" },
+	{ "mulx rax", 64, "mulx rax, rbx, rcx", "C4 E2 E3 F6 C1" },
+	{ "adcx rax", 64, "adcx rax, rcx", "66 48 0F 38 F6 C1" },
+	{ "adox r9", 64, "adox r9, r10", "F3 4D 0F 38 F6 CA" },
+	{ "lzcnt rax", 64, "lzcnt rax, rbx", "F3 48 0F BD C3" },
+	{ "aesenc", 32, "aesenc xmm1, xmm2", "66 0F 38 DC CA" },
+	{ "pclmulqdq", 32, "pclmulqdq xmm1, xmm2, 0x11", "66 0F 3A 44 CA 11" },
+	{ "sha1rnds4", 32, "sha1rnds4 xmm1, xmm2, 3", "0F 3A CC CA 03" },
+	{ "aesenc xmm9", 64, "aesenc xmm9, [r10]", "66 45 0F 38 DC 0A" },
+	{ "crc32", 32, "crc32 eax, ebx", "F2 0F 38 F1 C3" },
+	{ "crc32 bl", 32, "crc32 eax, bl", "F2 0F 38 F0 C3" },
+	{ "crc32 word", 32, "crc32 eax, word [ecx]", "66 F2 0F 38 F1 01" },
+	{ "crc32 rax", 64, "crc32 rax, rbx", "F2 48 0F 38 F1 C3" },
+	{ "crc32 rax, bl", 64, "crc32 rax, bl", "F2 48 0F 38 F0 C3" },
+	{ "crc32 r9b", 64, "crc32 eax, r9b", "F2 41 0F 38 F0 C1" },
+	{ "crc32 r10, byte", 64, "crc32 r10, byte [r8]", "F2 4D 0F 38 F0 10" },
+	{ NULL, 0, NULL, NULL },
+};
+
+static const struct TestCase TestErrors[] = {
+	{ "mov eax, byte", 32, "mov eax, byte [esi]", NULL },
+	{ "imm32 range", 64, "add rax, 0x80000000", NULL },
+	{ "rax in 32-bit", 32, "inc rax", NULL },
+	{ "aaa in 64-bit", 64, "aaa", NULL },
+	{ "ah with rex", 64, "mov ah, r8b", NULL },
+	{ "movsxd edx, ecx", 64, "movsxd edx, ecx", NULL },
+	{ "movsxd rdx, rcx", 64, "movsxd rdx, rcx", NULL },
+	{ "cmova rax, ecx", 64, "cmova rax, ecx", NULL },
+	{ "pinsrd rax", 64, "pinsrd xmm0, rax, 1", NULL },
+	{ "movq xmm0, eax", 64, "movq xmm0, eax", NULL },
+	{ "pextrq ecx", 64, "pextrq ecx, xmm3, 1", NULL },
+	{ "pinsrq in 32-bit", 32, "pinsrq xmm1, eax, 1", NULL },
+	{ "vmovq xmm3, ecx", 64, "vmovq xmm3, ecx", NULL },
+	{ "vmovd xmm3, rcx", 64, "vmovd xmm3, rcx", NULL },
+	{ "kmovq k2, edx", 64, "kmovq k2, edx", NULL },
+	{ "kmovd k2, rdx", 64, "kmovd k2, rdx", NULL },
+	{ "vpbroadcastq zmm5, edx", 64, "vpbroadcastq zmm5, edx", NULL },
+	{ "adcx eax, rcx", 64, "adcx eax, rcx", NULL },
+	{ "andn rax, ebx", 64, "andn rax, ebx, ecx", NULL },
+	{ "andn rax in 32-bit", 32, "andn rax, rbx, rcx", NULL },
+	{ "crc32 rax, ebx", 64, "crc32 rax, ebx", NULL },
+	{ "crc32 rax in 32-bit", 32, "crc32 rax, rbx", NULL },
+	{ NULL, 0, NULL, NULL },
+};
+
+void testEncodings(void)
+{
+	const struct TestCase *test;
+	for (test = TestEncodings; test->name; test++)
+		testCode(test->name, test->bits, test->source, test->expect);
+	for (test = TestErrors; test->name; test++)
+		testError(test->name, test->bits, test->source);
+}
+
+
+//---------------------------------------------------------------------
+// labels and jumps
+//---------------------------------------------------------------------
+// a size query doesn't change the code, short jumps shrink the result
+static void testSize(void)
+{
+	static unsigned char code1[1024], code2[1024];
+	CAssembler *casm;
+	long bound, size1, size2;
+	char detail[256];
+	int ok;
+
+	casm = casm_create();
+	casm_loadfile(casm, "testblit.asm");
+	bound = casm_compile(casm, NULL, 0);
+	size1 = casm_compile(casm, code1, sizeof(code1));
+	ok = (casm_compile(casm, NULL, 0) == bound);
+	size2 = casm_compile(casm, code2, sizeof(code2));
+	ok = ok && (size1 == 99 + 10) && (size2 == size1) && (bound >= size1) &&
+		memcmp(code1, code2, size1) == 0;
+	sprintf(detail, "bound %ld size %ld then %ld", bound, size1, size2);
+	report("code size", ok, detail);
+	casm_release(casm);
+}
+
+// jmp over nops to a label before or after them, jump is its bytes
+static void testJump(const char *name, int nops, int back, 
+	const char *jump, int size)
+{
+	static unsigned char expect[400];
+	static char source[8192];
+	int i, n;
+
+	n = sprintf(source, back? "top:\n" : "jmp top\n");
+	for (i = 0; i < nops; i++) 
+		n += sprintf(source + n, "nop\n");
+	sprintf(source + n, back? "jmp top\n" : "top:\n");
+	memset(expect, 0x90, 400);
+	memcpy(expect + (back? nops : 0), jump, size);
+	testBytes(name, 32, source, expect, nops + size);
+}
+
+void testLabels(void)
+{
+	static unsigned char expect[400];
+	static char source[8192];
+	int i, n;
+
+	// rel8 where the target is close, rel32 past 127 bytes
+	testCode("jmp short", 32, "jmp done\nnop\ndone:\nret\n", "EB 01 90 C3");
+	testCode("jnz back", 32, "top:\ndec ecx\njnz top\n", "49 75 FD");
+	testCode("jmp anonymous", 32, "jz @f\nnop\n@@:\nret\n", "74 01 90 C3");
+
+	for (i = 0, n = 0; i < 300; i++)
+		n += sprintf(source + n, "L%d: nop\n", i);
+	sprintf(source + n, "jmp L0\njmp L299\n");
+	memset(expect, 0x90, 300);
+	memcpy(expect + 300, "\xE9\xCF\xFE\xFF\xFF\xEB\xF8", 7);
+	testBytes("300 labels", 32, source, expect, 307);
+
+	sprintf(source, "jmp far_label\n");
+	for (i = 0, n = (int)strlen(source); i < 200; i++)
+		n += sprintf(source + n, "nop\n");
+	sprintf(source + n, "far_label:\nret\n");
+	memcpy(expect, "\xE9\xC8\x00\x00\x00", 5);
+	memset(expect + 5, 0x90, 200);
+	expect[205] = 0xc3;
+	testBytes("jmp near", 32, source, expect, 206);
+
+	// rel8 holds -128..127 on any char signedness
+	testJump("jmp back -128", 126, 1, "\xEB\x80", 2);
+	testJump("jmp back -129", 127, 1, "\xE9\x7C\xFF\xFF\xFF", 5);
+	testJump("jmp ahead 127", 127, 0, "\xEB\x7F", 2);
+	testJump("jmp ahead 128", 128, 0, "\xE9\x80\x00\x00\x00", 5);
+
+	testSize();
+}
+
+
+//---------------------------------------------------------------------
+// source text: CRLF, long runs, 4KB tokenizer blocks, loadfile
+//---------------------------------------------------------------------
+void testSource(void)
+{
+	static unsigned char expect[4096];
+	static char source[65536];
+	CAssembler *casm1, *casm2;
+	unsigned char *code1, *code2;
+	long size1, size2;
+	const char *error;
+	char *text;
+	FILE *fp;
+	int i, n;
+
+	testCode("crlf", 32, "mov eax, 1\r\nret\r\n", "B8 01 00 00 00 C3");
+	testCode("no newline", 32, "mov eax, 1\nret", "B8 01 00 00 00 C3");
+	testCode("utf-8 comment", 32, "mov eax, 1 ; caf\xC3\xA9 \xE2\x82\xAC\n"
+		"mov ecx, 2\nret\n", "B8 01 00 00 00 B9 02 00 00 00 C3");
+	testCode("utf-8 string", 32, "db 'caf\xC3\xA9' // \xE2\x82\xAC\nret\n", 
+		"63 61 66 C3 A9 C3");
+	testCode("keyword case", 32, "MOV EAX, Dword [EBX]\nRet\n", "8B 03 C3");
+	testCode("proc ret case", 32, "PROC a:DWORD\nmov eax, a\nRet\nENDP\n",
+		"55 8B EC 8B 44 25 08 8B E5 5D C3");
+	testError("macro case", 32, "PROC a:DWORD\nmov eax, A\nret\nENDP\n");
+	testCode("mnemonic case", 64, "MoV eax, 1\nmovZX ecx, byte [rax]\n",
+		"B8 01 00 00 00 0F B6 08");
+
+	// a missed mnemonic lookup names the mnemonic
+	casm1 = casm_create();
+	casm_source(casm1, "mov eax, 1\nfoo eax\n");
+	n = 0;
+	size1 = casm_compile(casm1, NULL, 0);
+	error = casm_geterror(casm1, &n);
+	report("mnemonic miss", size1 < 0 && n == 10 && 
+		strstr(error, "Mnemonic 'foo' not recognised") != NULL, error);
+	casm_release(casm1);
+	testCode("long runs", 32,
+		"                                                        \t"
+		"jmp                                             "
+		"a_label_name_which_is_longer_than_thirty_two_chars\n"
+		"a_label_name_which_is_longer_than_thirty_two_chars: ret  "
+		"; comment of more than thirty-two characters ......\n", "EB 00 C3");
+
+	// lines cross the 4KB blocks of the tokenizer
+	for (i = 0, n = 0; i < 2000; i++)
+		n += sprintf(source + n, "    nop        ; padding %d\n", i);
+	sprintf(source + n, "ret");
+	memset(expect, 0x90, 2000);
+	expect[2000] = 0xc3;
+	testBytes("4KB blocks", 32, source, expect, 2001);
+
+	// a mapped file compiles as the same text added by casm_source
+	casm1 = casm_create();
+	casm2 = casm_create();
+	code1 = code2 = NULL;
+	text = (char*)malloc(65536);
+	fp = fopen("testblit.asm", "rb");
+	if (fp != NULL && text != NULL) {
+		n = (int)fread(text, 1, 65535, fp);
+		text[n] = 0;
+		fclose(fp);
+		casm_source(casm2, text);
+		if (casm_loadfile(casm1, "testblit.asm") == 0) {
+			code1 = (unsigned char*)casm_callable(casm1, &size1);
+			code2 = (unsigned char*)casm_callable(casm2, &size2);
+		}
+	}
+	report("loadfile", code1 && code2 && size1 == size2 &&
+		memcmp(code1, code2, size1) == 0, "differs from source text");
+	free(code1);
+	free(code2);
+	free(text);
+	casm_release(casm1);
+	casm_release(casm2);
+
+	// the listing shows each whole line, label lines too
+	casm1 = casm_create();
+	casm_source(casm1, "start:\nmov eax, 1 ; load\nret");
+	fp = tmpfile();
+	n = 0;
+	if (fp != NULL && casm_dumpinst(casm1, fp) == 0) {
+		rewind(fp);
+		n = (int)fread(source, 1, sizeof(source) - 1, fp);
+	}
+	source[n] = 0;
+	if (fp != NULL) fclose(fp);
+	report("dumpinst", strcmp(source, 
+		"                          \tstart:\n"
+		"00000000:  B8 01 00 00 00 \tmov eax, 1 ; load\n"
+		"00000005:  C3             \tret\n") == 0, source);
+	casm_release(casm1);
+}
+
+
+//---------------------------------------------------------------------
+// assemblers compiling at the same time in threads of their own
+//---------------------------------------------------------------------
+#define TEST_THREADS	4
+
+static const char *threadSource = 
+	"add eax, 1\nmov [ebx + esi*4 + 8], cl\nmovzx edx, byte [eax]\n"
+	"shl ecx, 3\npaddd xmm1, [eax]\nvaddps ymm0, ymm1, ymm2\n"
+	"top:\ndec ecx\njnz top\nret\n";
+
+static unsigned char threadExpect[128];
+static long threadSize;
+
+static int threadCompile(void)
+{
+	unsigned char code[128];
+	CAssembler *casm;
+	int i, ok = 1;
+	for (i = 0; i < 200 && ok; i++) {
+		casm = casm_create();
+		casm_source(casm, threadSource);
+		ok = (casm_compile(casm, code, sizeof(code)) == threadSize &&
+			memcmp(code, threadExpect, threadSize) == 0);
+		casm_release(casm);
+	}
+	return ok;
+}
+
+#ifdef TEST_WIN32
+static DWORD WINAPI threadMain(LPVOID arg)
+{
+	*(int*)arg = threadCompile();
+	return 0;
+}
+#else
+static void *threadMain(void *arg)
+{
+	*(int*)arg = threadCompile();
+	return NULL;
+}
+#endif
+
+void testThreads(void)
+{
+	int result[TEST_THREADS];
+	CAssembler *casm;
+	int i, ok;
+#ifdef TEST_WIN32
+	HANDLE threads[TEST_THREADS];
+#else
+	pthread_t threads[TEST_THREADS];
+#endif
+
+	casm = casm_create();
+	casm_source(casm, threadSource);
+	threadSize = casm_compile(casm, threadExpect, sizeof(threadExpect));
+	casm_release(casm);
+
+	for (i = 0; i < TEST_THREADS; i++) {
+		result[i] = 0;
+#ifdef TEST_WIN32
+		threads[i] = CreateThread(NULL, 0, threadMain, &result[i], 0, NULL);
+#else
+		pthread_create(&threads[i], NULL, threadMain, &result[i]);
+#endif
+	}
+
+	for (i = 0, ok = (threadSize > 0); i < TEST_THREADS; i++) {
+#ifdef TEST_WIN32
+		WaitForSingleObject(threads[i], INFINITE);
+		CloseHandle(threads[i]);
+#else
+		pthread_join(threads[i], NULL);
+#endif
+		ok = ok && result[i];
+	}
+
+	report("threads", ok, "code differs between threads");
+}
+
+
+//---------------------------------------------------------------------
+// compile again: size query, more source, mode switch
+//---------------------------------------------------------------------
+void testIncremental(void)
+{
+	unsigned char code[64];
+	char detail[256];
+	CAssembler *casm;
+	long size;
+	int ok;
+
+	casm = casm_create();
+	casm_source(casm, "mov eax, 1\n");
+	size = casm_compile(casm, NULL, 0);
+	casm_source(casm, "ret\n");
+	size = casm_compile(casm, NULL, 0);
+	ok = (size > 0 && casm_compile(casm, code, sizeof(code)) == size &&
+		memcmp(code, "\xB8\x01\x00\x00\x00\xC3", 6) == 0);
+	hexdump(detail, code, 6);
+	report("source added", ok, detail);
+
+	casm_set_mode(casm, 64);
+	casm_source(casm, "push r8\n");
+	ok = (casm_compile(casm, code, sizeof(code)) > 0 &&
+		memcmp(code, "\xB8\x01\x00\x00\x00\xC3\x41\x50", 8) == 0);
+	hexdump(detail, code, 8);
+	report("mode switch", ok, detail);
+
+	casm_release(casm);
+}
+
+// links and labels fill many pool chunks, a reset drops all of them
+static void testPools(void)
+{
+	static unsigned char code1[8192], code2[8192];
+	static char source[131072];
+	const char *name = "a_label_long_enough_to_fill_pool_chunks_quickly";
+	CAssembler *casm;
+	long size1, size2;
+	int i, n, ok;
+
+	for (i = 0, n = 0; i < 1000; i++) 
+		n += sprintf(source + n, "%s_%d: jmp %s_%d\n", name, i, name, i + 1);
+	sprintf(source + n, "%s_%d: ret\n", name, i);
+
+	casm = casm_create();
+	casm_source(casm, source);
+	size1 = casm_compile(casm, code1, sizeof(code1));
+	casm_reset(casm);
+	casm_source(casm, source);
+	size2 = casm_compile(casm, code2, sizeof(code2));
+	ok = (size1 == 2001 + 10 && size2 == size1 && 
+		memcmp(code1, code2, size1) == 0 && 
+		memcmp(code1, "\xEB\x00\xEB\x00", 4) == 0 && code1[2000] == 0xC3);
+
+	casm_reset(casm);
+	casm_source(casm, "jmp a_label_long_enough_to_fill_pool_chunks_quickly_0\n");
+	ok = ok && (casm_compile(casm, code2, sizeof(code2)) < 0);
+	report("pools", ok, casm->error);
+	casm_release(casm);
+}
+
+
+//---------------------------------------------------------------------
+// builder interface
+//---------------------------------------------------------------------
+void testEmit(void)
+{
+	unsigned char code[64];
+	char detail[256];
+	CAssembler *casm;
+	int ok;
+
+	casm = casm_create();
+	casm_source(casm, "mov ebx, 4\n");
+	casm_emit_label(casm, "top");
+	casm_emit(casm, "add", 2, casm_reg(O_REG32, E_EAX),
+		casm_mem(CS_UNKNOWN, casm_reg(O_REG32, E_EBX),
+		casm_reg(O_REG32, E_ESI), 4, 8));
+	casm_emit(casm, "jnz", 1, casm_label("top"));
+	casm_source(casm, "ret\n");
+	ok = (casm_compile(casm, code, sizeof(code)) > 0 &&
+		memcmp(code, "\xBB\x04\x00\x00\x00\x03\x44\xB3\x08\x75\xFA\xC3",
+		12) == 0);
+	hexdump(detail, code, 12);
+	report("emit", ok, detail);
+
+	ok = (casm_emit(casm, "add", 2, casm_reg(O_REG32, E_EAX),
+		casm_reg(O_REG8, E_CL)) != 0);
+	report("emit mismatch", ok, "emitted without error");
+
+	// a parse from the start encodes the emitted lines again
+	casm_reset(casm);
+	casm_source(casm, "mov ebx, 4\n");
+	casm_emit(casm, "inc", 1, casm_reg(O_REG32, E_EAX));
+	casm_source(casm, "mov ecx,");
+	ok = (casm_compile(casm, code, sizeof(code)) < 0);
+	casm_source(casm, " 2\nret\n");
+	ok = ok && (casm_compile(casm, code, sizeof(code)) > 0 &&
+		memcmp(code, "\xBB\x04\x00\x00\x00\x40\xB9\x02\x00\x00\x00\xC3",
+		12) == 0);
+	hexdump(detail, code, 12);
+	report("emit reparse", ok, detail);
+
+	casm_set_mode(casm, 64);
+	ok = (casm_compile(casm, code, sizeof(code)) > 0 &&
+		memcmp(code, "\xBB\x04\x00\x00\x00\xFF\xC0\xB9\x02\x00\x00\x00"
+		"\xC3", 13) == 0);
+	hexdump(detail, code, 13);
+	report("emit set_mode", ok, detail);
+
+	casm_release(casm);
+}
+
+
+//---------------------------------------------------------------------
+// templates
+//---------------------------------------------------------------------
+void testTemplate(void)
+{
+	unsigned char block[128], *code;
+	char detail[256];
+	CAssembler *casm;
+	CTemplate *tpl;
+	cint64 values[2];
+	int ok = 0;
+
+	casm = casm_create();
+	casm_source(casm, "mov eax, value\nadd eax, [edx + offset]\nret\n");
+	tpl = casm_template(casm);
+
+	strcpy(detail, casm->error);
+
+	if (tpl != NULL) {
+		code = block + ((tpl->align - ((size_t)block % tpl->align)) %
+			tpl->align);
+		values[ctemplate_param(tpl, "value")] = 0x12345678;
+		values[ctemplate_param(tpl, "offset")] = 0x20;
+		ok = (tpl->nparam == 2 && ctemplate_instance(tpl, code, values) > 0 &&
+			memcmp(code, "\xB8\x78\x56\x34\x12\x03\x82\x20\x00\x00\x00\xC3",
+			12) == 0);
+		hexdump(detail, code, 12);
+		ctemplate_release(tpl);
+	}
+
+	report("template", ok, detail);
+
+	// a value is never cut to the width of its field
+	casm_reset(casm);
+	casm_source(casm, "mov ax, value\nret\n");
+	tpl = casm_template(casm);
+	ok = 0;
+	if (tpl != NULL) {
+		code = block + ((tpl->align - ((size_t)block % tpl->align)) %
+			tpl->align);
+		values[0] = 0x12345;
+		ok = (ctemplate_instance(tpl, code, values) < 0);
+		values[0] = -2;
+		ok = ok && (ctemplate_instance(tpl, code, values) > 0 && 
+			memcmp(code, "\x66\xB8\xFE\xFF\xC3", 5) == 0);
+		ctemplate_release(tpl);
+	}
+	report("template range", ok, "out of range value patched");
+
+	// constants of 64-bit ALU instructions are sign extended imm32
+	casm_reset(casm);
+	casm_set_mode(casm, 64);
+	casm_source(casm, "add rcx, value\ncmp rax, limit\nret\n");
+	tpl = casm_template(casm);
+	strcpy(detail, casm->error);
+	ok = 0;
+	if (tpl != NULL) {
+		code = block + ((tpl->align - ((size_t)block % tpl->align)) %
+			tpl->align);
+		values[ctemplate_param(tpl, "value")] = -5;
+		values[ctemplate_param(tpl, "limit")] = 0x1000;
+		ok = (ctemplate_instance(tpl, code, values) > 0 && 
+			memcmp(code, "\x48\x81\xC1\xFB\xFF\xFF\xFF"
+			"\x48\x3D\x00\x10\x00\x00\xC3", 14) == 0);
+		hexdump(detail, code, 14);
+		values[ctemplate_param(tpl, "limit")] = 0x80000000LL;
+		ok = ok && (ctemplate_instance(tpl, code, values) < 0);
+		ctemplate_release(tpl);
+	}
+	report("template 64-bit", ok, detail);
+	casm_release(casm);
+}
+
+
+//---------------------------------------------------------------------
+// executable memory: arena, batch and cache
+//---------------------------------------------------------------------
+void testExecute(void)
+{
+	CExecArena *arena;
+	CAssembler *casm1, *casm2;
+	CAsmBatch *batch;
+	unsigned char *code;
+	int (*fn1)(void), (*fn2)(void);
+	long hits, misses;
+	int entries, ok;
+
+	arena = cexec_arena_create(0);
+
+	casm1 = casm_create();
+	casm_set_mode(casm1, HOST_BITS);
+	casm_source(casm1, "mov eax, 42\nret\n");
+	fn1 = (int (*)(void))casm_callable_arena(casm1, arena, NULL);
+	ok = (fn1 != NULL && cexec_arena_protect(arena) == 0 && fn1() == 42);
+	report("arena", ok, casm1->error);
+
+	batch = casm_batch_create();
+	casm_batch_add(batch, "one", "mov eax, 1\nret\n");
+	casm_batch_add(batch, "two", "jmp next\nnext:\nmov eax, 2\nret\n");
+	casm_set_mode(batch->casm, HOST_BITS);
+	ok = 0;
+	if (casm_batch_compile(batch, arena, NULL) != NULL &&
+		cexec_arena_protect(arena) == 0) {
+		fn1 = (int (*)(void))casm_batch_symbol(batch, "one");
+		fn2 = (int (*)(void))casm_batch_symbol(batch, "two");
+		ok = ((char*)fn2 - (char*)fn1 == 16 && fn1() == 1 && fn2() == 2);
+	}
+	report("batch", ok, batch->error);
+	casm_batch_release(batch);
+
+	// labels are local to a unit, errors name the unit
+	batch = casm_batch_create();
+	casm_batch_add(batch, "one", "jmp done\nnop\ndone:\nret\n");
+	casm_batch_add(batch, "two", "done:\ndec ecx\njnz done\nret\n");
+	code = (unsigned char*)casm_batch_compile(batch, NULL, NULL);
+	ok = (code != NULL && 
+		casm_batch_symbol(batch, "two") == code + 16 &&
+		memcmp(code, "\xEB\x01\x90\xC3", 4) == 0 &&
+		memcmp(code + 16, "\x49\x75\xFD\xC3", 4) == 0);
+	report("batch labels", ok, batch->error);
+	free(code);
+	casm_batch_release(batch);
+
+	batch = casm_batch_create();
+	casm_batch_add(batch, "good", "ret\n");
+	casm_batch_add(batch, "bad", "jmp nowhere\n");
+	ok = (casm_batch_compile(batch, NULL, NULL) == NULL &&
+		strncmp(batch->error, "bad: ", 5) == 0);
+	report("batch error", ok, batch->error);
+	casm_batch_release(batch);
+
+	cexec_arena_release(arena);
+
+	casm_cache_enable(4);
+	casm2 = casm_create();
+	casm_set_mode(casm2, HOST_BITS);
+	casm_source(casm2, "mov eax, 42\nret\n");
+	fn1 = (int (*)(void))casm_callable_cached(casm1, NULL);
+	fn2 = (int (*)(void))casm_callable_cached(casm2, NULL);
+	casm_cache_stats(&hits, &misses, &entries);
+	ok = (fn1 != NULL && fn1 == fn2 && fn1() == 42 && hits == 1 &&
+		misses == 1 && entries == 1);
+	report("cache", ok, "not shared");
+	casm_cache_release(fn2);
+
+	// the next entry goes on the pages after the protected one
+	casm_reset(casm2);
+	casm_set_mode(casm2, HOST_BITS);
+	casm_source(casm2, "mov eax, 7\nret\n");
+	fn2 = (int (*)(void))casm_callable_cached(casm2, NULL);
+	ok = (fn2 != NULL && fn2 != fn1 && fn2() == 7 && fn1() == 42);
+	report("cache arena", ok, casm2->error);
+	casm_cache_release(fn1);
+	casm_cache_release(fn2);
+	casm_cache_enable(0);
+
+	// a disabled cache counts nothing
+	fn1 = (int (*)(void))casm_callable_cached(casm1, NULL);
+	casm_cache_stats(&hits, &misses, &entries);
+	ok = (fn1 != NULL && fn1() == 42 && hits == 1 && misses == 2 &&
+		entries == 0);
+	report("cache disabled", ok, "counted");
+	casm_cache_release(fn1);
+
+	casm_release(casm1);
+	casm_release(casm2);
+}
+
+
+//! src: ctoken.c, cscanner.c, csynthesis.c, cparser.c, casmpure.c
+//! exe: cencoding.c, cinstruct.c, cinstset.c, ckeywords.c, cloader.c, cexecmem.c, ctemplate.c, cmempool.c
+int main(void)
+{
+	testEncodings();
+	testLabels();
+	testSource();
+	testIncremental();
+	testPools();
+	testThreads();
+	testEmit();
+	testTemplate();
+	testExecute();
+	printf("\n%d failed\n", failures);
+	return (failures == 0)? 0 : 1;
+}